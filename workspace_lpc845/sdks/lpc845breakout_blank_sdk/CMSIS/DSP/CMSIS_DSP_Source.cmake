@@ -35,6 +35,30 @@ message("${CMAKE_CURRENT_LIST_FILE} component is included.")
           ${CMAKE_CURRENT_LIST_DIR}/Source/WindowFunctions/WindowFunctions.c
         )
 
+    if(DEFINED CONFIG_CMSIS_DSP_FFT_TABLES)
+      find_package(Python3 REQUIRED COMPONENTS Interpreter)
+      execute_process(
+          COMMAND ${Python3_EXECUTABLE} ${CMAKE_CURRENT_LIST_DIR}/Scripts/gen_fft_tables.py
+                  -o ${CMAKE_CURRENT_BINARY_DIR}/arm_fft_tables.c ${CONFIG_CMSIS_DSP_FFT_TABLES}
+          OUTPUT_VARIABLE CMSIS_DSP_FFT_TABLES_DEFINES
+          OUTPUT_STRIP_TRAILING_WHITESPACE
+          RESULT_VARIABLE CMSIS_DSP_FFT_TABLES_RESULT
+        )
+      if(NOT CMSIS_DSP_FFT_TABLES_RESULT EQUAL 0)
+        message(FATAL_ERROR "CONFIG_CMSIS_DSP_FFT_TABLES: cannot generate the FFT tables of ${CONFIG_CMSIS_DSP_FFT_TABLES}")
+      endif()
+      string(REPLACE "\n" ";" CMSIS_DSP_FFT_TABLES_DEFINES "${CMSIS_DSP_FFT_TABLES_DEFINES}")
+      set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${CMAKE_CURRENT_LIST_DIR}/Scripts/gen_fft_tables.py)
+
+      target_sources(${MCUX_SDK_PROJECT_NAME} PRIVATE
+          ${CMAKE_CURRENT_BINARY_DIR}/arm_fft_tables.c
+        )
+
+      target_compile_definitions(${MCUX_SDK_PROJECT_NAME} PUBLIC
+          ${CMSIS_DSP_FFT_TABLES_DEFINES}
+        )
+    endif()
+
   
       target_include_directories(${MCUX_SDK_PROJECT_NAME} PUBLIC
           ${CMAKE_CURRENT_LIST_DIR}/Include
@@ -34,6 +34,49 @@
 #include "arm_common_tables.h"
 #include "dsp/transform_functions.h"
 
+/*
+ * The FFT tables are pruned when the build defines ARM_DSP_FFT_TABLES_PRUNED together with one
+ * ARM_DSP_FFT_TABLE_<kind>_<type>_<length> define per transform it uses, as printed by Scripts/gen_fft_tables.py.
+ * The generic init functions then only handle these lengths. Otherwise all the tables are available.
+ */
+#if !defined(ARM_DSP_FFT_TABLES_PRUNED)
+#define ARM_DSP_FFT_TABLE_CFFT_F32_16
+#define ARM_DSP_FFT_TABLE_CFFT_F32_32
+#define ARM_DSP_FFT_TABLE_CFFT_F32_64
+#define ARM_DSP_FFT_TABLE_CFFT_F32_128
+#define ARM_DSP_FFT_TABLE_CFFT_F32_256
+#define ARM_DSP_FFT_TABLE_CFFT_F32_512
+#define ARM_DSP_FFT_TABLE_CFFT_F32_1024
+#define ARM_DSP_FFT_TABLE_CFFT_F32_2048
+#define ARM_DSP_FFT_TABLE_CFFT_F32_4096
+#define ARM_DSP_FFT_TABLE_CFFT_Q31_16
+#define ARM_DSP_FFT_TABLE_CFFT_Q31_32
+#define ARM_DSP_FFT_TABLE_CFFT_Q31_64
+#define ARM_DSP_FFT_TABLE_CFFT_Q31_128
+#define ARM_DSP_FFT_TABLE_CFFT_Q31_256
+#define ARM_DSP_FFT_TABLE_CFFT_Q31_512
+#define ARM_DSP_FFT_TABLE_CFFT_Q31_1024
+#define ARM_DSP_FFT_TABLE_CFFT_Q31_2048
+#define ARM_DSP_FFT_TABLE_CFFT_Q31_4096
+#define ARM_DSP_FFT_TABLE_CFFT_Q15_16
+#define ARM_DSP_FFT_TABLE_CFFT_Q15_32
+#define ARM_DSP_FFT_TABLE_CFFT_Q15_64
+#define ARM_DSP_FFT_TABLE_CFFT_Q15_128
+#define ARM_DSP_FFT_TABLE_CFFT_Q15_256
+#define ARM_DSP_FFT_TABLE_CFFT_Q15_512
+#define ARM_DSP_FFT_TABLE_CFFT_Q15_1024
+#define ARM_DSP_FFT_TABLE_CFFT_Q15_2048
+#define ARM_DSP_FFT_TABLE_CFFT_Q15_4096
+#define ARM_DSP_FFT_TABLE_RFFT_FAST_F32_32
+#define ARM_DSP_FFT_TABLE_RFFT_FAST_F32_64
+#define ARM_DSP_FFT_TABLE_RFFT_FAST_F32_128
+#define ARM_DSP_FFT_TABLE_RFFT_FAST_F32_256
+#define ARM_DSP_FFT_TABLE_RFFT_FAST_F32_512
+#define ARM_DSP_FFT_TABLE_RFFT_FAST_F32_1024
+#define ARM_DSP_FFT_TABLE_RFFT_FAST_F32_2048
+#define ARM_DSP_FFT_TABLE_RFFT_FAST_F32_4096
+#endif /* !defined(ARM_DSP_FFT_TABLES_PRUNED) */
+
 #ifdef   __cplusplus
 extern "C"
 {
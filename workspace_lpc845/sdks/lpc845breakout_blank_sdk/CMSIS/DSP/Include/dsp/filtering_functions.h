@@ -362,6 +362,19 @@ extern "C"
         q15_t * pDst,
         uint32_t blockSize);
 
+  /**
+   * @brief Processing function for the Q15 Biquad cascade filter for Cortex-M0 and Cortex-M0+.
+   * @param[in]  S          points to an instance of the Q15 Biquad cascade structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_biquad_cascade_df1_m0_q15(
+  const arm_biquad_casd_df1_inst_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
   /**
    * @brief Processing function for the Q31 Biquad cascade filter
    * @param[in]  S          points to an instance of the Q31 Biquad cascade structure.
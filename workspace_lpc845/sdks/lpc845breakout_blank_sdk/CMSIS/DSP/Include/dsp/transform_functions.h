@@ -433,6 +433,62 @@ arm_status arm_rfft_init_8192_q15(
         q15_t * pSrc,
         q15_t * pDst);
 
+  /**
+   * @brief Number of entries in a quarter wave of the sine table of the Cortex-M0+ Q15 real FFT, without the last one.
+   */
+#define ARM_RFFT_M0_Q15_SINE_TABLE_LEN (128U)
+
+  /**
+   * @brief Instance structure for the Q15 real FFT tuned for Cortex-M0+.
+   */
+  typedef struct
+  {
+          uint16_t fftLenReal;                      /**< length of the real FFT, 64 to 512. */
+          uint16_t twidCoefModifier;                /**< sine table index step for the angle 2 * pi / fftLenReal. */
+    const q15_t *pSineTable;                        /**< points to the quarter-wave sine table. */
+  } arm_rfft_m0_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q15 real FFT tuned for Cortex-M0+.
+   * @param[in,out] S           points to an instance of the Q15 real FFT structure.
+   * @param[in]     fftLenReal  length of the real FFT, 64, 128, 256 or 512.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if the length is not supported.
+   */
+  arm_status arm_rfft_m0_init_q15(
+        arm_rfft_m0_instance_q15 * S,
+        uint32_t fftLenReal);
+
+  /**
+   * @brief  In-place Q15 real FFT tuned for Cortex-M0+.
+   * @param[in]     S      points to an instance of the Q15 real FFT structure.
+   * @param[in,out] pData  points to fftLenReal input samples, replaced by the packed spectrum.
+   */
+  void arm_rfft_m0_q15(
+  const arm_rfft_m0_instance_q15 * S,
+        q15_t * pData);
+
+  /**
+   * @brief  Power spectrum of the output of arm_rfft_m0_q15.
+   * @param[in]  S          points to an instance of the Q15 real FFT structure.
+   * @param[in]  pSpectrum  points to the packed spectrum.
+   * @param[out] pPower     points to fftLenReal / 2 + 1 power values in 2.30 format.
+   */
+  void arm_rfft_m0_power_q15(
+  const arm_rfft_m0_instance_q15 * S,
+  const q15_t * pSpectrum,
+        q31_t * pPower);
+
+  /**
+   * @brief  Magnitude spectrum of the output of arm_rfft_m0_q15.
+   * @param[in]  S          points to an instance of the Q15 real FFT structure.
+   * @param[in]  pSpectrum  points to the packed spectrum.
+   * @param[out] pMag       points to fftLenReal / 2 + 1 magnitude values in 1.15 format.
+   */
+  void arm_rfft_m0_mag_q15(
+  const arm_rfft_m0_instance_q15 * S,
+  const q15_t * pSpectrum,
+        q15_t * pMag);
+
   /**
    * @brief Instance structure for the Q31 RFFT/RIFFT function.
    */
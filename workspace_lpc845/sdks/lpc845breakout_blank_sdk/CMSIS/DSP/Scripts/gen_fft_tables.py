@@ -0,0 +1,306 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 NXP
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+"""Generates the CMSIS-DSP FFT tables of the transforms an application uses.
+
+The CommonTables sources define the twiddle and bit reversal tables of every FFT length and data type, and the
+generic init functions reference all of them, so none can be discarded by the linker. This script writes a C file
+with only the tables and constant structs of the listed transforms and prints the matching preprocessor defines,
+one per line. Compile the file with CMSIS-DSP and define them for the whole library: CommonTables.c then leaves out
+arm_common_tables.c and arm_const_structs.c, and the generic init functions only handle the listed lengths.
+
+The file also holds every table of arm_common_tables.c that is not an FFT table: the sine tables of arm_sin_*,
+arm_cos_* and arm_sin_cos_*, the start values of arm_sqrt_q15/q31, the reciprocal tables of arm_lms_norm_*, the
+DCT4 weights and cos factors and the realCoefA/B tables of arm_rfft_q15/q31 and arm_rfft_f32. Each is a separate
+object that the linker drops when it is not referenced. The deprecated radix-2 and radix-4 CFFTs also need the
+armBitRevTable written here and the 4096-point twiddles of cfft_<type>_4096, which the DCT4 and arm_rfft_f32 run on.
+
+Transforms are named <kind>_<type>_<length>:
+
+    cfft_f32_<16..4096>       arm_cfft_f32, arm_cfft_init_f32
+    cfft_q31_<16..4096>       arm_cfft_q31, arm_cfft_init_q31
+    cfft_q15_<16..4096>       arm_cfft_q15, arm_cfft_init_q15
+    rfft_fast_f32_<32..4096>  arm_rfft_fast_f32, arm_rfft_fast_init_f32, includes cfft_f32_<length / 2>
+
+arm_rfft_q15 and arm_rfft_q31 of a length need cfft_q15_<length / 2> and cfft_q31_<length / 2>.
+
+Usage:
+
+    gen_fft_tables.py -o arm_fft_tables.c cfft_q15_256 rfft_fast_f32_512
+
+With CMake, list the transforms in CONFIG_CMSIS_DSP_FFT_TABLES, see devices/LPC845/all_lib_device.cmake.
+"""
+
+import argparse
+import math
+import sys
+
+LENGTHS = [16, 32, 64, 128, 256, 512, 1024, 2048, 4096]
+
+HEADER = """/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        {name}
+ * Description:  FFT tables and constant structs of the transforms used by the application.
+ *
+ * Generated by gen_fft_tables.py {args}
+ * Do not edit.
+ * -------------------------------------------------------------------- */
+
+#include "arm_math_types.h"
+#include "arm_const_structs.h"
+
+"""
+
+
+def parse(name):
+    """Splits a transform name into (kind, type, length)."""
+    parts = name.lower().split("_")
+    try:
+        length = int(parts[-1])
+    except ValueError:
+        length = 0
+    kind = "_".join(parts[:-2])
+    dtype = parts[-2] if len(parts) >= 3 else ""
+    if (kind, dtype) in (("cfft", "f32"), ("cfft", "q31"), ("cfft", "q15")) and length in LENGTHS:
+        return kind, dtype, length
+    if (kind, dtype) == ("rfft_fast", "f32") and (length // 2) in LENGTHS:
+        return kind, dtype, length
+    raise ValueError("unsupported transform '%s'" % name)
+
+
+def define(kind, dtype, length):
+    return "ARM_DSP_FFT_TABLE_%s_%s_%d" % (kind.upper(), dtype.upper(), length)
+
+
+def to_fixed(value, bits):
+    """Rounds to a fixed-point value with saturation, as the CMSIS tables are converted."""
+    scaled = int(round(value * (1 << bits)))
+    return max(-(1 << bits), min((1 << bits) - 1, scaled))
+
+
+def bitrev_fixed_permutation(length):
+    """Bin held by each output position of the radix-4 by 2 fixed-point FFTs: radix-2 bit reversal."""
+    bits = length.bit_length() - 1
+    return [int(format(k, "0%db" % bits)[::-1], 2) for k in range(length)]
+
+
+def bitrev_f32_permutation(length):
+    """Bin held by each output position of the radix-8 floating-point FFT: a first radix-2 or radix-4 stage for
+    lengths that are not a power of 8, then radix-8 stages, each stage takes the next digit of the bin index from
+    the least significant one."""
+    radices = []
+    rest = length
+    while rest % 8 == 0 and rest > 1:
+        rest //= 8
+        radices.append(8)
+    if rest > 1:
+        radices.insert(0, rest)
+
+    order = []
+    for position in range(length):
+        # The position is read most significant digit first, in stage order
+        index = 0
+        weight = 1
+        span = length
+        remainder = position
+        for radix in radices:
+            span //= radix
+            digit = remainder // span
+            remainder %= span
+            index += digit * weight
+            weight *= radix
+        order.append(index)
+    return order
+
+
+def swaps(order):
+    """Sequence of swaps sorting the FFT output, where position p holds bin order[p], as applied in turn by
+    arm_bitreversal_32 and arm_bitreversal_16."""
+    current = list(order)
+    where = [0] * len(order)
+    for position, held in enumerate(order):
+        where[held] = position
+    result = []
+    for position in range(len(order)):
+        if current[position] != position:
+            other = where[position]
+            result.append((position, other))
+            current[other] = current[position]
+            where[current[other]] = other
+            current[position] = position
+            where[position] = position
+    return result
+
+
+def c_array(ctype, name, values, per_line, fmt):
+    lines = ["const %s %s[%d] ARM_DSP_TABLE_ATTRIBUTE = {" % (ctype, name, len(values))]
+    for start in range(0, len(values), per_line):
+        chunk = ", ".join(fmt(v) for v in values[start:start + per_line])
+        lines.append("    " + chunk + ("," if start + per_line < len(values) else ""))
+    lines.append("};")
+    return "\n".join(lines) + "\n\n"
+
+
+def fmt_f32(value):
+    return "%.9ff" % value
+
+
+def fmt_q31(value):
+    return "(q31_t)0x%08X" % (value & 0xFFFFFFFF)
+
+
+def fmt_q15(value):
+    return "(q15_t)0x%04X" % (value & 0xFFFF)
+
+
+def fmt_u16(value):
+    return "%5d" % value
+
+
+def bitrev_table(name, order):
+    """Byte offsets of the complex pairs to swap, as in the CMSIS bit reversal tables."""
+    values = []
+    for a, b in swaps(order):
+        values.extend([8 * a, 8 * b])
+    return c_array("uint16_t", name, values, 8, fmt_u16), len(values)
+
+
+def cfft_tables(dtype, length):
+    out = "/* cfft_%s_%d */\n" % (dtype, length)
+    if dtype == "f32":
+        twiddle = []
+        for i in range(length):
+            twiddle += [math.cos(2.0 * math.pi * i / length), math.sin(2.0 * math.pi * i / length)]
+        out += c_array("float32_t", "twiddleCoef_%d" % length, twiddle, 4, fmt_f32)
+        table = "armBitRevIndexTable%d" % length
+        text, count = bitrev_table(table, bitrev_f32_permutation(length))
+        out += text
+        twiddle_name = "twiddleCoef_%d" % length
+    else:
+        bits = 31 if dtype == "q31" else 15
+        twiddle = []
+        for i in range(3 * length // 4):
+            twiddle += [to_fixed(math.cos(2.0 * math.pi * i / length), bits),
+                        to_fixed(math.sin(2.0 * math.pi * i / length), bits)]
+        twiddle_name = "twiddleCoef_%d_%s" % (length, dtype)
+        out += c_array("%s_t" % dtype, twiddle_name, twiddle, 8 if dtype == "q15" else 4,
+                       fmt_q15 if dtype == "q15" else fmt_q31)
+        # The bit reversal table is shared by the q15 and q31 transforms of the same length
+        table = "armBitRevIndexTable_fixed_%d" % length
+        text, count = bitrev_table(table, bitrev_fixed_permutation(length))
+        out += text
+    out += "const arm_cfft_instance_%s arm_cfft_sR_%s_len%d ARM_DSP_TABLE_ATTRIBUTE = {\n" % (dtype, dtype, length)
+    out += "  %d, %s, %s, %d\n};\n\n" % (length, twiddle_name, table, count)
+    return out, table
+
+
+def fixed_tables(names, values):
+    """The same table in f32, q31 and q15, with the names in this order."""
+    out = c_array("float32_t", names[0], values, 4, fmt_f32)
+    out += c_array("q31_t", names[1], [to_fixed(v, 31) for v in values], 4, fmt_q31)
+    out += c_array("q15_t", names[2], [to_fixed(v, 15) for v in values], 8, fmt_q15)
+    return out
+
+
+def common_tables():
+    """The tables of arm_common_tables.c that are not FFT tables, computed with the formulas documented there."""
+    out = "/* Tables other than FFT tables */\n"
+
+    # Radix-2 and radix-4 CFFT bit reversal of 4096 points: y[l - 1] = bitrev12(l) >> 1
+    bitrev = [int(format(l, "012b")[::-1], 2) >> 1 for l in range(1, 1025)]
+    out += c_array("uint16_t", "armBitRevTable", bitrev, 8, fmt_u16)
+
+    # Real FFT split coefficients of n = 4096
+    n = 4096
+    coef_a = []
+    coef_b = []
+    for i in range(n):
+        angle = 2.0 * math.pi / (2.0 * n) * i
+        coef_a += [0.5 * (1.0 - math.sin(angle)), 0.5 * (-1.0 * math.cos(angle))]
+        coef_b += [0.5 * (1.0 + math.sin(angle)), 0.5 * (1.0 * math.cos(angle))]
+    out += fixed_tables(("realCoefA", "realCoefAQ31", "realCoefAQ15"), coef_a)
+    out += fixed_tables(("realCoefB", "realCoefBQ31", "realCoefBQ15"), coef_b)
+
+    # DCT4 weights e^(-j * i * pi / (2 * N)) and cos factors cos((2 * i + 1) * pi / (4 * N))
+    for length in (128, 512, 2048, 8192):
+        c = math.pi / (2.0 * length)
+        weights = []
+        for i in range(length):
+            weights += [math.cos(i * c), 0.0 - math.sin(i * c)]
+        factors = [math.cos((2 * i + 1) * c / 2.0) for i in range(length)]
+        out += fixed_tables(("Weights_%d" % length, "WeightsQ31_%d" % length, "WeightsQ15_%d" % length), weights)
+        out += fixed_tables(("cos_factors_%d" % length, "cos_factorsQ31_%d" % length,
+                             "cos_factorsQ15_%d" % length), factors)
+
+    # Reciprocal start values in 1.31 with exponent 1, at the middle of each of the 64 steps of [0.5, 1)
+    recip = [min(0x7FFFFFFF, int(round((1 << 30) * 128.0 / (64.5 + i)))) for i in range(64)]
+    out += c_array("q31_t", "armRecipTableQ31", recip, 4, fmt_q31)
+    out += c_array("q15_t", "armRecipTableQ15", [v >> 16 for v in recip], 8, fmt_q15)
+
+    # Sine of FAST_MATH_TABLE_SIZE = 512 steps of the period, with the closing point
+    sine = [math.sin(2.0 * math.pi * i / 512) for i in range(513)]
+    out += fixed_tables(("sinTable_f32", "sinTable_q31", "sinTable_q15"), sine)
+
+    # Start values of 1 / sqrt(x) for the Newton iterations, x from 0.25 in steps of 1 / 32 and 1 / 16
+    out += c_array("q31_t", "sqrt_initial_lut_q31",
+                   [int(round((1 << 28) / math.sqrt(0.25 + i / 32.0))) for i in range(32)], 4, fmt_q31)
+    out += c_array("q15_t", "sqrt_initial_lut_q15",
+                   [int(round((1 << 12) / math.sqrt(0.25 + i / 16.0))) for i in range(16)], 8, fmt_q15)
+    return out
+
+
+def rfft_fast_tables(length):
+    # Sine first, as arm_rfft_fast_f32 reads the split twiddles
+    twiddle = []
+    for i in range(length // 2):
+        twiddle += [math.sin(2.0 * math.pi * i / length), math.cos(2.0 * math.pi * i / length)]
+    return "/* rfft_fast_f32_%d */\n" % length + c_array("float32_t", "twiddleCoef_rfft_%d" % length, twiddle, 4,
+                                                         fmt_f32)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("-o", "--output", required=True, help="generated C file")
+    parser.add_argument("transforms", nargs="+", help="transforms used by the application, e.g. cfft_q15_256")
+    args = parser.parse_args()
+
+    wanted = set()
+    try:
+        for name in args.transforms:
+            kind, dtype, length = parse(name)
+            wanted.add((kind, dtype, length))
+            if kind == "rfft_fast":
+                wanted.add(("cfft", "f32", length // 2))
+    except ValueError as error:
+        sys.stderr.write("gen_fft_tables.py: %s\n" % error)
+        return 1
+
+    text = HEADER.format(name=args.output.replace("\\", "/").split("/")[-1], args=" ".join(args.transforms))
+    emitted = set()
+    for kind, dtype, length in sorted(wanted, key=lambda w: (w[0], w[1], w[2])):
+        if kind == "cfft":
+            tables, bitrev = cfft_tables(dtype, length)
+            if bitrev in emitted:
+                # q15 and q31 of the same length share the bit reversal table, drop the second copy
+                start = tables.index("const uint16_t %s[" % bitrev)
+                tables = tables[:start] + tables[tables.index("};\n\n", start) + 4:]
+            emitted.add(bitrev)
+            text += tables
+        else:
+            text += rfft_fast_tables(length)
+    text += common_tables()
+
+    with open(args.output, "w", newline="\n") as handle:
+        handle.write(text.rstrip("\n") + "\n")
+
+    print("ARM_DSP_FFT_TABLES_PRUNED")
+    for kind, dtype, length in sorted(wanted):
+        print(define(kind, dtype, length))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -26,6 +26,10 @@
  * limitations under the License.
  */
 
+/* With pruned FFT tables, the file generated by Scripts/gen_fft_tables.py takes the place of these two: it holds the
+ * tables of the listed transforms and every table of arm_common_tables.c that is not an FFT table. */
+#if !defined(ARM_DSP_FFT_TABLES_PRUNED)
 #include "arm_common_tables.c"
 #include "arm_const_structs.c"
+#endif
 #include "arm_mve_tables.c"
@@ -34,6 +34,7 @@
 #include "arm_biquad_cascade_df1_init_f32.c"
 #include "arm_biquad_cascade_df1_init_q15.c"
 #include "arm_biquad_cascade_df1_init_q31.c"
+#include "arm_biquad_cascade_df1_m0_q15.c"
 #include "arm_biquad_cascade_df1_q15.c"
 #include "arm_biquad_cascade_df1_q31.c"
 #include "arm_biquad_cascade_df2T_f32.c"
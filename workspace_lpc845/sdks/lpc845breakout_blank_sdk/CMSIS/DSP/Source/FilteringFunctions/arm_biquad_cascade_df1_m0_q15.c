@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_df1_m0_q15.c
+ * Description:  Processing function for the Q15 Biquad cascade DirectFormI(DF1) filter tuned for Cortex-M0+
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M0 and Cortex-M0+ cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF1
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 Biquad cascade filter (Cortex-M0+ variant).
+  @param[in]     S         points to an instance of the Q15 Biquad cascade structure
+  @param[in]     pSrc      points to the block of input data
+  @param[out]    pDst      points to the block of output data
+  @param[in]     blockSize number of samples to process per call
+
+  @par           Scaling and Overflow Behavior
+                   This function computes the same results as \ref arm_biquad_cascade_df1_fast_q15().
+                   It uses a 32-bit accumulator with 2.30 format and provides only a single guard bit.
+                   Thus, if the accumulator result overflows it wraps around and distorts the result.
+                   In order to avoid overflows completely the input signal must be scaled down by two bits and lie in the range [-0.25 +0.25).
+                   The 2.30 accumulator is then shifted by <code>postShift</code> bits and the result truncated to 1.15 format by discarding the low 16 bits.
+
+  @par           Implementation
+                   The state of a stage is kept in registers as 32-bit values and every term is a single cycle multiply,
+                   without the halfword packing and unpacking the SIMD emulation needs on Cortex-M0 and Cortex-M0+.
+                   Two samples are computed per pass so the state variables swap roles instead of being moved.
+
+  @remark
+                   Both the standard, the fast and this version use the same instance structure.
+                   Use the function \ref arm_biquad_cascade_df1_init_q15() to initialize the filter structure.
+ */
+
+ARM_DSP_ATTRIBUTE void arm_biquad_cascade_df1_m0_q15(
+  const arm_biquad_casd_df1_inst_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+  const q15_t *pIn = pSrc;                             /* Source pointer */
+        q15_t *pOut = pDst;                            /* Destination pointer */
+        q15_t *pState = S->pState;                     /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+        q31_t acc;                                     /* Accumulator */
+        q31_t b0, b1, b2, a1, a2;                      /* Filter coefficients */
+        q31_t Xn, Xn1, Xn2, Yn1, Yn2;                  /* Filter state variables */
+        int32_t shift = (int32_t) (15 - S->postShift); /* Post shift */
+        uint32_t sample, stage = S->numStages;         /* Loop counters */
+
+  do
+  {
+    /* Read the coefficients, skipping the padding after b0 */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[2];
+    b2 = pCoeffs[3];
+    a1 = pCoeffs[4];
+    a2 = pCoeffs[5];
+    pCoeffs += 6U;
+
+    /* Read the state values: x[n-1], x[n-2], y[n-1], y[n-2] */
+    Xn1 = pState[0];
+    Xn2 = pState[1];
+    Yn1 = pState[2];
+    Yn2 = pState[3];
+
+    /* Compute 2 outputs at a time.
+     * acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2]
+     * The samples of the second output are written over x[n-2] and y[n-2]. */
+    sample = blockSize >> 1U;
+
+    while (sample > 0U)
+    {
+      /* First output, the new sample goes to Xn2 */
+      Xn = *pIn++;
+      acc = (b0 * Xn) + (b1 * Xn1) + (b2 * Xn2) + (a1 * Yn1) + (a2 * Yn2);
+      Xn2 = Xn;
+      Yn2 = __SSAT((acc >> shift), 16);
+      *pOut++ = (q15_t) Yn2;
+
+      /* Second output, x[n-1] is now Xn2 and y[n-1] is Yn2 */
+      Xn = *pIn++;
+      acc = (b0 * Xn) + (b1 * Xn2) + (b2 * Xn1) + (a1 * Yn2) + (a2 * Yn1);
+      Xn1 = Xn;
+      Yn1 = __SSAT((acc >> shift), 16);
+      *pOut++ = (q15_t) Yn1;
+
+      /* Decrement loop counter */
+      sample--;
+    }
+
+    /* Last output of an odd block size */
+    if ((blockSize & 1U) != 0U)
+    {
+      Xn = *pIn;
+      acc = (b0 * Xn) + (b1 * Xn1) + (b2 * Xn2) + (a1 * Yn1) + (a2 * Yn2);
+      Xn2 = Xn1;
+      Xn1 = Xn;
+      Yn2 = Yn1;
+      Yn1 = __SSAT((acc >> shift), 16);
+      *pOut = (q15_t) Yn1;
+    }
+
+    /* The first stage goes from the input buffer to the output buffer. */
+    /* Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+    /* Reset the output pointer */
+    pOut = pDst;
+
+    /* Store the updated state variables back into the state array */
+    *pState++ = (q15_t) Xn1;
+    *pState++ = (q15_t) Xn2;
+    *pState++ = (q15_t) Yn1;
+    *pState++ = (q15_t) Yn2;
+
+    /* Decrement loop counter */
+    stage--;
+
+  } while (stage > 0U);
+}
+
+/**
+  @} end of BiquadCascadeDF1 group
+ */
@@ -47,6 +47,10 @@
 #include "arm_rfft_fast_f64.c"
 #include "arm_rfft_fast_init_f32.c"
 #include "arm_rfft_fast_init_f64.c"
+#include "arm_rfft_m0_init_q15.c"
+#include "arm_rfft_m0_mag_q15.c"
+#include "arm_rfft_m0_power_q15.c"
+#include "arm_rfft_m0_q15.c"
 
 #include "arm_mfcc_init_f32.c"
 #include "arm_mfcc_f32.c"
@@ -134,7 +134,9 @@ ARM_DSP_ATTRIBUTE arm_status arm_cfft_init_##LEN##_f32(arm_cfft_instance_f32 * S
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_F32_4096)
 CFFTINIT_F32(4096,4096)
+#endif
 
 
 /**
@@ -148,7 +150,9 @@ CFFTINIT_F32(4096,4096)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_F32_2048)
 CFFTINIT_F32(2048,1024)
+#endif
 
 
 /**
@@ -162,7 +166,9 @@ CFFTINIT_F32(2048,1024)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_F32_1024)
 CFFTINIT_F32(1024,1024)
+#endif
 
 
 /**
@@ -176,7 +182,9 @@ CFFTINIT_F32(1024,1024)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_F32_512)
 CFFTINIT_F32(512,256)
+#endif
 
 
 /**
@@ -190,7 +198,9 @@ CFFTINIT_F32(512,256)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_F32_256)
 CFFTINIT_F32(256,256)
+#endif
 
 
 /**
@@ -204,7 +214,9 @@ CFFTINIT_F32(256,256)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_F32_128)
 CFFTINIT_F32(128,64)
+#endif
 
 
 /**
@@ -218,7 +230,9 @@ CFFTINIT_F32(128,64)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_F32_64)
 CFFTINIT_F32(64,64)
+#endif
  
 
 /**
@@ -232,7 +246,9 @@ CFFTINIT_F32(64,64)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_F32_32)
 CFFTINIT_F32(32,16)
+#endif
 
 
 /**
@@ -246,7 +262,9 @@ CFFTINIT_F32(32,16)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_F32_16)
 CFFTINIT_F32(16,16)
+#endif
 
 
 /**
@@ -284,49 +302,67 @@ ARM_DSP_ATTRIBUTE arm_status arm_cfft_init_f32(
         /*  Initializations of Instance structure depending on the FFT length */
         switch (fftLen) {                                                    
             /*  Initializations of structure parameters for 4096 point FFT */   
+#if defined(ARM_DSP_FFT_TABLE_CFFT_F32_4096)
         case 4096U:  
             /*  Initialise the bit reversal table modifier */                   
             status=arm_cfft_init_4096_f32(S);
             break;                                                              
+#endif
 
             /*  Initializations of structure parameters for 2048 point FFT */   
+#if defined(ARM_DSP_FFT_TABLE_CFFT_F32_2048)
         case 2048U:                                                             
             /*  Initialise the bit reversal table modifier */                   
             status=arm_cfft_init_2048_f32(S);
             break;     
+#endif
 
             /*  Initializations of structure parameters for 1024 point FFT */   
+#if defined(ARM_DSP_FFT_TABLE_CFFT_F32_1024)
         case 1024U:                                                             
             /*  Initialise the bit reversal table modifier */                   
             status=arm_cfft_init_1024_f32(S);
             break;                                                              
+#endif
 
             /*  Initializations of structure parameters for 512 point FFT */    
+#if defined(ARM_DSP_FFT_TABLE_CFFT_F32_512)
         case 512U:                                                              
             /*  Initialise the bit reversal table modifier */                   
             status=arm_cfft_init_512_f32(S);
             break;                                                              
+#endif
 
+#if defined(ARM_DSP_FFT_TABLE_CFFT_F32_256)
         case 256U:                                                              
             status=arm_cfft_init_256_f32(S);          
             break;  
+#endif
                  
+#if defined(ARM_DSP_FFT_TABLE_CFFT_F32_128)
         case 128U:                                                              
             status=arm_cfft_init_128_f32(S);
             break;                                                              
+#endif
 
+#if defined(ARM_DSP_FFT_TABLE_CFFT_F32_64)
         case 64U:                                                               
             status=arm_cfft_init_64_f32(S);           
             break;                                                              
+#endif
 
+#if defined(ARM_DSP_FFT_TABLE_CFFT_F32_32)
         case 32U:                                                               
             status=arm_cfft_init_32_f32(S);
             break;                                                              
+#endif
 
+#if defined(ARM_DSP_FFT_TABLE_CFFT_F32_16)
         case 16U:                                                               
             /*  Initializations of structure parameters for 16 point FFT */     
             status=arm_cfft_init_16_f32(S);
             break;                                                              
+#endif
                                                                                 
         default:                                                                
             /*  Reporting argument error if fftSize is not valid value */       
@@ -136,7 +136,9 @@ ARM_DSP_ATTRIBUTE arm_status arm_cfft_init_##LEN##_q15(arm_cfft_instance_q15 * S
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_4096)
 CFFTINIT_Q15(4096,4096)
+#endif
 
 /**
   @brief         Initialization function for the cfft q15 function for 2048 samples
@@ -149,7 +151,9 @@ CFFTINIT_Q15(4096,4096)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_2048)
 CFFTINIT_Q15(2048,1024)
+#endif
 
 /**
   @brief         Initialization function for the cfft q15 function for 1024 samples
@@ -162,7 +166,9 @@ CFFTINIT_Q15(2048,1024)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_1024)
 CFFTINIT_Q15(1024,1024)
+#endif
 
 /**
   @brief         Initialization function for the cfft q15 function for 512 samples
@@ -175,7 +181,9 @@ CFFTINIT_Q15(1024,1024)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_512)
 CFFTINIT_Q15(512,256)
+#endif
 
 /**
   @brief         Initialization function for the cfft q15 function for 256 samples
@@ -188,7 +196,9 @@ CFFTINIT_Q15(512,256)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_256)
 CFFTINIT_Q15(256,256)
+#endif
 
 /**
   @brief         Initialization function for the cfft q15 function for 128 samples
@@ -201,7 +211,9 @@ CFFTINIT_Q15(256,256)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_128)
 CFFTINIT_Q15(128,64)
+#endif
 
 /**
   @brief         Initialization function for the cfft q15 function for 64 samples
@@ -214,7 +226,9 @@ CFFTINIT_Q15(128,64)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_64)
 CFFTINIT_Q15(64,64)
+#endif
 
 /**
   @brief         Initialization function for the cfft q15 function for 32 samples
@@ -227,7 +241,9 @@ CFFTINIT_Q15(64,64)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_32)
 CFFTINIT_Q15(32,16)
+#endif
 
 /**
   @brief         Initialization function for the cfft q15 function for 16 samples
@@ -240,7 +256,9 @@ CFFTINIT_Q15(32,16)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_16)
 CFFTINIT_Q15(16,16)
+#endif
 
 /**
   @brief         Generic initialization function for the cfft q15 function
@@ -276,49 +294,67 @@ ARM_DSP_ATTRIBUTE arm_status arm_cfft_init_q15(
         /*  Initializations of Instance structure depending on the FFT length */
         switch (fftLen) {                                                    
             /*  Initializations of structure parameters for 4096 point FFT */   
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_4096)
         case 4096U:  
             /*  Initialise the bit reversal table modifier */                   
             status=arm_cfft_init_4096_q15(S);
             break;                                                              
+#endif
 
             /*  Initializations of structure parameters for 2048 point FFT */   
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_2048)
         case 2048U:                                                             
             /*  Initialise the bit reversal table modifier */                   
             status=arm_cfft_init_2048_q15(S);
             break;     
+#endif
 
             /*  Initializations of structure parameters for 1024 point FFT */   
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_1024)
         case 1024U:                                                             
             /*  Initialise the bit reversal table modifier */                   
             status=arm_cfft_init_1024_q15(S);
             break;                                                              
+#endif
 
             /*  Initializations of structure parameters for 512 point FFT */    
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_512)
         case 512U:                                                              
             /*  Initialise the bit reversal table modifier */                   
             status=arm_cfft_init_512_q15(S);
             break;                                                              
+#endif
 
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_256)
         case 256U:                                                              
             status=arm_cfft_init_256_q15(S);
             break;  
+#endif
                  
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_128)
         case 128U:                                                              
             status=arm_cfft_init_128_q15(S);
             break;                                                              
+#endif
 
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_64)
         case 64U:                                                               
             status=arm_cfft_init_64_q15(S);
             break;                                                              
+#endif
 
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_32)
         case 32U:                                                               
             status=arm_cfft_init_32_q15(S);
             break;                                                              
+#endif
 
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_16)
         case 16U:                                                               
             /*  Initializations of structure parameters for 16 point FFT */     
             status=arm_cfft_init_16_q15(S);
             break;                                                              
+#endif
                                                                          
         default:                                                                
             /*  Reporting argument error if fftSize is not valid value */       
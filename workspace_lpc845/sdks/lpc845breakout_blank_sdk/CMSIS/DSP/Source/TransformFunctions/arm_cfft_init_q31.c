@@ -137,7 +137,9 @@ ARM_DSP_ATTRIBUTE arm_status arm_cfft_init_##LEN##_q31(arm_cfft_instance_q31 * S
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_4096)
 CFFTINIT_Q31(4096,4096)
+#endif
 
 /**
   @brief         Initialization function for the cfft q31 function for 2048 samples
@@ -150,7 +152,9 @@ CFFTINIT_Q31(4096,4096)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_2048)
 CFFTINIT_Q31(2048,1024)
+#endif
 
 /**
   @brief         Initialization function for the cfft q31 function for 1024 samples
@@ -163,7 +167,9 @@ CFFTINIT_Q31(2048,1024)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_1024)
 CFFTINIT_Q31(1024,1024)
+#endif
 
 /**
   @brief         Initialization function for the cfft q31 function for 512 samples
@@ -176,7 +182,9 @@ CFFTINIT_Q31(1024,1024)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_512)
 CFFTINIT_Q31(512,256)
+#endif
 
 /**
   @brief         Initialization function for the cfft q31 function for 256 samples
@@ -189,7 +197,9 @@ CFFTINIT_Q31(512,256)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_256)
 CFFTINIT_Q31(256,256)
+#endif
 
 /**
   @brief         Initialization function for the cfft q31 function for 128 samples
@@ -202,7 +212,9 @@ CFFTINIT_Q31(256,256)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_128)
 CFFTINIT_Q31(128,64)
+#endif
 
 /**
   @brief         Initialization function for the cfft q31 function for 64 samples
@@ -215,7 +227,9 @@ CFFTINIT_Q31(128,64)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_64)
 CFFTINIT_Q31(64,64)
+#endif
 
 /**
   @brief         Initialization function for the cfft q31 function for 32 samples
@@ -228,7 +242,9 @@ CFFTINIT_Q31(64,64)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_32)
 CFFTINIT_Q31(32,16)
+#endif
 
 /**
   @brief         Initialization function for the cfft q31 function for 16 samples
@@ -241,7 +257,9 @@ CFFTINIT_Q31(32,16)
                 Other versions can still initialize directly the data structure using 
                 variables declared in arm_const_structs.h
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_16)
 CFFTINIT_Q31(16,16)
+#endif
 
 /**
   @brief         Generic initialization function for the cfft q31 function
@@ -279,49 +297,67 @@ ARM_DSP_ATTRIBUTE arm_status arm_cfft_init_q31(
         /*  Initializations of Instance structure depending on the FFT length */
         switch (fftLen) {                                                    
             /*  Initializations of structure parameters for 4096 point FFT */   
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_4096)
         case 4096U:  
             /*  Initialise the bit reversal table modifier */                   
             status=arm_cfft_init_4096_q31(S);
             break;                                                              
+#endif
 
             /*  Initializations of structure parameters for 2048 point FFT */   
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_2048)
         case 2048U:                                                             
             /*  Initialise the bit reversal table modifier */                   
             status=arm_cfft_init_2048_q31(S);
             break;     
+#endif
 
             /*  Initializations of structure parameters for 1024 point FFT */   
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_1024)
         case 1024U:                                                             
             /*  Initialise the bit reversal table modifier */                   
             status=arm_cfft_init_1024_q31(S);
             break;                                                              
+#endif
 
             /*  Initializations of structure parameters for 512 point FFT */    
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_512)
         case 512U:                                                              
             /*  Initialise the bit reversal table modifier */                   
             status=arm_cfft_init_512_q31(S);
             break;                                                              
+#endif
 
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_256)
         case 256U:                                                              
             status=arm_cfft_init_256_q31(S);
             break;  
+#endif
                  
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_128)
         case 128U:                                                              
             status=arm_cfft_init_128_q31(S);
             break;                                                              
+#endif
 
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_64)
         case 64U:                                                               
             status=arm_cfft_init_64_q31(S);
             break;                                                              
+#endif
 
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_32)
         case 32U:                                                               
             status=arm_cfft_init_32_q31(S);
             break;                                                              
+#endif
 
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_16)
         case 16U:                                                               
             /*  Initializations of structure parameters for 16 point FFT */     
             status=arm_cfft_init_16_q31(S);
             break;                                                              
+#endif
                                                                          
         default:                                                                
             /*  Reporting argument error if fftSize is not valid value */       
@@ -47,6 +47,7 @@
                    - \ref ARM_MATH_ARGUMENT_ERROR : an error is detected
  */
 
+#if defined(ARM_DSP_FFT_TABLE_RFFT_FAST_F32_32)
 ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_32_f32( arm_rfft_fast_instance_f32 * S ) {
 
   arm_status status;
@@ -64,6 +65,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_32_f32( arm_rfft_fast_instance_f
 
   return ARM_MATH_SUCCESS;
 }
+#endif
 
 /**
   @brief         Initialization function for the 64pt floating-point real FFT.
@@ -73,6 +75,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_32_f32( arm_rfft_fast_instance_f
                    - \ref ARM_MATH_ARGUMENT_ERROR : an error is detected
  */
 
+#if defined(ARM_DSP_FFT_TABLE_RFFT_FAST_F32_64)
 ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_64_f32( arm_rfft_fast_instance_f32 * S ) {
 
   arm_status status;
@@ -90,6 +93,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_64_f32( arm_rfft_fast_instance_f
 
   return ARM_MATH_SUCCESS;
 }
+#endif
 
 /**
   @brief         Initialization function for the 128pt floating-point real FFT.
@@ -99,6 +103,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_64_f32( arm_rfft_fast_instance_f
                    - \ref ARM_MATH_ARGUMENT_ERROR : an error is detected
  */
 
+#if defined(ARM_DSP_FFT_TABLE_RFFT_FAST_F32_128)
 ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_128_f32( arm_rfft_fast_instance_f32 * S ) {
 
   arm_status status;
@@ -116,6 +121,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_128_f32( arm_rfft_fast_instance_
 
   return ARM_MATH_SUCCESS;
 }
+#endif
 
 /**
   @brief         Initialization function for the 256pt floating-point real FFT.
@@ -125,6 +131,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_128_f32( arm_rfft_fast_instance_
                    - \ref ARM_MATH_ARGUMENT_ERROR : an error is detected
 */
 
+#if defined(ARM_DSP_FFT_TABLE_RFFT_FAST_F32_256)
 ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_256_f32( arm_rfft_fast_instance_f32 * S ) {
 
   arm_status status;
@@ -142,6 +149,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_256_f32( arm_rfft_fast_instance_
 
   return ARM_MATH_SUCCESS;
 }
+#endif
 
 /**
   @brief         Initialization function for the 512pt floating-point real FFT.
@@ -151,6 +159,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_256_f32( arm_rfft_fast_instance_
                    - \ref ARM_MATH_ARGUMENT_ERROR : an error is detected
  */
 
+#if defined(ARM_DSP_FFT_TABLE_RFFT_FAST_F32_512)
 ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_512_f32( arm_rfft_fast_instance_f32 * S ) {
 
   arm_status status;
@@ -168,6 +177,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_512_f32( arm_rfft_fast_instance_
 
   return ARM_MATH_SUCCESS;
 }
+#endif
 
 /**
   @brief         Initialization function for the 1024pt floating-point real FFT.
@@ -177,6 +187,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_512_f32( arm_rfft_fast_instance_
                    - \ref ARM_MATH_ARGUMENT_ERROR : an error is detected
  */
 
+#if defined(ARM_DSP_FFT_TABLE_RFFT_FAST_F32_1024)
 ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_1024_f32( arm_rfft_fast_instance_f32 * S ) {
 
   arm_status status;
@@ -194,6 +205,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_1024_f32( arm_rfft_fast_instance
 
   return ARM_MATH_SUCCESS;
 }
+#endif
 
 /**
   @brief         Initialization function for the 2048pt floating-point real FFT.
@@ -202,6 +214,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_1024_f32( arm_rfft_fast_instance
                    - \ref ARM_MATH_SUCCESS        : Operation successful
                    - \ref ARM_MATH_ARGUMENT_ERROR : an error is detected
  */
+#if defined(ARM_DSP_FFT_TABLE_RFFT_FAST_F32_2048)
 ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_2048_f32( arm_rfft_fast_instance_f32 * S ) {
 
   arm_status status;
@@ -219,6 +232,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_2048_f32( arm_rfft_fast_instance
 
   return ARM_MATH_SUCCESS;
 }
+#endif
 
 /**
 * @brief         Initialization function for the 4096pt floating-point real FFT.
@@ -228,6 +242,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_2048_f32( arm_rfft_fast_instance
                    - \ref ARM_MATH_ARGUMENT_ERROR : an error is detected
  */
 
+#if defined(ARM_DSP_FFT_TABLE_RFFT_FAST_F32_4096)
 ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_4096_f32( arm_rfft_fast_instance_f32 * S ) {
 
   arm_status status;
@@ -245,6 +260,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_4096_f32( arm_rfft_fast_instance
 
   return ARM_MATH_SUCCESS;
 }
+#endif
 
 /**
   @brief         Generic initialization function for the floating-point real FFT.
@@ -283,30 +299,46 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_f32(
 
   switch (fftLen)
   {
+#if defined(ARM_DSP_FFT_TABLE_RFFT_FAST_F32_4096)
   case 4096U:
     status = arm_rfft_fast_init_4096_f32(S);
     break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_RFFT_FAST_F32_2048)
   case 2048U:
     status = arm_rfft_fast_init_2048_f32(S);
     break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_RFFT_FAST_F32_1024)
   case 1024U:
     status = arm_rfft_fast_init_1024_f32(S);
     break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_RFFT_FAST_F32_512)
   case 512U:
     status = arm_rfft_fast_init_512_f32(S);
     break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_RFFT_FAST_F32_256)
   case 256U:
     status = arm_rfft_fast_init_256_f32(S);
     break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_RFFT_FAST_F32_128)
   case 128U:
     status = arm_rfft_fast_init_128_f32(S);
     break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_RFFT_FAST_F32_64)
   case 64U:
     status = arm_rfft_fast_init_64_f32(S);
     break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_RFFT_FAST_F32_32)
   case 32U:
     status = arm_rfft_fast_init_32_f32(S);
     break;
+#endif
   default:
     return(ARM_MATH_ARGUMENT_ERROR);
     break;
@@ -131,7 +131,9 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_init_##LEN##_q15( arm_rfft_instance_q15 *
 
  */
 
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_4096)
 RFFTINIT_Q15(8192,4096,1)
+#endif
 
 /**
   @brief         Initialization function for the 4096 pt Q15 real FFT.
@@ -155,7 +157,9 @@ RFFTINIT_Q15(8192,4096,1)
   @par
                    This function also initializes Twiddle factor table.
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_2048)
 RFFTINIT_Q15(4096,2048,2)
+#endif
 
 /**
   @brief         Initialization function for the 2048 pt Q15 real FFT.
@@ -179,7 +183,9 @@ RFFTINIT_Q15(4096,2048,2)
   @par
                    This function also initializes Twiddle factor table.
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_1024)
 RFFTINIT_Q15(2048,1024,4)
+#endif
 
 /**
   @brief         Initialization function for the 1024 pt Q15 real FFT.
@@ -203,7 +209,9 @@ RFFTINIT_Q15(2048,1024,4)
   @par
                    This function also initializes Twiddle factor table.
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_512)
 RFFTINIT_Q15(1024,512,8)
+#endif
 
 /**
   @brief         Initialization function for the 512 pt Q15 real FFT.
@@ -227,7 +235,9 @@ RFFTINIT_Q15(1024,512,8)
   @par
                    This function also initializes Twiddle factor table.
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_256)
 RFFTINIT_Q15(512,256,16)
+#endif
 
 /**
   @brief         Initialization function for the 256 pt Q15 real FFT.
@@ -251,7 +261,9 @@ RFFTINIT_Q15(512,256,16)
   @par
                    This function also initializes Twiddle factor table.
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_128)
 RFFTINIT_Q15(256,128,32)
+#endif
 
 /**
   @brief         Initialization function for the 128 pt Q15 real FFT.
@@ -275,7 +287,9 @@ RFFTINIT_Q15(256,128,32)
   @par
                    This function also initializes Twiddle factor table.
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_64)
 RFFTINIT_Q15(128,64,64)
+#endif
 
 /**
   @brief         Initialization function for the 64 pt Q15 real FFT.
@@ -299,7 +313,9 @@ RFFTINIT_Q15(128,64,64)
   @par
                    This function also initializes Twiddle factor table.
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_32)
 RFFTINIT_Q15(64,32,128)
+#endif
 
 /**
   @brief         Initialization function for the 32 pt Q15 real FFT.
@@ -323,7 +339,9 @@ RFFTINIT_Q15(64,32,128)
   @par
                    This function also initializes Twiddle factor table.
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_16)
 RFFTINIT_Q15(32,16,256)
+#endif
 
 /**
   @brief         Generic initialization function for the Q15 RFFT/RIFFT.
@@ -374,33 +392,51 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_init_q15(
     /*  Initialization of coef modifier depending on the FFT length */
     switch (fftLenReal)
     {
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_4096)
     case 8192U:
         status = arm_rfft_init_8192_q15( S,ifftFlagR,bitReverseFlag );
         break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_2048)
     case 4096U:
         status = arm_rfft_init_4096_q15( S,ifftFlagR,bitReverseFlag );
         break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_1024)
     case 2048U:
         status = arm_rfft_init_2048_q15( S,ifftFlagR,bitReverseFlag );
         break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_512)
     case 1024U:
         status = arm_rfft_init_1024_q15( S,ifftFlagR,bitReverseFlag );
         break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_256)
     case 512U:
         status = arm_rfft_init_512_q15( S,ifftFlagR,bitReverseFlag );
         break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_128)
     case 256U:
         status = arm_rfft_init_256_q15( S,ifftFlagR,bitReverseFlag );
         break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_64)
     case 128U:
         status = arm_rfft_init_128_q15( S,ifftFlagR,bitReverseFlag );
         break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_32)
     case 64U:
         status = arm_rfft_init_64_q15( S,ifftFlagR,bitReverseFlag );
         break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q15_16)
    case 32U:
         status = arm_rfft_init_32_q15( S,ifftFlagR,bitReverseFlag );
         break;
+#endif
     default:
         /*  Reporting argument error if rfftSize is not valid value */
         status = ARM_MATH_ARGUMENT_ERROR;
@@ -128,7 +128,9 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_init_##LEN##_q31( arm_rfft_instance_q31 *
   @par
                    This function also initializes Twiddle factor table.
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_4096)
 RFFTINIT_Q31(8192,4096,1)
+#endif
 
 /**
   @brief         Initialization function for the 4096 pt Q31 real FFT.
@@ -152,7 +154,9 @@ RFFTINIT_Q31(8192,4096,1)
   @par
                    This function also initializes Twiddle factor table.
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_2048)
 RFFTINIT_Q31(4096,2048,2)
+#endif
 
 /**
   @brief         Initialization function for the 2048 pt Q31 real FFT.
@@ -176,7 +180,9 @@ RFFTINIT_Q31(4096,2048,2)
   @par
                    This function also initializes Twiddle factor table.
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_1024)
 RFFTINIT_Q31(2048,1024,4)
+#endif
 
 /**
   @brief         Initialization function for the 1024 pt Q31 real FFT.
@@ -200,7 +206,9 @@ RFFTINIT_Q31(2048,1024,4)
   @par
                    This function also initializes Twiddle factor table.
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_512)
 RFFTINIT_Q31(1024,512,8)
+#endif
 
 /**
   @brief         Initialization function for the 512 pt Q31 real FFT.
@@ -224,7 +232,9 @@ RFFTINIT_Q31(1024,512,8)
   @par
                    This function also initializes Twiddle factor table.
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_256)
 RFFTINIT_Q31(512,256,16)
+#endif
 
 /**
   @brief         Initialization function for the 256 pt Q31 real FFT.
@@ -248,7 +258,9 @@ RFFTINIT_Q31(512,256,16)
   @par
                    This function also initializes Twiddle factor table.
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_128)
 RFFTINIT_Q31(256,128,32)
+#endif
 
 /**
   @brief         Initialization function for the 128 pt Q31 real FFT.
@@ -272,7 +284,9 @@ RFFTINIT_Q31(256,128,32)
   @par
                    This function also initializes Twiddle factor table.
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_64)
 RFFTINIT_Q31(128,64,64)
+#endif
 
 /**
   @brief         Initialization function for the 64 pt Q31 real FFT.
@@ -296,7 +310,9 @@ RFFTINIT_Q31(128,64,64)
   @par
                    This function also initializes Twiddle factor table.
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_32)
 RFFTINIT_Q31(64,32,128)
+#endif
 
 /**
   @brief         Initialization function for the 32 pt Q31 real FFT.
@@ -320,7 +336,9 @@ RFFTINIT_Q31(64,32,128)
   @par
                    This function also initializes Twiddle factor table.
  */
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_16)
 RFFTINIT_Q31(32,16,256)
+#endif
 
 
 /**
@@ -371,33 +389,51 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_init_q31(
     /*  Initialization of coef modifier depending on the FFT length */
     switch (fftLenReal)
     {
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_4096)
     case 8192U:
         status = arm_rfft_init_8192_q31( S,ifftFlagR,bitReverseFlag );
         break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_2048)
     case 4096U:
         status = arm_rfft_init_4096_q31( S,ifftFlagR,bitReverseFlag );
         break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_1024)
     case 2048U:
         status = arm_rfft_init_2048_q31( S,ifftFlagR,bitReverseFlag );
         break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_512)
     case 1024U:
         status = arm_rfft_init_1024_q31( S,ifftFlagR,bitReverseFlag );
         break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_256)
     case 512U:
         status = arm_rfft_init_512_q31( S,ifftFlagR,bitReverseFlag );
         break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_128)
     case 256U:
         status = arm_rfft_init_256_q31( S,ifftFlagR,bitReverseFlag );
         break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_64)
     case 128U:
         status = arm_rfft_init_128_q31( S,ifftFlagR,bitReverseFlag );
         break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_32)
     case 64U:
         status = arm_rfft_init_64_q31( S,ifftFlagR,bitReverseFlag );
         break;
+#endif
+#if defined(ARM_DSP_FFT_TABLE_CFFT_Q31_16)
     case 32U:
         status = arm_rfft_init_32_q31( S,ifftFlagR,bitReverseFlag );
         break;
+#endif
     default:
         /*  Reporting argument error if rfftSize is not valid value */
         status = ARM_MATH_ARGUMENT_ERROR;
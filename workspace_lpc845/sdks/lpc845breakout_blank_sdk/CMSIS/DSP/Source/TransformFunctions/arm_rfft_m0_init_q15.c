@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_m0_init_q15.c
+ * Description:  Initialization function for the Q15 real FFT tuned for Cortex-M0+
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M0 and Cortex-M0+ cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup RealFFT
+*/
+
+/**
+  @defgroup RealFFTQ15M0 Real FFT Q15 Functions for Cortex-M0+
+
+  In-place Q15 real FFT for lengths 64 to 512, sized for small parts without DSP extension.
+  It needs no twiddle or bit reversal table per length: the twiddle factors of every length are read from a single
+  quarter-wave sine table of 129 entries and the bit reversal is computed on the fly.
+
+  The N real samples are transformed as a complex FFT of length N/2 followed by a split step.
+  The first two radix-2 stages are merged into a radix-4 pass without multiplication and all other products are
+  single cycle 16 x 16 bit multiplications, which is what Cortex-M0 and Cortex-M0+ execute best.
+*/
+
+/**
+  @addtogroup RealFFTQ15M0
+  @{
+ */
+
+/**
+  @brief sin(2 * pi * i / 512) for i = 0 to 128 in Q15, the quarter wave of the longest supported FFT.
+ */
+static const q15_t arm_rfft_m0_sine_table_q15[ARM_RFFT_M0_Q15_SINE_TABLE_LEN + 1U] = {
+    (q15_t)0x0000, (q15_t)0x0192, (q15_t)0x0324, (q15_t)0x04B6, (q15_t)0x0648, (q15_t)0x07D9, (q15_t)0x096B, (q15_t)0x0AFB,
+    (q15_t)0x0C8C, (q15_t)0x0E1C, (q15_t)0x0FAB, (q15_t)0x113A, (q15_t)0x12C8, (q15_t)0x1455, (q15_t)0x15E2, (q15_t)0x176E,
+    (q15_t)0x18F9, (q15_t)0x1A83, (q15_t)0x1C0C, (q15_t)0x1D93, (q15_t)0x1F1A, (q15_t)0x209F, (q15_t)0x2224, (q15_t)0x23A7,
+    (q15_t)0x2528, (q15_t)0x26A8, (q15_t)0x2827, (q15_t)0x29A4, (q15_t)0x2B1F, (q15_t)0x2C99, (q15_t)0x2E11, (q15_t)0x2F87,
+    (q15_t)0x30FC, (q15_t)0x326E, (q15_t)0x33DF, (q15_t)0x354E, (q15_t)0x36BA, (q15_t)0x3825, (q15_t)0x398D, (q15_t)0x3AF3,
+    (q15_t)0x3C57, (q15_t)0x3DB8, (q15_t)0x3F17, (q15_t)0x4074, (q15_t)0x41CE, (q15_t)0x4326, (q15_t)0x447B, (q15_t)0x45CD,
+    (q15_t)0x471D, (q15_t)0x486A, (q15_t)0x49B4, (q15_t)0x4AFB, (q15_t)0x4C40, (q15_t)0x4D81, (q15_t)0x4EC0, (q15_t)0x4FFB,
+    (q15_t)0x5134, (q15_t)0x5269, (q15_t)0x539B, (q15_t)0x54CA, (q15_t)0x55F6, (q15_t)0x571E, (q15_t)0x5843, (q15_t)0x5964,
+    (q15_t)0x5A82, (q15_t)0x5B9D, (q15_t)0x5CB4, (q15_t)0x5DC8, (q15_t)0x5ED7, (q15_t)0x5FE4, (q15_t)0x60EC, (q15_t)0x61F1,
+    (q15_t)0x62F2, (q15_t)0x63EF, (q15_t)0x64E9, (q15_t)0x65DE, (q15_t)0x66D0, (q15_t)0x67BD, (q15_t)0x68A7, (q15_t)0x698C,
+    (q15_t)0x6A6E, (q15_t)0x6B4B, (q15_t)0x6C24, (q15_t)0x6CF9, (q15_t)0x6DCA, (q15_t)0x6E97, (q15_t)0x6F5F, (q15_t)0x7023,
+    (q15_t)0x70E3, (q15_t)0x719E, (q15_t)0x7255, (q15_t)0x7308, (q15_t)0x73B6, (q15_t)0x7460, (q15_t)0x7505, (q15_t)0x75A6,
+    (q15_t)0x7642, (q15_t)0x76D9, (q15_t)0x776C, (q15_t)0x77FB, (q15_t)0x7885, (q15_t)0x790A, (q15_t)0x798A, (q15_t)0x7A06,
+    (q15_t)0x7A7D, (q15_t)0x7AEF, (q15_t)0x7B5D, (q15_t)0x7BC6, (q15_t)0x7C2A, (q15_t)0x7C89, (q15_t)0x7CE4, (q15_t)0x7D3A,
+    (q15_t)0x7D8A, (q15_t)0x7DD6, (q15_t)0x7E1E, (q15_t)0x7E60, (q15_t)0x7E9D, (q15_t)0x7ED6, (q15_t)0x7F0A, (q15_t)0x7F38,
+    (q15_t)0x7F62, (q15_t)0x7F87, (q15_t)0x7FA7, (q15_t)0x7FC2, (q15_t)0x7FD9, (q15_t)0x7FEA, (q15_t)0x7FF6, (q15_t)0x7FFE,
+    (q15_t)0x7FFF
+};
+
+/**
+  @brief         Initialization function for the Q15 real FFT (Cortex-M0+ variant).
+  @param[in,out] S           points to an instance of the Q15 real FFT structure
+  @param[in]     fftLenReal  length of the real FFT, 64, 128, 256 or 512
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLenReal</code> is not a supported length
+ */
+
+ARM_DSP_ATTRIBUTE arm_status arm_rfft_m0_init_q15(
+  arm_rfft_m0_instance_q15 * S,
+  uint32_t fftLenReal)
+{
+  /* Supported lengths are the powers of 2 from 64 to 512 */
+  if ((fftLenReal < 64U) || (fftLenReal > (4U * ARM_RFFT_M0_Q15_SINE_TABLE_LEN)) ||
+      ((fftLenReal & (fftLenReal - 1U)) != 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Initialize the real FFT length */
+  S->fftLenReal = (uint16_t) fftLenReal;
+
+  /* Sine table index step for the angle 2 * pi / fftLenReal */
+  S->twidCoefModifier = (uint16_t) ((4U * ARM_RFFT_M0_Q15_SINE_TABLE_LEN) / fftLenReal);
+
+  /* Initialize the sine table pointer */
+  S->pSineTable = arm_rfft_m0_sine_table_q15;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of RealFFTQ15M0 group
+ */
@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_m0_mag_q15.c
+ * Description:  Magnitude spectrum of the Q15 real FFT tuned for Cortex-M0+
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M0 and Cortex-M0+ cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+
+/**
+  @brief         Integer square root, rounded down.
+  @param[in]     value  input value
+  @return        square root of the input value
+ */
+__STATIC_FORCEINLINE uint32_t arm_rfft_m0_sqrt_u32(
+  uint32_t value)
+{
+  uint32_t root = 0U;
+  uint32_t bit = 1UL << 30U;
+
+  while (bit > value)
+  {
+    bit >>= 2U;
+  }
+
+  /* One result bit per iteration, with shifts and subtractions only */
+  while (bit != 0U)
+  {
+    if (value >= (root + bit))
+    {
+      value -= root + bit;
+      root = (root >> 1U) + bit;
+    }
+    else
+    {
+      root >>= 1U;
+    }
+
+    bit >>= 2U;
+  }
+
+  return (root);
+}
+
+/**
+  @addtogroup RealFFTQ15M0
+  @{
+ */
+
+/**
+  @brief         Magnitude spectrum of the output of \ref arm_rfft_m0_q15().
+  @param[in]     S          points to an instance of the Q15 real FFT structure
+  @param[in]     pSpectrum  points to the packed spectrum
+  @param[out]    pMag       points to the fftLenReal / 2 + 1 magnitude values, from DC to the Nyquist frequency
+
+  @par           Scaling
+                   The magnitude is in the 1.15 format of the spectrum, saturated to 0x7FFF.
+                   The square root is an integer one without division or multiplication.
+ */
+
+ARM_DSP_ATTRIBUTE void arm_rfft_m0_mag_q15(
+  const arm_rfft_m0_instance_q15 * S,
+  const q15_t * pSpectrum,
+        q15_t * pMag)
+{
+  uint32_t L = (uint32_t) S->fftLenReal >> 1U;         /* Number of bins between DC and the Nyquist frequency */
+  uint32_t k;                                          /* Loop counter */
+  uint32_t root;                                       /* Magnitude */
+  q31_t re, im;                                        /* Real and imaginary parts */
+
+  /* DC and Nyquist bins are real */
+  re = pSpectrum[0];
+  im = pSpectrum[1];
+  pMag[0] = (q15_t) __SSAT((re < 0) ? -re : re, 16);
+  pMag[L] = (q15_t) __SSAT((im < 0) ? -im : im, 16);
+
+  for (k = 1U; k < L; k++)
+  {
+    re = pSpectrum[2U * k];
+    im = pSpectrum[(2U * k) + 1U];
+
+    /* sqrt of the 2.30 power is the 1.15 magnitude */
+    root = arm_rfft_m0_sqrt_u32((uint32_t) (re * re) + (uint32_t) (im * im));
+    pMag[k] = (q15_t) ((root > 0x7FFFU) ? 0x7FFFU : root);
+  }
+}
+
+/**
+  @} end of RealFFTQ15M0 group
+ */
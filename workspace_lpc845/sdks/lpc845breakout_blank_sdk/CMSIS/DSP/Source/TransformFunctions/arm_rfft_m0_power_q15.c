@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_m0_power_q15.c
+ * Description:  Power spectrum of the Q15 real FFT tuned for Cortex-M0+
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M0 and Cortex-M0+ cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+
+/**
+  @addtogroup RealFFTQ15M0
+  @{
+ */
+
+/**
+  @brief         Power spectrum of the output of \ref arm_rfft_m0_q15().
+  @param[in]     S          points to an instance of the Q15 real FFT structure
+  @param[in]     pSpectrum  points to the packed spectrum
+  @param[out]    pPower     points to the fftLenReal / 2 + 1 power values, from DC to the Nyquist frequency
+
+  @par           Scaling
+                   The squares of the 1.15 real and imaginary parts are added without loss in 2.30 format.
+                   The result saturates only when both parts are -1.
+ */
+
+ARM_DSP_ATTRIBUTE void arm_rfft_m0_power_q15(
+  const arm_rfft_m0_instance_q15 * S,
+  const q15_t * pSpectrum,
+        q31_t * pPower)
+{
+  uint32_t L = (uint32_t) S->fftLenReal >> 1U;         /* Number of bins between DC and the Nyquist frequency */
+  uint32_t k;                                          /* Loop counter */
+  uint32_t acc;                                        /* Sum of squares */
+  q31_t re, im;                                        /* Real and imaginary parts */
+
+  /* DC and Nyquist bins are real */
+  re = pSpectrum[0];
+  im = pSpectrum[1];
+  pPower[0] = re * re;
+  pPower[L] = im * im;
+
+  for (k = 1U; k < L; k++)
+  {
+    re = pSpectrum[2U * k];
+    im = pSpectrum[(2U * k) + 1U];
+
+    acc = (uint32_t) (re * re) + (uint32_t) (im * im);
+    pPower[k] = (acc > (uint32_t) INT32_MAX) ? INT32_MAX : (q31_t) acc;
+  }
+}
+
+/**
+  @} end of RealFFTQ15M0 group
+ */
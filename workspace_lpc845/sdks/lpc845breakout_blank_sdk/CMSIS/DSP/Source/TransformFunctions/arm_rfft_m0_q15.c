@@ -0,0 +1,258 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_m0_q15.c
+ * Description:  Q15 real FFT tuned for Cortex-M0+
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M0 and Cortex-M0+ cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @brief         Twiddle factor cos(a) - j sin(a) for the angle a = 2 * pi * index / 512.
+  @param[in]     pSine   points to the quarter-wave sine table
+  @param[in]     index   angle index, 0 to 255
+  @param[out]    pCos    cos(a) in 1.15 format
+  @param[out]    pSin    sin(a) in 1.15 format
+ */
+__STATIC_FORCEINLINE void arm_rfft_m0_twiddle_q15(
+  const q15_t * pSine,
+        uint32_t index,
+        q31_t * pCos,
+        q31_t * pSin)
+{
+  if (index <= ARM_RFFT_M0_Q15_SINE_TABLE_LEN)
+  {
+    *pSin = pSine[index];
+    *pCos = pSine[ARM_RFFT_M0_Q15_SINE_TABLE_LEN - index];
+  }
+  else
+  {
+    *pSin = pSine[(2U * ARM_RFFT_M0_Q15_SINE_TABLE_LEN) - index];
+    *pCos = -(q31_t) pSine[index - ARM_RFFT_M0_Q15_SINE_TABLE_LEN];
+  }
+}
+
+/**
+  @brief         In-place radix-2 complex FFT scaled by 1 / (2 * fftLen).
+  @param[in]     pSine    points to the quarter-wave sine table
+  @param[in,out] pData    points to fftLen complex values
+  @param[in]     fftLen   length of the complex FFT, 32 to 256
+ */
+static void arm_cfft_m0_q15(
+  const q15_t * pSine,
+        q15_t * pData,
+        uint32_t fftLen)
+{
+  uint32_t i, j, k, m, h, step;                        /* Loop counters and indexes */
+  q31_t x0r, x0i, x1r, x1i, x2r, x2i, x3r, x3i;        /* Temporary variables for the radix-4 pass */
+  q31_t ar, ai, br, bi, tr, ti;                        /* Temporary variables for the butterflies */
+  q31_t c, s;                                          /* Twiddle factor */
+  q15_t *pA, *pB;                                      /* Butterfly pointers */
+
+  /* Bit reversal permutation, the reversed index j is counted along with i */
+  j = 0U;
+
+  for (i = 0U; i < (fftLen - 1U); i++)
+  {
+    if (i < j)
+    {
+      ar = pData[2U * i];
+      ai = pData[(2U * i) + 1U];
+      pData[2U * i]        = pData[2U * j];
+      pData[(2U * i) + 1U] = pData[(2U * j) + 1U];
+      pData[2U * j]        = (q15_t) ar;
+      pData[(2U * j) + 1U] = (q15_t) ai;
+    }
+
+    k = fftLen >> 1U;
+
+    while (k <= j)
+    {
+      j -= k;
+      k >>= 1U;
+    }
+
+    j += k;
+  }
+
+  /* The first two stages as one radix-4 pass, the twiddles are 1 and -j so no multiplication is needed.
+   * The pass scales by 1/8, the magnitudes stay below 1/sqrt(2) for any 1.15 real input. */
+  pA = pData;
+
+  for (i = fftLen >> 2U; i > 0U; i--)
+  {
+    x0r = (q31_t) pA[0] + pA[2];
+    x0i = (q31_t) pA[1] + pA[3];
+    x1r = (q31_t) pA[0] - pA[2];
+    x1i = (q31_t) pA[1] - pA[3];
+    x2r = (q31_t) pA[4] + pA[6];
+    x2i = (q31_t) pA[5] + pA[7];
+    x3r = (q31_t) pA[4] - pA[6];
+    x3i = (q31_t) pA[5] - pA[7];
+
+    pA[0] = (q15_t) ((x0r + x2r) >> 3);
+    pA[1] = (q15_t) ((x0i + x2i) >> 3);
+    pA[2] = (q15_t) ((x1r + x3i) >> 3);
+    pA[3] = (q15_t) ((x1i - x3r) >> 3);
+    pA[4] = (q15_t) ((x0r - x2r) >> 3);
+    pA[5] = (q15_t) ((x0i - x2i) >> 3);
+    pA[6] = (q15_t) ((x1r - x3i) >> 3);
+    pA[7] = (q15_t) ((x1i + x3r) >> 3);
+
+    pA += 8U;
+  }
+
+  /* Remaining radix-2 stages, scaled by 1/2 each. The twiddle factor is looked up once per butterfly column. */
+  for (m = 8U; m <= fftLen; m <<= 1U)
+  {
+    h = m >> 1U;
+    step = (4U * ARM_RFFT_M0_Q15_SINE_TABLE_LEN) / m;
+
+    /* Twiddle factor 1 */
+    for (k = 0U; k < fftLen; k += m)
+    {
+      pA = &pData[2U * k];
+      pB = &pData[2U * (k + h)];
+
+      ar = pA[0];
+      ai = pA[1];
+      br = pB[0];
+      bi = pB[1];
+
+      pA[0] = (q15_t) ((ar + br) >> 1);
+      pA[1] = (q15_t) ((ai + bi) >> 1);
+      pB[0] = (q15_t) ((ar - br) >> 1);
+      pB[1] = (q15_t) ((ai - bi) >> 1);
+    }
+
+    for (j = 1U; j < h; j++)
+    {
+      arm_rfft_m0_twiddle_q15(pSine, j * step, &c, &s);
+
+      for (k = j; k < fftLen; k += m)
+      {
+        pA = &pData[2U * k];
+        pB = &pData[2U * (k + h)];
+
+        /* t = b * (c - js), 2.30 format */
+        br = pB[0];
+        bi = pB[1];
+        tr = (c * br) + (s * bi);
+        ti = (c * bi) - (s * br);
+
+        ar = (q31_t) pA[0] << 15;
+        ai = (q31_t) pA[1] << 15;
+
+        pA[0] = (q15_t) ((ar + tr) >> 16);
+        pA[1] = (q15_t) ((ai + ti) >> 16);
+        pB[0] = (q15_t) ((ar - tr) >> 16);
+        pB[1] = (q15_t) ((ai - ti) >> 16);
+      }
+    }
+  }
+}
+
+/**
+  @addtogroup RealFFTQ15M0
+  @{
+ */
+
+/**
+  @brief         In-place processing function for the Q15 real FFT (Cortex-M0+ variant).
+  @param[in]     S      points to an instance of the Q15 real FFT structure
+  @param[in,out] pData  points to fftLenReal input samples in 1.15 format, replaced by the packed spectrum
+
+  @par           Output format
+                   The spectrum X[k] of the N = fftLenReal input samples is divided by N, so no bin can overflow, and
+                   packed in the N input samples as for \ref arm_rfft_fast_f32():
+                   pData[0] is X[0], pData[1] is X[N/2], both real, then pData[2k] and pData[2k + 1] are the real and
+                   imaginary parts of X[k] for k = 1 to N/2 - 1. Multiply by N, or shift left by log2(N) bits, to get
+                   the unscaled spectrum.
+
+  @par           Scaling and precision
+                   The scaling is spread over the stages, every intermediate result is truncated to 1.15 format.
+                   The error on a bin stays below 10 LSB up to 512 points, small signals lose log2(N) bits of
+                   resolution as with \ref arm_rfft_q15().
+
+  @par           Memory
+                   The transform works in place and uses only the 258 byte sine table shared by all lengths.
+ */
+
+ARM_DSP_ATTRIBUTE void arm_rfft_m0_q15(
+  const arm_rfft_m0_instance_q15 * S,
+        q15_t * pData)
+{
+  uint32_t L = (uint32_t) S->fftLenReal >> 1U;         /* Length of the complex FFT */
+  uint32_t k;                                          /* Loop counter */
+  q31_t ar, ai, br, bi;                                /* Bins k and L - k of the complex FFT */
+  q31_t er, ei, tr, ti;                                /* Ze and W * Zo, 2.30 format */
+  q31_t sre, sim, dre, dim;                            /* Sum and difference of the bins */
+  q31_t c, s;                                          /* Twiddle factor */
+
+  /* Complex FFT of the even and odd samples packed as L complex values, scaled by 1/N */
+  arm_cfft_m0_q15(S->pSineTable, pData, L);
+
+  /* X[0] and X[N/2] are real, they share the first bin */
+  ar = pData[0];
+  ai = pData[1];
+  pData[0] = (q15_t) __SSAT(ar + ai, 16);
+  pData[1] = (q15_t) __SSAT(ar - ai, 16);
+
+  /* Split step, bins k and L - k are computed together:
+   * X[k]     =       Ze + W * Zo
+   * X[L - k] = conj(Ze - W * Zo)
+   * with Ze = (Z[k] + conj(Z[L - k])) / 2, Zo = -j (Z[k] - conj(Z[L - k])) / 2 and W = exp(-j 2 ti k / N) */
+  for (k = 1U; k < (L >> 1U); k++)
+  {
+    ar = pData[2U * k];
+    ai = pData[(2U * k) + 1U];
+    br = pData[2U * (L - k)];
+    bi = pData[(2U * (L - k)) + 1U];
+
+    sre = ar + br;
+    sim = ai - bi;
+    dre = ar - br;
+    dim = ai + bi;
+
+    arm_rfft_m0_twiddle_q15(S->pSineTable, k * S->twidCoefModifier, &c, &s);
+
+    /* Ze and W * Zo in 2.30 format */
+    er = sre << 14;
+    ei = sim << 14;
+    tr = ((c * dim) >> 1) - ((s * dre) >> 1);
+    ti = -((c * dre) >> 1) - ((s * dim) >> 1);
+
+    pData[2U * k]              = (q15_t) __SSAT((er + tr) >> 15, 16);
+    pData[(2U * k) + 1U]       = (q15_t) __SSAT((ei + ti) >> 15, 16);
+    pData[2U * (L - k)]        = (q15_t) __SSAT((er - tr) >> 15, 16);
+    pData[(2U * (L - k)) + 1U] = (q15_t) __SSAT((ti - ei) >> 15, 16);
+  }
+
+  /* X[N/4] is the conjugate of Z[L/2] */
+  pData[L + 1U] = (q15_t) __SSAT(-(q31_t) pData[L + 1U], 16);
+}
+
+/**
+  @} end of RealFFTQ15M0 group
+ */
@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        cmsis_compiler.h
+ * Description:  Host replacement of the CMSIS compiler header for the host tests
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * The CMSIS compiler header needs the ARM C language extensions. The host tests build the library sources as for a
+ * core without DSP extension, which only needs the few intrinsics below.
+ */
+
+#ifndef CMSIS_COMPILER_H
+#define CMSIS_COMPILER_H
+
+#include <stdint.h>
+
+#define __STATIC_FORCEINLINE static inline __attribute__((always_inline))
+#define __STATIC_INLINE      static inline
+#define __ALIGNED(x)         __attribute__((aligned(x)))
+#define __PACKED             __attribute__((packed))
+#define __RESTRICT           __restrict
+#define __INLINE             inline
+
+#define __UNALIGNED_UINT32_READ(ptr) (*(const uint32_t *)(ptr))
+
+__STATIC_INLINE int32_t __SSAT(int32_t val, uint32_t sat)
+{
+  int32_t max = (int32_t)((1U << (sat - 1U)) - 1U);
+  int32_t min = -max - 1;
+
+  return (val > max) ? max : ((val < min) ? min : val);
+}
+
+__STATIC_INLINE uint32_t __USAT(int32_t val, uint32_t sat)
+{
+  int32_t max = (int32_t)((1U << sat) - 1U);
+
+  return (uint32_t)((val > max) ? max : ((val < 0) ? 0 : val));
+}
+
+__STATIC_INLINE uint8_t __CLZ(uint32_t value)
+{
+  return (value == 0U) ? 32U : (uint8_t)__builtin_clz(value);
+}
+
+#endif /* CMSIS_COMPILER_H */
@@ -0,0 +1,210 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        fft_tables_pruned_test.c
+ * Description:  Host link test of the library with the FFT tables pruned
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Build and run from this directory, with the tables of a single transform generated as CONFIG_CMSIS_DSP_FFT_TABLES
+ * would:
+ *   python3 ../Scripts/gen_fft_tables.py -o arm_fft_tables.c cfft_q15_128 > arm_fft_tables.defines && \
+ *   gcc -O2 -I. -I../Include -I../PrivateInclude $(sed 's/^/-D/' arm_fft_tables.defines) -o fft_tables_pruned_test \
+ *       fft_tables_pruned_test.c arm_fft_tables.c -lm && ./fft_tables_pruned_test
+ *
+ * Only the generated file defines tables, so the test links only if it holds the tables of the functions below that
+ * are not FFT functions: the sine, cosine, square root and reciprocal functions and the normalized LMS init. Their
+ * results are compared with the C library, which checks the generated values. arm_rfft_q15 of 256 points, on the
+ * listed cfft_q15_128, is compared with a double precision DFT divided by N within the rounding of its scaled stages,
+ * and its generic init must refuse a length whose tables were pruned. The exit code is 0 on success.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../Source/FastMathFunctions/arm_sin_f32.c"
+#include "../Source/FastMathFunctions/arm_sin_q15.c"
+#include "../Source/FastMathFunctions/arm_sin_q31.c"
+#include "../Source/FastMathFunctions/arm_cos_q15.c"
+#include "../Source/FastMathFunctions/arm_sqrt_q15.c"
+#include "../Source/FastMathFunctions/arm_sqrt_q31.c"
+#include "../Source/FilteringFunctions/arm_lms_norm_init_q15.c"
+#include "../Source/BasicMathFunctions/arm_shift_q15.c"
+#include "../Source/TransformFunctions/arm_bitreversal.c"
+#include "../Source/TransformFunctions/arm_bitreversal2.c"
+#include "../Source/TransformFunctions/arm_cfft_q15.c"
+#include "../Source/TransformFunctions/arm_cfft_radix4_q15.c"
+#include "../Source/TransformFunctions/arm_cfft_init_q15.c"
+#include "../Source/TransformFunctions/arm_rfft_init_q15.c"
+#include "../Source/TransformFunctions/arm_rfft_q15.c"
+
+#define TEST_STEPS    (10000U)
+#define TEST_RFFT_LEN (256U)
+#define TEST_PI       (3.14159265358979323846)
+
+static int testFailures;
+
+static void TestCheck(const char *name, double error, double limit)
+{
+  printf("%-26s max error %12.3e, limit %9.3e\n", name, error, limit);
+  if (!(error <= limit))
+  {
+    printf("FAIL: %s\n", name);
+    testFailures++;
+  }
+}
+
+static double TestMax(double a, double b)
+{
+  return (a > b) ? a : b;
+}
+
+/* Over a period, the errors in the unit of the output format. The fixed-point functions interpolate linearly and
+ * truncate the products, a few LSB of q15 and about 2e-5 of full scale are their own error, a wrong table entry
+ * exceeds it. */
+static void TestSinCos(void)
+{
+  double sinF32 = 0.0;
+  double sinQ15 = 0.0;
+  double cosQ15 = 0.0;
+  double sinQ31 = 0.0;
+
+  for (uint32_t i = 0U; i < TEST_STEPS; i++)
+  {
+    double x     = (double)i / (double)TEST_STEPS;
+    q15_t xQ15   = (q15_t)(x * 32768.0);
+    q31_t xQ31   = (q31_t)(x * 2147483648.0);
+    double angle = 2.0 * TEST_PI * x;
+
+    sinF32 = TestMax(sinF32, fabs(arm_sin_f32((float32_t)angle) - sin(angle)));
+    sinQ15 = TestMax(sinQ15, fabs(arm_sin_q15(xQ15) - sin(2.0 * TEST_PI * xQ15 / 32768.0) * 32768.0));
+    cosQ15 = TestMax(cosQ15, fabs(arm_cos_q15(xQ15) - cos(2.0 * TEST_PI * xQ15 / 32768.0) * 32768.0));
+    sinQ31 = TestMax(sinQ31, fabs(arm_sin_q31(xQ31) - sin(2.0 * TEST_PI * xQ31 / 2147483648.0) * 2147483648.0));
+  }
+  TestCheck("arm_sin_f32", sinF32, 2e-5);
+  TestCheck("arm_sin_q15 (LSB)", sinQ15, 6.0);
+  TestCheck("arm_cos_q15 (LSB)", cosQ15, 6.0);
+  TestCheck("arm_sin_q31 (LSB)", sinQ31, 65536.0);
+}
+
+static void TestSqrtRecip(void)
+{
+  double sqrtQ15  = 0.0;
+  double sqrtQ31  = 0.0;
+  double recipQ31 = 0.0;
+  double recipQ15 = 0.0;
+
+  for (uint32_t i = 1U; i < TEST_STEPS; i++)
+  {
+    double x   = (double)i / (double)TEST_STEPS;
+    q15_t xQ15 = (q15_t)(x * 32768.0);
+    q31_t xQ31 = (q31_t)(x * 2147483648.0);
+    q15_t outQ15;
+    q31_t outQ31;
+    uint32_t shift;
+
+    (void)arm_sqrt_q15(xQ15, &outQ15);
+    sqrtQ15 = TestMax(sqrtQ15, fabs(outQ15 - sqrt(xQ15 / 32768.0) * 32768.0));
+    (void)arm_sqrt_q31(xQ31, &outQ31);
+    sqrtQ31 = TestMax(sqrtQ31, fabs(outQ31 - sqrt(xQ31 / 2147483648.0) * 2147483648.0));
+
+    /* The reciprocal is returned with its exponent, the error is relative */
+    shift    = arm_recip_q31(xQ31, &outQ31, armRecipTableQ31);
+    recipQ31 = TestMax(recipQ31, fabs((outQ31 / 2147483648.0) * (double)(1UL << shift) * (xQ31 / 2147483648.0) - 1.0));
+    shift    = arm_recip_q15(xQ15, &outQ15, armRecipTableQ15);
+    recipQ15 = TestMax(recipQ15, fabs((outQ15 / 32768.0) * (double)(1UL << shift) * (xQ15 / 32768.0) - 1.0));
+  }
+  TestCheck("arm_sqrt_q15 (LSB)", sqrtQ15, 8.0);
+  TestCheck("arm_sqrt_q31 (LSB)", sqrtQ31, 8.0);
+  TestCheck("arm_recip_q31 (relative)", recipQ31, 1e-8);
+  TestCheck("arm_recip_q15 (relative)", recipQ15, 1e-3);
+}
+
+static void TestLmsNormInit(void)
+{
+  static q15_t coeffs[8];
+  static q15_t state[8 + 16 - 1];
+  arm_lms_norm_instance_q15 lms;
+
+  arm_lms_norm_init_q15(&lms, 8U, coeffs, state, 0x1000, 16U, 0U);
+  printf("arm_lms_norm_init_q15      reciprocal table %s\n",
+         (lms.recipTable == armRecipTableQ15) ? "armRecipTableQ15" : "wrong");
+  if (lms.recipTable != armRecipTableQ15)
+  {
+    testFailures++;
+  }
+}
+
+static void TestRfft(void)
+{
+  static q15_t input[TEST_RFFT_LEN];
+  static q15_t buffer[TEST_RFFT_LEN];
+  static q15_t output[2U * TEST_RFFT_LEN];
+  arm_rfft_instance_q15 rfft;
+  double error = 0.0;
+  uint32_t seed = 1U;
+
+  for (uint32_t n = 0U; n < TEST_RFFT_LEN; n++)
+  {
+    seed     = (seed * 1103515245U) + 12345U;
+    input[n] = (q15_t)((int32_t)((seed >> 8U) & 0xFFFFU) - 32768) / 2;
+  }
+  if ((ARM_MATH_SUCCESS != arm_rfft_init_q15(&rfft, TEST_RFFT_LEN, 0U, 1U)) ||
+      (ARM_MATH_ARGUMENT_ERROR != arm_rfft_init_q15(&rfft, 2U * TEST_RFFT_LEN, 0U, 1U)))
+  {
+    printf("FAIL: arm_rfft_init_q15 does not follow the listed transforms\n");
+    testFailures++;
+    return;
+  }
+  (void)arm_rfft_init_q15(&rfft, TEST_RFFT_LEN, 0U, 1U);
+  /* The input buffer is modified by the transform */
+  (void)memcpy(buffer, input, sizeof(buffer));
+  arm_rfft_q15(&rfft, buffer, output);
+  for (uint32_t k = 0U; k <= (TEST_RFFT_LEN / 2U); k++)
+  {
+    double re = 0.0;
+    double im = 0.0;
+
+    for (uint32_t n = 0U; n < TEST_RFFT_LEN; n++)
+    {
+      re += input[n] * cos(2.0 * TEST_PI * k * n / TEST_RFFT_LEN);
+      im -= input[n] * sin(2.0 * TEST_PI * k * n / TEST_RFFT_LEN);
+    }
+    error = TestMax(error, fabs(output[2U * k] - re / TEST_RFFT_LEN));
+    error = TestMax(error, fabs(output[(2U * k) + 1U] - im / TEST_RFFT_LEN));
+  }
+  TestCheck("arm_rfft_q15 256 (LSB)", error, 16.0);
+}
+
+int main(void)
+{
+  TestSinCos();
+  TestSqrtRecip();
+  TestLmsNormInit();
+  TestRfft();
+
+  printf("%s\n", (testFailures == 0) ? "PASS" : "FAIL");
+  return (testFailures == 0) ? 0 : 1;
+}
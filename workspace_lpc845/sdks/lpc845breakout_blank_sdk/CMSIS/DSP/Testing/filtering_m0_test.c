@@ -0,0 +1,241 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        filtering_m0_test.c
+ * Description:  Host test of the Cortex-M0+ biquad kernel
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Build and run from this directory:
+ *   gcc -O2 -I. -I../Include -I../PrivateInclude -o filtering_m0_test filtering_m0_test.c && ./filtering_m0_test
+ *
+ * arm_biquad_cascade_df1_m0_q15() runs next to arm_biquad_cascade_df1_fast_q15() on random filters, block sizes and
+ * input blocks, with the same instance structure, and must give the same output and state. Then both are timed on the
+ * host with clock_gettime(CLOCK_MONOTONIC): they filter the same block of 40 samples with the same 2 stages, in 25
+ * alternating rounds of 2000 calls, and the best round of each is printed. The FIR and decimator kernels written
+ * for Cortex-M0+ were not faster than their fast variants this way and have been removed. The exit code is 0 on
+ * success.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "../Source/FilteringFunctions/arm_biquad_cascade_df1_init_q15.c"
+#include "../Source/FilteringFunctions/arm_biquad_cascade_df1_fast_q15.c"
+#include "../Source/FilteringFunctions/arm_biquad_cascade_df1_m0_q15.c"
+
+#define TEST_RUNS       (3000U)
+#define TEST_BLOCKS     (4U)
+#define TEST_MAX_BLOCK  (40U)
+#define TEST_MAX_STAGES (3U)
+
+#define TEST_BENCH_RUNS   (2000U)
+#define TEST_BENCH_ROUNDS (25U)
+#define TEST_BENCH_BLOCK  (40U)
+#define TEST_BENCH_STAGES (2U)
+
+/* Largest deviation seen per kernel, in LSB of the output */
+typedef struct
+{
+  const char *name;
+  int64_t worst;
+  uint32_t failures;
+} test_result_t;
+
+static uint32_t testSeed = 1U;
+
+static uint32_t TestRandom(void)
+{
+  testSeed = (testSeed * 1103515245U) + 12345U;
+  return (testSeed >> 16U) | (testSeed << 16U);
+}
+
+/* Random q31 value scaled down by shift bits */
+static q31_t TestRandomQ31(uint32_t shift)
+{
+  return (q31_t)((TestRandom() << 16U) ^ TestRandom()) >> shift;
+}
+
+/* Records fast - m0 and checks it is within [minDiff, maxDiff] */
+static void TestCompare(test_result_t *result, int64_t fast, int64_t m0, int64_t minDiff, int64_t maxDiff)
+{
+  int64_t diff = fast - m0;
+  int64_t dev = (diff < 0) ? -diff : diff;
+
+  if (dev > result->worst)
+  {
+    result->worst = dev;
+  }
+  if ((diff < minDiff) || (diff > maxDiff))
+  {
+    if (result->failures < 5U)
+    {
+      printf("FAIL: %s: fast %lld, m0 %lld\n", result->name, (long long)fast, (long long)m0);
+    }
+    result->failures++;
+  }
+}
+
+static void TestBiquadQ15(test_result_t *result)
+{
+  q15_t coeffs[6U * TEST_MAX_STAGES];
+  q15_t stateFast[4U * TEST_MAX_STAGES], stateM0[4U * TEST_MAX_STAGES];
+  q15_t src[TEST_MAX_BLOCK], dstFast[TEST_MAX_BLOCK], dstM0[TEST_MAX_BLOCK];
+
+  for (uint32_t run = 0U; run < TEST_RUNS; run++)
+  {
+    arm_biquad_casd_df1_inst_q15 fast, m0;
+    uint32_t numStages = 1U + (TestRandom() % TEST_MAX_STAGES);
+    uint32_t blockSize = 1U + (TestRandom() % TEST_MAX_BLOCK);
+
+    /* Low pass sections with random stable feedback, {b0, 0, b1, b2, a1, a2} with a postShift of 1 */
+    for (uint32_t stage = 0U; stage < numStages; stage++)
+    {
+      coeffs[(6U * stage) + 0U] = 4000;
+      coeffs[(6U * stage) + 1U] = 0;
+      coeffs[(6U * stage) + 2U] = 8000;
+      coeffs[(6U * stage) + 3U] = 4000;
+      coeffs[(6U * stage) + 4U] = (q15_t)TestRandomQ31(19U);
+      coeffs[(6U * stage) + 5U] = (q15_t)(-(int32_t)(TestRandom() % 8000U));
+    }
+    memset(stateFast, 0, sizeof(stateFast));
+    memset(stateM0, 0, sizeof(stateM0));
+    arm_biquad_cascade_df1_init_q15(&fast, (uint8_t)numStages, coeffs, stateFast, 1);
+    arm_biquad_cascade_df1_init_q15(&m0, (uint8_t)numStages, coeffs, stateM0, 1);
+
+    for (uint32_t block = 0U; block < TEST_BLOCKS; block++)
+    {
+      for (uint32_t i = 0U; i < blockSize; i++)
+      {
+        src[i] = (q15_t)(TestRandomQ31(19U));
+      }
+      arm_biquad_cascade_df1_fast_q15(&fast, src, dstFast, blockSize);
+      arm_biquad_cascade_df1_m0_q15(&m0, src, dstM0, blockSize);
+
+      for (uint32_t i = 0U; i < blockSize; i++)
+      {
+        TestCompare(result, dstFast[i], dstM0[i], 0, 0);
+      }
+    }
+    for (uint32_t i = 0U; i < (4U * numStages); i++)
+    {
+      TestCompare(result, stateFast[i], stateM0[i], 0, 0);
+    }
+  }
+}
+
+/* Instance and buffers shared by the two kernels, so both run with the same settings */
+static arm_biquad_casd_df1_inst_q15 benchBiquad;
+static q15_t benchCoeffs[6U * TEST_BENCH_STAGES];
+static q15_t benchState[4U * TEST_BENCH_STAGES];
+static q15_t benchSrc[TEST_BENCH_BLOCK];
+static q15_t benchDst[TEST_BENCH_BLOCK];
+
+static void TestBenchFast(void)
+{
+  arm_biquad_cascade_df1_fast_q15(&benchBiquad, benchSrc, benchDst, TEST_BENCH_BLOCK);
+}
+
+static void TestBenchM0(void)
+{
+  arm_biquad_cascade_df1_m0_q15(&benchBiquad, benchSrc, benchDst, TEST_BENCH_BLOCK);
+}
+
+static uint64_t TestNowNs(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+/* Time of a block over TEST_BENCH_RUNS calls, in ns */
+static double TestBenchTime(void (*kernel)(void))
+{
+  uint64_t start = TestNowNs();
+
+  for (uint32_t run = 0U; run < TEST_BENCH_RUNS; run++)
+  {
+    kernel();
+  }
+  return (double)(TestNowNs() - start) / (double)TEST_BENCH_RUNS;
+}
+
+/* Host time of the _m0 kernel against the stock fast variant on the same instance and block */
+static void TestBench(void)
+{
+  double fast = 0.0;
+  double m0 = 0.0;
+
+  for (uint32_t i = 0U; i < TEST_BENCH_BLOCK; i++)
+  {
+    benchSrc[i] = (q15_t)(TestRandomQ31(18U));
+  }
+  /* Low pass sections as in TestBiquadQ15() */
+  for (uint32_t stage = 0U; stage < TEST_BENCH_STAGES; stage++)
+  {
+    benchCoeffs[(6U * stage) + 0U] = 4000;
+    benchCoeffs[(6U * stage) + 1U] = 0;
+    benchCoeffs[(6U * stage) + 2U] = 8000;
+    benchCoeffs[(6U * stage) + 3U] = 4000;
+    benchCoeffs[(6U * stage) + 4U] = 12000;
+    benchCoeffs[(6U * stage) + 5U] = -4000;
+  }
+  arm_biquad_cascade_df1_init_q15(&benchBiquad, TEST_BENCH_STAGES, benchCoeffs, benchState, 1);
+
+  /* The two kernels take turns and the best round of each counts, which filters out the other load of the host */
+  for (uint32_t round = 0U; round < TEST_BENCH_ROUNDS; round++)
+  {
+    double time = TestBenchTime(TestBenchFast);
+
+    fast = ((round == 0U) || (time < fast)) ? time : fast;
+    time = TestBenchTime(TestBenchM0);
+    m0 = ((round == 0U) || (time < m0)) ? time : m0;
+  }
+  printf("Host time per block of %u samples and %u stages: %.1f ns, fast variant %.1f ns, %.2f times\n",
+         TEST_BENCH_BLOCK, TEST_BENCH_STAGES, m0, fast, fast / m0);
+}
+
+int main(void)
+{
+  test_result_t results[] = {
+    {"arm_biquad_cascade_df1_m0_q15", 0, 0U},
+  };
+  uint32_t failures = 0U;
+
+  TestBiquadQ15(&results[0]);
+
+  for (uint32_t i = 0U; i < (sizeof(results) / sizeof(results[0])); i++)
+  {
+    printf("%-44s worst deviation %3lld LSB, %u failures\n", results[i].name, (long long)results[i].worst,
+           results[i].failures);
+    failures += results[i].failures;
+  }
+
+  TestBench();
+
+  printf("%s\n", (failures == 0U) ? "PASS" : "FAIL");
+  return (failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,337 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        rfft_m0_test.c
+ * Description:  Host test of the Cortex-M0+ Q15 real FFT
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Build and run from this directory, with the tables arm_rfft_q15 needs for the same lengths generated as
+ * CONFIG_CMSIS_DSP_FFT_TABLES would:
+ *   python3 ../Scripts/gen_fft_tables.py -o arm_fft_tables.c cfft_q15_32 cfft_q15_64 cfft_q15_128 cfft_q15_256 \
+ *       > arm_fft_tables.defines && \
+ *   gcc -O2 -I. -I../Include -I../PrivateInclude $(sed 's/^/-D/' arm_fft_tables.defines) -o rfft_m0_test \
+ *       rfft_m0_test.c arm_fft_tables.c -lm && ./rfft_m0_test
+ *
+ * arm_rfft_m0_q15() is compared with a double precision DFT divided by N on full scale, sine and random inputs, for
+ * every supported length. The worst bin error must stay below the 10 LSB documented on the function. The magnitude
+ * and power helpers are checked against the exact values of the spectrum.
+ *
+ * It is then compared with arm_rfft_q15(), whose output has the same scale for these lengths. Both transform the same
+ * random blocks: the worst bin error of each is printed, and the host time of each is measured with
+ * clock_gettime(CLOCK_MONOTONIC) as the best of alternating rounds, copy of the input included as both overwrite it.
+ * The table bytes are those each one links for a length: the quarter-wave sine table for arm_rfft_m0_q15(), the
+ * twiddle and bit reversal tables of the CFFT of N/2 points plus realCoefAQ15 and realCoefBQ15 for arm_rfft_q15().
+ * The exit code is 0 on success.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "../Source/TransformFunctions/arm_rfft_m0_init_q15.c"
+#include "../Source/TransformFunctions/arm_rfft_m0_q15.c"
+#include "../Source/TransformFunctions/arm_rfft_m0_mag_q15.c"
+#include "../Source/TransformFunctions/arm_rfft_m0_power_q15.c"
+#include "../Source/BasicMathFunctions/arm_shift_q15.c"
+#include "../Source/TransformFunctions/arm_bitreversal.c"
+#include "../Source/TransformFunctions/arm_bitreversal2.c"
+#include "../Source/TransformFunctions/arm_cfft_q15.c"
+#include "../Source/TransformFunctions/arm_cfft_radix4_q15.c"
+#include "../Source/TransformFunctions/arm_cfft_init_q15.c"
+#include "../Source/TransformFunctions/arm_rfft_init_q15.c"
+#include "../Source/TransformFunctions/arm_rfft_q15.c"
+
+#define TEST_MAX_LEN    (512U)
+#define TEST_TRIALS     (300U)
+#define TEST_MAX_ERROR  (10.0)
+#define TEST_BENCH_RUNS (20000U)
+
+#define TEST_COMPARE_BLOCKS (50U)
+#define TEST_COMPARE_RUNS   (2000U)
+#define TEST_COMPARE_ROUNDS (25U)
+
+/* Tables linked by arm_rfft_q15() for each length besides realCoefAQ15 and realCoefBQ15 */
+static const struct
+{
+  uint32_t fftLen;
+  uint32_t twiddleBytes;
+  uint32_t bitRevBytes;
+} testStockTables[] = {
+  {64U, sizeof(twiddleCoef_32_q15), sizeof(armBitRevIndexTable_fixed_32)},
+  {128U, sizeof(twiddleCoef_64_q15), sizeof(armBitRevIndexTable_fixed_64)},
+  {256U, sizeof(twiddleCoef_128_q15), sizeof(armBitRevIndexTable_fixed_128)},
+  {512U, sizeof(twiddleCoef_256_q15), sizeof(armBitRevIndexTable_fixed_256)},
+};
+
+static uint32_t testSeed = 1U;
+
+static uint32_t TestRandom(void)
+{
+  testSeed = (testSeed * 1103515245U) + 12345U;
+  return testSeed >> 8U;
+}
+
+static uint64_t TestNowNs(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+/* Full scale square waves, then sines of random frequencies, then random samples */
+static void TestSignal(q15_t *pSrc, uint32_t fftLen, uint32_t trial)
+{
+  double freq = 1.0 + ((double)(TestRandom() % 1000U) * (double)(fftLen / 2U - 2U) / 1000.0);
+
+  for (uint32_t n = 0U; n < fftLen; n++)
+  {
+    int32_t value;
+
+    if (trial == 0U)
+    {
+      value = -32768;
+    }
+    else if (trial == 1U)
+    {
+      value = ((n & 1U) != 0U) ? -32768 : 32767;
+    }
+    else if (trial < 20U)
+    {
+      value = (int32_t)lround(32767.0 * sin(2.0 * M_PI * freq * (double)n / (double)fftLen));
+    }
+    else
+    {
+      value = (int32_t)(TestRandom() % 65536U) - 32768;
+    }
+    pSrc[n] = (q15_t)value;
+  }
+}
+
+/* Worst error of the bins 0 to N/2 of a spectrum in the arm_rfft_q15() layout, against the DFT of pSrc divided by N */
+static double TestStockError(const q15_t *pSrc, const q15_t *pDst, uint32_t fftLen)
+{
+  double worst = 0.0;
+
+  for (uint32_t k = 0U; k <= (fftLen / 2U); k++)
+  {
+    double re = 0.0, im = 0.0;
+
+    for (uint32_t n = 0U; n < fftLen; n++)
+    {
+      double a = 2.0 * M_PI * (double)((k * n) % fftLen) / (double)fftLen;
+
+      re += (double)pSrc[n] * cos(a);
+      im -= (double)pSrc[n] * sin(a);
+    }
+    worst = fmax(worst, fmax(fabs(pDst[2U * k] - (re / (double)fftLen)),
+                             fabs(pDst[(2U * k) + 1U] - (im / (double)fftLen))));
+  }
+  return worst;
+}
+
+/* Accuracy, host time and table bytes of arm_rfft_m0_q15() against arm_rfft_q15() */
+static uint32_t TestCompareStock(void)
+{
+  uint32_t failures = 0U;
+
+  printf("\nlength  m0 error  rfft_q15 error  m0 time   rfft_q15 time  m0 tables  rfft_q15 tables\n");
+  for (uint32_t i = 0U; i < (sizeof(testStockTables) / sizeof(testStockTables[0])); i++)
+  {
+    uint32_t fftLen = testStockTables[i].fftLen;
+    arm_rfft_m0_instance_q15 S;
+    arm_rfft_instance_q15 R;
+    q15_t src[TEST_MAX_LEN], x[TEST_MAX_LEN], dst[2U * TEST_MAX_LEN];
+    double errorM0 = 0.0, errorStock = 0.0;
+    double timeM0 = 0.0, timeStock = 0.0;
+    uint32_t bytesM0 = (uint32_t)sizeof(arm_rfft_m0_sine_table_q15);
+    uint32_t bytesStock = testStockTables[i].twiddleBytes + testStockTables[i].bitRevBytes +
+                          (uint32_t)sizeof(realCoefAQ15) + (uint32_t)sizeof(realCoefBQ15);
+
+    if ((arm_rfft_m0_init_q15(&S, fftLen) != ARM_MATH_SUCCESS) ||
+        (arm_rfft_init_q15(&R, fftLen, 0U, 1U) != ARM_MATH_SUCCESS))
+    {
+      printf("FAIL: length %u is rejected\n", fftLen);
+      failures++;
+      continue;
+    }
+
+    for (uint32_t block = 0U; block < TEST_COMPARE_BLOCKS; block++)
+    {
+      TestSignal(src, fftLen, 20U + block);
+
+      memcpy(x, src, fftLen * sizeof(q15_t));
+      arm_rfft_m0_q15(&S, x);
+      /* Bins 0 and N/2 are packed in x[0] and x[1], the other ones in the arm_rfft_q15() layout */
+      dst[0] = x[0];
+      dst[1] = 0;
+      memcpy(&dst[2], &x[2], (fftLen - 2U) * sizeof(q15_t));
+      dst[fftLen] = x[1];
+      dst[fftLen + 1U] = 0;
+      errorM0 = fmax(errorM0, TestStockError(src, dst, fftLen));
+
+      memcpy(x, src, fftLen * sizeof(q15_t));
+      arm_rfft_q15(&R, x, dst);
+      errorStock = fmax(errorStock, TestStockError(src, dst, fftLen));
+    }
+
+    /* The two transforms take turns and the best round of each counts */
+    for (uint32_t round = 0U; round < TEST_COMPARE_ROUNDS; round++)
+    {
+      uint64_t start = TestNowNs();
+      double time;
+
+      for (uint32_t run = 0U; run < TEST_COMPARE_RUNS; run++)
+      {
+        memcpy(x, src, fftLen * sizeof(q15_t));
+        arm_rfft_m0_q15(&S, x);
+      }
+      time = (double)(TestNowNs() - start) / (1000.0 * TEST_COMPARE_RUNS);
+      timeM0 = ((round == 0U) || (time < timeM0)) ? time : timeM0;
+
+      start = TestNowNs();
+      for (uint32_t run = 0U; run < TEST_COMPARE_RUNS; run++)
+      {
+        memcpy(x, src, fftLen * sizeof(q15_t));
+        arm_rfft_q15(&R, x, dst);
+      }
+      time = (double)(TestNowNs() - start) / (1000.0 * TEST_COMPARE_RUNS);
+      timeStock = ((round == 0U) || (time < timeStock)) ? time : timeStock;
+    }
+
+    printf("%6u  %4.1f LSB  %10.1f LSB  %5.2f us  %10.2f us  %6u B  %12u B\n", fftLen, errorM0, errorStock, timeM0,
+           timeStock, bytesM0, bytesStock);
+  }
+  return failures;
+}
+
+int main(void)
+{
+  static const uint32_t unsupported[] = {16U, 32U, 1024U};
+  uint32_t failures = 0U;
+
+  for (uint32_t i = 0U; i < (sizeof(unsupported) / sizeof(unsupported[0])); i++)
+  {
+    arm_rfft_m0_instance_q15 S;
+
+    if (arm_rfft_m0_init_q15(&S, unsupported[i]) != ARM_MATH_ARGUMENT_ERROR)
+    {
+      printf("FAIL: length %u is accepted\n", unsupported[i]);
+      failures++;
+    }
+  }
+
+  printf("length  worst bin error  worst magnitude error  power errors  host time\n");
+  for (uint32_t fftLen = 64U; fftLen <= TEST_MAX_LEN; fftLen *= 2U)
+  {
+    arm_rfft_m0_instance_q15 S;
+    q15_t x[TEST_MAX_LEN], src[TEST_MAX_LEN];
+    q15_t mag[(TEST_MAX_LEN / 2U) + 1U];
+    q31_t power[(TEST_MAX_LEN / 2U) + 1U];
+    double worstBin = 0.0;
+    double worstMag = 0.0;
+    uint32_t powerErrors = 0U;
+    uint64_t start;
+
+    if (arm_rfft_m0_init_q15(&S, fftLen) != ARM_MATH_SUCCESS)
+    {
+      printf("FAIL: length %u is rejected\n", fftLen);
+      failures++;
+      continue;
+    }
+
+    for (uint32_t trial = 0U; trial < TEST_TRIALS; trial++)
+    {
+      TestSignal(x, fftLen, trial);
+
+      /* Reference X[k] / N for k = 0 to N/2 */
+      double ref[(TEST_MAX_LEN / 2U) + 1U][2];
+      for (uint32_t k = 0U; k <= (fftLen / 2U); k++)
+      {
+        double re = 0.0, im = 0.0;
+
+        for (uint32_t n = 0U; n < fftLen; n++)
+        {
+          double a = 2.0 * M_PI * (double)((k * n) % fftLen) / (double)fftLen;
+
+          re += (double)x[n] * cos(a);
+          im -= (double)x[n] * sin(a);
+        }
+        ref[k][0] = re / (double)fftLen;
+        ref[k][1] = im / (double)fftLen;
+      }
+
+      arm_rfft_m0_q15(&S, x);
+
+      for (uint32_t k = 0U; k <= (fftLen / 2U); k++)
+      {
+        double re = (k == 0U) ? x[0] : ((k == (fftLen / 2U)) ? x[1] : x[2U * k]);
+        double im = ((k == 0U) || (k == (fftLen / 2U))) ? 0.0 : x[(2U * k) + 1U];
+        double err = fmax(fabs(re - ref[k][0]), fabs(im - ref[k][1]));
+
+        worstBin = fmax(worstBin, err);
+      }
+
+      arm_rfft_m0_mag_q15(&S, x, mag);
+      arm_rfft_m0_power_q15(&S, x, power);
+
+      for (uint32_t k = 0U; k <= (fftLen / 2U); k++)
+      {
+        double re = (k == 0U) ? x[0] : ((k == (fftLen / 2U)) ? x[1] : x[2U * k]);
+        double im = ((k == 0U) || (k == (fftLen / 2U))) ? 0.0 : x[(2U * k) + 1U];
+        double exact = fmin(floor(sqrt((re * re) + (im * im))), 32767.0);
+
+        worstMag = fmax(worstMag, fabs(exact - (double)mag[k]));
+        if ((double)power[k] != fmin((re * re) + (im * im), 2147483647.0))
+        {
+          powerErrors++;
+        }
+      }
+    }
+
+    TestSignal(src, fftLen, TEST_TRIALS);
+    start = TestNowNs();
+    for (uint32_t run = 0U; run < TEST_BENCH_RUNS; run++)
+    {
+      memcpy(x, src, fftLen * sizeof(q15_t));
+      arm_rfft_m0_q15(&S, x);
+    }
+
+    printf("%6u  %11.2f LSB  %17.0f LSB  %12u  %6.2f us\n", fftLen, worstBin, worstMag, powerErrors,
+           (double)(TestNowNs() - start) / (1000.0 * TEST_BENCH_RUNS));
+
+    if ((worstBin >= TEST_MAX_ERROR) || (worstMag != 0.0) || (powerErrors != 0U))
+    {
+      printf("FAIL: length %u\n", fftLen);
+      failures++;
+    }
+  }
+
+  failures += TestCompareStock();
+
+  printf("%s\n", (failures == 0U) ? "PASS" : "FAIL");
+  return (failures == 0U) ? 0 : 1;
+}
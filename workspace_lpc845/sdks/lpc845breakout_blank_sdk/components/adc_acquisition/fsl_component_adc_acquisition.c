@@ -0,0 +1,284 @@
+/*
+ * Copyright 2024 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*! *********************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+********************************************************************************** */
+#include "fsl_component_adc_acquisition.h"
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private prototypes
+*************************************************************************************
+********************************************************************************** */
+static void ADC_AcquisitionDmaCallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode);
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private functions
+*************************************************************************************
+********************************************************************************** */
+
+/* Gets the log2 of the data registers read per sequence and the first of them. */
+static uint32_t ADC_AcquisitionGetLayout(uint32_t channelMask, uint32_t *firstRegister)
+{
+    uint32_t lowest  = 0U;
+    uint32_t highest = ADC_DAT_COUNT - 1U;
+    uint32_t power   = 0U;
+
+    while ((0U == (channelMask & (1UL << lowest))) && (lowest < highest))
+    {
+        lowest++;
+    }
+    while ((0U == (channelMask & (1UL << highest))) && (highest > lowest))
+    {
+        highest--;
+    }
+    while ((1UL << power) < (highest - lowest + 1U))
+    {
+        power++;
+    }
+
+    /* Keep the burst inside the data registers where possible, a 16 register burst also reads the threshold
+     * registers following them, which has no side effect. */
+    if ((lowest + (1UL << power)) > ADC_DAT_COUNT)
+    {
+        lowest = ((1UL << power) <= ADC_DAT_COUNT) ? (ADC_DAT_COUNT - (1UL << power)) : 0U;
+    }
+
+    *firstRegister = lowest;
+    return power;
+}
+
+/* Transfer configuration of one block, interrupt A marks block 0 and interrupt B block 1. */
+static uint32_t ADC_AcquisitionXferCfg(adc_acquisition_handle_t *handle, uint32_t block)
+{
+    return DMA_CHANNEL_XFER(true, true, (0U == block), (1U == block), kDMA_Transfer32BitWidth,
+                            kDMA_AddressInterleave1xWidth, kDMA_AddressInterleave1xWidth,
+                            handle->blockWords * sizeof(uint32_t));
+}
+
+/*
+ * Unpacks the 12-bit results of a block in place. Sample n is written over bytes 2n and 2n + 1, the data register
+ * word it comes from is at or after word n, so no word is overwritten before it is read.
+ */
+static adc_acquisition_status_t ADC_AcquisitionUnpack(adc_acquisition_handle_t *handle,
+                                                      uint32_t *block,
+                                                      uint32_t *sampleCount)
+{
+    uint16_t *samples   = (uint16_t *)(void *)block;
+    const uint32_t *raw = block;
+    uint32_t flags      = 0U;
+    uint32_t count      = 0U;
+    uint32_t word;
+    uint32_t sequence;
+    uint32_t channel;
+
+    for (sequence = 0U; sequence < handle->sequencesPerBlock; sequence++)
+    {
+        for (channel = 0U; channel < handle->channelCount; channel++)
+        {
+            word = raw[handle->registerOffset[channel]];
+            flags |= word;
+            samples[count] = (uint16_t)((word & ADC_DAT_RESULT_MASK) >> ADC_DAT_RESULT_SHIFT);
+            count++;
+        }
+        raw += (1UL << handle->spanPower);
+    }
+
+    *sampleCount = count;
+    return (0U != (flags & ADC_DAT_OVERRUN_MASK)) ? kStatus_ADC_AcquisitionOverrun : kStatus_ADC_AcquisitionSuccess;
+}
+
+static void ADC_AcquisitionDmaCallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode)
+{
+    adc_acquisition_handle_t *acquisition = (adc_acquisition_handle_t *)userData;
+    adc_acquisition_status_t status;
+    uint32_t *block;
+    uint32_t sampleCount = 0U;
+
+    if (!acquisition->running)
+    {
+        return;
+    }
+
+    if (!transferDone)
+    {
+        ADC_AcquisitionStop(acquisition);
+        if (NULL != acquisition->callback)
+        {
+            acquisition->callback(acquisition, NULL, 0U, kStatus_ADC_AcquisitionDmaError, acquisition->userData);
+        }
+        return;
+    }
+
+    block  = (intmode == (uint32_t)kDMA_IntB) ? &acquisition->buffer[acquisition->blockWords] : acquisition->buffer;
+    status = ADC_AcquisitionUnpack(acquisition, block, &sampleCount);
+
+    if (NULL != acquisition->callback)
+    {
+        acquisition->callback(acquisition, (const uint16_t *)(void *)block, sampleCount, status, acquisition->userData);
+    }
+}
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+********************************************************************************** */
+
+uint32_t ADC_AcquisitionGetSpan(uint32_t channelMask)
+{
+    uint32_t firstRegister;
+
+    channelMask &= (1UL << ADC_DAT_COUNT) - 1U;
+    if (0U == channelMask)
+    {
+        return 0U;
+    }
+
+    return 1UL << ADC_AcquisitionGetLayout(channelMask, &firstRegister);
+}
+
+adc_acquisition_status_t ADC_AcquisitionInit(adc_acquisition_handle_t *handle, const adc_acquisition_config_t *config)
+{
+    adc_conv_seq_config_t seqConfig;
+    uint32_t firstRegister;
+    uint32_t channel;
+
+    assert((NULL != handle) && (NULL != config));
+    assert((NULL != config->dmaHandle) && (NULL != config->descriptors));
+
+    if ((0U == (config->channelMask & ((1UL << ADC_DAT_COUNT) - 1U))) || (NULL == config->buffer) ||
+        (0U == config->sequencesPerBlock))
+    {
+        return kStatus_ADC_AcquisitionInvalidParameter;
+    }
+
+    (void)memset(handle, 0, sizeof(*handle));
+
+    handle->spanPower         = (uint8_t)ADC_AcquisitionGetLayout(config->channelMask, &firstRegister);
+    handle->firstRegister     = (uint8_t)firstRegister;
+    handle->sequencesPerBlock = config->sequencesPerBlock;
+    handle->blockWords        = config->sequencesPerBlock << handle->spanPower;
+
+    if ((handle->blockWords > DMA_MAX_TRANSFER_COUNT) || (config->bufferWords < (2U * handle->blockWords)))
+    {
+        return kStatus_ADC_AcquisitionInvalidParameter;
+    }
+
+    for (channel = firstRegister; channel < ADC_DAT_COUNT; channel++)
+    {
+        if (0U != (config->channelMask & (1UL << channel)))
+        {
+            handle->registerOffset[handle->channelCount] = (uint8_t)(channel - firstRegister);
+            handle->channelCount++;
+        }
+    }
+
+    handle->base        = config->base;
+    handle->dmaHandle   = config->dmaHandle;
+    handle->descriptors = config->descriptors;
+    handle->buffer      = config->buffer;
+    handle->callback    = config->callback;
+    handle->userData    = config->userData;
+
+    /* One DMA request per sequence, the sequence stays disabled until started. */
+    (void)memset(&seqConfig, 0, sizeof(seqConfig));
+    seqConfig.channelMask     = config->channelMask;
+    seqConfig.triggerMask     = config->triggerMask;
+    seqConfig.triggerPolarity = config->triggerPolarity;
+    seqConfig.interruptMode   = kADC_InterruptForEachSequence;
+    ADC_SetConvSeqAConfig(handle->base, &seqConfig);
+    ADC_EnableInterrupts(handle->base, (uint32_t)kADC_ConvSeqAInterruptEnable);
+
+    DMA_SetCallback(handle->dmaHandle, ADC_AcquisitionDmaCallback, handle);
+
+    return kStatus_ADC_AcquisitionSuccess;
+}
+
+adc_acquisition_status_t ADC_AcquisitionStart(adc_acquisition_handle_t *handle)
+{
+    dma_channel_config_t transferConfig;
+    dma_channel_trigger_t trigger;
+    void *source;
+
+    assert(NULL != handle);
+
+    if (handle->running)
+    {
+        return kStatus_ADC_AcquisitionInvalidParameter;
+    }
+
+    /* Each request copies the data registers of one sequence, the source wraps back for the next one. */
+    source        = (void *)(uintptr_t)&handle->base->DAT[handle->firstRegister];
+    trigger.type  = kDMA_RisingEdgeTrigger;
+    trigger.burst = (dma_trigger_burst_t)(DMA_CHANNEL_CFG_TRIGBURST(1) | DMA_CHANNEL_CFG_BURSTPOWER(handle->spanPower));
+    trigger.wrap  = kDMA_SrcWrap;
+
+    /* Block 0, block 1, then back to block 0 through the link descriptors. */
+    DMA_SetupChannelDescriptor(&handle->descriptors[0], ADC_AcquisitionXferCfg(handle, 0U), source, handle->buffer,
+                               &handle->descriptors[1], kDMA_SrcWrap, handle->spanPower);
+    DMA_SetupChannelDescriptor(&handle->descriptors[1], ADC_AcquisitionXferCfg(handle, 1U), source,
+                               &handle->buffer[handle->blockWords], &handle->descriptors[0], kDMA_SrcWrap,
+                               handle->spanPower);
+    DMA_PrepareChannelTransfer(&transferConfig, source, handle->buffer, ADC_AcquisitionXferCfg(handle, 0U),
+                               kDMA_MemoryToMemory, &trigger, &handle->descriptors[1]);
+    if (kStatus_Success != DMA_SubmitChannelTransfer(handle->dmaHandle, &transferConfig))
+    {
+        return kStatus_ADC_AcquisitionInvalidParameter;
+    }
+
+    DMA_EnableChannelInterrupts(handle->dmaHandle->base, handle->dmaHandle->channel);
+    handle->running = true;
+    DMA_StartTransfer(handle->dmaHandle);
+
+    ADC_EnableConvSeqA(handle->base, true);
+
+    return kStatus_ADC_AcquisitionSuccess;
+}
+
+void ADC_AcquisitionStop(adc_acquisition_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    if (!handle->running)
+    {
+        return;
+    }
+
+    ADC_EnableConvSeqA(handle->base, false);
+    DMA_DisableChannelInterrupts(handle->dmaHandle->base, handle->dmaHandle->channel);
+    DMA_AbortTransfer(handle->dmaHandle);
+
+    handle->running = false;
+}
+
+adc_acquisition_status_t ADC_AcquisitionSetupCtimerTrigger(CTIMER_Type *base,
+                                                           uint32_t srcClock_Hz,
+                                                           uint32_t sampleRate_Hz)
+{
+    ctimer_match_config_t matchConfig;
+
+    if ((0U == sampleRate_Hz) || (sampleRate_Hz > (srcClock_Hz / 2U)))
+    {
+        return kStatus_ADC_AcquisitionInvalidParameter;
+    }
+
+    /* The output toggles twice per sample period, one rising edge per sequence. */
+    matchConfig.matchValue         = (srcClock_Hz / (2U * sampleRate_Hz)) - 1U;
+    matchConfig.enableCounterReset = true;
+    matchConfig.enableCounterStop  = false;
+    matchConfig.outControl         = kCTIMER_Output_Toggle;
+    matchConfig.outPinInitState    = false;
+    matchConfig.enableInterrupt    = false;
+    CTIMER_SetupMatch(base, kCTIMER_Match_3, &matchConfig);
+
+    return kStatus_ADC_AcquisitionSuccess;
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright 2024 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_COMPONENT_ADC_ACQUISITION_H_
+#define _FSL_COMPONENT_ADC_ACQUISITION_H_
+
+#include "fsl_common.h"
+#include "fsl_adc.h"
+#include "fsl_ctimer.h"
+#include "fsl_dma.h"
+
+/*!
+ * @addtogroup AdcAcquisition
+ * @{
+ */
+
+/**********************************************************************************
+ * Public macro definitions
+ ***********************************************************************************/
+
+/*! @brief Number of link descriptors the application allocates for one acquisition.
+ *
+ * Allocate them with DMA_ALLOCATE_LINK_DESCRIPTORS(name, ADC_ACQUISITION_DESCRIPTOR_COUNT).
+ */
+#define ADC_ACQUISITION_DESCRIPTOR_COUNT (2U)
+
+/*!
+ * @brief Size of the acquisition buffer in words.
+ *
+ * @param span Number of data registers read per sequence, the smallest power of two covering the lowest to the
+ *             highest channel of the sequence, see ADC_AcquisitionGetSpan().
+ * @param sequencesPerBlock Number of sequences per block.
+ */
+#define ADC_ACQUISITION_BUFFER_WORDS(span, sequencesPerBlock) (2U * (span) * (sequencesPerBlock))
+
+/**********************************************************************************
+ * Public type definitions
+ ***********************************************************************************/
+
+/*! @brief The status of the acquisition */
+typedef enum _adc_acquisition_status
+{
+    kStatus_ADC_AcquisitionSuccess          = kStatus_Success,                       /*!< Success */
+    kStatus_ADC_AcquisitionInvalidParameter = MAKE_STATUS(kStatusGroup_ADC_ACQ, 1), /*!< Invalid parameter */
+    kStatus_ADC_AcquisitionOverrun          = MAKE_STATUS(kStatusGroup_ADC_ACQ, 2), /*!< Conversion lost in the block */
+    kStatus_ADC_AcquisitionDmaError         = MAKE_STATUS(kStatusGroup_ADC_ACQ, 3), /*!< DMA error, stopped */
+} adc_acquisition_status_t;
+
+/*! @brief ADC acquisition handle typedef. */
+typedef struct _adc_acquisition_handle adc_acquisition_handle_t;
+
+/*!
+ * @brief Block callback.
+ *
+ * Called from the DMA interrupt when a block is complete. The samples are the 12-bit results, one per channel of the
+ * sequence in ascending channel order, sequence after sequence. They are unpacked in place in the block buffer and
+ * stay valid until the other block is complete.
+ */
+typedef void (*adc_acquisition_callback_t)(adc_acquisition_handle_t *handle,
+                                           const uint16_t *samples,
+                                           uint32_t sampleCount,
+                                           adc_acquisition_status_t status,
+                                           void *userData);
+
+/*! @brief Acquisition configuration. */
+typedef struct _adc_acquisition_config
+{
+    ADC_Type *base;                         /*!< ADC peripheral base address, initialized and calibrated. */
+    dma_handle_t *dmaHandle;                /*!< DMA handle of the channel triggered by the sequence A DMA request. */
+    dma_descriptor_t *descriptors;          /*!< ADC_ACQUISITION_DESCRIPTOR_COUNT link descriptors. */
+    uint32_t channelMask;                   /*!< Channels converted by sequence A. */
+    uint32_t triggerMask;                   /*!< Hardware trigger input launching sequence A, as in
+                                                 adc_conv_seq_config_t. */
+    adc_trigger_polarity_t triggerPolarity; /*!< Trigger edge. */
+    uint32_t *buffer;                       /*!< Acquisition buffer, two blocks. */
+    uint32_t bufferWords;                   /*!< Size of the buffer in words, see ADC_ACQUISITION_BUFFER_WORDS(). */
+    uint32_t sequencesPerBlock;             /*!< Sequences per block. */
+    adc_acquisition_callback_t callback;    /*!< Block callback. */
+    void *userData;                         /*!< Parameter of the callback. */
+} adc_acquisition_config_t;
+
+/*! @brief ADC acquisition handle, users should not touch the content of the handle. */
+struct _adc_acquisition_handle
+{
+    ADC_Type *base;                        /*!< ADC peripheral base address. */
+    dma_handle_t *dmaHandle;               /*!< DMA handle. */
+    dma_descriptor_t *descriptors;         /*!< Link descriptors, one per block. */
+    uint32_t *buffer;                      /*!< Acquisition buffer. */
+    uint32_t blockWords;                   /*!< Words per block. */
+    uint32_t sequencesPerBlock;            /*!< Sequences per block. */
+    adc_acquisition_callback_t callback;   /*!< Block callback. */
+    void *userData;                        /*!< Parameter of the callback. */
+    uint8_t firstRegister;                 /*!< First data register read by a DMA burst. */
+    uint8_t spanPower;                     /*!< Log2 of the data registers read per DMA burst. */
+    uint8_t channelCount;                  /*!< Channels per sequence. */
+    uint8_t registerOffset[ADC_DAT_COUNT]; /*!< Offset of each channel in a burst, in channel order. */
+    volatile bool running;                 /*!< Acquisition running. */
+};
+
+/**********************************************************************************
+ * API
+ **********************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* _cplusplus */
+
+/*!
+ * @brief Gets the number of data registers read per sequence.
+ *
+ * The DMA copies a power of two of consecutive channel data registers in one burst per sequence, the burst covers the
+ * lowest to the highest channel of the mask.
+ *
+ * @param channelMask - Channels of the sequence.
+ *
+ * @retval Number of data registers, 0 if the mask is empty.
+ */
+uint32_t ADC_AcquisitionGetSpan(uint32_t channelMask);
+
+/*!
+ * @brief Initializes the acquisition.
+ *
+ * Sequence A is configured to convert the channels on each hardware trigger and to request the DMA at the end of the
+ * sequence. The DMA copies the channel data registers into two blocks in turn and the callback is called once per
+ * block, so no interrupt is taken per conversion.
+ *
+ * The DMA channel must be created with DMA_CreateHandle() and enabled with DMA_EnableChannel(), and the sequence A
+ * DMA request must be routed to it, for example with INPUTMUX_AttachSignal(INPUTMUX, channel,
+ * kINPUTMUX_AdcASeqaIrqToDma).
+ *
+ * @note The data registers of the channels between the lowest and the highest channel of the mask are read by the
+ * DMA, which clears their DATAVALID flags. Do not poll them from sequence B.
+ *
+ * @param handle - Acquisition handle.
+ * @param config - Acquisition configuration.
+ *
+ * @retval kStatus_ADC_AcquisitionSuccess Acquisition initialized.
+ * @retval kStatus_ADC_AcquisitionInvalidParameter The channel mask is empty, the buffer too small or a block longer
+ *         than DMA_MAX_TRANSFER_COUNT words.
+ */
+adc_acquisition_status_t ADC_AcquisitionInit(adc_acquisition_handle_t *handle, const adc_acquisition_config_t *config);
+
+/*!
+ * @brief Starts the acquisition.
+ *
+ * Sequence A is enabled, conversions start on the next trigger edge.
+ *
+ * @param handle - Acquisition handle.
+ *
+ * @retval kStatus_ADC_AcquisitionSuccess Acquisition started.
+ * @retval kStatus_ADC_AcquisitionInvalidParameter The acquisition is already running.
+ */
+adc_acquisition_status_t ADC_AcquisitionStart(adc_acquisition_handle_t *handle);
+
+/*!
+ * @brief Stops the acquisition.
+ *
+ * Sequence A is disabled and the DMA aborted, the samples of the block in progress are dropped.
+ *
+ * @param handle - Acquisition handle.
+ */
+void ADC_AcquisitionStop(adc_acquisition_handle_t *handle);
+
+/*!
+ * @brief Sets up a CTIMER match 3 output as the fixed rate trigger.
+ *
+ * Match 3 resets the counter and toggles its output, which gives one rising edge per sample period on the T0_MAT3
+ * trigger input of the ADC. The CTIMER must be initialized with CTIMER_Init() and started with CTIMER_StartTimer()
+ * afterwards. An SCTimer output can trigger the acquisition in the same way.
+ *
+ * @param base - CTIMER peripheral base address.
+ * @param srcClock_Hz - CTIMER counter clock.
+ * @param sampleRate_Hz - Sequences per second.
+ *
+ * @retval kStatus_ADC_AcquisitionSuccess Trigger set up.
+ * @retval kStatus_ADC_AcquisitionInvalidParameter The rate is 0 or above half the counter clock.
+ */
+adc_acquisition_status_t ADC_AcquisitionSetupCtimerTrigger(CTIMER_Type *base,
+                                                           uint32_t srcClock_Hz,
+                                                           uint32_t sampleRate_Hz);
+
+#if defined(__cplusplus)
+}
+#endif
+/*! @}*/
+#endif /* _FSL_COMPONENT_ADC_ACQUISITION_H_ */
@@ -21,6 +21,35 @@
 *************************************************************************************
 ***********************************************************************************/
 
+/************************************************************************************
+*************************************************************************************
+* Public macros
+*************************************************************************************
+************************************************************************************/
+/*! @brief Software CRC engine, only used by the software CRC adapter.
+ *
+ * 0: bit by bit computation, no table.
+ * 1: 4 bits at a time, 16 entries (64 bytes) table per polynomial and input bit order.
+ * 2: 8 bits at a time, 256 entries (1 KB) table per polynomial and input bit order.
+ * 3: 32 bits at a time (slice-by-4), 4 x 256 entries (4 KB) table per polynomial and input bit order.
+ *
+ * The tables are built at compile time and placed in flash, the polynomials not listed in
+ * HAL_CRC_SOFTWARE_TABLE_POLYNOMIALS are always computed bit by bit.
+ */
+#ifndef HAL_CRC_SOFTWARE_ENGINE
+#define HAL_CRC_SOFTWARE_ENGINE (1U)
+#endif
+
+#define HAL_CRC_SOFTWARE_TABLE_CRC_8  (1U << 0U) /*!< Table for KHAL_CrcPolynomial_CRC_8_CCITT */
+#define HAL_CRC_SOFTWARE_TABLE_CRC_16 (1U << 1U) /*!< Table for KHAL_CrcPolynomial_CRC_16 */
+#define HAL_CRC_SOFTWARE_TABLE_CRC_32 (1U << 2U) /*!< Table for KHAL_CrcPolynomial_CRC_32 */
+
+/*! @brief Polynomials the software CRC engine builds tables for, mask of HAL_CRC_SOFTWARE_TABLE_CRC_xx. */
+#ifndef HAL_CRC_SOFTWARE_TABLE_POLYNOMIALS
+#define HAL_CRC_SOFTWARE_TABLE_POLYNOMIALS \
+    (HAL_CRC_SOFTWARE_TABLE_CRC_8 | HAL_CRC_SOFTWARE_TABLE_CRC_16 | HAL_CRC_SOFTWARE_TABLE_CRC_32)
+#endif
+
 /************************************************************************************
 *************************************************************************************
 * Public types
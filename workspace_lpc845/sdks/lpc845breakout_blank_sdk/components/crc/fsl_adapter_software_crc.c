@@ -8,10 +8,178 @@
 #include "fsl_common.h"
 #include "fsl_adapter_crc.h"
 
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#if (defined(HAL_CRC_SOFTWARE_ENGINE) && (HAL_CRC_SOFTWARE_ENGINE > 0U)) && \
+    (defined(HAL_CRC_SOFTWARE_TABLE_POLYNOMIALS) && (HAL_CRC_SOFTWARE_TABLE_POLYNOMIALS != 0U))
+#define CRC_SW_TABLE_ENABLE (1U)
+#else
+#define CRC_SW_TABLE_ENABLE (0U)
+#endif
+
+#if (CRC_SW_TABLE_ENABLE > 0U)
+/*
+ * The CRC register is processed MSB aligned on 32 bits whatever the CRC size, so that a single
+ * set of routines serves all the polynomials. The CRC being linear, the table entry of index i is
+ * the XOR of the entries of the bits set in i. The entries of the single bits are listed below,
+ * entry k of CRC_SW_<poly>_SLICE<n> is x^(31 + 8 * n + k + 1) mod P (MSB aligned). The _REFLECTED
+ * lists hold the same values bit reversed, in the order of the bits of a reflected input byte.
+ */
+#define CRC_SW_CRC8_NIBBLE           0x03000000U, 0x06000000U, 0x0C000000U, 0x18000000U
+#define CRC_SW_CRC8_NIBBLE_REFLECTED 0x00000018U, 0x00000030U, 0x00000060U, 0x000000C0U
+#define CRC_SW_CRC8_SLICE0 \
+    0x03000000U, 0x06000000U, 0x0C000000U, 0x18000000U, 0x30000000U, 0x60000000U, 0xC0000000U, 0x83000000U
+#define CRC_SW_CRC8_SLICE1 \
+    0x05000000U, 0x0A000000U, 0x14000000U, 0x28000000U, 0x50000000U, 0xA0000000U, 0x43000000U, 0x86000000U
+#define CRC_SW_CRC8_SLICE2 \
+    0x0F000000U, 0x1E000000U, 0x3C000000U, 0x78000000U, 0xF0000000U, 0xE3000000U, 0xC5000000U, 0x89000000U
+#define CRC_SW_CRC8_SLICE3 \
+    0x11000000U, 0x22000000U, 0x44000000U, 0x88000000U, 0x13000000U, 0x26000000U, 0x4C000000U, 0x98000000U
+#define CRC_SW_CRC8_SLICE0_REFLECTED \
+    0x000000C1U, 0x00000003U, 0x00000006U, 0x0000000CU, 0x00000018U, 0x00000030U, 0x00000060U, 0x000000C0U
+#define CRC_SW_CRC8_SLICE1_REFLECTED \
+    0x00000061U, 0x000000C2U, 0x00000005U, 0x0000000AU, 0x00000014U, 0x00000028U, 0x00000050U, 0x000000A0U
+#define CRC_SW_CRC8_SLICE2_REFLECTED \
+    0x00000091U, 0x000000A3U, 0x000000C7U, 0x0000000FU, 0x0000001EU, 0x0000003CU, 0x00000078U, 0x000000F0U
+#define CRC_SW_CRC8_SLICE3_REFLECTED \
+    0x00000019U, 0x00000032U, 0x00000064U, 0x000000C8U, 0x00000011U, 0x00000022U, 0x00000044U, 0x00000088U
+
+#define CRC_SW_CRC16_NIBBLE           0x10210000U, 0x20420000U, 0x40840000U, 0x81080000U
+#define CRC_SW_CRC16_NIBBLE_REFLECTED 0x00001081U, 0x00002102U, 0x00004204U, 0x00008408U
+#define CRC_SW_CRC16_SLICE0 \
+    0x10210000U, 0x20420000U, 0x40840000U, 0x81080000U, 0x12310000U, 0x24620000U, 0x48C40000U, 0x91880000U
+#define CRC_SW_CRC16_SLICE1 \
+    0x33310000U, 0x66620000U, 0xCCC40000U, 0x89A90000U, 0x03730000U, 0x06E60000U, 0x0DCC0000U, 0x1B980000U
+#define CRC_SW_CRC16_SLICE2 \
+    0x37300000U, 0x6E600000U, 0xDCC00000U, 0xA9A10000U, 0x43630000U, 0x86C60000U, 0x1DAD0000U, 0x3B5A0000U
+#define CRC_SW_CRC16_SLICE3 \
+    0x76B40000U, 0xED680000U, 0xCAF10000U, 0x85C30000U, 0x1BA70000U, 0x374E0000U, 0x6E9C0000U, 0xDD380000U
+#define CRC_SW_CRC16_SLICE0_REFLECTED \
+    0x00001189U, 0x00002312U, 0x00004624U, 0x00008C48U, 0x00001081U, 0x00002102U, 0x00004204U, 0x00008408U
+#define CRC_SW_CRC16_SLICE1_REFLECTED \
+    0x000019D8U, 0x000033B0U, 0x00006760U, 0x0000CEC0U, 0x00009591U, 0x00002333U, 0x00004666U, 0x00008CCCU
+#define CRC_SW_CRC16_SLICE2_REFLECTED \
+    0x00005ADCU, 0x0000B5B8U, 0x00006361U, 0x0000C6C2U, 0x00008595U, 0x0000033BU, 0x00000676U, 0x00000CECU
+#define CRC_SW_CRC16_SLICE3_REFLECTED \
+    0x00001CBBU, 0x00003976U, 0x000072ECU, 0x0000E5D8U, 0x0000C3A1U, 0x00008F53U, 0x000016B7U, 0x00002D6EU
+
+#define CRC_SW_CRC32_NIBBLE           0x04C11DB7U, 0x09823B6EU, 0x130476DCU, 0x2608EDB8U
+#define CRC_SW_CRC32_NIBBLE_REFLECTED 0x1DB71064U, 0x3B6E20C8U, 0x76DC4190U, 0xEDB88320U
+#define CRC_SW_CRC32_SLICE0 \
+    0x04C11DB7U, 0x09823B6EU, 0x130476DCU, 0x2608EDB8U, 0x4C11DB70U, 0x9823B6E0U, 0x34867077U, 0x690CE0EEU
+#define CRC_SW_CRC32_SLICE1 \
+    0xD219C1DCU, 0xA0F29E0FU, 0x452421A9U, 0x8A484352U, 0x10519B13U, 0x20A33626U, 0x41466C4CU, 0x828CD898U
+#define CRC_SW_CRC32_SLICE2 \
+    0x01D8AC87U, 0x03B1590EU, 0x0762B21CU, 0x0EC56438U, 0x1D8AC870U, 0x3B1590E0U, 0x762B21C0U, 0xEC564380U
+#define CRC_SW_CRC32_SLICE3 \
+    0xDC6D9AB7U, 0xBC1A28D9U, 0x7CF54C05U, 0xF9EA980AU, 0xF7142DA3U, 0xEAE946F1U, 0xD1139055U, 0xA6E63D1DU
+#define CRC_SW_CRC32_SLICE0_REFLECTED \
+    0x77073096U, 0xEE0E612CU, 0x076DC419U, 0x0EDB8832U, 0x1DB71064U, 0x3B6E20C8U, 0x76DC4190U, 0xEDB88320U
+#define CRC_SW_CRC32_SLICE1_REFLECTED \
+    0x191B3141U, 0x32366282U, 0x646CC504U, 0xC8D98A08U, 0x4AC21251U, 0x958424A2U, 0xF0794F05U, 0x3B83984BU
+#define CRC_SW_CRC32_SLICE2_REFLECTED \
+    0x01C26A37U, 0x0384D46EU, 0x0709A8DCU, 0x0E1351B8U, 0x1C26A370U, 0x384D46E0U, 0x709A8DC0U, 0xE1351B80U
+#define CRC_SW_CRC32_SLICE3_REFLECTED \
+    0xB8BC6765U, 0xAA09C88BU, 0x8F629757U, 0xC5B428EFU, 0x5019579FU, 0xA032AF3EU, 0x9B14583DU, 0xED59B63BU
+
+/* Entry of index i of a table, from the list of the single bit entries */
+#define CRC_SW_TERM(i, b, v) (((((uint32_t)(i)) >> (b)) & 1U) != 0U ? (v) : 0U)
+#define CRC_SW_ENTRY4_(i, v0, v1, v2, v3) \
+    (CRC_SW_TERM(i, 0U, v0) ^ CRC_SW_TERM(i, 1U, v1) ^ CRC_SW_TERM(i, 2U, v2) ^ CRC_SW_TERM(i, 3U, v3))
+#define CRC_SW_ENTRY8_(i, v0, v1, v2, v3, v4, v5, v6, v7)                                                  \
+    (CRC_SW_TERM(i, 0U, v0) ^ CRC_SW_TERM(i, 1U, v1) ^ CRC_SW_TERM(i, 2U, v2) ^ CRC_SW_TERM(i, 3U, v3) ^ \
+     CRC_SW_TERM(i, 4U, v4) ^ CRC_SW_TERM(i, 5U, v5) ^ CRC_SW_TERM(i, 6U, v6) ^ CRC_SW_TERM(i, 7U, v7))
+#define CRC_SW_ENTRY4(i, ...) CRC_SW_ENTRY4_(i, __VA_ARGS__)
+#define CRC_SW_ENTRY8(i, ...) CRC_SW_ENTRY8_(i, __VA_ARGS__)
+
+#define CRC_SW_ROW16(entry, h, ...)                                                                          \
+    entry((h) + 0U, __VA_ARGS__), entry((h) + 1U, __VA_ARGS__), entry((h) + 2U, __VA_ARGS__),                \
+        entry((h) + 3U, __VA_ARGS__), entry((h) + 4U, __VA_ARGS__), entry((h) + 5U, __VA_ARGS__),            \
+        entry((h) + 6U, __VA_ARGS__), entry((h) + 7U, __VA_ARGS__), entry((h) + 8U, __VA_ARGS__),            \
+        entry((h) + 9U, __VA_ARGS__), entry((h) + 10U, __VA_ARGS__), entry((h) + 11U, __VA_ARGS__),          \
+        entry((h) + 12U, __VA_ARGS__), entry((h) + 13U, __VA_ARGS__), entry((h) + 14U, __VA_ARGS__),         \
+        entry((h) + 15U, __VA_ARGS__)
+#define CRC_SW_TABLE16(...) CRC_SW_ROW16(CRC_SW_ENTRY4, 0U, __VA_ARGS__)
+#define CRC_SW_TABLE256(...)                                                                                 \
+    CRC_SW_ROW16(CRC_SW_ENTRY8, 0U, __VA_ARGS__), CRC_SW_ROW16(CRC_SW_ENTRY8, 16U, __VA_ARGS__),             \
+        CRC_SW_ROW16(CRC_SW_ENTRY8, 32U, __VA_ARGS__), CRC_SW_ROW16(CRC_SW_ENTRY8, 48U, __VA_ARGS__),        \
+        CRC_SW_ROW16(CRC_SW_ENTRY8, 64U, __VA_ARGS__), CRC_SW_ROW16(CRC_SW_ENTRY8, 80U, __VA_ARGS__),        \
+        CRC_SW_ROW16(CRC_SW_ENTRY8, 96U, __VA_ARGS__), CRC_SW_ROW16(CRC_SW_ENTRY8, 112U, __VA_ARGS__),       \
+        CRC_SW_ROW16(CRC_SW_ENTRY8, 128U, __VA_ARGS__), CRC_SW_ROW16(CRC_SW_ENTRY8, 144U, __VA_ARGS__),      \
+        CRC_SW_ROW16(CRC_SW_ENTRY8, 160U, __VA_ARGS__), CRC_SW_ROW16(CRC_SW_ENTRY8, 176U, __VA_ARGS__),      \
+        CRC_SW_ROW16(CRC_SW_ENTRY8, 192U, __VA_ARGS__), CRC_SW_ROW16(CRC_SW_ENTRY8, 208U, __VA_ARGS__),      \
+        CRC_SW_ROW16(CRC_SW_ENTRY8, 224U, __VA_ARGS__), CRC_SW_ROW16(CRC_SW_ENTRY8, 240U, __VA_ARGS__)
+
+#if (HAL_CRC_SOFTWARE_ENGINE == 1U)
+#define CRC_SW_TABLE_ENTRIES                     (16U)
+#define CRC_SW_TABLE_INITIALIZER(poly)           {CRC_SW_TABLE16(CRC_SW_##poly##_NIBBLE)}
+#define CRC_SW_REFLECTED_TABLE_INITIALIZER(poly) {CRC_SW_TABLE16(CRC_SW_##poly##_NIBBLE_REFLECTED)}
+#elif (HAL_CRC_SOFTWARE_ENGINE == 2U)
+#define CRC_SW_TABLE_ENTRIES                     (256U)
+#define CRC_SW_TABLE_INITIALIZER(poly)           {CRC_SW_TABLE256(CRC_SW_##poly##_SLICE0)}
+#define CRC_SW_REFLECTED_TABLE_INITIALIZER(poly) {CRC_SW_TABLE256(CRC_SW_##poly##_SLICE0_REFLECTED)}
+#elif (HAL_CRC_SOFTWARE_ENGINE == 3U)
+#define CRC_SW_TABLE_ENTRIES (4U * 256U)
+#define CRC_SW_TABLE_INITIALIZER(poly)                                                       \
+    {                                                                                        \
+        CRC_SW_TABLE256(CRC_SW_##poly##_SLICE0), CRC_SW_TABLE256(CRC_SW_##poly##_SLICE1),    \
+            CRC_SW_TABLE256(CRC_SW_##poly##_SLICE2), CRC_SW_TABLE256(CRC_SW_##poly##_SLICE3) \
+    }
+#define CRC_SW_REFLECTED_TABLE_INITIALIZER(poly)                                      \
+    {                                                                                 \
+        CRC_SW_TABLE256(CRC_SW_##poly##_SLICE0_REFLECTED),                            \
+            CRC_SW_TABLE256(CRC_SW_##poly##_SLICE1_REFLECTED),                        \
+            CRC_SW_TABLE256(CRC_SW_##poly##_SLICE2_REFLECTED),                        \
+            CRC_SW_TABLE256(CRC_SW_##poly##_SLICE3_REFLECTED)                         \
+    }
+#else
+#error "HAL_CRC_SOFTWARE_ENGINE value is not supported"
+#endif
+
+/*! @brief Tables of a polynomial. */
+typedef struct _crc_sw_table
+{
+    uint32_t crcPoly;               /*!< MSB aligned polynomial */
+    const uint32_t *table;          /*!< Table for the MSB first processing of the input bytes */
+    const uint32_t *reflectedTable; /*!< Table for the LSB first processing of the input bytes */
+} crc_sw_table_t;
+#endif /* CRC_SW_TABLE_ENABLE */
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+#if (CRC_SW_TABLE_ENABLE > 0U)
+#if ((HAL_CRC_SOFTWARE_TABLE_POLYNOMIALS & HAL_CRC_SOFTWARE_TABLE_CRC_8) != 0U)
+static const uint32_t s_crcSwCrc8Table[CRC_SW_TABLE_ENTRIES]          = CRC_SW_TABLE_INITIALIZER(CRC8);
+static const uint32_t s_crcSwCrc8ReflectedTable[CRC_SW_TABLE_ENTRIES] = CRC_SW_REFLECTED_TABLE_INITIALIZER(CRC8);
+#endif
+#if ((HAL_CRC_SOFTWARE_TABLE_POLYNOMIALS & HAL_CRC_SOFTWARE_TABLE_CRC_16) != 0U)
+static const uint32_t s_crcSwCrc16Table[CRC_SW_TABLE_ENTRIES]          = CRC_SW_TABLE_INITIALIZER(CRC16);
+static const uint32_t s_crcSwCrc16ReflectedTable[CRC_SW_TABLE_ENTRIES] = CRC_SW_REFLECTED_TABLE_INITIALIZER(CRC16);
+#endif
+#if ((HAL_CRC_SOFTWARE_TABLE_POLYNOMIALS & HAL_CRC_SOFTWARE_TABLE_CRC_32) != 0U)
+static const uint32_t s_crcSwCrc32Table[CRC_SW_TABLE_ENTRIES]          = CRC_SW_TABLE_INITIALIZER(CRC32);
+static const uint32_t s_crcSwCrc32ReflectedTable[CRC_SW_TABLE_ENTRIES] = CRC_SW_REFLECTED_TABLE_INITIALIZER(CRC32);
+#endif
+
+static const crc_sw_table_t s_crcSwTables[] = {
+#if ((HAL_CRC_SOFTWARE_TABLE_POLYNOMIALS & HAL_CRC_SOFTWARE_TABLE_CRC_8) != 0U)
+    {(uint32_t)KHAL_CrcPolynomial_CRC_8_CCITT << 24U, s_crcSwCrc8Table, s_crcSwCrc8ReflectedTable},
+#endif
+#if ((HAL_CRC_SOFTWARE_TABLE_POLYNOMIALS & HAL_CRC_SOFTWARE_TABLE_CRC_16) != 0U)
+    {(uint32_t)KHAL_CrcPolynomial_CRC_16 << 16U, s_crcSwCrc16Table, s_crcSwCrc16ReflectedTable},
+#endif
+#if ((HAL_CRC_SOFTWARE_TABLE_POLYNOMIALS & HAL_CRC_SOFTWARE_TABLE_CRC_32) != 0U)
+    {(uint32_t)KHAL_CrcPolynomial_CRC_32, s_crcSwCrc32Table, s_crcSwCrc32ReflectedTable},
+#endif
+};
+#endif /* CRC_SW_TABLE_ENABLE */
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
-uint32_t HAL_CrcCompute(hal_crc_config_t *crcConfig, uint8_t *dataIn, uint32_t length)
+static uint32_t CRC_SwComputeBitwise(hal_crc_config_t *crcConfig, uint8_t *dataIn, uint32_t length)
 {
     uint32_t shiftReg    = crcConfig->crcSeed << ((4U - crcConfig->crcSize) << 3U);
     uint32_t crcPoly     = crcConfig->crcPoly << ((4U - crcConfig->crcSize) << 3U);
@@ -91,3 +259,168 @@ uint32_t HAL_CrcCompute(hal_crc_config_t *crcConfig, uint8_t *dataIn, uint32_t l
 
     return computedCRC;
 }
+
+#if (CRC_SW_TABLE_ENABLE > 0U)
+/* Bit reversal of a 32-bit word */
+static uint32_t CRC_SwReflect32(uint32_t value)
+{
+    value = ((value >> 1U) & 0x55555555U) | ((value & 0x55555555U) << 1U);
+    value = ((value >> 2U) & 0x33333333U) | ((value & 0x33333333U) << 2U);
+    value = ((value >> 4U) & 0x0F0F0F0FU) | ((value & 0x0F0F0F0FU) << 4U);
+    value = ((value >> 8U) & 0x00FF00FFU) | ((value & 0x00FF00FFU) << 8U);
+    return (value >> 16U) | (value << 16U);
+}
+
+static const crc_sw_table_t *CRC_SwGetTable(hal_crc_config_t *crcConfig)
+{
+    const crc_sw_table_t *table = NULL;
+    uint32_t crcPoly;
+
+    if ((crcConfig->crcSize > 0U) && (crcConfig->crcSize <= 4U))
+    {
+        crcPoly = crcConfig->crcPoly << ((4U - crcConfig->crcSize) << 3U);
+        for (uint32_t i = 0U; i < ARRAY_SIZE(s_crcSwTables); i++)
+        {
+            if (s_crcSwTables[i].crcPoly == crcPoly)
+            {
+                table = &s_crcSwTables[i];
+                break;
+            }
+        }
+    }
+
+    return table;
+}
+
+/* MSB first processing of the input, shiftReg holds the MSB aligned CRC register */
+static uint32_t CRC_SwProcess(const uint32_t *table, uint32_t shiftReg, const uint8_t *data, uint32_t length)
+{
+#if (HAL_CRC_SOFTWARE_ENGINE == 3U)
+    /* Process the bytes up to a word boundary, then a word at a time */
+    while ((length > 0U) && ((((uint32_t)data) & 3U) != 0U))
+    {
+        shiftReg = (shiftReg << 8U) ^ table[(shiftReg >> 24U) ^ (uint32_t)*data];
+        data++;
+        length--;
+    }
+    while (length >= 4U)
+    {
+        shiftReg ^= __REV(*(const uint32_t *)(const void *)data);
+        shiftReg = table[(3U * 256U) + (shiftReg >> 24U)] ^ table[(2U * 256U) + ((shiftReg >> 16U) & 0xFFU)] ^
+                   table[256U + ((shiftReg >> 8U) & 0xFFU)] ^ table[shiftReg & 0xFFU];
+        data += 4U;
+        length -= 4U;
+    }
+#endif
+    while (length > 0U)
+    {
+#if (HAL_CRC_SOFTWARE_ENGINE == 1U)
+        shiftReg = (shiftReg << 4U) ^ table[(shiftReg >> 28U) ^ ((uint32_t)*data >> 4U)];
+        shiftReg = (shiftReg << 4U) ^ table[(shiftReg >> 28U) ^ ((uint32_t)*data & 0x0FU)];
+#else
+        shiftReg = (shiftReg << 8U) ^ table[(shiftReg >> 24U) ^ (uint32_t)*data];
+#endif
+        data++;
+        length--;
+    }
+    return shiftReg;
+}
+
+/* LSB first processing of the input, shiftReg holds the bit reversed MSB aligned CRC register */
+static uint32_t CRC_SwProcessReflected(const uint32_t *table, uint32_t shiftReg, const uint8_t *data, uint32_t length)
+{
+#if (HAL_CRC_SOFTWARE_ENGINE == 3U)
+    /* Process the bytes up to a word boundary, then a word at a time */
+    while ((length > 0U) && ((((uint32_t)data) & 3U) != 0U))
+    {
+        shiftReg = (shiftReg >> 8U) ^ table[(shiftReg ^ (uint32_t)*data) & 0xFFU];
+        data++;
+        length--;
+    }
+    while (length >= 4U)
+    {
+        /* Little endian core, the first byte of the word is its LSB */
+        shiftReg ^= *(const uint32_t *)(const void *)data;
+        shiftReg = table[(3U * 256U) + (shiftReg & 0xFFU)] ^ table[(2U * 256U) + ((shiftReg >> 8U) & 0xFFU)] ^
+                   table[256U + ((shiftReg >> 16U) & 0xFFU)] ^ table[shiftReg >> 24U];
+        data += 4U;
+        length -= 4U;
+    }
+#endif
+    while (length > 0U)
+    {
+#if (HAL_CRC_SOFTWARE_ENGINE == 1U)
+        shiftReg = (shiftReg >> 4U) ^ table[(shiftReg ^ (uint32_t)*data) & 0x0FU];
+        shiftReg = (shiftReg >> 4U) ^ table[(shiftReg ^ ((uint32_t)*data >> 4U)) & 0x0FU];
+#else
+        shiftReg = (shiftReg >> 8U) ^ table[(shiftReg ^ (uint32_t)*data) & 0xFFU];
+#endif
+        data++;
+        length--;
+    }
+    return shiftReg;
+}
+
+static uint32_t CRC_SwComputeWithTable(hal_crc_config_t *crcConfig,
+                                       const crc_sw_table_t *table,
+                                       uint8_t *dataIn,
+                                       uint32_t length)
+{
+    uint32_t shift       = (4U - crcConfig->crcSize) << 3U;
+    uint32_t shiftReg    = crcConfig->crcSeed << shift;
+    uint32_t crcXorOut   = crcConfig->crcXorOut << shift;
+    uint32_t startOffset = crcConfig->crcStartByte;
+    uint32_t computedCRC;
+
+    length = (length > startOffset) ? (length - startOffset) : 0U;
+
+    if (crcConfig->crcRefIn == KHAL_CrcRefInput)
+    {
+        /* Reflected input bytes are processed LSB first on the bit reversed register */
+        shiftReg = CRC_SwProcessReflected(table->reflectedTable, CRC_SwReflect32(shiftReg), &dataIn[startOffset],
+                                          length);
+        if (crcConfig->crcByteOrder == KHAL_CrcMSByteFirst)
+        {
+            computedCRC = (CRC_SwReflect32(shiftReg) ^ crcXorOut) >> shift;
+        }
+        else
+        {
+            computedCRC = shiftReg ^ CRC_SwReflect32(crcXorOut);
+        }
+    }
+    else
+    {
+        shiftReg = CRC_SwProcess(table->table, shiftReg, &dataIn[startOffset], length) ^ crcXorOut;
+        if (crcConfig->crcByteOrder == KHAL_CrcMSByteFirst)
+        {
+            computedCRC = shiftReg >> shift;
+        }
+        else
+        {
+            computedCRC = CRC_SwReflect32(shiftReg);
+        }
+    }
+
+    return computedCRC;
+}
+#endif /* CRC_SW_TABLE_ENABLE */
+
+uint32_t HAL_CrcCompute(hal_crc_config_t *crcConfig, uint8_t *dataIn, uint32_t length)
+{
+    uint32_t computedCRC;
+#if (CRC_SW_TABLE_ENABLE > 0U)
+    const crc_sw_table_t *table = CRC_SwGetTable(crcConfig);
+
+    if (NULL != table)
+    {
+        computedCRC = CRC_SwComputeWithTable(crcConfig, table, dataIn, length);
+    }
+    else
+#endif /* CRC_SW_TABLE_ENABLE */
+    {
+        /* Size 0 or polynomial without table */
+        computedCRC = CRC_SwComputeBitwise(crcConfig, dataIn, length);
+    }
+
+    return computedCRC;
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host test of the software CRC adapter engines.
+ *
+ * Build and run from this directory, once per engine (0 to 3):
+ *   gcc -O2 -Wno-pointer-to-int-cast -I. -I.. -DHAL_CRC_SOFTWARE_ENGINE=1U -o crc_test crc_test.c && ./crc_test
+ *
+ * HAL_CrcCompute() is checked against catalogued check values and against the bit by bit computation of the adapter,
+ * CRC_SwComputeBitwise(), on random configurations, start bytes, lengths and buffer alignments. It then measures the
+ * throughput of both on the host. The exit code is 0 on success.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "fsl_adapter_software_crc.c"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_RANDOM_NUM   (300000U)
+#define TEST_BUFFER_SIZE  (600U)
+#define TEST_BENCH_SIZE   (4096U)
+#define TEST_BENCH_ROUNDS (2000U)
+
+typedef struct _test_check_value
+{
+    const char *name;
+    hal_crc_config_t config;
+    uint32_t check;
+} test_check_value_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* CRC of "123456789", from the catalogue of parametrised CRC algorithms. */
+static const test_check_value_t s_checkValues[] = {
+    {"CRC-16/XMODEM",
+     {KHAL_CrcInputNoRef, KHAL_CrcOutputNoRef, KHAL_CrcMSByteFirst, 0x0000U, KHAL_CrcPolynomial_CRC_16, 0x0000U, 0U,
+      2U},
+     0x31C3U},
+    {"CRC-16/IBM-3740",
+     {KHAL_CrcInputNoRef, KHAL_CrcOutputNoRef, KHAL_CrcMSByteFirst, 0xFFFFU, KHAL_CrcPolynomial_CRC_16, 0x0000U, 0U,
+      2U},
+     0x29B1U},
+    {"CRC-32/MPEG-2",
+     {KHAL_CrcInputNoRef, KHAL_CrcOutputNoRef, KHAL_CrcMSByteFirst, 0xFFFFFFFFU, KHAL_CrcPolynomial_CRC_32, 0x00000000U,
+      0U, 4U},
+     0x0376E6E7U},
+    {"CRC-32/ISO-HDLC",
+     {KHAL_CrcRefInput, KHAL_CrcRefOutput, KHAL_CrcLSByteFirst, 0xFFFFFFFFU, KHAL_CrcPolynomial_CRC_32, 0xFFFFFFFFU, 0U,
+      4U},
+     0xCBF43926U},
+};
+
+static const uint32_t s_polynomials[] = {KHAL_CrcPolynomial_CRC_8_CCITT, KHAL_CrcPolynomial_CRC_16,
+                                         KHAL_CrcPolynomial_CRC_32};
+static const uint8_t s_sizes[]        = {1U, 2U, 4U};
+
+static uint32_t s_buffer[(TEST_BENCH_SIZE / sizeof(uint32_t)) + 1U];
+static uint32_t s_seed = 1U;
+static int s_failures;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t Random(void)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+    return s_seed >> 8U;
+}
+
+static void TestCheckValues(void)
+{
+    uint8_t data[] = "123456789";
+
+    for (uint32_t i = 0U; i < ARRAY_SIZE(s_checkValues); i++)
+    {
+        hal_crc_config_t config = s_checkValues[i].config;
+        uint32_t crc            = HAL_CrcCompute(&config, data, 9U);
+
+        if (crc != s_checkValues[i].check)
+        {
+            printf("FAIL: %s is 0x%08X, expected 0x%08X\n", s_checkValues[i].name, crc, s_checkValues[i].check);
+            s_failures++;
+        }
+    }
+}
+
+static void TestRandom(void)
+{
+    uint8_t *buffer     = (uint8_t *)s_buffer;
+    uint32_t mismatches = 0U;
+
+    for (uint32_t n = 0U; n < TEST_RANDOM_NUM; n++)
+    {
+        hal_crc_config_t config;
+        uint32_t index  = Random() % ARRAY_SIZE(s_polynomials);
+        uint32_t mask   = (s_sizes[index] == 4U) ? 0xFFFFFFFFU : ((1U << (8U * s_sizes[index])) - 1U);
+        uint32_t offset = Random() % 4U;
+        uint32_t length = ((Random() % 50U) == 0U) ? (Random() % (TEST_BUFFER_SIZE - 4U)) : (Random() % 40U);
+
+        config.crcSize            = s_sizes[index];
+        config.crcPoly            = s_polynomials[index];
+        config.crcSeed            = Random() & mask;
+        config.crcXorOut          = ((Random() & 1U) != 0U) ? mask : (Random() & mask);
+        config.crcRefIn           = ((Random() & 1U) != 0U) ? KHAL_CrcRefInput : KHAL_CrcInputNoRef;
+        config.crcRefOut          = ((Random() & 1U) != 0U) ? KHAL_CrcRefOutput : KHAL_CrcOutputNoRef;
+        config.crcByteOrder       = ((Random() & 1U) != 0U) ? KHAL_CrcMSByteFirst : KHAL_CrcLSByteFirst;
+        config.crcStartByte       = (uint8_t)(Random() % 5U);
+        config.complementChecksum = 0U;
+        for (uint32_t i = 0U; i < (offset + length); i++)
+        {
+            buffer[i] = (uint8_t)Random();
+        }
+
+        if (HAL_CrcCompute(&config, &buffer[offset], length) != CRC_SwComputeBitwise(&config, &buffer[offset], length))
+        {
+            if (mismatches < 5U)
+            {
+                printf("FAIL: size %u refin %u byte order %u start %u length %u offset %u\n", config.crcSize,
+                       (uint32_t)config.crcRefIn, (uint32_t)config.crcByteOrder, config.crcStartByte, length, offset);
+            }
+            mismatches++;
+        }
+    }
+    if (mismatches != 0U)
+    {
+        s_failures++;
+    }
+    printf("random configurations: %u checked, %u mismatches\n", TEST_RANDOM_NUM, mismatches);
+}
+
+static double BenchMBps(uint32_t (*compute)(hal_crc_config_t *, uint8_t *, uint32_t), hal_crc_config_t *config)
+{
+    volatile uint32_t sink = 0U;
+    uint64_t start         = NowNs();
+
+    for (uint32_t n = 0U; n < TEST_BENCH_ROUNDS; n++)
+    {
+        config->crcSeed = n;
+        sink ^= compute(config, (uint8_t *)s_buffer, TEST_BENCH_SIZE);
+    }
+    (void)sink;
+    return ((double)TEST_BENCH_SIZE * TEST_BENCH_ROUNDS * 1000.0) / (double)(NowNs() - start);
+}
+
+static void TestBenchmark(void)
+{
+    printf("engine %u, %u byte buffer, host MB/s\n", (uint32_t)HAL_CRC_SOFTWARE_ENGINE, TEST_BENCH_SIZE);
+    printf("polynomial  refin  HAL_CrcCompute  bitwise  speedup\n");
+    for (uint32_t i = 0U; i < ARRAY_SIZE(s_buffer); i++)
+    {
+        s_buffer[i] = Random();
+    }
+    for (uint32_t index = 0U; index < ARRAY_SIZE(s_polynomials); index++)
+    {
+        for (uint32_t refIn = 0U; refIn < 2U; refIn++)
+        {
+            hal_crc_config_t config = {(hal_crc_cfg_refin_t)refIn, KHAL_CrcOutputNoRef, KHAL_CrcMSByteFirst, 0U,
+                                       s_polynomials[index], 0U, 0U, s_sizes[index]};
+            double table   = BenchMBps(HAL_CrcCompute, &config);
+            double bitwise = BenchMBps(CRC_SwComputeBitwise, &config);
+
+            printf("CRC-%-2u      %u      %14.1f  %7.1f  %6.1fx\n", 8U * s_sizes[index], refIn, table, bitwise,
+                   table / bitwise);
+        }
+    }
+}
+
+int main(void)
+{
+    TestCheckValues();
+    TestRandom();
+    TestBenchmark();
+
+    printf("%s\n", (s_failures == 0) ? "PASS" : "FAIL");
+    return (s_failures == 0) ? 0 : 1;
+}
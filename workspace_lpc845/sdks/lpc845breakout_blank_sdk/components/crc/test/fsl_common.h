@@ -0,0 +1,25 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of fsl_common.h for the software CRC adapter test, see crc_test.c. */
+
+#ifndef _FSL_COMMON_H_
+#define _FSL_COMMON_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
+
+static inline uint32_t __REV(uint32_t value)
+{
+    return __builtin_bswap32(value);
+}
+
+#endif /* _FSL_COMMON_H_ */
@@ -0,0 +1,378 @@
+/*
+ * Copyright 2024 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*! *********************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+********************************************************************************** */
+#include "fsl_component_flash_writer.h"
+#include "fsl_iap.h"
+#include <string.h>
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private macros
+*************************************************************************************
+********************************************************************************** */
+
+/* Converts a flash address to a pointer, the flash is memory mapped. */
+#ifndef FLASH_WRITER_FLASH_POINTER
+#define FLASH_WRITER_FLASH_POINTER(address) ((const uint8_t *)(uintptr_t)(address))
+#endif
+
+#define FLASH_WRITER_PAGE_WORDS (FLASH_WRITER_PAGE_SIZE / sizeof(uint32_t))
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private type definitions
+*************************************************************************************
+********************************************************************************** */
+
+/* Next operation on the oldest page. */
+typedef enum _flash_writer_step
+{
+    kFLASH_WriterStepStart = 0U, /* Compare the page with the flash */
+    kFLASH_WriterStepErase,      /* Erase the page */
+    kFLASH_WriterStepProgram,    /* Program the page */
+    kFLASH_WriterStepVerify,     /* Compare the flash with the page */
+} flash_writer_step_t;
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private functions
+*************************************************************************************
+********************************************************************************** */
+
+static flash_writer_page_t *FLASH_WriterBuffer(flash_writer_handle_t *handle, uint32_t position)
+{
+    return &handle->pages[(handle->head + position) % FLASH_WRITER_PAGE_BUFFER_NUM];
+}
+
+/* Finds the newest buffer of a page. With merge, only a buffer the engine has not started on is returned. */
+static flash_writer_page_t *FLASH_WriterFind(flash_writer_handle_t *handle, uint32_t page, bool merge)
+{
+    flash_writer_page_t *buffer;
+
+    for (uint32_t position = handle->count; position > 0U; position--)
+    {
+        buffer = FLASH_WriterBuffer(handle, position - 1U);
+        if (page == buffer->page)
+        {
+            if (merge && (1U == position) && ((uint8_t)kFLASH_WriterStepStart != handle->step))
+            {
+                return NULL;
+            }
+            return buffer;
+        }
+    }
+    return NULL;
+}
+
+static void FLASH_WriterClose(flash_writer_handle_t *handle, flash_writer_page_t *buffer)
+{
+    if (!buffer->ready)
+    {
+        buffer->ready = true;
+        handle->progress.pagesQueued++;
+    }
+}
+
+/* Opens the buffer of a page, initialized with the content the page will have once the older buffers are done. */
+static flash_writer_page_t *FLASH_WriterOpen(flash_writer_handle_t *handle, uint32_t page)
+{
+    const flash_writer_page_t *previous = FLASH_WriterFind(handle, page, false);
+    flash_writer_page_t *buffer;
+
+    if (0U != handle->count)
+    {
+        FLASH_WriterClose(handle, FLASH_WriterBuffer(handle, handle->count - 1U));
+    }
+
+    buffer = FLASH_WriterBuffer(handle, handle->count);
+    if (NULL != previous)
+    {
+        (void)memcpy(buffer->data, previous->data, FLASH_WRITER_PAGE_SIZE);
+    }
+    else
+    {
+        (void)memcpy(buffer->data, FLASH_WRITER_FLASH_POINTER(page * FLASH_WRITER_PAGE_SIZE), FLASH_WRITER_PAGE_SIZE);
+    }
+    buffer->page  = (uint16_t)page;
+    buffer->ready = false;
+    handle->count++;
+
+    return buffer;
+}
+
+/* Ends the work on the oldest page and frees its buffer. */
+static status_t FLASH_WriterComplete(flash_writer_handle_t *handle, status_t status)
+{
+    uint32_t address = (uint32_t)FLASH_WriterBuffer(handle, 0U)->page * FLASH_WRITER_PAGE_SIZE;
+
+    handle->progress.pagesDone++;
+    if ((kStatus_FLASH_WriterSuccess != status) && (kStatus_FLASH_WriterSuccess == handle->progress.status))
+    {
+        handle->progress.status = status;
+    }
+    handle->step = (uint8_t)kFLASH_WriterStepStart;
+    handle->head = (uint8_t)((handle->head + 1U) % FLASH_WRITER_PAGE_BUFFER_NUM);
+    handle->count--;
+
+    /* The buffer is free, the callback can write again */
+    if (NULL != handle->callback)
+    {
+        handle->callback(handle, address, status, handle->userData);
+    }
+    return status;
+}
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+********************************************************************************** */
+
+void FLASH_WriterInit(flash_writer_handle_t *handle, flash_writer_callback_t callback, void *userData)
+{
+    assert(NULL != handle);
+
+    (void)memset(handle, 0, sizeof(*handle));
+    handle->callback        = callback;
+    handle->userData        = userData;
+    handle->progress.status = kStatus_FLASH_WriterSuccess;
+}
+
+status_t FLASH_WriterWrite(flash_writer_handle_t *handle, uint32_t address, const void *data, uint32_t length)
+{
+    const uint8_t *source = (const uint8_t *)data;
+    flash_writer_page_t *buffer;
+    uint32_t firstPage;
+    uint32_t lastPage;
+    uint32_t needed = 0U;
+    uint32_t offset;
+    uint32_t chunk;
+
+    assert(NULL != handle);
+
+    if (0U == length)
+    {
+        return kStatus_FLASH_WriterSuccess;
+    }
+    if ((NULL == data) || (address >= FLASH_WRITER_FLASH_SIZE) || (length > (FLASH_WRITER_FLASH_SIZE - address)))
+    {
+        return kStatus_FLASH_WriterInvalidArgument;
+    }
+
+    firstPage = address / FLASH_WRITER_PAGE_SIZE;
+    lastPage  = (address + length - 1U) / FLASH_WRITER_PAGE_SIZE;
+    if ((lastPage - firstPage) >= FLASH_WRITER_PAGE_BUFFER_NUM)
+    {
+        return kStatus_FLASH_WriterInvalidArgument;
+    }
+
+    /* FLASH_WriterProcess() leaves the buffers alone until the write is done */
+    handle->writing = true;
+    __DMB();
+
+    for (uint32_t page = firstPage; page <= lastPage; page++)
+    {
+        if (NULL == FLASH_WriterFind(handle, page, true))
+        {
+            needed++;
+        }
+    }
+    if ((handle->count + needed) > FLASH_WRITER_PAGE_BUFFER_NUM)
+    {
+        __DMB();
+        handle->writing = false;
+        return kStatus_FLASH_WriterBusy;
+    }
+
+    for (uint32_t page = firstPage; page <= lastPage; page++)
+    {
+        buffer = FLASH_WriterFind(handle, page, true);
+        if (NULL == buffer)
+        {
+            buffer = FLASH_WriterOpen(handle, page);
+        }
+        else if (buffer != FLASH_WriterBuffer(handle, handle->count - 1U))
+        {
+            /* The write went back to an older page, the page being written is closed */
+            FLASH_WriterClose(handle, FLASH_WriterBuffer(handle, handle->count - 1U));
+        }
+        else
+        {
+            /* Still writing the same page */
+        }
+
+        offset = address - (page * FLASH_WRITER_PAGE_SIZE);
+        chunk  = MIN(length, FLASH_WRITER_PAGE_SIZE - offset);
+        (void)memcpy(&((uint8_t *)buffer->data)[offset], source, chunk);
+        if (FLASH_WRITER_PAGE_SIZE == (offset + chunk))
+        {
+            FLASH_WriterClose(handle, buffer);
+        }
+
+        source += chunk;
+        address += chunk;
+        length -= chunk;
+    }
+
+    __DMB();
+    handle->writing = false;
+    return kStatus_FLASH_WriterSuccess;
+}
+
+void FLASH_WriterFlush(flash_writer_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    if (0U != handle->count)
+    {
+        FLASH_WriterClose(handle, FLASH_WriterBuffer(handle, handle->count - 1U));
+    }
+}
+
+status_t FLASH_WriterProcess(flash_writer_handle_t *handle)
+{
+    flash_writer_page_t *buffer;
+    const uint32_t *flash;
+    uint32_t address;
+    uint32_t sector;
+    bool blank = true;
+    bool same  = true;
+    status_t status;
+
+    assert(NULL != handle);
+
+    if (handle->writing || (0U == handle->count))
+    {
+        return kStatus_FLASH_WriterIdle;
+    }
+    buffer = FLASH_WriterBuffer(handle, 0U);
+    if (!buffer->ready)
+    {
+        return kStatus_FLASH_WriterIdle;
+    }
+
+    address = (uint32_t)buffer->page * FLASH_WRITER_PAGE_SIZE;
+    sector  = address / FLASH_WRITER_SECTOR_SIZE;
+
+    if ((uint8_t)kFLASH_WriterStepStart == handle->step)
+    {
+        /* Word compare, no IAP call: a page already holding the data is skipped, a blank page is not erased */
+        flash = (const uint32_t *)(const void *)FLASH_WRITER_FLASH_POINTER(address);
+        for (uint32_t i = 0U; i < FLASH_WRITER_PAGE_WORDS; i++)
+        {
+            same  = same && (flash[i] == buffer->data[i]);
+            blank = blank && (0xFFFFFFFFU == flash[i]);
+        }
+        if (same)
+        {
+            handle->progress.pagesSkipped++;
+            return FLASH_WriterComplete(handle, kStatus_FLASH_WriterSuccess);
+        }
+        handle->retry = (uint8_t)FLASH_WRITER_RETRY_NUM;
+        handle->step  = (uint8_t)(blank ? kFLASH_WriterStepProgram : kFLASH_WriterStepErase);
+    }
+
+    switch (handle->step)
+    {
+        case (uint8_t)kFLASH_WriterStepErase:
+            status = IAP_PrepareSectorForWrite(sector, sector);
+            if (kStatus_IAP_Success == status)
+            {
+                status = IAP_ErasePage(buffer->page, buffer->page, SystemCoreClock);
+            }
+            handle->progress.pagesErased++;
+            if (kStatus_IAP_Success != status)
+            {
+                return FLASH_WriterComplete(handle, kStatus_FLASH_WriterFlashError);
+            }
+            handle->step = (uint8_t)kFLASH_WriterStepProgram;
+            break;
+
+        case (uint8_t)kFLASH_WriterStepProgram:
+            status = IAP_PrepareSectorForWrite(sector, sector);
+            if (kStatus_IAP_Success == status)
+            {
+                status = IAP_CopyRamToFlash(address, buffer->data, FLASH_WRITER_PAGE_SIZE, SystemCoreClock);
+            }
+            handle->progress.pagesProgrammed++;
+            if (kStatus_IAP_Success != status)
+            {
+                return FLASH_WriterComplete(handle, kStatus_FLASH_WriterFlashError);
+            }
+            handle->step = (uint8_t)kFLASH_WriterStepVerify;
+            break;
+
+        default:
+            status = IAP_Compare(address, buffer->data, FLASH_WRITER_PAGE_SIZE);
+            if (kStatus_IAP_Success == status)
+            {
+                return FLASH_WriterComplete(handle, kStatus_FLASH_WriterSuccess);
+            }
+            if ((kStatus_IAP_CompareError != status) || (0U == handle->retry))
+            {
+                return FLASH_WriterComplete(handle, (kStatus_IAP_CompareError == status) ?
+                                                        kStatus_FLASH_WriterVerifyError :
+                                                        kStatus_FLASH_WriterFlashError);
+            }
+            handle->retry--;
+            handle->step = (uint8_t)kFLASH_WriterStepErase;
+            break;
+    }
+
+    return kStatus_FLASH_WriterSuccess;
+}
+
+void FLASH_WriterTimerCallback(void *param)
+{
+    (void)FLASH_WriterProcess((flash_writer_handle_t *)param);
+}
+
+bool FLASH_WriterIsIdle(flash_writer_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    return (0U == handle->count);
+}
+
+void FLASH_WriterGetProgress(flash_writer_handle_t *handle, flash_writer_progress_t *progress)
+{
+    assert(NULL != handle);
+    assert(NULL != progress);
+
+    *progress              = handle->progress;
+    progress->pagesPending = handle->count;
+}
+
+#if defined(FSL_FEATURE_IAP_HAS_FLASH_EXTENDED_SIGNATURE_READ) && FSL_FEATURE_IAP_HAS_FLASH_EXTENDED_SIGNATURE_READ
+status_t FLASH_WriterReadSignature(uint32_t address, uint32_t length, uint32_t signature[4])
+{
+    uint32_t waitStates = 0U;
+    status_t status;
+
+    assert(NULL != signature);
+
+    if ((0U == length) || (0U != (address % FLASH_WRITER_PAGE_SIZE)) || (0U != (length % FLASH_WRITER_PAGE_SIZE)) ||
+        (address >= FLASH_WRITER_FLASH_SIZE) || (length > (FLASH_WRITER_FLASH_SIZE - address)))
+    {
+        return kStatus_FLASH_WriterInvalidArgument;
+    }
+
+#if defined(FLASH_CTRL_FLASHCFG_FLASHTIM_MASK)
+    /* The flash controller reads the pages with the wait states in use */
+    waitStates = (FLASH_CTRL->FLASHCFG & FLASH_CTRL_FLASHCFG_FLASHTIM_MASK) >> FLASH_CTRL_FLASHCFG_FLASHTIM_SHIFT;
+#endif
+    status = IAP_ExtendedFlashSignatureRead(address / FLASH_WRITER_PAGE_SIZE,
+                                            ((address + length) / FLASH_WRITER_PAGE_SIZE) - 1U, waitStates, signature);
+
+    return (kStatus_IAP_Success == status) ? kStatus_FLASH_WriterSuccess : kStatus_FLASH_WriterFlashError;
+}
+#endif /* FSL_FEATURE_IAP_HAS_FLASH_EXTENDED_SIGNATURE_READ */
@@ -0,0 +1,219 @@
+/*
+ * Copyright 2024 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_COMPONENT_FLASH_WRITER_H_
+#define _FSL_COMPONENT_FLASH_WRITER_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup FlashWriter
+ * @{
+ */
+
+/**********************************************************************************
+ * Public macro definitions
+ ***********************************************************************************/
+
+/*! @brief Number of page buffers in RAM. FLASH_WriterWrite() fills one while the others wait to be programmed, so the
+ * default of 4 queues up to three closed pages, and a single write spans at most this many pages. */
+#ifndef FLASH_WRITER_PAGE_BUFFER_NUM
+#define FLASH_WRITER_PAGE_BUFFER_NUM (4U)
+#endif
+
+/*! @brief Number of times a page that fails the verification is erased and programmed again. */
+#ifndef FLASH_WRITER_RETRY_NUM
+#define FLASH_WRITER_RETRY_NUM (1U)
+#endif
+
+/*! @brief Flash page size, the unit the writer programs and erases. */
+#define FLASH_WRITER_PAGE_SIZE (FSL_FEATURE_SYSCON_FLASH_PAGE_SIZE_BYTES)
+
+/*! @brief Flash sector size, the unit IAP_PrepareSectorForWrite() works on. */
+#define FLASH_WRITER_SECTOR_SIZE (FSL_FEATURE_SYSCON_FLASH_SECTOR_SIZE_BYTES)
+
+/*! @brief Flash size. */
+#define FLASH_WRITER_FLASH_SIZE (FSL_FEATURE_SYSCON_FLASH_SIZE_BYTES)
+
+/**********************************************************************************
+ * Public type definitions
+ ***********************************************************************************/
+
+/*! @brief The status of the flash writer */
+typedef enum _flash_writer_status
+{
+    kStatus_FLASH_WriterSuccess         = kStatus_Success,                           /*!< Success */
+    kStatus_FLASH_WriterInvalidArgument = MAKE_STATUS(kStatusGroup_FLASH_WRITER, 1), /*!< Invalid argument */
+    kStatus_FLASH_WriterBusy            = MAKE_STATUS(kStatusGroup_FLASH_WRITER, 2), /*!< No free page buffer */
+    kStatus_FLASH_WriterIdle            = MAKE_STATUS(kStatusGroup_FLASH_WRITER, 3), /*!< No page ready to program */
+    kStatus_FLASH_WriterFlashError      = MAKE_STATUS(kStatusGroup_FLASH_WRITER, 4), /*!< IAP program or erase failed */
+    kStatus_FLASH_WriterVerifyError     = MAKE_STATUS(kStatusGroup_FLASH_WRITER, 5), /*!< Page does not verify */
+} flash_writer_status_t;
+
+/*! @brief Flash writer handle typedef. */
+typedef struct _flash_writer_handle flash_writer_handle_t;
+
+/*!
+ * @brief Page callback.
+ *
+ * Called by FLASH_WriterProcess() when a page is done, with the flash address of the page and the result.
+ */
+typedef void (*flash_writer_callback_t)(flash_writer_handle_t *handle,
+                                        uint32_t address,
+                                        status_t status,
+                                        void *userData);
+
+/*! @brief Progress of the writer. */
+typedef struct _flash_writer_progress
+{
+    uint32_t pagesQueued;     /*!< Pages handed to the engine, buffered pages not included. */
+    uint32_t pagesDone;       /*!< Pages done, programmed, unchanged or failed. */
+    uint32_t pagesProgrammed; /*!< Pages programmed. */
+    uint32_t pagesErased;     /*!< Pages erased. */
+    uint32_t pagesSkipped;    /*!< Pages left as they were, the flash already held the data. */
+    uint32_t pagesPending;    /*!< Pages in the RAM buffers, not done yet. */
+    status_t status;          /*!< First error, kStatus_FLASH_WriterSuccess if none. */
+} flash_writer_progress_t;
+
+/*! @brief Page buffer, users should not touch the content of the buffer. */
+typedef struct _flash_writer_page
+{
+    uint32_t data[FLASH_WRITER_PAGE_SIZE / sizeof(uint32_t)]; /*!< Content of the page, word aligned for the IAP. */
+    uint16_t page;                                             /*!< Flash page number. */
+    bool ready;                                                /*!< The page is closed and can be programmed. */
+} flash_writer_page_t;
+
+/*!
+ * @brief Flash writer handle, users should not touch the content of the handle.
+ *
+ * The page buffers form a FIFO, the pages are programmed in the order they are opened. The engine works on the
+ * oldest page, @p step tells which IAP operation comes next.
+ */
+struct _flash_writer_handle
+{
+    flash_writer_page_t pages[FLASH_WRITER_PAGE_BUFFER_NUM]; /*!< Page buffers. */
+    flash_writer_callback_t callback;                        /*!< Page callback, can be NULL. */
+    void *userData;                                          /*!< Parameter of the callback. */
+    flash_writer_progress_t progress;                        /*!< Counters and first error. */
+    uint8_t head;                                            /*!< Oldest page buffer. */
+    uint8_t count;                                           /*!< Page buffers in use. */
+    uint8_t step;                                            /*!< Next operation on the oldest page. */
+    uint8_t retry;                                           /*!< Retries left for the oldest page. */
+    volatile bool writing;                                   /*!< FLASH_WriterWrite() is updating the buffers. */
+};
+
+/**********************************************************************************
+ * API
+ **********************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* _cplusplus */
+
+/*!
+ * @brief Initializes the flash writer.
+ *
+ * @param handle - Flash writer handle.
+ * @param callback - Page callback, can be NULL.
+ * @param userData - Parameter of the callback.
+ */
+void FLASH_WriterInit(flash_writer_handle_t *handle, flash_writer_callback_t callback, void *userData);
+
+/*!
+ * @brief Writes data to the flash, through the RAM page buffers.
+ *
+ * The data is copied to the buffer of its page, nothing is programmed here. A page is read from the flash when its
+ * buffer is opened, so the bytes that are not written keep their content. Writes to a page that is still buffered
+ * are merged into its buffer, so a page is programmed once however it is written. A page is closed, and handed to
+ * FLASH_WriterProcess(), when its last byte is written, when a write goes to another page, or by FLASH_WriterFlush().
+ *
+ * @param handle - Flash writer handle.
+ * @param address - Flash address.
+ * @param data - Data to write.
+ * @param length - Data length in bytes.
+ *
+ * @retval kStatus_FLASH_WriterSuccess The data is buffered.
+ * @retval kStatus_FLASH_WriterInvalidArgument The range is outside of the flash.
+ * @retval kStatus_FLASH_WriterBusy Not enough free page buffers, nothing is written. Call FLASH_WriterProcess() and
+ *                                  try again.
+ */
+status_t FLASH_WriterWrite(flash_writer_handle_t *handle, uint32_t address, const void *data, uint32_t length);
+
+/*!
+ * @brief Closes the page being written, so that it is programmed.
+ *
+ * @param handle - Flash writer handle.
+ */
+void FLASH_WriterFlush(flash_writer_handle_t *handle);
+
+/*!
+ * @brief Runs one IAP operation on the oldest closed page.
+ *
+ * A page takes three calls: erase, program, and verify with IAP_Compare(). The erase is skipped when the page is
+ * blank, and a page the flash already holds is done without any IAP call. A page that fails the verification is
+ * erased and programmed again, up to FLASH_WRITER_RETRY_NUM times. The IAP driver disables the interrupts for each
+ * operation, so the interrupts are held off for one page erase or program at most per call, instead of a whole
+ * sector. Call it from the idle loop, or from a timer_manager callback, see FLASH_WriterTimerCallback().
+ *
+ * @param handle - Flash writer handle.
+ *
+ * @retval kStatus_FLASH_WriterSuccess An operation ran.
+ * @retval kStatus_FLASH_WriterIdle No closed page, or FLASH_WriterWrite() is running.
+ * @retval kStatus_FLASH_WriterFlashError An IAP operation failed, the page is dropped.
+ * @retval kStatus_FLASH_WriterVerifyError The page does not verify after the retries, the page is dropped.
+ */
+status_t FLASH_WriterProcess(flash_writer_handle_t *handle);
+
+/*!
+ * @brief Timer callback running FLASH_WriterProcess(), install it with TM_InstallCallback() and the handle as the
+ * parameter.
+ *
+ * @param param - Flash writer handle.
+ */
+void FLASH_WriterTimerCallback(void *param);
+
+/*!
+ * @brief Checks whether all the written data is in the flash.
+ *
+ * @param handle - Flash writer handle.
+ *
+ * @retval true No page is buffered.
+ * @retval false Pages are buffered, call FLASH_WriterFlush() and FLASH_WriterProcess().
+ */
+bool FLASH_WriterIsIdle(flash_writer_handle_t *handle);
+
+/*!
+ * @brief Gets the progress of the writer.
+ *
+ * @param handle - Flash writer handle.
+ * @param progress - Returns the progress.
+ */
+void FLASH_WriterGetProgress(flash_writer_handle_t *handle, flash_writer_progress_t *progress);
+
+#if defined(FSL_FEATURE_IAP_HAS_FLASH_EXTENDED_SIGNATURE_READ) && FSL_FEATURE_IAP_HAS_FLASH_EXTENDED_SIGNATURE_READ
+/*!
+ * @brief Reads the signature of a flash range, to check a whole image at once.
+ *
+ * The signature is computed by the flash controller with IAP_ExtendedFlashSignatureRead(), compare it with the one of
+ * the reference image. The interrupts are disabled while the pages are read.
+ *
+ * @param address - Flash address, page aligned.
+ * @param length - Length in bytes, a multiple of the page size.
+ * @param signature - Returns the 128-bit signature.
+ *
+ * @retval kStatus_FLASH_WriterSuccess The signature is read.
+ * @retval kStatus_FLASH_WriterInvalidArgument The range is not page aligned or outside of the flash.
+ * @retval kStatus_FLASH_WriterFlashError The IAP call failed.
+ */
+status_t FLASH_WriterReadSignature(uint32_t address, uint32_t length, uint32_t signature[4]);
+#endif /* FSL_FEATURE_IAP_HAS_FLASH_EXTENDED_SIGNATURE_READ */
+
+#if defined(__cplusplus)
+}
+#endif
+/*! @}*/
+#endif /* _FSL_COMPONENT_FLASH_WRITER_H_ */
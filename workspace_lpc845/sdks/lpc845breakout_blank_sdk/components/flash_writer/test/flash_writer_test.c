@@ -0,0 +1,354 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host test of the flash writer over a simulated flash.
+ *
+ * Build and run from this directory:
+ *   gcc -O2 -I. -I.. -o flash_writer_test flash_writer_test.c && ./flash_writer_test
+ *
+ * The simulated IAP refuses to program a page that is not blank or a sector that is not prepared, and counts the
+ * erase, program and compare operations of each FLASH_WriterProcess() call. The test streams a firmware image in
+ * small chunks, then runs random overlapping writes interleaved with random process and flush calls while programs
+ * are corrupted now and then, and checks the flash against a model of the written data after each phase. It also
+ * checks that a page which never verifies is reported and that the signature range is checked. The exit code is 0
+ * on success.
+ */
+
+#include <stdio.h>
+
+#include "fsl_iap.h"
+
+/* The writer reads the simulated flash. */
+#define FLASH_WRITER_FLASH_POINTER(address) ((const uint8_t *)&s_flash[(address)])
+static uint8_t s_flash[FSL_FEATURE_SYSCON_FLASH_SIZE_BYTES] __attribute__((aligned(4)));
+
+#include "fsl_component_flash_writer.c"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_PAGE_NUM     (FLASH_WRITER_FLASH_SIZE / FLASH_WRITER_PAGE_SIZE)
+#define TEST_IMAGE_START  (0x2000U)
+#define TEST_IMAGE_END    (0xE000U)
+#define TEST_CHUNK_SIZE   (20U)
+#define TEST_RANDOM_NUM   (200000U)
+#define TEST_FAULT_PERIOD (500U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+uint32_t SystemCoreClock = 30000000U;
+
+static uint8_t s_model[FLASH_WRITER_FLASH_SIZE];
+static uint32_t s_programs[TEST_PAGE_NUM];
+static int32_t s_preparedSector = -1;
+static uint32_t s_operations;     /* Erase, program and compare calls of the current process call */
+static uint32_t s_maxOperations;  /* Most operations in one process call */
+static uint32_t s_protocolErrors; /* Programs of a page that is not blank, or of a sector that is not prepared */
+static bool s_faultPending;       /* Corrupt the next program */
+static bool s_faultAlways;        /* Corrupt every program */
+static uint32_t s_faultAddress;   /* Page of the last corrupted program, it is not corrupted twice in a row */
+static uint32_t s_faults;
+static uint32_t s_callbacks;
+static uint32_t s_callbackErrors;
+static uint32_t s_signaturePages[2];
+
+static uint32_t s_seed = 3U;
+static int s_failures;
+
+/*******************************************************************************
+ * Simulated IAP
+ ******************************************************************************/
+
+static uint32_t Random(void)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+    return s_seed >> 8U;
+}
+
+/* Each erase or program needs its own prepare of the sector. */
+static void UsePreparedSector(uint32_t address)
+{
+    if (s_preparedSector != (int32_t)(address / FLASH_WRITER_SECTOR_SIZE))
+    {
+        s_protocolErrors++;
+    }
+    s_preparedSector = -1;
+    s_operations++;
+}
+
+status_t IAP_PrepareSectorForWrite(uint32_t startSector, uint32_t endSector)
+{
+    assert(startSector == endSector);
+    s_preparedSector = (int32_t)startSector;
+    return kStatus_IAP_Success;
+}
+
+status_t IAP_CopyRamToFlash(uint32_t dstAddr, uint32_t *srcAddr, uint32_t numOfBytes, uint32_t systemCoreClock)
+{
+    (void)systemCoreClock;
+    assert((dstAddr % FLASH_WRITER_PAGE_SIZE) == 0U);
+    assert(numOfBytes == FLASH_WRITER_PAGE_SIZE);
+
+    UsePreparedSector(dstAddr);
+    for (uint32_t i = 0U; i < numOfBytes; i++)
+    {
+        if (s_flash[dstAddr + i] != 0xFFU)
+        {
+            s_protocolErrors++;
+            break;
+        }
+    }
+    for (uint32_t i = 0U; i < numOfBytes; i++)
+    {
+        s_flash[dstAddr + i] &= ((const uint8_t *)srcAddr)[i];
+    }
+    if (s_faultAlways || (s_faultPending && (s_faultAddress != dstAddr)))
+    {
+        s_flash[dstAddr + (Random() % numOfBytes)] ^= 0x10U;
+        s_faultPending = false;
+        s_faultAddress = dstAddr;
+        s_faults++;
+    }
+    s_programs[dstAddr / FLASH_WRITER_PAGE_SIZE]++;
+    return kStatus_IAP_Success;
+}
+
+status_t IAP_ErasePage(uint32_t startPage, uint32_t endPage, uint32_t systemCoreClock)
+{
+    (void)systemCoreClock;
+    assert(startPage == endPage);
+
+    UsePreparedSector(startPage * FLASH_WRITER_PAGE_SIZE);
+    (void)memset(&s_flash[startPage * FLASH_WRITER_PAGE_SIZE], 0xFF, FLASH_WRITER_PAGE_SIZE);
+    return kStatus_IAP_Success;
+}
+
+status_t IAP_Compare(uint32_t dstAddr, uint32_t *srcAddr, uint32_t numOfBytes)
+{
+    s_operations++;
+    return (memcmp(&s_flash[dstAddr], srcAddr, numOfBytes) == 0) ? kStatus_IAP_Success : kStatus_IAP_CompareError;
+}
+
+status_t IAP_ExtendedFlashSignatureRead(uint32_t startPage,
+                                        uint32_t endPage,
+                                        uint32_t numOfWaitStates,
+                                        uint32_t *signature)
+{
+    (void)numOfWaitStates;
+
+    s_signaturePages[0] = startPage;
+    s_signaturePages[1] = endPage;
+    (void)memset(signature, 0, 4U * sizeof(uint32_t));
+    return kStatus_IAP_Success;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void Check(bool condition, const char *what)
+{
+    if (!condition)
+    {
+        printf("FAIL: %s\n", what);
+        s_failures++;
+    }
+}
+
+static void PageDone(flash_writer_handle_t *handle, uint32_t address, status_t status, void *userData)
+{
+    (void)handle;
+    (void)address;
+    (void)userData;
+
+    s_callbacks++;
+    if (status != kStatus_FLASH_WriterSuccess)
+    {
+        s_callbackErrors++;
+    }
+}
+
+static status_t Process(flash_writer_handle_t *handle)
+{
+    status_t status;
+
+    s_operations = 0U;
+    status       = FLASH_WriterProcess(handle);
+    if (s_operations > s_maxOperations)
+    {
+        s_maxOperations = s_operations;
+    }
+    return status;
+}
+
+static void Drain(flash_writer_handle_t *handle)
+{
+    FLASH_WriterFlush(handle);
+    while (Process(handle) != kStatus_FLASH_WriterIdle)
+    {
+    }
+    Check(FLASH_WriterIsIdle(handle), "pages left after the flush");
+}
+
+static void TestStream(flash_writer_handle_t *handle)
+{
+    flash_writer_progress_t progress;
+    uint32_t address = TEST_IMAGE_START;
+    uint32_t busy    = 0U;
+    uint32_t once    = 0U;
+    uint8_t chunk[TEST_CHUNK_SIZE];
+
+    while (address < TEST_IMAGE_END)
+    {
+        uint32_t length = MIN(TEST_CHUNK_SIZE, TEST_IMAGE_END - address);
+
+        for (uint32_t i = 0U; i < length; i++)
+        {
+            chunk[i] = (uint8_t)Random();
+        }
+        while (FLASH_WriterWrite(handle, address, chunk, length) == kStatus_FLASH_WriterBusy)
+        {
+            busy++;
+            Check(Process(handle) != kStatus_FLASH_WriterIdle, "busy writer with nothing to program");
+        }
+        (void)memcpy(&s_model[address], chunk, length);
+        address += length;
+        if ((Random() & 1U) != 0U)
+        {
+            (void)Process(handle);
+        }
+    }
+    Drain(handle);
+
+    for (uint32_t page = TEST_IMAGE_START / FLASH_WRITER_PAGE_SIZE; page < (TEST_IMAGE_END / FLASH_WRITER_PAGE_SIZE);
+         page++)
+    {
+        once += (s_programs[page] == 1U) ? 1U : 0U;
+    }
+    FLASH_WriterGetProgress(handle, &progress);
+    printf("stream of %u bytes in %u byte chunks\n", TEST_IMAGE_END - TEST_IMAGE_START, TEST_CHUNK_SIZE);
+    printf("  pages queued %u, programmed %u, erased %u, skipped %u, programmed once %u\n", progress.pagesQueued,
+           progress.pagesProgrammed, progress.pagesErased, progress.pagesSkipped, once);
+    printf("  busy writes %u, most IAP operations in a process call %u, callbacks %u\n", busy, s_maxOperations,
+           s_callbacks);
+
+    Check(once == ((TEST_IMAGE_END - TEST_IMAGE_START) / FLASH_WRITER_PAGE_SIZE), "pages programmed once");
+    Check(s_callbacks == progress.pagesDone, "callback per page");
+    Check(progress.status == kStatus_FLASH_WriterSuccess, "stream status");
+    Check(memcmp(s_flash, s_model, sizeof(s_flash)) == 0, "flash content after the stream");
+}
+
+static void TestRandom(flash_writer_handle_t *handle)
+{
+    flash_writer_progress_t progress;
+    uint8_t data[3U * FLASH_WRITER_PAGE_SIZE];
+    uint32_t busy = 0U;
+
+    for (uint32_t round = 0U; round < TEST_RANDOM_NUM; round++)
+    {
+        uint32_t length  = 1U + (Random() % (((Random() % 4U) != 0U) ? 16U : sizeof(data)));
+        uint32_t address = Random() % (FLASH_WRITER_FLASH_SIZE - length + 1U);
+        status_t status;
+
+        /* A third of the bytes keep their value, so some pages need no erase or no program at all */
+        for (uint32_t i = 0U; i < length; i++)
+        {
+            data[i] = ((Random() % 3U) != 0U) ? (uint8_t)Random() : s_model[address + i];
+        }
+        status = FLASH_WriterWrite(handle, address, data, length);
+        if (status == kStatus_FLASH_WriterSuccess)
+        {
+            (void)memcpy(&s_model[address], data, length);
+        }
+        else
+        {
+            Check(status == kStatus_FLASH_WriterBusy, "random write status");
+            busy++;
+        }
+
+        for (uint32_t n = Random() % 4U; n > 0U; n--)
+        {
+            s_faultPending = s_faultPending || ((Random() % TEST_FAULT_PERIOD) == 0U);
+            (void)Process(handle);
+        }
+        if ((Random() % 50U) == 0U)
+        {
+            FLASH_WriterFlush(handle);
+        }
+    }
+    Drain(handle);
+
+    FLASH_WriterGetProgress(handle, &progress);
+    printf("%u random writes, %u busy, %u corrupted programs\n", TEST_RANDOM_NUM, busy, s_faults);
+    printf("  pages done %u, programmed %u, erased %u, skipped %u, errors %u\n", progress.pagesDone,
+           progress.pagesProgrammed, progress.pagesErased, progress.pagesSkipped, s_callbackErrors);
+
+    Check(s_faults != 0U, "no program was corrupted");
+    Check(progress.status == kStatus_FLASH_WriterSuccess, "status after the retried pages");
+    Check(memcmp(s_flash, s_model, sizeof(s_flash)) == 0, "flash content after the random writes");
+}
+
+static void TestErrors(flash_writer_handle_t *handle)
+{
+    flash_writer_progress_t progress;
+    uint32_t signature[4];
+    uint8_t data[FLASH_WRITER_PAGE_SIZE];
+
+    Check(FLASH_WriterWrite(handle, FLASH_WRITER_FLASH_SIZE - 4U, data, 8U) == kStatus_FLASH_WriterInvalidArgument,
+          "write past the end of the flash is accepted");
+    Check(FLASH_WriterWrite(handle, 0U, data, (FLASH_WRITER_PAGE_BUFFER_NUM + 1U) * FLASH_WRITER_PAGE_SIZE) ==
+              kStatus_FLASH_WriterInvalidArgument,
+          "write longer than the buffers is accepted");
+
+    /* A page that never verifies is erased and programmed FLASH_WRITER_RETRY_NUM more times, then dropped */
+    (void)memset(data, 0x00, sizeof(data));
+    s_faultAlways    = true;
+    s_callbackErrors = 0U;
+    (void)memset(s_programs, 0, sizeof(s_programs));
+    Check(FLASH_WriterWrite(handle, 0x1000U, data, sizeof(data)) == kStatus_FLASH_WriterSuccess, "write");
+    Drain(handle);
+    s_faultAlways = false;
+    FLASH_WriterGetProgress(handle, &progress);
+    Check(progress.status == kStatus_FLASH_WriterVerifyError, "verify error is not latched");
+    Check(s_callbackErrors == 1U, "verify error is not reported to the callback");
+    Check(s_programs[0x1000U / FLASH_WRITER_PAGE_SIZE] == (1U + FLASH_WRITER_RETRY_NUM), "retries");
+
+    Check(FLASH_WriterReadSignature(0x100U, 0x800U, signature) == kStatus_FLASH_WriterSuccess, "signature");
+    Check((s_signaturePages[0] == 4U) && (s_signaturePages[1] == 35U), "signature page range");
+    Check(FLASH_WriterReadSignature(0x104U, 0x800U, signature) == kStatus_FLASH_WriterInvalidArgument,
+          "unaligned signature range is accepted");
+    Check(FLASH_WriterReadSignature(0xFC00U, 0x800U, signature) == kStatus_FLASH_WriterInvalidArgument,
+          "signature range past the end of the flash is accepted");
+}
+
+int main(void)
+{
+    flash_writer_handle_t handle;
+
+    /* The lower half is blank, the upper half holds old data */
+    for (uint32_t i = 0U; i < sizeof(s_flash); i++)
+    {
+        s_flash[i] = (i < (sizeof(s_flash) / 2U)) ? 0xFFU : (uint8_t)Random();
+    }
+    (void)memcpy(s_model, s_flash, sizeof(s_flash));
+
+    FLASH_WriterInit(&handle, PageDone, NULL);
+    TestStream(&handle);
+    TestRandom(&handle);
+    TestErrors(&handle);
+
+    printf("most IAP operations in a process call %u, protocol errors %u\n", s_maxOperations, s_protocolErrors);
+    Check(s_maxOperations == 1U, "more than one IAP operation in a process call");
+    Check(s_protocolErrors == 0U, "program of a page that is not blank or of a sector that is not prepared");
+
+    printf("%s\n", (s_failures == 0) ? "PASS" : "FAIL");
+    return (s_failures == 0) ? 0 : 1;
+}
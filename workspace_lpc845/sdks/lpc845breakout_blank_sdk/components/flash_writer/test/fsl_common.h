@@ -0,0 +1,45 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of fsl_common.h for the flash writer test, see flash_writer_test.c. */
+
+#ifndef _FSL_COMMON_H_
+#define _FSL_COMMON_H_
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef int32_t status_t;
+
+#define MAKE_STATUS(group, code) ((((group)*100) + (code)))
+
+enum
+{
+    kStatus_Success = 0,
+};
+
+enum _status_groups
+{
+    kStatusGroup_IAP          = 102,
+    kStatusGroup_FLASH_WRITER = 176,
+};
+
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+
+#define __DMB() __sync_synchronize()
+
+#define FSL_FEATURE_SYSCON_FLASH_PAGE_SIZE_BYTES          (64)
+#define FSL_FEATURE_SYSCON_FLASH_SECTOR_SIZE_BYTES        (1024)
+#define FSL_FEATURE_SYSCON_FLASH_SIZE_BYTES               (65536)
+#define FSL_FEATURE_IAP_HAS_FLASH_EXTENDED_SIGNATURE_READ (1)
+
+extern uint32_t SystemCoreClock;
+
+#endif /* _FSL_COMMON_H_ */
@@ -0,0 +1,471 @@
+/*
+ * Copyright 2024 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*! *********************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+********************************************************************************** */
+#include "fsl_component_kv_store.h"
+#include "fsl_iap.h"
+#include <stddef.h>
+#include <string.h>
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private macros
+*************************************************************************************
+********************************************************************************** */
+
+/* Converts a flash address to a pointer, the flash is memory mapped. */
+#ifndef KV_STORE_FLASH_POINTER
+#define KV_STORE_FLASH_POINTER(address) ((const uint8_t *)(uintptr_t)(address))
+#endif
+
+/* Flag of a delete record. */
+#define KV_STORE_FLAG_DELETE (0x01U)
+
+/* Sequence number of an erased page, never given to a record. */
+#define KV_STORE_SEQUENCE_BLANK (0xFFFFFFFFU)
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private type definitions
+*************************************************************************************
+********************************************************************************** */
+
+/* Record of one value, it takes a whole flash page so that each page is programmed once between two erases. The CRC
+ * is the last word, a record torn by a reset during the program fails it. */
+typedef struct _kv_store_record
+{
+    uint32_t sequence;                      /* Sequence number, increases along the log */
+    uint16_t key;                           /* Key */
+    uint8_t length;                         /* Value length */
+    uint8_t flags;                          /* KV_STORE_FLAG_DELETE for a delete record */
+    uint8_t value[KV_STORE_VALUE_MAX_SIZE]; /* Value */
+    uint32_t crc;                           /* CRC-32 of the fields above */
+} kv_store_record_t;
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private memory declarations
+*************************************************************************************
+********************************************************************************** */
+
+/* CRC-32 (0xEDB88320) of a nibble. */
+static const uint32_t s_kvStoreCrcTable[16] = {
+    0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU, 0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+    0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU, 0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU,
+};
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private functions
+*************************************************************************************
+********************************************************************************** */
+
+static uint32_t KV_StoreCrc(const uint8_t *data, uint32_t length)
+{
+    uint32_t crc = 0xFFFFFFFFU;
+
+    for (uint32_t i = 0U; i < length; i++)
+    {
+        crc ^= data[i];
+        crc = (crc >> 4U) ^ s_kvStoreCrcTable[crc & 0x0FU];
+        crc = (crc >> 4U) ^ s_kvStoreCrcTable[crc & 0x0FU];
+    }
+
+    return ~crc;
+}
+
+static uint32_t KV_StorePageAddress(kv_store_handle_t *handle, uint32_t page)
+{
+    return handle->startAddress + (page * KV_STORE_PAGE_SIZE);
+}
+
+static const kv_store_record_t *KV_StoreRecord(kv_store_handle_t *handle, uint32_t page)
+{
+    return (const kv_store_record_t *)(const void *)KV_STORE_FLASH_POINTER(KV_StorePageAddress(handle, page));
+}
+
+static uint32_t KV_StoreNextPage(kv_store_handle_t *handle, uint32_t page)
+{
+    return ((page + 1U) < handle->pageCount) ? (page + 1U) : 0U;
+}
+
+static bool KV_StoreIsRecordValid(const kv_store_record_t *record)
+{
+    return (KV_STORE_SEQUENCE_BLANK != record->sequence) && (record->key < KV_STORE_KEY_NUM) &&
+           (record->length <= KV_STORE_VALUE_MAX_SIZE) &&
+           (record->crc == KV_StoreCrc((const uint8_t *)record, offsetof(kv_store_record_t, crc)));
+}
+
+static bool KV_StoreIsPageBlank(kv_store_handle_t *handle, uint32_t page)
+{
+    const uint32_t *word = (const uint32_t *)(const void *)KV_StoreRecord(handle, page);
+
+    for (uint32_t i = 0U; i < (KV_STORE_PAGE_SIZE / sizeof(uint32_t)); i++)
+    {
+        if (0xFFFFFFFFU != word[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static status_t KV_StoreErasePage(kv_store_handle_t *handle, uint32_t page)
+{
+    uint32_t address = KV_StorePageAddress(handle, page);
+    status_t status;
+
+    if (KV_StoreIsPageBlank(handle, page))
+    {
+        return kStatus_KV_StoreSuccess;
+    }
+
+    status = IAP_PrepareSectorForWrite(address / KV_STORE_SECTOR_SIZE, address / KV_STORE_SECTOR_SIZE);
+    if (kStatus_IAP_Success == status)
+    {
+        status = IAP_ErasePage(address / KV_STORE_PAGE_SIZE, address / KV_STORE_PAGE_SIZE, SystemCoreClock);
+    }
+    handle->pagesErased++;
+
+    return (kStatus_IAP_Success == status) ? kStatus_KV_StoreSuccess : kStatus_KV_StoreFlashError;
+}
+
+/* Appends a record at the head, it gets the next sequence number and its CRC. There must be a free page. */
+static status_t KV_StoreAppend(kv_store_handle_t *handle, kv_store_record_t *record)
+{
+    uint32_t page = handle->head;
+    uint32_t address;
+    status_t status;
+
+    /* After a reset, the page may hold a torn record or a partly erased page */
+    status = KV_StoreErasePage(handle, page);
+    if (kStatus_KV_StoreSuccess != status)
+    {
+        return status;
+    }
+
+    record->sequence = handle->sequence;
+    record->crc      = KV_StoreCrc((const uint8_t *)record, offsetof(kv_store_record_t, crc));
+
+    address = KV_StorePageAddress(handle, page);
+    status  = IAP_PrepareSectorForWrite(address / KV_STORE_SECTOR_SIZE, address / KV_STORE_SECTOR_SIZE);
+    if (kStatus_IAP_Success == status)
+    {
+        status = IAP_CopyRamToFlash(address, (uint32_t *)(void *)record, KV_STORE_PAGE_SIZE, SystemCoreClock);
+    }
+    handle->pagesProgrammed++;
+    if (kStatus_IAP_Success != status)
+    {
+        return kStatus_KV_StoreFlashError;
+    }
+
+    /* The page is part of the log even if it does not verify, it is reclaimed as a dead page */
+    handle->sequence++;
+    handle->head = (uint16_t)KV_StoreNextPage(handle, page);
+    handle->usedPages++;
+
+    if (!KV_StoreIsRecordValid(KV_StoreRecord(handle, page)))
+    {
+        return kStatus_KV_StoreFlashError;
+    }
+    return kStatus_KV_StoreSuccess;
+}
+
+/* Reclaims the page at the tail, its record is moved to the head first if it is current. */
+static status_t KV_StoreCompactStep(kv_store_handle_t *handle)
+{
+    uint32_t page                    = handle->tail;
+    const kv_store_record_t *current = KV_StoreRecord(handle, page);
+    kv_store_record_t record;
+    status_t status;
+
+    if (KV_StoreIsRecordValid(current) && (0U == (current->flags & KV_STORE_FLAG_DELETE)) &&
+        (page == handle->index[current->key]))
+    {
+        (void)memcpy(&record, current, sizeof(record));
+        status = KV_StoreAppend(handle, &record);
+        if (kStatus_KV_StoreSuccess != status)
+        {
+            return status;
+        }
+        handle->index[record.key] = (uint16_t)((0U != handle->head) ? (handle->head - 1U) : (handle->pageCount - 1U));
+    }
+
+    /* Once the record is copied, a reset before the erase leaves two copies and the newer one wins */
+    handle->tail = (uint16_t)KV_StoreNextPage(handle, page);
+    handle->usedPages--;
+
+    return KV_StoreErasePage(handle, page);
+}
+
+/* Makes room for one record, keeping a free page for the compaction. */
+static status_t KV_StoreReserve(kv_store_handle_t *handle)
+{
+    status_t status = kStatus_KV_StoreSuccess;
+
+    while (((uint32_t)handle->pageCount - handle->usedPages) < 2U)
+    {
+        status = KV_StoreCompactStep(handle);
+        if (kStatus_KV_StoreSuccess != status)
+        {
+            break;
+        }
+    }
+    return status;
+}
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+********************************************************************************** */
+
+status_t KV_StoreInit(kv_store_handle_t *handle, const kv_store_config_t *config)
+{
+    const kv_store_record_t *record;
+    const kv_store_record_t *other;
+    uint32_t newest = KV_STORE_INVALID_PAGE;
+    uint32_t oldest = KV_STORE_INVALID_PAGE;
+
+    assert(NULL != handle);
+    assert(NULL != config);
+    assert(sizeof(kv_store_record_t) == KV_STORE_PAGE_SIZE);
+
+    if ((0U != (config->startAddress % KV_STORE_PAGE_SIZE)) || (config->pageCount < 3U) ||
+        (config->pageCount >= KV_STORE_INVALID_PAGE))
+    {
+        return kStatus_KV_StoreInvalidArgument;
+    }
+
+    (void)memset(handle, 0, sizeof(*handle));
+    handle->startAddress = config->startAddress;
+    handle->pageCount    = (uint16_t)config->pageCount;
+    (void)memset(handle->index, 0xFF, sizeof(handle->index));
+
+    /* The valid records follow each other in sequence order from the tail to the head, anything else is garbage */
+    for (uint32_t page = 0U; page < handle->pageCount; page++)
+    {
+        record = KV_StoreRecord(handle, page);
+        if (!KV_StoreIsRecordValid(record))
+        {
+            continue;
+        }
+        if ((KV_STORE_INVALID_PAGE == newest) || (record->sequence > KV_StoreRecord(handle, newest)->sequence))
+        {
+            newest = page;
+        }
+        if ((KV_STORE_INVALID_PAGE == oldest) || (record->sequence < KV_StoreRecord(handle, oldest)->sequence))
+        {
+            oldest = page;
+        }
+        if ((KV_STORE_INVALID_PAGE == handle->index[record->key]) ||
+            (record->sequence > KV_StoreRecord(handle, handle->index[record->key])->sequence))
+        {
+            handle->index[record->key] = (uint16_t)page;
+        }
+    }
+
+    if (KV_STORE_INVALID_PAGE != newest)
+    {
+        handle->sequence  = KV_StoreRecord(handle, newest)->sequence + 1U;
+        handle->tail      = (uint16_t)oldest;
+        handle->head      = (uint16_t)KV_StoreNextPage(handle, newest);
+        handle->usedPages = (uint16_t)(((newest + handle->pageCount) - oldest) % handle->pageCount + 1U);
+    }
+
+    /* A delete record hides the key */
+    for (uint32_t key = 0U; key < KV_STORE_KEY_NUM; key++)
+    {
+        if (KV_STORE_INVALID_PAGE != handle->index[key])
+        {
+            other = KV_StoreRecord(handle, handle->index[key]);
+            if (0U != (other->flags & KV_STORE_FLAG_DELETE))
+            {
+                handle->index[key] = KV_STORE_INVALID_PAGE;
+            }
+            else
+            {
+                handle->liveCount++;
+            }
+        }
+    }
+
+    return kStatus_KV_StoreSuccess;
+}
+
+status_t KV_StoreFormat(kv_store_handle_t *handle)
+{
+    status_t status = kStatus_KV_StoreSuccess;
+
+    assert(NULL != handle);
+
+    for (uint32_t page = 0U; (page < handle->pageCount) && (kStatus_KV_StoreSuccess == status); page++)
+    {
+        status = KV_StoreErasePage(handle, page);
+    }
+
+    handle->head      = 0U;
+    handle->tail      = 0U;
+    handle->usedPages = 0U;
+    handle->liveCount = 0U;
+    (void)memset(handle->index, 0xFF, sizeof(handle->index));
+
+    return status;
+}
+
+status_t KV_StorePut(kv_store_handle_t *handle, uint16_t key, const void *value, uint32_t length)
+{
+    const kv_store_record_t *current;
+    kv_store_record_t record;
+    uint32_t liveCount;
+    status_t status;
+
+    assert(NULL != handle);
+
+    if ((key >= KV_STORE_KEY_NUM) || (length > KV_STORE_VALUE_MAX_SIZE) || ((NULL == value) && (0U != length)))
+    {
+        return kStatus_KV_StoreInvalidArgument;
+    }
+
+    liveCount = handle->liveCount;
+    if (KV_STORE_INVALID_PAGE != handle->index[key])
+    {
+        current = KV_StoreRecord(handle, handle->index[key]);
+        if ((length == current->length) && ((0U == length) || (0 == memcmp(current->value, value, length))))
+        {
+            return kStatus_KV_StoreSuccess;
+        }
+    }
+    else
+    {
+        /* The compaction needs a free page besides the current records */
+        liveCount++;
+        if ((liveCount + 2U) > handle->pageCount)
+        {
+            return kStatus_KV_StoreFull;
+        }
+    }
+
+    status = KV_StoreReserve(handle);
+    if (kStatus_KV_StoreSuccess != status)
+    {
+        return status;
+    }
+
+    (void)memset(&record, 0xFF, sizeof(record));
+    record.key    = key;
+    record.length = (uint8_t)length;
+    record.flags  = 0U;
+    if (0U != length)
+    {
+        (void)memcpy(record.value, value, length);
+    }
+
+    status = KV_StoreAppend(handle, &record);
+    if (kStatus_KV_StoreSuccess == status)
+    {
+        handle->index[key] = (uint16_t)((0U != handle->head) ? (handle->head - 1U) : (handle->pageCount - 1U));
+        handle->liveCount  = (uint16_t)liveCount;
+        handle->userWrites++;
+    }
+    return status;
+}
+
+status_t KV_StoreGet(kv_store_handle_t *handle, uint16_t key, void *value, uint32_t size, uint32_t *length)
+{
+    const kv_store_record_t *current;
+
+    assert(NULL != handle);
+
+    if (key >= KV_STORE_KEY_NUM)
+    {
+        return kStatus_KV_StoreInvalidArgument;
+    }
+    if (KV_STORE_INVALID_PAGE == handle->index[key])
+    {
+        return kStatus_KV_StoreNotFound;
+    }
+
+    current = KV_StoreRecord(handle, handle->index[key]);
+    if (NULL != value)
+    {
+        (void)memcpy(value, current->value, MIN(size, (uint32_t)current->length));
+    }
+    if (NULL != length)
+    {
+        *length = current->length;
+    }
+    return kStatus_KV_StoreSuccess;
+}
+
+status_t KV_StoreDelete(kv_store_handle_t *handle, uint16_t key)
+{
+    kv_store_record_t record;
+    status_t status;
+
+    assert(NULL != handle);
+
+    if (key >= KV_STORE_KEY_NUM)
+    {
+        return kStatus_KV_StoreInvalidArgument;
+    }
+    if (KV_STORE_INVALID_PAGE == handle->index[key])
+    {
+        return kStatus_KV_StoreNotFound;
+    }
+
+    status = KV_StoreReserve(handle);
+    if (kStatus_KV_StoreSuccess != status)
+    {
+        return status;
+    }
+
+    (void)memset(&record, 0xFF, sizeof(record));
+    record.key    = key;
+    record.length = 0U;
+    record.flags  = KV_STORE_FLAG_DELETE;
+
+    status = KV_StoreAppend(handle, &record);
+    if (kStatus_KV_StoreSuccess == status)
+    {
+        handle->index[key] = KV_STORE_INVALID_PAGE;
+        handle->liveCount--;
+        handle->userWrites++;
+    }
+    return status;
+}
+
+status_t KV_StoreCompact(kv_store_handle_t *handle, uint32_t maxPages)
+{
+    status_t status = kStatus_KV_StoreSuccess;
+
+    assert(NULL != handle);
+
+    /* Each step erases a page, and moves at most one record when the log has a dead page */
+    while ((0U != maxPages) && (handle->usedPages > handle->liveCount) && (kStatus_KV_StoreSuccess == status))
+    {
+        status = KV_StoreCompactStep(handle);
+        maxPages--;
+    }
+    return status;
+}
+
+void KV_StoreGetStatistics(kv_store_handle_t *handle, kv_store_statistics_t *statistics)
+{
+    assert(NULL != handle);
+    assert(NULL != statistics);
+
+    statistics->userWrites      = handle->userWrites;
+    statistics->pagesProgrammed = handle->pagesProgrammed;
+    statistics->pagesErased     = handle->pagesErased;
+    statistics->freePages       = (uint32_t)handle->pageCount - handle->usedPages;
+    statistics->deadPages       = (uint32_t)handle->usedPages - handle->liveCount;
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright 2024 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_COMPONENT_KV_STORE_H_
+#define _FSL_COMPONENT_KV_STORE_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup KvStore
+ * @{
+ */
+
+/**********************************************************************************
+ * Public macro definitions
+ ***********************************************************************************/
+
+/*! @brief Number of keys, the keys are 0 to KV_STORE_KEY_NUM - 1. The RAM index takes 2 bytes per key. */
+#ifndef KV_STORE_KEY_NUM
+#define KV_STORE_KEY_NUM (32U)
+#endif
+
+/*! @brief Flash page size, the unit the store programs and erases. */
+#ifndef KV_STORE_PAGE_SIZE
+#define KV_STORE_PAGE_SIZE (FSL_FEATURE_SYSCON_FLASH_PAGE_SIZE_BYTES)
+#endif
+
+/*! @brief Flash sector size, the unit IAP_PrepareSectorForWrite() works on. */
+#ifndef KV_STORE_SECTOR_SIZE
+#define KV_STORE_SECTOR_SIZE (FSL_FEATURE_SYSCON_FLASH_SECTOR_SIZE_BYTES)
+#endif
+
+/*! @brief Size of the record header and CRC in a page. */
+#define KV_STORE_RECORD_OVERHEAD (12U)
+
+/*! @brief Largest value, a record takes one flash page. */
+#define KV_STORE_VALUE_MAX_SIZE (KV_STORE_PAGE_SIZE - KV_STORE_RECORD_OVERHEAD)
+
+/*! @brief Page index of a key that has no value. */
+#define KV_STORE_INVALID_PAGE (0xFFFFU)
+
+/**********************************************************************************
+ * Public type definitions
+ ***********************************************************************************/
+
+/*! @brief The status of the key value store */
+typedef enum _kv_store_status
+{
+    kStatus_KV_StoreSuccess         = kStatus_Success,                       /*!< Success */
+    kStatus_KV_StoreInvalidArgument = MAKE_STATUS(kStatusGroup_KV_STORE, 1), /*!< Invalid argument */
+    kStatus_KV_StoreNotFound        = MAKE_STATUS(kStatusGroup_KV_STORE, 2), /*!< The key has no value */
+    kStatus_KV_StoreFull            = MAKE_STATUS(kStatusGroup_KV_STORE, 3), /*!< No room for one more key */
+    kStatus_KV_StoreFlashError      = MAKE_STATUS(kStatusGroup_KV_STORE, 4), /*!< IAP program or erase failed */
+} kv_store_status_t;
+
+/*! @brief Key value store configuration. */
+typedef struct _kv_store_config
+{
+    uint32_t startAddress; /*!< Flash address of the store, page aligned, the region is not used by the code. */
+    uint32_t pageCount;    /*!< Number of flash pages of the store, at least the number of keys stored plus 2. */
+} kv_store_config_t;
+
+/*! @brief Key value store statistics. */
+typedef struct _kv_store_statistics
+{
+    uint32_t userWrites;      /*!< Puts and deletes that programmed a record. */
+    uint32_t pagesProgrammed; /*!< Pages programmed, including the records moved by the compaction. */
+    uint32_t pagesErased;     /*!< Pages erased. */
+    uint32_t freePages;       /*!< Pages ready to take a record or to be erased. */
+    uint32_t deadPages;       /*!< Pages of the log holding no current value, reclaimed by the compaction. */
+} kv_store_statistics_t;
+
+/*!
+ * @brief Key value store handle, users should not touch the content of the handle.
+ *
+ * The pages of the store form a circular log, the records are appended at @p head and reclaimed at @p tail. The
+ * index holds the page of the current record of each key, so a read is a lookup and a copy from flash.
+ */
+typedef struct _kv_store_handle
+{
+    uint32_t startAddress;            /*!< Flash address of the store. */
+    uint32_t sequence;                /*!< Sequence number of the next record. */
+    uint32_t userWrites;              /*!< Puts and deletes that programmed a record. */
+    uint32_t pagesProgrammed;         /*!< Pages programmed. */
+    uint32_t pagesErased;             /*!< Pages erased. */
+    uint16_t pageCount;               /*!< Number of pages of the store. */
+    uint16_t head;                    /*!< Page the next record is written to. */
+    uint16_t tail;                    /*!< Oldest page of the log. */
+    uint16_t usedPages;               /*!< Pages from tail to head. */
+    uint16_t liveCount;               /*!< Keys that have a value. */
+    uint16_t index[KV_STORE_KEY_NUM]; /*!< Page of the current record of each key, or KV_STORE_INVALID_PAGE. */
+} kv_store_handle_t;
+
+/**********************************************************************************
+ * API
+ **********************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* _cplusplus */
+
+/*!
+ * @brief Mounts the key value store.
+ *
+ * Scans the pages of the store once and builds the index from the records with a valid CRC, the record with the
+ * highest sequence number of a key is its value. A record torn by a reset or a power failure fails its CRC and is
+ * ignored, so each key keeps either its previous or its new value. A blank region is an empty store.
+ *
+ * @param handle - Key value store handle.
+ * @param config - Key value store configuration.
+ *
+ * @retval kStatus_KV_StoreSuccess The store is mounted.
+ * @retval kStatus_KV_StoreInvalidArgument The region is not page aligned or has less than 3 pages.
+ */
+status_t KV_StoreInit(kv_store_handle_t *handle, const kv_store_config_t *config);
+
+/*!
+ * @brief Erases all the pages of the store, the store is empty afterwards.
+ *
+ * @param handle - Key value store handle.
+ *
+ * @retval kStatus_KV_StoreSuccess The store is erased.
+ * @retval kStatus_KV_StoreFlashError An IAP erase failed.
+ */
+status_t KV_StoreFormat(kv_store_handle_t *handle);
+
+/*!
+ * @brief Writes the value of a key.
+ *
+ * The record is appended to the log with a single page program, the previous record of the key is left in place and
+ * reclaimed later by the compaction. Nothing is written when the value does not change. When fewer than 2 pages are
+ * free the compaction runs first, call KV_StoreCompact() from the idle loop to keep the erases out of this call.
+ *
+ * @note The IAP driver disables the interrupts while a page is programmed or erased.
+ *
+ * @param handle - Key value store handle.
+ * @param key - Key, lower than KV_STORE_KEY_NUM.
+ * @param value - Value to write.
+ * @param length - Value length in bytes, at most KV_STORE_VALUE_MAX_SIZE.
+ *
+ * @retval kStatus_KV_StoreSuccess The value is written.
+ * @retval kStatus_KV_StoreInvalidArgument The key or the length is out of range.
+ * @retval kStatus_KV_StoreFull The key is new and the store has no room for it.
+ * @retval kStatus_KV_StoreFlashError An IAP program or erase failed.
+ */
+status_t KV_StorePut(kv_store_handle_t *handle, uint16_t key, const void *value, uint32_t length);
+
+/*!
+ * @brief Reads the value of a key.
+ *
+ * @param handle - Key value store handle.
+ * @param key - Key, lower than KV_STORE_KEY_NUM.
+ * @param value - Buffer to copy the value to.
+ * @param size - Size of the buffer, a longer value is truncated.
+ * @param length - Returns the length of the value, can be NULL.
+ *
+ * @retval kStatus_KV_StoreSuccess The value is copied.
+ * @retval kStatus_KV_StoreInvalidArgument The key is out of range.
+ * @retval kStatus_KV_StoreNotFound The key has no value.
+ */
+status_t KV_StoreGet(kv_store_handle_t *handle, uint16_t key, void *value, uint32_t size, uint32_t *length);
+
+/*!
+ * @brief Deletes the value of a key.
+ *
+ * A delete record is appended to the log, it hides the previous records of the key until they are reclaimed.
+ *
+ * @param handle - Key value store handle.
+ * @param key - Key, lower than KV_STORE_KEY_NUM.
+ *
+ * @retval kStatus_KV_StoreSuccess The value is deleted.
+ * @retval kStatus_KV_StoreInvalidArgument The key is out of range.
+ * @retval kStatus_KV_StoreNotFound The key has no value.
+ * @retval kStatus_KV_StoreFlashError An IAP program or erase failed.
+ */
+status_t KV_StoreDelete(kv_store_handle_t *handle, uint16_t key);
+
+/*!
+ * @brief Reclaims the pages holding no current value.
+ *
+ * Each step erases the oldest page of the log, after moving its record to the head when it is the current value of
+ * its key. The pages are thus all written in turn, which levels the wear over the whole region. Call it when the
+ * application is idle, with a small maxPages to bound the time the interrupts are disabled.
+ *
+ * @param handle - Key value store handle.
+ * @param maxPages - Maximum number of pages to erase.
+ *
+ * @retval kStatus_KV_StoreSuccess Done, or nothing left to reclaim.
+ * @retval kStatus_KV_StoreFlashError An IAP program or erase failed.
+ */
+status_t KV_StoreCompact(kv_store_handle_t *handle, uint32_t maxPages);
+
+/*!
+ * @brief Gets the statistics of the store.
+ *
+ * The write amplification is pagesProgrammed / userWrites.
+ *
+ * @param handle - Key value store handle.
+ * @param statistics - Returns the statistics.
+ */
+void KV_StoreGetStatistics(kv_store_handle_t *handle, kv_store_statistics_t *statistics);
+
+#if defined(__cplusplus)
+}
+#endif
+/*! @}*/
+#endif /* _FSL_COMPONENT_KV_STORE_H_ */
@@ -0,0 +1,41 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of fsl_common.h for the key value store test, see kv_store_test.c. */
+
+#ifndef _FSL_COMMON_H_
+#define _FSL_COMMON_H_
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef int32_t status_t;
+
+#define MAKE_STATUS(group, code) ((((group)*100) + (code)))
+
+enum
+{
+    kStatus_Success = 0,
+};
+
+enum _status_groups
+{
+    kStatusGroup_IAP      = 102,
+    kStatusGroup_KV_STORE = 175,
+};
+
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+
+#define FSL_FEATURE_SYSCON_FLASH_PAGE_SIZE_BYTES   (64)
+#define FSL_FEATURE_SYSCON_FLASH_SECTOR_SIZE_BYTES (1024)
+
+extern uint32_t SystemCoreClock;
+
+#endif /* _FSL_COMMON_H_ */
@@ -0,0 +1,24 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of fsl_iap.h for the key value store test, the flash is simulated by kv_store_test.c. */
+
+#ifndef _FSL_IAP_H_
+#define _FSL_IAP_H_
+
+#include "fsl_common.h"
+
+enum
+{
+    kStatus_IAP_Success = kStatus_Success,
+};
+
+status_t IAP_PrepareSectorForWrite(uint32_t startSector, uint32_t endSector);
+status_t IAP_CopyRamToFlash(uint32_t dstAddr, uint32_t *srcAddr, uint32_t numOfBytes, uint32_t systemCoreClock);
+status_t IAP_ErasePage(uint32_t startPage, uint32_t endPage, uint32_t systemCoreClock);
+
+#endif /* _FSL_IAP_H_ */
@@ -0,0 +1,378 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host test of the key value store over a simulated flash.
+ *
+ * Build and run from this directory:
+ *   gcc -O2 -I. -I.. -o kv_store_test kv_store_test.c && ./kv_store_test
+ *
+ * The simulated flash has 64-byte pages that can only be programmed when blank, a program only clears bits. The test
+ * measures the write amplification and the wear of counters updated at different rates, checks the argument checks
+ * and the capacity of the store, and then cuts the power at random points of random puts, deletes and compactions.
+ * A cut tears the program or the erase in progress: a program writes part of the page, an erase leaves random
+ * bytes. After each cut the store is mounted again and every key must hold either its value before or after the
+ * interrupted operation. The exit code is 0 on success.
+ */
+
+#include <setjmp.h>
+#include <stdio.h>
+
+#include "fsl_iap.h"
+
+/* The store reads the simulated flash. */
+#define KV_STORE_FLASH_POINTER(address) ((const uint8_t *)&s_flash[(address)])
+static uint8_t s_flash[0x10000U] __attribute__((aligned(4)));
+
+#include "fsl_component_kv_store.c"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_STORE_ADDRESS (0x8000U)
+#define TEST_STORE_PAGES   (64U)
+#define TEST_UPDATE_NUM    (200000U)
+#define TEST_COUNTER_NUM   (8U)
+#define TEST_CUT_ROUNDS    (20000U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+uint32_t SystemCoreClock = 12000000U;
+
+static uint32_t s_eraseCount[sizeof(s_flash) / KV_STORE_PAGE_SIZE];
+static uint32_t s_programsNotBlank;
+static uint32_t s_cutCountdown; /* Flash operations left before the power cut, 0 for none */
+static jmp_buf s_cut;
+
+static kv_store_handle_t s_handle;
+static const kv_store_config_t s_config = {TEST_STORE_ADDRESS, TEST_STORE_PAGES};
+
+/* Expected value of each key, after and before the operation in progress */
+static uint32_t s_value[KV_STORE_KEY_NUM];
+static bool s_present[KV_STORE_KEY_NUM];
+static uint32_t s_previousValue[KV_STORE_KEY_NUM];
+static bool s_previousPresent[KV_STORE_KEY_NUM];
+
+static uint32_t s_seed = 1U;
+static int s_failures;
+
+/*******************************************************************************
+ * Simulated flash
+ ******************************************************************************/
+
+static uint32_t Random(void)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+    return s_seed >> 8U;
+}
+
+/* Returns true when the power fails during this flash operation. */
+static bool PowerCut(void)
+{
+    return (s_cutCountdown != 0U) && (--s_cutCountdown == 0U);
+}
+
+status_t IAP_PrepareSectorForWrite(uint32_t startSector, uint32_t endSector)
+{
+    assert(startSector <= endSector);
+    assert(endSector < (sizeof(s_flash) / KV_STORE_SECTOR_SIZE));
+    return kStatus_IAP_Success;
+}
+
+status_t IAP_CopyRamToFlash(uint32_t dstAddr, uint32_t *srcAddr, uint32_t numOfBytes, uint32_t systemCoreClock)
+{
+    const uint8_t *src = (const uint8_t *)srcAddr;
+    uint32_t length    = numOfBytes;
+
+    assert((dstAddr % KV_STORE_PAGE_SIZE) == 0U);
+    assert(numOfBytes == KV_STORE_PAGE_SIZE);
+    (void)systemCoreClock;
+
+    for (uint32_t i = 0U; i < numOfBytes; i++)
+    {
+        if (s_flash[dstAddr + i] != 0xFFU)
+        {
+            s_programsNotBlank++;
+            break;
+        }
+    }
+    if (PowerCut())
+    {
+        length = Random() % numOfBytes;
+    }
+    for (uint32_t i = 0U; i < length; i++)
+    {
+        s_flash[dstAddr + i] &= src[i];
+    }
+    if (length != numOfBytes)
+    {
+        longjmp(s_cut, 1);
+    }
+    return kStatus_IAP_Success;
+}
+
+status_t IAP_ErasePage(uint32_t startPage, uint32_t endPage, uint32_t systemCoreClock)
+{
+    (void)systemCoreClock;
+
+    for (uint32_t page = startPage; page <= endPage; page++)
+    {
+        uint8_t *data = &s_flash[page * KV_STORE_PAGE_SIZE];
+
+        if (PowerCut())
+        {
+            for (uint32_t i = 0U; i < KV_STORE_PAGE_SIZE; i++)
+            {
+                uint32_t outcome = Random() % 3U;
+
+                data[i] = (outcome == 0U) ? 0xFFU : ((outcome == 1U) ? data[i] : (uint8_t)Random());
+            }
+            longjmp(s_cut, 1);
+        }
+        (void)memset(data, 0xFF, KV_STORE_PAGE_SIZE);
+        s_eraseCount[page]++;
+    }
+    return kStatus_IAP_Success;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void Check(bool condition, const char *what)
+{
+    if (!condition)
+    {
+        printf("FAIL: %s\n", what);
+        s_failures++;
+    }
+}
+
+static void Mount(void)
+{
+    Check(KV_StoreInit(&s_handle, &s_config) == kStatus_KV_StoreSuccess, "mount");
+}
+
+/* Checks every key against the expected values, a key may also hold its previous value after a power cut. */
+static bool CheckKeys(bool allowPrevious)
+{
+    for (uint16_t key = 0U; key < KV_STORE_KEY_NUM; key++)
+    {
+        uint32_t value  = 0U;
+        uint32_t length = 0U;
+        status_t status = KV_StoreGet(&s_handle, key, &value, sizeof(value), &length);
+        bool isNew      = s_present[key] ? ((status == kStatus_KV_StoreSuccess) && (length == sizeof(value)) &&
+                                       (value == s_value[key])) :
+                                           (status == kStatus_KV_StoreNotFound);
+        bool isPrevious = s_previousPresent[key] ? ((status == kStatus_KV_StoreSuccess) &&
+                                                    (length == sizeof(value)) && (value == s_previousValue[key])) :
+                                                   (status == kStatus_KV_StoreNotFound);
+
+        if (!isNew && !(allowPrevious && isPrevious))
+        {
+            printf("FAIL: key %u reads status %d value %u, expected %u (present %u)\n", key, status, value,
+                   s_value[key], (uint32_t)s_present[key]);
+            s_failures++;
+            return false;
+        }
+        if (!isNew)
+        {
+            s_value[key]   = s_previousValue[key];
+            s_present[key] = s_previousPresent[key];
+        }
+    }
+    return true;
+}
+
+static void TestArguments(void)
+{
+    kv_store_config_t config = {TEST_STORE_ADDRESS + 4U, TEST_STORE_PAGES};
+    uint8_t value[KV_STORE_VALUE_MAX_SIZE + 1U];
+
+    Check(KV_StoreInit(&s_handle, &config) == kStatus_KV_StoreInvalidArgument, "unaligned region is accepted");
+    config.startAddress = TEST_STORE_ADDRESS;
+    config.pageCount    = 2U;
+    Check(KV_StoreInit(&s_handle, &config) == kStatus_KV_StoreInvalidArgument, "2 page region is accepted");
+
+    Mount();
+    (void)memset(value, 0x5A, sizeof(value));
+    Check(KV_StorePut(&s_handle, KV_STORE_KEY_NUM, value, 4U) == kStatus_KV_StoreInvalidArgument,
+          "key out of range is accepted");
+    Check(KV_StorePut(&s_handle, 0U, value, sizeof(value)) == kStatus_KV_StoreInvalidArgument,
+          "too long value is accepted");
+    Check(KV_StorePut(&s_handle, 0U, value, KV_STORE_VALUE_MAX_SIZE) == kStatus_KV_StoreSuccess,
+          "longest value is rejected");
+    Check(KV_StoreGet(&s_handle, 1U, value, sizeof(value), NULL) == kStatus_KV_StoreNotFound, "missing key is found");
+    Check(KV_StoreDelete(&s_handle, 1U) == kStatus_KV_StoreNotFound, "missing key is deleted");
+    Check(KV_StoreFormat(&s_handle) == kStatus_KV_StoreSuccess, "format");
+    Mount();
+    Check(KV_StoreGet(&s_handle, 0U, value, sizeof(value), NULL) == kStatus_KV_StoreNotFound, "format keeps a key");
+}
+
+/* A region of n pages holds n - 2 keys, one page is kept for the compaction and one for the next record. */
+static void TestCapacity(void)
+{
+    kv_store_config_t config = {TEST_STORE_ADDRESS, 8U};
+    uint32_t accepted        = 0U;
+    uint32_t value;
+
+    Check(KV_StoreInit(&s_handle, &config) == kStatus_KV_StoreSuccess, "mount of the small store");
+    (void)KV_StoreFormat(&s_handle);
+    for (uint16_t key = 0U; key < KV_STORE_KEY_NUM; key++)
+    {
+        value = key;
+        if (KV_StorePut(&s_handle, key, &value, sizeof(value)) == kStatus_KV_StoreSuccess)
+        {
+            accepted++;
+        }
+    }
+    Check(accepted == (config.pageCount - 2U), "capacity of the small store");
+    for (uint32_t round = 0U; round < 100U; round++)
+    {
+        value = round;
+        Check(KV_StorePut(&s_handle, (uint16_t)(round % accepted), &value, sizeof(value)) == kStatus_KV_StoreSuccess,
+              "update of the full store");
+    }
+    Check(KV_StoreDelete(&s_handle, 0U) == kStatus_KV_StoreSuccess, "delete in the full store");
+    value = 1234U;
+    Check(KV_StorePut(&s_handle, accepted, &value, sizeof(value)) == kStatus_KV_StoreSuccess,
+          "put after a delete in the full store");
+    Check(KV_StoreInit(&s_handle, &config) == kStatus_KV_StoreSuccess, "remount of the small store");
+    value = 0U;
+    Check((KV_StoreGet(&s_handle, accepted, &value, sizeof(value), NULL) == kStatus_KV_StoreSuccess) &&
+              (value == 1234U),
+          "value after the remount of the small store");
+    Check(KV_StoreGet(&s_handle, 0U, &value, sizeof(value), NULL) == kStatus_KV_StoreNotFound,
+          "deleted key after the remount of the small store");
+    (void)KV_StoreFormat(&s_handle);
+}
+
+static void TestWriteAmplification(void)
+{
+    kv_store_statistics_t statistics;
+    uint32_t minErase = UINT32_MAX;
+    uint32_t maxErase = 0U;
+
+    Mount();
+    (void)memset(s_eraseCount, 0, sizeof(s_eraseCount));
+    (void)memset(s_present, 0, sizeof(s_present));
+    (void)memset(s_previousPresent, 0, sizeof(s_previousPresent));
+
+    /* Key 0 takes two updates out of three, the others share the rest */
+    for (uint32_t n = 0U; n < TEST_UPDATE_NUM; n++)
+    {
+        uint16_t key = ((n % 3U) == 0U) ? (uint16_t)(n % TEST_COUNTER_NUM) : 0U;
+
+        s_value[key]   = n;
+        s_present[key] = true;
+        if (KV_StorePut(&s_handle, key, &s_value[key], sizeof(s_value[key])) != kStatus_KV_StoreSuccess)
+        {
+            Check(false, "counter update");
+            return;
+        }
+        if ((n % 64U) == 0U)
+        {
+            (void)KV_StoreCompact(&s_handle, 2U);
+        }
+    }
+
+    KV_StoreGetStatistics(&s_handle, &statistics);
+    for (uint32_t page = 0U; page < TEST_STORE_PAGES; page++)
+    {
+        uint32_t count = s_eraseCount[(TEST_STORE_ADDRESS / KV_STORE_PAGE_SIZE) + page];
+
+        minErase = MIN(minErase, count);
+        maxErase = (count > maxErase) ? count : maxErase;
+    }
+    printf("%u updates of %u counters in %u pages\n", TEST_UPDATE_NUM, TEST_COUNTER_NUM, TEST_STORE_PAGES);
+    printf("  user writes %u, pages programmed %u, erased %u, write amplification %.3f\n", statistics.userWrites,
+           statistics.pagesProgrammed, statistics.pagesErased,
+           (double)statistics.pagesProgrammed / (double)statistics.userWrites);
+    printf("  erases per page %u to %u\n", minErase, maxErase);
+
+    Check(statistics.userWrites == TEST_UPDATE_NUM, "user write count");
+    Check((maxErase - minErase) <= 1U, "wear levelling");
+    Check(CheckKeys(false), "counters before the remount");
+    Mount();
+    Check(CheckKeys(false), "counters after the remount");
+}
+
+static void TestPowerCuts(void)
+{
+    volatile uint32_t cuts = 0U;
+
+    Mount();
+    for (uint32_t round = 0U; round < TEST_CUT_ROUNDS; round++)
+    {
+        (void)memcpy(s_previousValue, s_value, sizeof(s_value));
+        (void)memcpy(s_previousPresent, s_present, sizeof(s_present));
+        s_cutCountdown = 1U + (Random() % 6U);
+
+        if (setjmp(s_cut) == 0)
+        {
+            uint16_t key = (uint16_t)(Random() % KV_STORE_KEY_NUM);
+
+            if ((Random() % 5U) == 0U)
+            {
+                if (s_present[key])
+                {
+                    s_present[key] = false;
+                    (void)KV_StoreDelete(&s_handle, key);
+                }
+            }
+            else
+            {
+                s_value[key]   = Random();
+                s_present[key] = true;
+                if (KV_StorePut(&s_handle, key, &s_value[key], sizeof(s_value[key])) == kStatus_KV_StoreFull)
+                {
+                    s_present[key] = s_previousPresent[key];
+                }
+            }
+            if ((Random() % 4U) == 0U)
+            {
+                (void)KV_StoreCompact(&s_handle, 1U + (Random() % 3U));
+            }
+            s_cutCountdown = 0U;
+            if (!CheckKeys(false))
+            {
+                return;
+            }
+        }
+        else
+        {
+            cuts++;
+            s_cutCountdown = 0U;
+            Mount();
+            if (!CheckKeys(true))
+            {
+                printf("  after %u power cuts\n", cuts);
+                return;
+            }
+        }
+    }
+    printf("%u random operations, %u power cuts, every key kept its old or new value\n", TEST_CUT_ROUNDS, cuts);
+}
+
+int main(void)
+{
+    (void)memset(s_flash, 0xFF, sizeof(s_flash));
+
+    TestArguments();
+    TestCapacity();
+    TestWriteAmplification();
+    TestPowerCuts();
+
+    printf("pages programmed without an erase: %u\n", s_programsNotBlank);
+    Check(s_programsNotBlank == 0U, "program of a page that is not blank");
+
+    printf("%s\n", (s_failures == 0) ? "PASS" : "FAIL");
+    return (s_failures == 0) ? 0 : 1;
+}
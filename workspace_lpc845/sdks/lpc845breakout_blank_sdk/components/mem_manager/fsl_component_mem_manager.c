@@ -75,6 +75,7 @@ typedef struct _mem_pool_structure
     struct _mem_pool_structure *nextPool;
     uint8_t *pHeap;
     uint32_t heapSize;
+    struct _block_list_header *pFreeList; /* Head of the free blocks list, linked through the block payload */
 #if (defined(MEM_MANAGER_ENABLE_TRACE) && (MEM_MANAGER_ENABLE_TRACE > 0U))
     uint16_t allocatedBlocksPeak;
     uint16_t poolFragmentWaste;
@@ -136,11 +137,31 @@ static mem_statis_t s_memStatis;
 ******************************************************************************
 *****************************************************************************/
 #define BLOCK_HDR_SIZE sizeof(block_list_header_t)
+/* A free block stores the address of the next free block in its first payload word */
+#define MEM_BLOCK_NEXT_FREE(pBlock) (*(block_list_header_t **)(void *)((pBlock) + 1))
 /*****************************************************************************
 ******************************************************************************
 * Private functions
 ******************************************************************************
 *****************************************************************************/
+/*! -------------------------------------------------------------------------
+ * \brief     Chains all the blocks of a pool in its free list, lowest address first
+ *---------------------------------------------------------------------------*/
+static void MEM_PoolInitFreeList(mem_pool_structure_t *pPool)
+{
+    uint32_t blockStride = (uint32_t)pPool->blockSize + (uint32_t)sizeof(block_list_header_t);
+    block_list_header_t *pBlock;
+
+    pPool->pFreeList = NULL;
+    for (uint32_t i = pPool->numBlocks; i > 0U; i--)
+    {
+        pBlock                      = (block_list_header_t *)(void *)(pPool->pHeap + (i - 1U) * blockStride);
+        pBlock->allocated           = 0U;
+        MEM_BLOCK_NEXT_FREE(pBlock) = pPool->pFreeList;
+        pPool->pFreeList            = pBlock;
+    }
+}
+
 #ifdef MEM_STATISTICS_INTERNAL
 static void MEM_BufferAllocates_memStatis(void *buffer, uint32_t time, uint32_t requestedSize)
 {
@@ -320,7 +341,8 @@ mem_status_t MEM_AddBuffer(const uint8_t *buffer)
 
     assert(buffer);
     assert(memConfig->numberOfBlocks);
-    assert(memConfig->blockSize);
+    /* A free block must be able to hold the free list link */
+    assert(memConfig->blockSize >= sizeof(block_list_header_t *));
 
     MEM_ENTER_CRITICAL();
 #if (defined(MEM_MANAGER_PRE_CONFIGURE) && (MEM_MANAGER_PRE_CONFIGURE == 0U))
@@ -332,6 +354,8 @@ mem_status_t MEM_AddBuffer(const uint8_t *buffer)
     pPool->poolId    = *(uint16_t *)(void *)(&buffer[4]);
     pPool->heapSize =
         (MEM_POOL_SIZE + (uint32_t)memConfig->numberOfBlocks * (MEM_BLOCK_SIZE + (uint32_t)memConfig->blockSize));
+    pPool->allocatedBlocks = 0U;
+    MEM_PoolInitFreeList(pPool);
 #if (defined(MEM_MANAGER_ENABLE_TRACE) && (MEM_MANAGER_ENABLE_TRACE > 0U))
     pPool->allocatedBlocksPeak    = 0;
     pPool->poolTotalFragmentWaste = 0;
@@ -431,15 +455,11 @@ mem_status_t MEM_RemoveBuffer(uint8_t *buffer)
 }
 #endif /* MEM_MANAGER_BUFFER_REMOVE */
 
-/*!
- * @brief Allocate a block from the memory pools. The function uses the
- *        numBytes argument to look up a pool with adequate block sizes.
- *
- * @param numBytes           The number of bytes will be allocated.
- * @param poolId             The ID of the pool where to search for a free buffer.
- * @retval Memory buffer address when allocate success, NULL when allocate fail.
- */
-void *MEM_BufferAllocWithId(uint32_t numBytes, uint8_t poolId)
+/*! -------------------------------------------------------------------------
+ * \brief     Pops the head of the free list of the first pool with adequate block size,
+ *            the lists are kept in the pools so the search is bounded by the number of pools
+ *---------------------------------------------------------------------------*/
+static void *MEM_BufferAllocate(uint32_t numBytes, uint8_t poolId, uint32_t caller)
 {
 #if (defined(MEM_MANAGER_ENABLE_TRACE) && (MEM_MANAGER_ENABLE_TRACE > 0U))
     uint32_t fragmentWaste = 0;
@@ -448,46 +468,33 @@ void *MEM_BufferAllocWithId(uint32_t numBytes, uint8_t poolId)
     block_list_header_t *pBlock;
     void *buffer = NULL;
 
+    (void)caller;
     MEM_ENTER_CRITICAL();
 #ifdef MEM_MANAGER_BENCH
     uint32_t START_TIME = 0U, STOP_TIME = 0U, ALLOC_TIME = 0U;
     START_TIME = TM_GetTimestamp();
 #endif /* MEM_MANAGER_BENCH */
 
-    while (0U != numBytes)
+    while ((0U != numBytes) && (NULL != pPool))
     {
-        if ((numBytes <= pPool->blockSize) && (pPool->poolId == poolId))
+        if ((numBytes <= pPool->blockSize) && (pPool->poolId == poolId) && (NULL != pPool->pFreeList))
         {
-            for (uint32_t i = 0; i < pPool->numBlocks; i++)
-            {
-                pBlock = (block_list_header_t *)(void *)(pPool->pHeap + i * ((uint32_t)pPool->blockSize +
-                                                                             (uint32_t)sizeof(block_list_header_t)));
-                if (0U == pBlock->allocated)
-                {
-                    pBlock->allocated = 1;
-                    pBlock->blockSize = pPool->blockSize;
+            pBlock           = pPool->pFreeList;
+            pPool->pFreeList = MEM_BLOCK_NEXT_FREE(pBlock);
+
+            pBlock->allocated = 1;
+            pBlock->blockSize = pPool->blockSize;
 #if (defined(MEM_MANAGER_ENABLE_TRACE) && (MEM_MANAGER_ENABLE_TRACE > 0U))
-                    pBlock->allocatedBytes = (uint16_t)numBytes;
-                    pBlock->caller         = (uint32_t)((uint32_t *)__mem_get_LR());
+            pBlock->allocatedBytes = (uint16_t)numBytes;
+            pBlock->caller         = caller;
 #endif /*MEM_MANAGER_ENABLE_TRACE*/
-                    pBlock++;
-                    pPool->allocatedBlocks++;
-                    buffer = pBlock;
-                    (void)memset(buffer, 0x0, pBlock->blockSize);
-                    break;
-                }
-            }
-        }
-        if (NULL != buffer)
-        {
+            pBlock++;
+            pPool->allocatedBlocks++;
+            buffer = pBlock;
             break;
         }
         /* Try next pool*/
         pPool = pPool->nextPool;
-        if (NULL == pPool)
-        {
-            break;
-        }
     }
 #ifdef MEM_MANAGER_BENCH
     STOP_TIME  = TM_GetTimestamp();
@@ -513,26 +520,62 @@ void *MEM_BufferAllocWithId(uint32_t numBytes, uint8_t poolId)
     }
 #endif /* MEM_STATISTICS_INTERNAL */
 #if (defined(MEM_MANAGER_ENABLE_TRACE) && (MEM_MANAGER_ENABLE_TRACE > 0U))
-    if (pPool->allocatedBlocks > pPool->allocatedBlocksPeak)
-    {
-        pPool->allocatedBlocksPeak = pPool->allocatedBlocks;
-    }
-    fragmentWaste = pPool->blockSize - numBytes;
-    if (fragmentWaste > pPool->poolFragmentWastePeak)
-    {
-        pPool->poolFragmentWastePeak = (uint16_t)fragmentWaste;
-    }
-    pPool->poolFragmentWaste = (uint16_t)fragmentWaste;
-    pPool->poolTotalFragmentWaste += (uint16_t)fragmentWaste;
-    if (fragmentWaste < pPool->poolFragmentMinWaste)
+    if (NULL != buffer)
     {
-        pPool->poolFragmentMinWaste = (uint16_t)fragmentWaste;
+        /* pPool is the pool the block was taken from */
+        if (pPool->allocatedBlocks > pPool->allocatedBlocksPeak)
+        {
+            pPool->allocatedBlocksPeak = pPool->allocatedBlocks;
+        }
+        fragmentWaste = pPool->blockSize - numBytes;
+        if (fragmentWaste > pPool->poolFragmentWastePeak)
+        {
+            pPool->poolFragmentWastePeak = (uint16_t)fragmentWaste;
+        }
+        pPool->poolFragmentWaste = (uint16_t)fragmentWaste;
+        pPool->poolTotalFragmentWaste += (uint16_t)fragmentWaste;
+        if (fragmentWaste < pPool->poolFragmentMinWaste)
+        {
+            pPool->poolFragmentMinWaste = (uint16_t)fragmentWaste;
+        }
     }
 #endif /*MEM_MANAGER_ENABLE_TRACE*/
     MEM_EXIT_CRITICAL();
     return buffer;
 }
 
+/*!
+ * @brief Allocate a block from the memory pools. The function uses the
+ *        numBytes argument to look up a pool with adequate block sizes.
+ *
+ * @param numBytes           The number of bytes will be allocated.
+ * @param poolId             The ID of the pool where to search for a free buffer.
+ * @retval Memory buffer address when allocate success, NULL when allocate fail.
+ */
+void *MEM_BufferAllocWithId(uint32_t numBytes, uint8_t poolId)
+{
+    void *buffer = MEM_BufferAllocate(numBytes, poolId, (uint32_t)((uint32_t *)__mem_get_LR()));
+
+    if (NULL != buffer)
+    {
+        /* The block is owned by the caller from now on, clear it outside of the critical section */
+        (void)memset(buffer, 0x0, ((block_list_header_t *)buffer - 1)->blockSize);
+    }
+    return buffer;
+}
+
+/*!
+ * @brief Allocate a block from the memory pools without clearing its content.
+ *
+ * @param numBytes           The number of bytes will be allocated.
+ * @param poolId             The ID of the pool where to search for a free buffer.
+ * @retval Memory buffer address when allocate success, NULL when allocate fail.
+ */
+void *MEM_BufferAllocNoInitWithId(uint32_t numBytes, uint8_t poolId)
+{
+    return MEM_BufferAllocate(numBytes, poolId, (uint32_t)((uint32_t *)__mem_get_LR()));
+}
+
 /*!
  * @brief Memory buffer free.
  *
@@ -545,6 +588,7 @@ mem_status_t MEM_BufferFree(void *buffer /* IN: Block of memory to free*/
 {
     block_list_header_t *pBlock;
     mem_pool_structure_t *pPool = s_memmanager.pHeadPool;
+    mem_status_t status         = kStatus_MemFreeError;
     MEM_ENTER_CRITICAL();
 
     do
@@ -560,34 +604,36 @@ mem_status_t MEM_BufferFree(void *buffer /* IN: Block of memory to free*/
         assert(pBlock);
         if (1U == pBlock->allocated)
         {
-            (void)memset(pBlock, 0x0, (sizeof(block_list_header_t) + (uint32_t)pBlock->blockSize));
-            MEM_EXIT_CRITICAL();
-            while (true)
+            while (NULL != pPool)
             {
                 if (((uint32_t)pPool->pHeap <= (uint32_t)pBlock) &&
                     ((uint32_t)pBlock <
                      (uint32_t)pPool->pHeap +
                          pPool->numBlocks * ((uint32_t)pPool->blockSize + (uint32_t)sizeof(block_list_header_t))))
                 {
+                    /* Give the block back to the head of the pool free list */
+                    pBlock->allocated           = 0U;
+                    MEM_BLOCK_NEXT_FREE(pBlock) = pPool->pFreeList;
+                    pPool->pFreeList            = pBlock;
                     pPool->allocatedBlocks--;
-                    return kStatus_MemSuccess;
+                    status = kStatus_MemSuccess;
+                    break;
                 }
                 pPool = pPool->nextPool;
-                if (NULL == pPool)
-                {
-                    return kStatus_MemFreeError;
-                }
             }
         }
 
 #if (defined(MEM_MANAGER_ENABLE_TRACE) && (MEM_MANAGER_ENABLE_TRACE > 0U))
-        s_memmanager.freeFailures++;
+        if (kStatus_MemSuccess != status)
+        {
+            s_memmanager.freeFailures++;
+        }
 #endif /*MEM_MANAGER_ENABLE_TRACE*/
 
     } while (false);
 
     MEM_EXIT_CRITICAL();
-    return kStatus_MemFreeError;
+    return status;
 }
 
 /*!
@@ -635,6 +681,7 @@ mem_status_t MEM_BufferFreeAllWithId(uint8_t poolId)
             pPool->poolFragmentMinWaste   = 0xffff;
 #endif /*MEM_MANAGER_ENABLE_TRACE*/
             pPool->allocatedBlocks = 0;
+            MEM_PoolInitFreeList(pPool);
         }
         pPool = pPool->nextPool;
     }
@@ -40,11 +40,38 @@
 
 /*!
  * @brief Configures the memory manager light enable.
+ *
+ * 0: legacy memory manager with fixed size block pools (fsl_component_mem_manager.c)
+ * 1: memory manager light, first fit allocation in a heap (fsl_component_mem_manager_light.c)
+ * 2: memory manager light with two-level segregated fit allocation, bounded allocation and free time
+ *    (fsl_component_mem_manager_tlsf.c)
  */
 #ifndef gMemManagerLight
 #define gMemManagerLight (1)
 #endif
 
+#if defined(gMemManagerLight) && (gMemManagerLight == 2)
+/*!
+ * @brief Configures the number of second level lists per power of two size class of the TLSF allocator, as a power
+ * of two. Higher values reduce the internal fragmentation at the cost of a bigger control structure per area.
+ */
+#ifndef gMemManagerLightTlsfSlIndexCountLog2
+#define gMemManagerLightTlsfSlIndexCountLog2 (2U)
+#endif
+
+/*!
+ * @brief Configures the biggest block the TLSF allocator can manage, as a power of two. An area bigger than
+ * (1 << gMemManagerLightTlsfFlIndexMax) bytes is truncated to that size.
+ */
+#ifndef gMemManagerLightTlsfFlIndexMax
+#define gMemManagerLightTlsfFlIndexMax (14U)
+#endif
+
+#define MEM_TLSF_FL_INDEX_SHIFT (gMemManagerLightTlsfSlIndexCountLog2 + 2U)
+#define MEM_TLSF_FL_INDEX_COUNT (gMemManagerLightTlsfFlIndexMax - MEM_TLSF_FL_INDEX_SHIFT + 1U)
+#define MEM_TLSF_SL_INDEX_COUNT (1U << gMemManagerLightTlsfSlIndexCountLog2)
+#endif
+
 /*!
  * @brief Configures the memory manager trace debug enable.
  */
@@ -68,14 +95,14 @@
 
 #if (defined(MEM_MANAGER_ENABLE_TRACE) && (MEM_MANAGER_ENABLE_TRACE > 0U))
 #ifndef MEM_POOL_SIZE
-#define MEM_POOL_SIZE (32U)
+#define MEM_POOL_SIZE (36U)
 #endif
 #ifndef MEM_BLOCK_SIZE
 #define MEM_BLOCK_SIZE (12U)
 #endif
 #else
 #ifndef MEM_POOL_SIZE
-#define MEM_POOL_SIZE (20U)
+#define MEM_POOL_SIZE (24U)
 #endif
 #ifndef MEM_BLOCK_SIZE
 #define MEM_BLOCK_SIZE (4U)
@@ -94,9 +121,14 @@
 #define MEM_BufferAlloc(numBytes) MEM_BufferAllocWithId(numBytes, 0)
 #endif
 
+/* Default memory allocator, the content of the buffer is not cleared */
+#ifndef MEM_BufferAllocNoInit
+#define MEM_BufferAllocNoInit(numBytes) MEM_BufferAllocNoInitWithId(numBytes, 0)
+#endif
+
 #if (defined(MEM_MANAGER_PRE_CONFIGURE) && (MEM_MANAGER_PRE_CONFIGURE > 0U))
 /*
- * Defines pools by block size and number of blocks. Must be aligned to 4 bytes.
+ * Defines pools by block size and number of blocks. Must be aligned to 4 bytes, 4 bytes at least.
  * Defines block as  (blockSize ,numberOfBlocks,  id), id must be keep here,
  * even id is 0, will be _block_set_(64, 8, 0) _eol_
  * and _block_set_(64, 8) _eol_\ could not supported
@@ -204,7 +236,11 @@ typedef enum mem_alloc_test_status
 } mem_alloc_test_status_t;
 #endif
 
-#ifdef MEM_STATISTICS
+#if defined(gMemManagerLight) && (gMemManagerLight == 2)
+#define MML_INTERNAL_STRUCT_SZ                                                          \
+    (sizeof(void *) + 2U * sizeof(uint32_t) + MEM_TLSF_FL_INDEX_COUNT * sizeof(uint32_t) + \
+     MEM_TLSF_FL_INDEX_COUNT * MEM_TLSF_SL_INDEX_COUNT * sizeof(void *))
+#elif defined(MEM_STATISTICS)
 #define MML_INTERNAL_STRUCT_SZ (2 * sizeof(uint32_t) + 48)
 #else
 #define MML_INTERNAL_STRUCT_SZ (2 * sizeof(uint32_t))
@@ -295,12 +331,31 @@ mem_status_t MEM_RemoveBuffer(uint8_t *buffer);
  * @brief Allocate a block from the memory pools. The function uses the
  *        numBytes argument to look up a pool with adequate block sizes.
  *
+ * @note With the legacy memory manager the whole block is cleared, see MEM_BufferAllocNoInitWithId.
+ *
  * @param numBytes           The number of bytes will be allocated.
  * @param poolId             The ID of the pool where to search for a free buffer.
  * @retval Memory buffer address when allocate success, NULL when allocate fail.
  */
 void *MEM_BufferAllocWithId(uint32_t numBytes, uint8_t poolId);
 
+#if !defined(gMemManagerLight) || (gMemManagerLight == 0)
+/*!
+ * @brief Allocate a block from the memory pools without clearing it.
+ *
+ * Same as MEM_BufferAllocWithId but the content of the block is left as is, intended for the callers
+ * that overwrite the whole buffer anyway, such as packet reception from an interrupt handler.
+ *
+ * @param numBytes           The number of bytes will be allocated.
+ * @param poolId             The ID of the pool where to search for a free buffer.
+ * @retval Memory buffer address when allocate success, NULL when allocate fail.
+ */
+void *MEM_BufferAllocNoInitWithId(uint32_t numBytes, uint8_t poolId);
+#else
+/* The light allocators never clear the allocated buffers */
+#define MEM_BufferAllocNoInitWithId(numBytes, poolId) MEM_BufferAllocWithId((numBytes), (poolId))
+#endif /* gMemManagerLight */
+
 /*!
  * @brief Memory buffer free .
  *
@@ -454,9 +509,9 @@ void MEM_Trace(void);
 #endif /* MEM_MANAGER_ENABLE_TRACE */
 #endif /* gMemManagerLight */
 
-#if defined(gMemManagerLight) && (gMemManagerLight == 1)
+#if defined(gMemManagerLight) && (gMemManagerLight > 0)
 void *MEM_CallocAlt(size_t len, size_t val);
-#endif /*gMemManagerLight == 1*/
+#endif /*gMemManagerLight > 0*/
 
 #if defined(gMemManagerLight) && (gMemManagerLight > 0)
 /*!
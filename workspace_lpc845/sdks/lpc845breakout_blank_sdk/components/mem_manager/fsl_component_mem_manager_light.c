@@ -372,9 +372,9 @@ static void MEM_BufferFreeBlocksCleanUp(memAreaPrivDesc_t *p_area, blockHeader_t
         if (NextBlockHdr == NULL)
         {
 #if (gMemManagerLightFreeBlocksCleanUp == 2)
-            /* Step backwards to merge all preceeding contiguous free blocks */
+            /* Step backwards to merge all preceeding contiguous free blocks, the head of the list has none */
             blockHeader_t *PrevFreeBlockHdr = BlockHdr->prev_free;
-            while (PrevFreeBlockHdr->next == BlockHdr)
+            while ((PrevFreeBlockHdr != NULL) && (PrevFreeBlockHdr->next == BlockHdr))
             {
                 assert(PrevFreeBlockHdr->next_free == BlockHdr);
                 assert(PrevFreeBlockHdr->used == MEMMANAGER_BLOCK_FREE);
@@ -764,7 +764,8 @@ static void *MEM_BufferAllocateFromArea(memAreaPrivDesc_t *p_area, uint8_t area_
 
             assert(FreeBlockHdr == p_area->ctx.FreeBlockHdrList.tail);
             total_size      = (numBytes + BLOCK_HDR_SIZE);
-            remaining_bytes = available_size - (int32_t)total_size;
+            /* The next BlockHeader is placed on the word boundary that follows the buffer */
+            remaining_bytes = available_size - (int32_t)ROUNDUP_WORD(total_size);
             if (remaining_bytes >= 0) /* need to keep the room for the next BlockHeader */
             {
                 if (p_area->low_watermark > (uint32_t)remaining_bytes)
@@ -0,0 +1,1039 @@
+/*! *********************************************************************************
+ * Copyright 2024 NXP
+ *
+ * \file
+ *
+ * This is the source file for the two-level segregated fit (TLSF) flavour of the
+ * Memory Manager light.
+ *
+ * Free blocks are sorted in size classes: a first level of power of two classes, each
+ * one split in MEM_TLSF_SL_INDEX_COUNT linear second level classes. A bitmap per level
+ * records the non empty classes so that a suitable free block is found with two bit
+ * scans, and freed blocks are merged with their physical neighbours through a back
+ * pointer kept in each block header. Allocation and free are therefore executed in
+ * constant time and the global interrupt lock is held for a bounded duration.
+ *
+ * The statistics, tracking and guard options of the first fit allocator are not
+ * supported by this implementation.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ ********************************************************************************** */
+
+/*! *********************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+********************************************************************************** */
+
+#include "fsl_common.h"
+#include "fsl_component_mem_manager.h"
+
+#if defined(gMemManagerLight) && (gMemManagerLight == 2)
+
+/*! Extend Heap usage beyond the size defined by MinimalHeapSize_c up to __HEAP_end__ symbol address
+ *   to make full use of the remaining available SRAM for the dynamic allocator.
+ *   See fsl_component_mem_manager_light.c for the linker script requirements.
+ */
+#ifndef gMemManagerLightExtendHeapAreaUsage
+#define gMemManagerLightExtendHeapAreaUsage 0
+#endif
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private macros
+*************************************************************************************
+********************************************************************************** */
+#ifndef MAX_UINT16
+#define MAX_UINT16 0x00010000U
+#endif
+
+#define MEMMANAGER_BLOCK_FREE (uint16_t)0xBA00 /* Mark a previous allocated block as free         */
+#define MEMMANAGER_BLOCK_USED (uint16_t)0xBABE /* Mark the block as allocated                     */
+
+#define ROUNDUP_WORD(__x)   (((((__x)-1U) & ~0x3U) + 4U) & 0XFFFFFFFFU)
+#define ROUNDDOWN_WORD(__x) ((__x) & ~0x3U)
+
+/* Only the physical links and the block status are kept in an allocated block, the free list
+ * links overlap the first bytes of the payload */
+#define BLOCK_HDR_SIZE (offsetof(blockHeader_t, next_free))
+/* A free block must be able to hold its free list links */
+#define BLOCK_SIZE_MIN (sizeof(blockHeader_t) - BLOCK_HDR_SIZE)
+/* Largest block size that can be mapped in the first level */
+#define BLOCK_SIZE_MAX (((uint32_t)1U << gMemManagerLightTlsfFlIndexMax) - 4U)
+
+#define SMALL_BLOCK_SIZE ((uint32_t)1U << MEM_TLSF_FL_INDEX_SHIFT)
+
+#if (MEM_TLSF_FL_INDEX_COUNT > 31U) || (MEM_TLSF_FL_INDEX_COUNT < 1U)
+#error "gMemManagerLightTlsfFlIndexMax is out of range"
+#endif
+#if (MEM_TLSF_SL_INDEX_COUNT > 32U)
+#error "gMemManagerLightTlsfSlIndexCountLog2 shall not be greater than 5"
+#endif
+
+#if defined(__IAR_SYSTEMS_ICC__) && (defined __CORTEX_M) && \
+    ((__CORTEX_M == 4U) || (__CORTEX_M == 7U) || (__CORTEX_M == 33U))
+#define D_BARRIER __asm("DSB"); /* __DSB() could not be used */
+#else
+#define D_BARRIER
+#endif
+#define ENABLE_GLOBAL_IRQ(reg) \
+    D_BARRIER;                 \
+    EnableGlobalIRQ(reg)
+#define KB(x) ((x) << 10u)
+
+/************************************************************************************
+*************************************************************************************
+* Private type definitions
+*************************************************************************************
+************************************************************************************/
+
+typedef struct blockHeader_s
+{
+    struct blockHeader_s *prev_phys; /* Physically previous block, NULL for the first block of the area */
+    uint32_t size;                   /* Payload size in bytes, multiple of 4 */
+    uint16_t used;
+    uint8_t area_id;
+    uint8_t reserved;
+    struct blockHeader_s *next_free; /* Valid only when the block is free */
+    struct blockHeader_s *prev_free; /* Valid only when the block is free */
+} blockHeader_t;
+
+typedef union void_ptr_tag
+{
+    uint32_t raw_address;
+    uint32_t *address_ptr;
+    uint8_t *byte_ptr;
+    void *void_ptr;
+    blockHeader_t *block_hdr_ptr;
+} void_ptr_t;
+
+typedef struct _memAreaPriv_s
+{
+    blockHeader_t *sentinel; /* Zero sized used block closing the area */
+    uint32_t free_size;      /* Sum of the payload sizes of the free blocks */
+    uint32_t fl_bitmap;
+    uint32_t sl_bitmap[MEM_TLSF_FL_INDEX_COUNT];
+    blockHeader_t *blocks[MEM_TLSF_FL_INDEX_COUNT][MEM_TLSF_SL_INDEX_COUNT];
+} memAreaPriv_t;
+
+typedef struct _mem_area_priv_desc_s
+{
+    memAreaCfg_t *next;       /*< Next registered RAM area descriptor. */
+    void_ptr_t start_address; /*< Start address of RAM area. */
+    void_ptr_t end_address;   /*< End address of registered RAM area. */
+    uint16_t flags;           /*< BIT(0) means not member of default pool, other bits RFFU */
+    uint16_t reserved;        /*< alignment padding */
+    uint32_t low_watermark;
+    union
+    {
+        uint8_t internal_ctx[MML_INTERNAL_STRUCT_SZ]; /* Placeholder for internal allocator data */
+        memAreaPriv_t ctx;
+    };
+} memAreaPrivDesc_t;
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private memory declarations
+*************************************************************************************
+********************************************************************************** */
+
+#ifndef MEMORY_POOL_GLOBAL_VARIABLE_ALLOC
+/* Allocate memHeap array in the .heap section to ensure the size of the .heap section is large enough
+   for the application
+   However, the real heap used at run time will cover all the .heap section so this area can be bigger
+   than the requested MinimalHeapSize_c - see memHeapEnd */
+#if defined(__IAR_SYSTEMS_ICC__)
+#pragma location = ".heap"
+static uint32_t memHeap[MinimalHeapSize_c / sizeof(uint32_t)];
+#elif defined(__CC_ARM) || defined(__ARMCC_VERSION)
+static uint32_t memHeap[MinimalHeapSize_c / sizeof(uint32_t)] __attribute__((section(".heap")));
+#elif defined(__GNUC__)
+static uint32_t memHeap[MinimalHeapSize_c / sizeof(uint32_t)] __attribute__((section(".heap, \"aw\", %nobits @")));
+#else
+#error "Compiler unknown!"
+#endif
+
+#if defined(gMemManagerLightExtendHeapAreaUsage) && (gMemManagerLightExtendHeapAreaUsage == 1)
+#if defined(__ARMCC_VERSION)
+extern uint32_t Image$$ARM_LIB_STACK$$Base[];
+static const uint32_t memHeapEnd = (uint32_t)&Image$$ARM_LIB_STACK$$Base;
+#else
+extern uint32_t __HEAP_end__[];
+static const uint32_t memHeapEnd = (uint32_t)&__HEAP_end__;
+#endif
+#else
+static const uint32_t memHeapEnd = (uint32_t)(memHeap + MinimalHeapSize_c / sizeof(uint32_t));
+#endif
+
+#else
+extern uint32_t *memHeap;
+extern uint32_t memHeapEnd;
+#endif /* MEMORY_POOL_GLOBAL_VARIABLE_ALLOC */
+
+static memAreaPrivDesc_t heap_area_list;
+
+static bool initialized = false;
+
+#if !(defined(__ARM_FEATURE_CLZ) && (__ARM_FEATURE_CLZ == 1))
+/* De Bruijn sequence lookup table used to find the index of an isolated bit without a CLZ instruction */
+static const uint8_t s_deBruijnBitPosition[32] = {0U,  1U,  28U, 2U,  29U, 14U, 24U, 3U,  30U, 22U, 20U,
+                                                  15U, 25U, 17U, 4U,  8U,  31U, 27U, 13U, 23U, 21U, 19U,
+                                                  16U, 7U,  26U, 12U, 18U, 6U,  11U, 5U,  10U, 9U};
+#endif
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private functions
+*************************************************************************************
+********************************************************************************** */
+
+/*! -------------------------------------------------------------------------
+ * \brief     Returns the index of the least significant bit set, word shall not be 0
+ *---------------------------------------------------------------------------*/
+static inline uint32_t MEM_TlsfFfs(uint32_t word)
+{
+    assert(0U != word);
+#if defined(__ARM_FEATURE_CLZ) && (__ARM_FEATURE_CLZ == 1)
+    return 31U - (uint32_t)__CLZ(word & (~word + 1U));
+#else
+    return (uint32_t)s_deBruijnBitPosition[((word & (~word + 1U)) * 0x077CB531U) >> 27U];
+#endif
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief     Returns the index of the most significant bit set, word shall not be 0
+ *---------------------------------------------------------------------------*/
+static inline uint32_t MEM_TlsfFls(uint32_t word)
+{
+    assert(0U != word);
+#if defined(__ARM_FEATURE_CLZ) && (__ARM_FEATURE_CLZ == 1)
+    return 31U - (uint32_t)__CLZ(word);
+#else
+    /* Propagate the most significant bit to the right, then isolate it */
+    word |= word >> 1U;
+    word |= word >> 2U;
+    word |= word >> 4U;
+    word |= word >> 8U;
+    word |= word >> 16U;
+    word = word - (word >> 1U);
+    return (uint32_t)s_deBruijnBitPosition[(word * 0x077CB531U) >> 27U];
+#endif
+}
+
+static inline blockHeader_t *MEM_TlsfBlockNext(blockHeader_t *block)
+{
+    void_ptr_t ptr;
+    ptr.block_hdr_ptr = block;
+    ptr.byte_ptr += BLOCK_HDR_SIZE + block->size;
+    return ptr.block_hdr_ptr;
+}
+
+static inline void *MEM_TlsfBlockToBuffer(blockHeader_t *block)
+{
+    void_ptr_t ptr;
+    ptr.block_hdr_ptr = block;
+    ptr.byte_ptr += BLOCK_HDR_SIZE;
+    return ptr.void_ptr;
+}
+
+static inline blockHeader_t *MEM_TlsfBufferToBlock(void *buffer)
+{
+    void_ptr_t ptr;
+    ptr.void_ptr = buffer;
+    ptr.byte_ptr -= BLOCK_HDR_SIZE;
+    return ptr.block_hdr_ptr;
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief     Computes the first and second level indexes of the list a free block of
+ *            the given size belongs to
+ *---------------------------------------------------------------------------*/
+static void MEM_TlsfMappingInsert(uint32_t size, uint32_t *fl, uint32_t *sl)
+{
+    uint32_t fli;
+    uint32_t sli;
+
+    if (size < SMALL_BLOCK_SIZE)
+    {
+        /* Small blocks are linearly spread in the first level 0 */
+        fli = 0U;
+        sli = size / (SMALL_BLOCK_SIZE / MEM_TLSF_SL_INDEX_COUNT);
+    }
+    else
+    {
+        fli = MEM_TlsfFls(size);
+        sli = (size >> (fli - gMemManagerLightTlsfSlIndexCountLog2)) ^ MEM_TLSF_SL_INDEX_COUNT;
+        fli -= (MEM_TLSF_FL_INDEX_SHIFT - 1U);
+    }
+    *fl = fli;
+    *sl = sli;
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief     Computes the indexes of the first list whose blocks are all large enough
+ *            for the requested size
+ *---------------------------------------------------------------------------*/
+static void MEM_TlsfMappingSearch(uint32_t size, uint32_t *fl, uint32_t *sl)
+{
+    if (size >= SMALL_BLOCK_SIZE)
+    {
+        /* Round up to the next second level boundary so that any block of the list fits */
+        size += ((uint32_t)1U << (MEM_TlsfFls(size) - gMemManagerLightTlsfSlIndexCountLog2)) - 1U;
+    }
+    MEM_TlsfMappingInsert(size, fl, sl);
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief     Returns the head of the first non empty list at or above (fl, sl) and
+ *            updates the indexes accordingly, NULL if no such list
+ *---------------------------------------------------------------------------*/
+static blockHeader_t *MEM_TlsfFindSuitableBlock(memAreaPriv_t *ctrl, uint32_t *fl, uint32_t *sl)
+{
+    blockHeader_t *block = NULL;
+    uint32_t fli         = *fl;
+    uint32_t sl_map;
+
+    do
+    {
+        if (fli >= MEM_TLSF_FL_INDEX_COUNT)
+        {
+            break;
+        }
+        sl_map = ctrl->sl_bitmap[fli] & (~0U << *sl);
+        if (0U == sl_map)
+        {
+            /* No block in this first level, look for the next non empty one */
+            uint32_t fl_map = ctrl->fl_bitmap & (~0U << (fli + 1U));
+            if (0U == fl_map)
+            {
+                break;
+            }
+            fli    = MEM_TlsfFfs(fl_map);
+            sl_map = ctrl->sl_bitmap[fli];
+        }
+        *fl   = fli;
+        *sl   = MEM_TlsfFfs(sl_map);
+        block = ctrl->blocks[fli][*sl];
+    } while (false);
+
+    return block;
+}
+
+static void MEM_TlsfRemoveFreeBlock(memAreaPriv_t *ctrl, blockHeader_t *block, uint32_t fl, uint32_t sl)
+{
+    blockHeader_t *prev = block->prev_free;
+    blockHeader_t *next = block->next_free;
+
+    if (next != NULL)
+    {
+        next->prev_free = prev;
+    }
+    if (prev != NULL)
+    {
+        prev->next_free = next;
+    }
+    else
+    {
+        /* block was the head of the list */
+        ctrl->blocks[fl][sl] = next;
+        if (next == NULL)
+        {
+            ctrl->sl_bitmap[fl] &= ~((uint32_t)1U << sl);
+            if (0U == ctrl->sl_bitmap[fl])
+            {
+                ctrl->fl_bitmap &= ~((uint32_t)1U << fl);
+            }
+        }
+    }
+}
+
+static void MEM_TlsfInsertFreeBlock(memAreaPriv_t *ctrl, blockHeader_t *block)
+{
+    uint32_t fl;
+    uint32_t sl;
+    blockHeader_t *head;
+
+    MEM_TlsfMappingInsert(block->size, &fl, &sl);
+    head             = ctrl->blocks[fl][sl];
+    block->used      = MEMMANAGER_BLOCK_FREE;
+    block->next_free = head;
+    block->prev_free = NULL;
+    if (head != NULL)
+    {
+        head->prev_free = block;
+    }
+    ctrl->blocks[fl][sl] = block;
+    ctrl->sl_bitmap[fl] |= ((uint32_t)1U << sl);
+    ctrl->fl_bitmap |= ((uint32_t)1U << fl);
+}
+
+static void MEM_TlsfUnlinkFreeBlock(memAreaPriv_t *ctrl, blockHeader_t *block)
+{
+    uint32_t fl;
+    uint32_t sl;
+
+    MEM_TlsfMappingInsert(block->size, &fl, &sl);
+    MEM_TlsfRemoveFreeBlock(ctrl, block, fl, sl);
+}
+
+static memAreaPrivDesc_t *MEM_GetAreaByAreaId(uint8_t area_id)
+{
+    memAreaPrivDesc_t *p_area = &heap_area_list;
+    for (uint8_t i = 0u; i < area_id; i++)
+    {
+        p_area = (memAreaPrivDesc_t *)(void *)p_area->next;
+    }
+    return p_area;
+}
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+********************************************************************************** */
+
+mem_status_t MEM_RegisterExtendedArea(memAreaCfg_t *area_desc, uint8_t *p_area_id, uint16_t flags)
+{
+    mem_status_t st = kStatus_MemSuccess;
+    memAreaPrivDesc_t *p_area;
+    uint32_t regPrimask = DisableGlobalIRQ();
+    assert(offsetof(memAreaCfg_t, internal_ctx) == offsetof(memAreaPrivDesc_t, ctx));
+    assert(sizeof(memAreaCfg_t) >= sizeof(memAreaPrivDesc_t));
+    do
+    {
+        void_ptr_t ptr;
+        blockHeader_t *firstBlockHdr;
+        blockHeader_t *sentinel;
+        uint32_t area_sz;
+
+        if (area_desc == NULL)
+        {
+            assert(flags == 0U);
+            p_area = &heap_area_list;
+            /* Area_desc can only be NULL in the case of the implicit default memHeap registration */
+            if ((p_area->start_address.address_ptr != NULL) || (p_area->end_address.address_ptr != NULL))
+            {
+                st = kStatus_MemInitError;
+                break;
+            }
+            /* The head of the area des list is necessarily the main heap */
+            p_area->start_address.address_ptr = &memHeap[0];
+            p_area->end_address.raw_address   = memHeapEnd;
+            assert(p_area->end_address.raw_address > p_area->start_address.raw_address);
+            p_area->next = NULL;
+            if (p_area_id != NULL)
+            {
+                *p_area_id = 0u;
+            }
+        }
+        else
+        {
+            memAreaPrivDesc_t *new_area_desc = (memAreaPrivDesc_t *)(void *)area_desc;
+            assert((flags & AREA_FLAGS_RFFU) == 0U);
+            /* Registering an additional area : memHeap nust have been registered beforehand */
+            uint8_t id = 0;
+            if (area_desc->start_address == NULL)
+            {
+                st = kStatus_MemInitError;
+                break;
+            }
+            if (heap_area_list.start_address.address_ptr == NULL)
+            {
+                /* memHeap must have been registered before */
+                st = kStatus_MemInitError;
+                break;
+            }
+            area_sz = new_area_desc->end_address.raw_address - new_area_desc->start_address.raw_address;
+            if (area_sz <= (uint32_t)KB((uint32_t)1U))
+            {
+                /* doesn't make sense to register an area smaller than 1024 bytes */
+                st = kStatus_MemInitError;
+                break;
+            }
+
+            id = 1;
+            for (p_area = &heap_area_list; p_area->next != NULL; p_area = (memAreaPrivDesc_t *)(void *)p_area->next)
+            {
+                if (p_area == new_area_desc)
+                {
+                    st = kStatus_MemInitError;
+                    break;
+                }
+                id++;
+            }
+            if (st != kStatus_MemSuccess)
+            {
+                break;
+            }
+            if (p_area_id != NULL)
+            {
+                /* Determine the rank of the area in the list and return it as area_id */
+                *p_area_id = id;
+            }
+            p_area->next  = area_desc;     /* p_area still points to previous area desc */
+            p_area        = new_area_desc; /* let p_area point to new element */
+            p_area->flags = flags;
+        }
+        /* Here p_area points either to the implicit memHeap when invoked from MEM_Init or to the
+         * newly appended area configuration descriptor
+         */
+        p_area->next = NULL;
+        (void)memset(&p_area->ctx, 0, sizeof(p_area->ctx));
+
+        /* The whole area is a single free block closed by a zero sized used block, so that the
+         * physical neighbour of a block is always a valid block header */
+        ptr.raw_address = ROUNDUP_WORD(p_area->start_address.raw_address);
+        firstBlockHdr   = ptr.block_hdr_ptr;
+        area_sz         = ROUNDDOWN_WORD(p_area->end_address.raw_address) - ptr.raw_address;
+        if (area_sz < (2U * BLOCK_HDR_SIZE + BLOCK_SIZE_MIN))
+        {
+            st = kStatus_MemInitError;
+            break;
+        }
+        area_sz -= 2U * BLOCK_HDR_SIZE;
+        if (area_sz > BLOCK_SIZE_MAX)
+        {
+            /* The upper part of the area cannot be mapped in the first level, leave it unused */
+            area_sz = BLOCK_SIZE_MAX;
+        }
+
+        firstBlockHdr->prev_phys = NULL;
+        firstBlockHdr->size      = area_sz;
+        firstBlockHdr->area_id   = 0U;
+
+        sentinel            = MEM_TlsfBlockNext(firstBlockHdr);
+        sentinel->prev_phys = firstBlockHdr;
+        sentinel->size      = 0U;
+        sentinel->used      = MEMMANAGER_BLOCK_USED;
+
+        p_area->ctx.sentinel  = sentinel;
+        p_area->ctx.free_size = area_sz;
+        MEM_TlsfInsertFreeBlock(&p_area->ctx, firstBlockHdr);
+
+        p_area->low_watermark = area_sz;
+
+        st = kStatus_MemSuccess;
+    } while (false);
+    ENABLE_GLOBAL_IRQ(regPrimask);
+    return st;
+}
+
+static bool MEM_AreaIsEmpty(memAreaPrivDesc_t *p_area)
+{
+    /* The area is empty when a single free block spans up to the sentinel */
+    blockHeader_t *lastBlockHdr = p_area->ctx.sentinel->prev_phys;
+
+    return ((lastBlockHdr->used == MEMMANAGER_BLOCK_FREE) && (lastBlockHdr->prev_phys == NULL));
+}
+
+mem_status_t MEM_UnRegisterExtendedArea(uint8_t area_id)
+{
+    mem_status_t st = kStatus_MemUnknownError;
+    memAreaPrivDesc_t *prev_area;
+    memAreaPrivDesc_t *p_area_to_remove = NULL;
+    uint32_t regPrimask                 = DisableGlobalIRQ();
+
+    do
+    {
+        /* Cannot unregister main heap */
+        if (area_id == 0U)
+        {
+            st = kStatus_MemFreeError;
+            break;
+        }
+        prev_area = MEM_GetAreaByAreaId(area_id - 1U); /* Get previous area in list */
+        if (prev_area == NULL)
+        {
+            st = kStatus_MemFreeError;
+            break;
+        }
+
+        p_area_to_remove = (memAreaPrivDesc_t *)(void *)prev_area->next;
+        if (p_area_to_remove == NULL)
+        {
+            st = kStatus_MemFreeError;
+            break;
+        }
+        if (!MEM_AreaIsEmpty(p_area_to_remove))
+        {
+            st = kStatus_MemFreeError;
+            break;
+        }
+
+        /* Only unchain if no remaining allocated buffers */
+        prev_area->next        = p_area_to_remove->next;
+        p_area_to_remove->next = NULL;
+
+        st = kStatus_MemSuccess;
+    } while (false);
+
+    ENABLE_GLOBAL_IRQ(regPrimask);
+
+    return st;
+}
+
+mem_status_t MEM_Init(void)
+{
+    mem_status_t st = kStatus_MemSuccess;
+    uint8_t memHeap_id;
+    if (initialized == false)
+    {
+        initialized = true;
+        st          = MEM_RegisterExtendedArea(NULL, &memHeap_id, 0U); /* initialized default heap area */
+    }
+    return st;
+}
+
+static void *MEM_BufferAllocateFromArea(memAreaPrivDesc_t *p_area, uint8_t area_id, uint32_t numBytes)
+{
+    memAreaPriv_t *ctrl = &p_area->ctx;
+    blockHeader_t *BlockHdrFound;
+    void *buffer = NULL;
+    uint32_t size;
+    uint32_t fl;
+    uint32_t sl;
+    uint32_t regPrimask;
+
+    if (numBytes > BLOCK_SIZE_MAX)
+    {
+        return NULL;
+    }
+    size = ROUNDUP_WORD(numBytes);
+    if (size < BLOCK_SIZE_MIN)
+    {
+        size = BLOCK_SIZE_MIN;
+    }
+    MEM_TlsfMappingSearch(size, &fl, &sl);
+
+    regPrimask = DisableGlobalIRQ();
+
+    BlockHdrFound = MEM_TlsfFindSuitableBlock(ctrl, &fl, &sl);
+    if (BlockHdrFound == NULL)
+    {
+        /* No list is guaranteed to fit, the head of the list the size belongs to may still be large enough */
+        MEM_TlsfMappingInsert(size, &fl, &sl);
+        BlockHdrFound = ctrl->blocks[fl][sl];
+        if ((BlockHdrFound != NULL) && (BlockHdrFound->size < size))
+        {
+            BlockHdrFound = NULL;
+        }
+    }
+    if (BlockHdrFound != NULL)
+    {
+        blockHeader_t *NextBlockHdr = MEM_TlsfBlockNext(BlockHdrFound);
+
+        assert(BlockHdrFound->used == MEMMANAGER_BLOCK_FREE);
+        assert(BlockHdrFound->size >= size);
+        MEM_TlsfRemoveFreeBlock(ctrl, BlockHdrFound, fl, sl);
+
+        if (NextBlockHdr == ctrl->sentinel)
+        {
+            /* Depending on the platform, some RAM banks could need some reinitialization after a low power
+             * period, such as ECC RAM banks */
+            void_ptr_t start;
+            start.void_ptr = MEM_TlsfBlockToBuffer(BlockHdrFound);
+            MEM_ReinitRamBank(start.raw_address, ROUNDUP_WORD(start.raw_address + size + BLOCK_HDR_SIZE));
+        }
+
+        ctrl->free_size -= BlockHdrFound->size;
+
+        if ((BlockHdrFound->size - size) >= sizeof(blockHeader_t))
+        {
+            /* Give the tail of the block back to the free lists */
+            uint32_t remaining_size = BlockHdrFound->size - size - BLOCK_HDR_SIZE;
+            blockHeader_t *RemainingBlockHdr;
+
+            BlockHdrFound->size          = size;
+            RemainingBlockHdr            = MEM_TlsfBlockNext(BlockHdrFound);
+            RemainingBlockHdr->prev_phys = BlockHdrFound;
+            RemainingBlockHdr->size      = remaining_size;
+            RemainingBlockHdr->area_id   = 0U;
+            NextBlockHdr->prev_phys      = RemainingBlockHdr;
+            ctrl->free_size += remaining_size;
+            MEM_TlsfInsertFreeBlock(ctrl, RemainingBlockHdr);
+        }
+
+        BlockHdrFound->used    = MEMMANAGER_BLOCK_USED;
+        BlockHdrFound->area_id = area_id;
+
+        if (p_area->low_watermark > ctrl->free_size)
+        {
+            p_area->low_watermark = ctrl->free_size;
+        }
+        buffer = MEM_TlsfBlockToBuffer(BlockHdrFound);
+    }
+
+    ENABLE_GLOBAL_IRQ(regPrimask);
+
+#ifdef MEM_DEBUG_OUT_OF_MEMORY
+    assert(buffer != NULL);
+#endif
+
+    return buffer;
+}
+
+static void *MEM_BufferAllocate(uint32_t numBytes, uint8_t poolId)
+{
+    memAreaPrivDesc_t *p_area;
+    void *buffer    = NULL;
+    uint8_t area_id = 0U;
+
+    if (initialized == false)
+    {
+        (void)MEM_Init();
+    }
+    if (poolId == 0U)
+    {
+        area_id = 0U;
+        for (p_area = &heap_area_list; p_area != NULL; p_area = (memAreaPrivDesc_t *)(void *)p_area->next)
+        {
+            if ((p_area->flags & AREA_FLAGS_POOL_NOT_SHARED) == 0U)
+            {
+                buffer = MEM_BufferAllocateFromArea(p_area, area_id, numBytes);
+                if (buffer != NULL)
+                {
+                    break;
+                }
+            }
+            area_id++;
+        }
+    }
+    else
+    {
+        p_area = MEM_GetAreaByAreaId(poolId); /* Exclusively allocate from targeted pool */
+        if (p_area != NULL)
+        {
+            buffer = MEM_BufferAllocateFromArea(p_area, poolId, numBytes);
+        }
+    }
+    return buffer;
+}
+
+void *MEM_BufferAllocWithId(uint32_t numBytes, uint8_t poolId)
+{
+    return MEM_BufferAllocate(numBytes, poolId);
+}
+
+static mem_status_t MEM_BufferFreeBackToArea(memAreaPrivDesc_t *p_area, void *buffer)
+{
+    memAreaPriv_t *ctrl     = &p_area->ctx;
+    blockHeader_t *BlockHdr = MEM_TlsfBufferToBlock(buffer);
+    blockHeader_t *NeighbourBlockHdr;
+
+    ctrl->free_size += BlockHdr->size;
+
+    /* Merge with the next physical block, the sentinel is never free */
+    NeighbourBlockHdr = MEM_TlsfBlockNext(BlockHdr);
+    if (NeighbourBlockHdr->used == MEMMANAGER_BLOCK_FREE)
+    {
+        MEM_TlsfUnlinkFreeBlock(ctrl, NeighbourBlockHdr);
+        BlockHdr->size += BLOCK_HDR_SIZE + NeighbourBlockHdr->size;
+        ctrl->free_size += BLOCK_HDR_SIZE;
+    }
+
+    /* Merge with the previous physical block */
+    NeighbourBlockHdr = BlockHdr->prev_phys;
+    if ((NeighbourBlockHdr != NULL) && (NeighbourBlockHdr->used == MEMMANAGER_BLOCK_FREE))
+    {
+        MEM_TlsfUnlinkFreeBlock(ctrl, NeighbourBlockHdr);
+        NeighbourBlockHdr->size += BLOCK_HDR_SIZE + BlockHdr->size;
+        ctrl->free_size += BLOCK_HDR_SIZE;
+        BlockHdr = NeighbourBlockHdr;
+    }
+
+    MEM_TlsfBlockNext(BlockHdr)->prev_phys = BlockHdr;
+    MEM_TlsfInsertFreeBlock(ctrl, BlockHdr);
+
+    return kStatus_MemSuccess;
+}
+
+mem_status_t MEM_BufferFree(void *buffer /* IN: Block of memory to free*/)
+{
+    mem_status_t ret = kStatus_MemSuccess;
+
+    if (buffer == NULL)
+    {
+        ret = kStatus_MemFreeError;
+    }
+    else
+    {
+        uint32_t regPrimask = DisableGlobalIRQ();
+
+        blockHeader_t *BlockHdr = MEM_TlsfBufferToBlock(buffer);
+
+        /* assert checks */
+        assert(BlockHdr->used == MEMMANAGER_BLOCK_USED);
+        assert(BlockHdr->size != 0U);
+        memAreaPrivDesc_t *p_area = MEM_GetAreaByAreaId(BlockHdr->area_id);
+
+        if (p_area != NULL)
+        {
+            ret = MEM_BufferFreeBackToArea(p_area, buffer);
+        }
+        else
+        {
+            assert(false);
+            ret = kStatus_MemFreeError;
+        }
+
+        ENABLE_GLOBAL_IRQ(regPrimask);
+    }
+
+    return ret;
+}
+
+mem_status_t MEM_BufferCheck(void *buffer, uint32_t size)
+{
+    mem_status_t ret = kStatus_MemSuccess;
+
+    if (buffer == NULL)
+    {
+        ret = kStatus_MemUnknownError;
+    }
+    else
+    {
+        uint32_t regPrimask = DisableGlobalIRQ();
+
+        blockHeader_t *BlockHdr = MEM_TlsfBufferToBlock(buffer);
+        /* checks buffer is valid */
+        if ((BlockHdr->used == MEMMANAGER_BLOCK_USED) && (BlockHdr->size != 0U))
+        {
+            memAreaPrivDesc_t *p_area = MEM_GetAreaByAreaId(BlockHdr->area_id);
+            if (p_area != NULL)
+            {
+                /* Not memory manager buffer, do not care */
+                if (((uint8_t *)buffer < p_area->start_address.byte_ptr) ||
+                    ((uint8_t *)buffer > p_area->end_address.byte_ptr))
+                {
+                    ret = kStatus_MemUnknownError;
+                }
+                else if (size > BlockHdr->size)
+                {
+                    assert(false);
+                    ret = kStatus_MemOverFlowError;
+                }
+                else
+                {
+                    /* buffer is large enough */
+                }
+            }
+            else
+            {
+                ret = kStatus_MemUnknownError;
+            }
+        }
+
+        ENABLE_GLOBAL_IRQ(regPrimask);
+    }
+
+    return ret;
+}
+
+mem_status_t MEM_BufferFreeAllWithId(uint8_t poolId)
+{
+    (void)poolId;
+    /* Buffers are not linked to their allocation source */
+    return kStatus_MemFreeError;
+}
+
+uint32_t MEM_GetHeapUpperLimitByAreaId(uint8_t area_id)
+{
+    /* Everything above the last used block is free */
+    uint32_t upper_limit = 0U;
+    do
+    {
+        memAreaPrivDesc_t *p_area;
+        blockHeader_t *lastBlockHdr;
+        void_ptr_t ptr;
+        p_area = MEM_GetAreaByAreaId(area_id);
+        if (p_area == NULL)
+        {
+            break;
+        }
+        lastBlockHdr = p_area->ctx.sentinel->prev_phys;
+        if (lastBlockHdr->used != MEMMANAGER_BLOCK_FREE)
+        {
+            lastBlockHdr = p_area->ctx.sentinel;
+        }
+        ptr.block_hdr_ptr = lastBlockHdr;
+        upper_limit       = ptr.raw_address + BLOCK_HDR_SIZE;
+
+    } while (false);
+
+    return upper_limit;
+}
+
+uint32_t MEM_GetHeapUpperLimit(void)
+{
+    return MEM_GetHeapUpperLimitByAreaId(0u);
+}
+
+uint32_t MEM_GetFreeHeapSizeLowWaterMarkByAreaId(uint8_t area_id)
+{
+    uint32_t low_watermark = 0U;
+    do
+    {
+        memAreaPrivDesc_t *p_area;
+        p_area = MEM_GetAreaByAreaId(area_id);
+        if (p_area == NULL)
+        {
+            break;
+        }
+        low_watermark = p_area->low_watermark;
+
+    } while (false);
+    return low_watermark;
+}
+
+uint32_t MEM_GetFreeHeapSizeLowWaterMark(void)
+{
+    return MEM_GetFreeHeapSizeLowWaterMarkByAreaId(0u);
+}
+
+uint32_t MEM_ResetFreeHeapSizeLowWaterMarkByAreaId(uint8_t area_id)
+{
+    uint32_t current_level = 0U;
+    do
+    {
+        memAreaPrivDesc_t *p_area;
+        p_area = MEM_GetAreaByAreaId(area_id);
+        if (p_area == NULL)
+        {
+            break;
+        }
+        current_level         = p_area->ctx.free_size;
+        p_area->low_watermark = current_level;
+
+    } while (false);
+    return current_level;
+}
+
+uint32_t MEM_ResetFreeHeapSizeLowWaterMark(void)
+{
+    return MEM_ResetFreeHeapSizeLowWaterMarkByAreaId(0u);
+}
+
+uint16_t MEM_BufferGetSize(void *buffer)
+{
+    uint16_t size;
+
+    if (buffer != NULL)
+    {
+        size = (uint16_t)MEM_TlsfBufferToBlock(buffer)->size;
+    }
+    else
+    {
+        /* is case of a NULL buffer, we return 0U */
+        size = 0U;
+    }
+
+    return size;
+}
+
+void *MEM_BufferRealloc(void *buffer, uint32_t new_size)
+{
+    void *realloc_buffer = NULL;
+    uint16_t block_size  = 0U;
+    do
+    {
+        if (new_size >= MAX_UINT16)
+        {
+            realloc_buffer = NULL;
+            /* Bypass he whole procedure so keep original buffer that cannot be reallocated */
+            break;
+        }
+        if (new_size == 0U)
+        {
+            /* new requested size is 0, free old buffer */
+            (void)MEM_BufferFree(buffer);
+            realloc_buffer = NULL;
+            break;
+        }
+        if (buffer == NULL)
+        {
+            /* input buffer is NULL simply allocate a new buffer and return it */
+            realloc_buffer = MEM_BufferAllocate(new_size, 0U);
+            break;
+        }
+        /* Current buffer needs to be reallocated */
+        block_size = MEM_BufferGetSize(buffer);
+
+        if ((uint16_t)new_size <= block_size)
+        {
+            /* current buffer is large enough for the new requested size
+               we can still use it */
+            realloc_buffer = buffer;
+        }
+        else
+        {
+            /* not enough space in the current block, creating a new one */
+            realloc_buffer = MEM_BufferAllocate(new_size, 0U);
+
+            if (realloc_buffer != NULL)
+            {
+                /* copy input buffer data to new buffer */
+                (void)memcpy(realloc_buffer, buffer, (uint32_t)block_size);
+
+                /* free old buffer */
+                (void)MEM_BufferFree(buffer);
+            }
+        }
+    } while (false);
+    return realloc_buffer;
+}
+
+uint32_t MEM_GetFreeHeapSizeByAreaId(uint8_t area_id)
+{
+    memAreaPrivDesc_t *p_area;
+    uint32_t free_size = 0U;
+
+    if (area_id == 0U)
+    {
+        /* Iterate through all registered areas */
+        for (p_area = &heap_area_list; p_area != NULL; p_area = (memAreaPrivDesc_t *)(void *)p_area->next)
+        {
+            if ((p_area->flags & AREA_FLAGS_POOL_NOT_SHARED) == 0U)
+            {
+                free_size += p_area->ctx.free_size;
+            }
+        }
+    }
+    else
+    {
+        p_area = MEM_GetAreaByAreaId(area_id);
+        if (p_area != NULL)
+        {
+            free_size = p_area->ctx.free_size;
+        }
+    }
+    return free_size;
+}
+
+uint32_t MEM_GetFreeHeapSize(void)
+{
+    return MEM_GetFreeHeapSizeByAreaId(0U);
+}
+
+__attribute__((weak)) void MEM_ReinitRamBank(uint32_t startAddress, uint32_t endAddress)
+{
+    /* To be implemented by the platform */
+    (void)startAddress;
+    (void)endAddress;
+}
+
+void *MEM_CallocAlt(size_t len, size_t val)
+{
+    size_t blk_size;
+
+    blk_size = len * val;
+
+    void *pData = MEM_BufferAllocate(blk_size, 0U);
+    if (NULL != pData)
+    {
+        (void)memset(pData, 0, blk_size);
+    }
+
+    return pData;
+}
+
+#endif /* gMemManagerLight == 2 */
@@ -0,0 +1,41 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of fsl_common.h for the memory manager test, see mem_manager_test.c. */
+
+#ifndef _FSL_COMMON_H_
+#define _FSL_COMMON_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int32_t status_t;
+
+#define MAKE_STATUS(group, code) ((((group)*100) + (code)))
+
+enum
+{
+    kStatusGroup_Generic     = 0,
+    kStatusGroup_MEM_MANAGER = 141,
+};
+
+#define kStatus_Success MAKE_STATUS(kStatusGroup_Generic, 0)
+
+/* The test is freestanding, it provides the few C library functions used by the allocators. */
+void *memset(void *s, int c, size_t n);
+void *memcpy(void *dest, const void *src, size_t n);
+int memcmp(const void *s1, const void *s2, size_t n);
+
+void TestAssert(bool condition, const char *expression, const char *file, int line);
+#define assert(x) TestAssert((x) ? true : false, #x, __FILE__, __LINE__)
+
+/* The interrupt mask of the simulated core, the test measures the time spent with the interrupts disabled. */
+uint32_t DisableGlobalIRQ(void);
+void EnableGlobalIRQ(uint32_t primask);
+
+#endif /* _FSL_COMMON_H_ */
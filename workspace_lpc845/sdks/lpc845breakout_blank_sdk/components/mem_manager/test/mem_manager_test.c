@@ -0,0 +1,584 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host test of the light memory manager allocation policies, replaying allocation traces.
+ *
+ * Build and run from this directory, once per policy:
+ *   gcc -m32 -O2 -ffreestanding -nostdlib -static -no-pie -I. -I.. -DgMemManagerLight=1 -o mm_first_fit \
+ *       mem_manager_test.c && ./mm_first_fit
+ *   gcc -m32 -O2 -ffreestanding -nostdlib -static -no-pie -I. -I.. -DgMemManagerLight=2 -o mm_tlsf \
+ *       mem_manager_test.c && ./mm_tlsf
+ *
+ * The allocators keep addresses in 32-bit words, so the test is a 32-bit Linux program. It does not need a 32-bit C
+ * library: it brings its own start code and system calls and measures time with the TSC.
+ *
+ * Every trace is replayed on a MinimalHeapSize_c heap. The test checks the content of every buffer when it is freed
+ * and that the whole heap is available again at the end of a trace. It reports the time spent with the interrupts
+ * disabled by each allocation and free in TSC ticks, the shortest of TEST_ROUND_NUM replays, the allocations that
+ * failed, and the fragmentation, that is the share of the free bytes that cannot be returned by a single allocation,
+ * sampled along the trace. An own trace can be replayed with -DTEST_TRACE_FILE=\"trace.h\", a file of
+ * {TEST_ALLOC, slot, size} and {TEST_FREE, slot, 0} entries. The exit code is 0 on success.
+ */
+
+#define MEMORY_POOL_GLOBAL_VARIABLE_ALLOC
+
+#ifndef MinimalHeapSize_c
+#define MinimalHeapSize_c (8192U)
+#endif
+
+#include "fsl_component_mem_manager_light.c"
+#include "fsl_component_mem_manager_tlsf.c"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_SLOT_NUM       (64U)
+#define TEST_TRACE_LENGTH   (40000U)
+#define TEST_FRAG_PERIOD    (256U)
+#define TEST_ROUND_NUM      (8U)
+#define TEST_SAMPLE_NUM     (TEST_TRACE_LENGTH)
+
+#define TEST_ALLOC (1U)
+#define TEST_FREE  (2U)
+
+typedef struct _test_op
+{
+    uint8_t op;
+    uint8_t slot;
+    uint16_t size;
+} test_op_t;
+
+typedef struct _test_stats
+{
+    uint32_t mean;
+    uint32_t p99;
+    uint32_t max;
+} test_stats_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint32_t s_heap[MinimalHeapSize_c / sizeof(uint32_t)];
+uint32_t *memHeap = s_heap;
+uint32_t memHeapEnd;
+
+static test_op_t s_trace[TEST_TRACE_LENGTH];
+static uint8_t *s_slots[TEST_SLOT_NUM];
+static uint16_t s_sizes[TEST_SLOT_NUM];
+
+static uint32_t s_masked;
+static uint64_t s_maskStart;
+static uint32_t s_maskTicks;
+static bool s_measure;
+static uint32_t s_allocSamples[TEST_SAMPLE_NUM];
+static uint32_t s_freeSamples[TEST_SAMPLE_NUM];
+static uint32_t s_seed;
+static int s_failures;
+
+#ifdef TEST_TRACE_FILE
+static const test_op_t s_userTrace[] = {
+#include TEST_TRACE_FILE
+};
+#endif
+
+/*******************************************************************************
+ * Freestanding runtime
+ ******************************************************************************/
+
+static int32_t SysCall3(uint32_t number, uint32_t arg1, uint32_t arg2, uint32_t arg3)
+{
+    int32_t ret;
+
+    __asm__ volatile("int $0x80" : "=a"(ret) : "a"(number), "b"(arg1), "c"(arg2), "d"(arg3) : "memory");
+    return ret;
+}
+
+static void Exit(int code)
+{
+    (void)SysCall3(252U, (uint32_t)code, 0U, 0U); /* exit_group */
+    for (;;)
+    {
+    }
+}
+
+static void Print(const char *text)
+{
+    uint32_t length = 0U;
+
+    while (text[length] != '\0')
+    {
+        length++;
+    }
+    (void)SysCall3(4U, 1U, (uint32_t)text, length); /* write to stdout */
+}
+
+/* Prints a number right aligned on width characters. */
+static void PrintNumber(uint32_t value, uint32_t width)
+{
+    char text[12];
+    uint32_t i = sizeof(text) - 1U;
+
+    text[i] = '\0';
+    do
+    {
+        text[--i] = (char)('0' + (value % 10U));
+        value /= 10U;
+    } while ((value != 0U) && (i > 0U));
+    while ((i > 0U) && ((sizeof(text) - 1U - i) < width))
+    {
+        text[--i] = ' ';
+    }
+    Print(&text[i]);
+}
+
+void *memset(void *s, int c, size_t n)
+{
+    uint8_t *p = s;
+
+    while (n-- > 0U)
+    {
+        *p++ = (uint8_t)c;
+    }
+    return s;
+}
+
+void *memcpy(void *dest, const void *src, size_t n)
+{
+    uint8_t *d       = dest;
+    const uint8_t *q = src;
+
+    while (n-- > 0U)
+    {
+        *d++ = *q++;
+    }
+    return dest;
+}
+
+int memcmp(const void *s1, const void *s2, size_t n)
+{
+    const uint8_t *p = s1;
+    const uint8_t *q = s2;
+
+    for (; n > 0U; n--, p++, q++)
+    {
+        if (*p != *q)
+        {
+            return (int)*p - (int)*q;
+        }
+    }
+    return 0;
+}
+
+static uint64_t NowTicks(void)
+{
+    return __builtin_ia32_rdtsc();
+}
+
+/*******************************************************************************
+ * Simulated core
+ ******************************************************************************/
+
+void TestAssert(bool condition, const char *expression, const char *file, int line)
+{
+    if (!condition)
+    {
+        Print(file);
+        Print(":");
+        PrintNumber((uint32_t)line, 0U);
+        Print(": assertion failed: ");
+        Print(expression);
+        Print("\n");
+        Exit(2);
+    }
+}
+
+uint32_t DisableGlobalIRQ(void)
+{
+    uint32_t primask = s_masked;
+
+    if (0U == s_masked)
+    {
+        s_masked    = 1U;
+        s_maskStart = NowTicks();
+    }
+    return primask;
+}
+
+void EnableGlobalIRQ(uint32_t primask)
+{
+    if ((0U == primask) && (0U != s_masked))
+    {
+        if (s_measure)
+        {
+            s_maskTicks += (uint32_t)(NowTicks() - s_maskStart);
+        }
+        s_masked = 0U;
+    }
+}
+
+/*******************************************************************************
+ * Traces
+ ******************************************************************************/
+
+static uint32_t Random(uint32_t range)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+    return (s_seed >> 8U) % range;
+}
+
+static uint32_t RandomSize(uint32_t min, uint32_t max)
+{
+    return min + Random(max - min + 1U);
+}
+
+/* Buffers of random sizes and lifetimes. */
+static uint32_t TraceUniform(void)
+{
+    bool live[TEST_SLOT_NUM] = {false};
+    uint32_t count;
+
+    for (count = 0U; count < TEST_TRACE_LENGTH; count++)
+    {
+        uint32_t slot = Random(TEST_SLOT_NUM);
+
+        s_trace[count].slot = (uint8_t)slot;
+        s_trace[count].op   = live[slot] ? TEST_FREE : TEST_ALLOC;
+        s_trace[count].size = live[slot] ? 0U : (uint16_t)RandomSize(8U, 256U);
+        live[slot]          = !live[slot];
+    }
+    return count;
+}
+
+/* Short lived small buffers between long lived large ones, the pattern that fragments a first fit heap. */
+static uint32_t TraceSmallLarge(void)
+{
+    bool live[TEST_SLOT_NUM] = {false};
+    uint32_t count           = 0U;
+
+    while (count < TEST_TRACE_LENGTH)
+    {
+        uint32_t slot;
+        bool large = (Random(10U) == 0U);
+
+        if (large)
+        {
+            slot = Random(8U);
+            if (live[slot] && (Random(8U) != 0U))
+            {
+                continue;
+            }
+        }
+        else
+        {
+            slot = 8U + Random(TEST_SLOT_NUM - 8U);
+        }
+        s_trace[count].slot = (uint8_t)slot;
+        s_trace[count].op   = live[slot] ? TEST_FREE : TEST_ALLOC;
+        s_trace[count].size = live[slot] ? 0U : (uint16_t)(large ? RandomSize(256U, 1024U) : RandomSize(8U, 64U));
+        live[slot]          = !live[slot];
+        count++;
+    }
+    return count;
+}
+
+/* A packet queue: buffers are freed in the order they were allocated. */
+static uint32_t TraceFifo(void)
+{
+    const uint32_t depth = 24U;
+    uint32_t head        = 0U;
+    uint32_t count       = 0U;
+
+    while ((count + 1U) < TEST_TRACE_LENGTH)
+    {
+        if (head >= depth)
+        {
+            s_trace[count].op   = TEST_FREE;
+            s_trace[count].slot = (uint8_t)((head - depth) % TEST_SLOT_NUM);
+            s_trace[count].size = 0U;
+            count++;
+        }
+        s_trace[count].op   = TEST_ALLOC;
+        s_trace[count].slot = (uint8_t)(head % TEST_SLOT_NUM);
+        s_trace[count].size = (uint16_t)RandomSize(32U, 320U);
+        count++;
+        head++;
+    }
+    return count;
+}
+
+#ifdef TEST_TRACE_FILE
+static uint32_t TraceUser(void)
+{
+    uint32_t count = sizeof(s_userTrace) / sizeof(s_userTrace[0]);
+
+    if (count > TEST_TRACE_LENGTH)
+    {
+        count = TEST_TRACE_LENGTH;
+    }
+    (void)memcpy(s_trace, s_userTrace, count * sizeof(s_userTrace[0]));
+    return count;
+}
+#endif
+
+/*******************************************************************************
+ * Replay
+ ******************************************************************************/
+
+static void TestFail(const char *trace, const char *message)
+{
+    Print("FAIL: ");
+    Print(trace);
+    Print(": ");
+    Print(message);
+    Print("\n");
+    s_failures++;
+}
+
+/* Largest single allocation the heap can return, found by bisection. */
+static uint32_t LargestBlock(void)
+{
+    uint32_t low  = 0U;
+    uint32_t high = MEM_GetFreeHeapSize();
+
+    while (low < high)
+    {
+        uint32_t size = (low + high + 1U) / 2U;
+        void *buffer  = MEM_BufferAllocWithId(size, 0U);
+
+        if (buffer != NULL)
+        {
+            (void)MEM_BufferFree(buffer);
+            low = size;
+        }
+        else
+        {
+            high = size - 1U;
+        }
+    }
+    return low;
+}
+
+static void SortSamples(uint32_t *samples, uint32_t count)
+{
+    uint32_t gap;
+
+    for (gap = count / 2U; gap > 0U; gap /= 2U)
+    {
+        for (uint32_t i = gap; i < count; i++)
+        {
+            uint32_t value = samples[i];
+            uint32_t j     = i;
+
+            for (; (j >= gap) && (samples[j - gap] > value); j -= gap)
+            {
+                samples[j] = samples[j - gap];
+            }
+            samples[j] = value;
+        }
+    }
+}
+
+static test_stats_t Stats(uint32_t *samples, uint32_t count)
+{
+    test_stats_t stats = {0U, 0U, 0U};
+    uint32_t remainder = 0U;
+
+    if (count > 0U)
+    {
+        SortSamples(samples, count);
+        /* No 64-bit division without libgcc, the mean is summed as a quotient and a remainder. */
+        for (uint32_t i = 0U; i < count; i++)
+        {
+            stats.mean += samples[i] / count;
+            remainder += samples[i] % count;
+            if (remainder >= count)
+            {
+                stats.mean++;
+                remainder -= count;
+            }
+        }
+        stats.p99  = samples[(count * 99U) / 100U];
+        stats.max  = samples[count - 1U];
+    }
+    return stats;
+}
+
+static void PrintStats(const char *name, test_stats_t stats)
+{
+    Print(name);
+    PrintNumber(stats.mean, 6U);
+    PrintNumber(stats.p99, 6U);
+    PrintNumber(stats.max, 7U);
+}
+
+/* Keeps the shortest time of an operation over the replays of a trace, the longer ones were preempted by the host. */
+static void RecordSample(uint32_t *samples, uint32_t index, uint32_t round)
+{
+    if ((round == 0U) || (s_maskTicks < samples[index]))
+    {
+        samples[index] = s_maskTicks;
+    }
+}
+
+static void TestReplay(const char *name, uint32_t (*trace)(void))
+{
+    uint32_t length     = trace();
+    uint32_t allocCount = 0U;
+    uint32_t freeCount  = 0U;
+    uint32_t failed     = 0U;
+    uint32_t fragSum    = 0U;
+    uint32_t fragCount  = 0U;
+    uint32_t fragWorst  = 0U;
+    uint32_t freeSize;
+    uint32_t largest;
+    bool corrupted = false;
+
+    freeSize = MEM_GetFreeHeapSize();
+    largest  = LargestBlock();
+
+    /* The heap is whole again at the end of a replay, so every replay takes the same path through the allocator. */
+    for (uint32_t round = 0U; round < TEST_ROUND_NUM; round++)
+    {
+        allocCount = 0U;
+        freeCount  = 0U;
+        failed     = 0U;
+        fragSum    = 0U;
+        fragCount  = 0U;
+        fragWorst  = 0U;
+
+        for (uint32_t i = 0U; i < length; i++)
+        {
+            uint32_t slot = s_trace[i].slot % TEST_SLOT_NUM;
+
+            if ((s_trace[i].op == TEST_ALLOC) && (s_slots[slot] == NULL) && (s_trace[i].size > 0U))
+            {
+                s_maskTicks   = 0U;
+                s_measure     = true;
+                s_slots[slot] = MEM_BufferAllocWithId(s_trace[i].size, 0U);
+                s_measure     = false;
+                RecordSample(s_allocSamples, allocCount++, round);
+                if (s_slots[slot] == NULL)
+                {
+                    failed++;
+                }
+                else
+                {
+                    s_sizes[slot] = s_trace[i].size;
+                    (void)memset(s_slots[slot], (int)(slot + s_trace[i].size), s_sizes[slot]);
+                }
+            }
+            else if ((s_trace[i].op == TEST_FREE) && (s_slots[slot] != NULL))
+            {
+                for (uint32_t k = 0U; k < s_sizes[slot]; k++)
+                {
+                    corrupted = corrupted || (s_slots[slot][k] != (uint8_t)(slot + s_sizes[slot]));
+                }
+                s_maskTicks = 0U;
+                s_measure   = true;
+                if (MEM_BufferFree(s_slots[slot]) != kStatus_MemSuccess)
+                {
+                    TestFail(name, "free rejected an allocated buffer");
+                }
+                s_measure = false;
+                RecordSample(s_freeSamples, freeCount++, round);
+                s_slots[slot] = NULL;
+            }
+            else
+            {
+                /* The slot is not in the state the trace expects, skip the operation. */
+            }
+
+            if ((i % TEST_FRAG_PERIOD) == (TEST_FRAG_PERIOD - 1U))
+            {
+                uint32_t available = MEM_GetFreeHeapSize();
+                uint32_t frag      = 0U;
+
+                if (available > 0U)
+                {
+                    frag = (100U * (available - LargestBlock())) / available;
+                }
+                fragSum += frag;
+                fragCount++;
+                fragWorst = (frag > fragWorst) ? frag : fragWorst;
+            }
+        }
+
+        for (uint32_t slot = 0U; slot < TEST_SLOT_NUM; slot++)
+        {
+            if (s_slots[slot] != NULL)
+            {
+                (void)MEM_BufferFree(s_slots[slot]);
+                s_slots[slot] = NULL;
+            }
+        }
+
+        if ((MEM_GetFreeHeapSize() != freeSize) || (LargestBlock() != largest))
+        {
+            TestFail(name, "the heap is not whole again once every buffer is freed");
+            break;
+        }
+    }
+
+    if (corrupted)
+    {
+        TestFail(name, "the content of a buffer changed before it was freed");
+    }
+
+    Print(name);
+    PrintStats("", Stats(s_allocSamples, allocCount));
+    PrintStats(" |", Stats(s_freeSamples, freeCount));
+    Print(" |");
+    PrintNumber(allocCount, 6U);
+    PrintNumber(failed, 7U);
+    Print(" |");
+    PrintNumber((fragCount > 0U) ? (fragSum / fragCount) : 0U, 5U);
+    Print("%");
+    PrintNumber(fragWorst, 5U);
+    Print("%\n");
+}
+
+static int TestMain(void)
+{
+    memHeapEnd = (uint32_t)&s_heap[MinimalHeapSize_c / sizeof(uint32_t)];
+    if (MEM_Init() != kStatus_MemSuccess)
+    {
+        Print("FAIL: MEM_Init\n");
+        return 1;
+    }
+
+#if (gMemManagerLight == 2)
+    Print("policy: two-level segregated fit");
+#else
+    Print("policy: first fit");
+#endif
+    Print(", heap ");
+    PrintNumber(MinimalHeapSize_c, 0U);
+    Print(" bytes, interrupts disabled in TSC ticks\n");
+    Print("trace        alloc: mean   p99    max |  free: mean  p99    max | allocs failed | frag: mean worst\n");
+
+    s_seed = 1U;
+    TestReplay("uniform     ", TraceUniform);
+    s_seed = 2U;
+    TestReplay("small/large ", TraceSmallLarge);
+    s_seed = 3U;
+    TestReplay("fifo        ", TraceFifo);
+#ifdef TEST_TRACE_FILE
+    TestReplay("user        ", TraceUser);
+#endif
+
+    Print((s_failures == 0) ? "PASS\n" : "FAIL\n");
+    return (s_failures == 0) ? 0 : 1;
+}
+
+__attribute__((force_align_arg_pointer)) void _start(void);
+__attribute__((force_align_arg_pointer)) void _start(void)
+{
+    Exit(TestMain());
+}
@@ -1,6 +1,6 @@
 /*!
  * Copyright (c) 2015, Freescale Semiconductor, Inc.
- * Copyright 2016-2018 NXP
+ * Copyright 2016-2018, 2024 NXP
  *
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -41,6 +41,36 @@
 #define FSL_OSA_BM_TIMEOUT_ENABLE 0U
 #endif
 
+/*! @brief Definition to determine whether bare-metal message queues use the lock-free SPSC queue.
+ *
+ * Enable it when each message queue has a single producer, for example an ISR, and a single consumer task. Put and
+ * get then copy the message with memcpy() and update the queue indices without a critical section. It requires the
+ * spsc_queue component.
+ */
+#ifndef FSL_OSA_BM_MSGQ_SPSC_ENABLE
+#define FSL_OSA_BM_MSGQ_SPSC_ENABLE 0U
+#endif
+
+/*! @brief Definition to determine whether the bare-metal scheduler keeps a bitmap of the ready priorities.
+ *
+ * When enabled, OSA_ProcessTasks() and OSA_TaskShouldYield() find the highest ready priority with a table lookup
+ * instead of walking the task list, and ready tasks of the same priority take turns. Task priorities must be lower
+ * than FSL_OSA_BM_PRIORITY_NUM.
+ */
+#ifndef FSL_OSA_BM_READY_BITMAP_ENABLE
+#define FSL_OSA_BM_READY_BITMAP_ENABLE 0U
+#endif
+
+/*! @brief Definition to determine whether OSA_Start() sleeps with WFI when no bare-metal task is ready. */
+#ifndef FSL_OSA_BM_IDLE_SLEEP_ENABLE
+#define FSL_OSA_BM_IDLE_SLEEP_ENABLE 0U
+#endif
+
+/*! @brief Definition to determine whether the bare-metal scheduler counts the runs and run time of each task. */
+#ifndef FSL_OSA_BM_TASK_STATS_ENABLE
+#define FSL_OSA_BM_TASK_STATS_ENABLE 0U
+#endif
+
 #ifndef FSL_OSA_ALLOCATED_HEAP
 #define FSL_OSA_ALLOCATED_HEAP (1U)
 #endif
@@ -192,11 +192,19 @@ extern const uint8_t gUseRtos_c;
 #define USE_RTOS (1)
 #else
 #define USE_RTOS (0)
+#if (defined(FSL_OSA_BM_TASK_STATS_ENABLE) && (FSL_OSA_BM_TASK_STATS_ENABLE > 0U))
+#if (defined(GENERIC_LIST_LIGHT) && (GENERIC_LIST_LIGHT > 0U))
+#define OSA_TASK_HANDLE_SIZE (36U)
+#else
+#define OSA_TASK_HANDLE_SIZE (40U)
+#endif
+#else
 #if (defined(GENERIC_LIST_LIGHT) && (GENERIC_LIST_LIGHT > 0U))
 #define OSA_TASK_HANDLE_SIZE (24U)
 #else
 #define OSA_TASK_HANDLE_SIZE (28U)
 #endif
+#endif /* FSL_OSA_BM_TASK_STATS_ENABLE */
 #if (defined(FSL_OSA_TASK_ENABLE) && (FSL_OSA_TASK_ENABLE > 0U))
 #define OSA_EVENT_HANDLE_SIZE (20U)
 #else
@@ -209,11 +217,19 @@ extern const uint8_t gUseRtos_c;
 #define OSA_SEM_HANDLE_SIZE   (8U)
 #define OSA_MUTEX_HANDLE_SIZE (4U)
 #endif
+#if (defined(FSL_OSA_BM_MSGQ_SPSC_ENABLE) && (FSL_OSA_BM_MSGQ_SPSC_ENABLE > 0U))
+#if (defined(FSL_OSA_TASK_ENABLE) && (FSL_OSA_TASK_ENABLE > 0U))
+#define OSA_MSGQ_HANDLE_SIZE (36U)
+#else
+#define OSA_MSGQ_HANDLE_SIZE (32U)
+#endif /* FSL_OSA_TASK_ENABLE */
+#else
 #if (defined(FSL_OSA_TASK_ENABLE) && (FSL_OSA_TASK_ENABLE > 0U))
 #define OSA_MSGQ_HANDLE_SIZE (32U)
 #else
 #define OSA_MSGQ_HANDLE_SIZE (28U)
 #endif /* FSL_OSA_TASK_ENABLE */
+#endif /* FSL_OSA_BM_MSGQ_SPSC_ENABLE */
 #define OSA_MSG_HANDLE_SIZE (4U)
 #endif
 
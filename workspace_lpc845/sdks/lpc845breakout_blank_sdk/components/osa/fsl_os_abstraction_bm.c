@@ -1,6 +1,6 @@
 /*!
  * Copyright (c) 2015, Freescale Semiconductor, Inc.
- * Copyright 2016-2019,2022 NXP
+ * Copyright 2016-2019,2022,2024 NXP
  *
  *
  * This is the source file for the OS Abstraction layer for MQXLite.
@@ -16,6 +16,9 @@
 #include "fsl_component_generic_list.h"
 #include "fsl_os_abstraction.h"
 #include "fsl_os_abstraction_bm.h"
+#if (defined(FSL_OSA_BM_MSGQ_SPSC_ENABLE) && (FSL_OSA_BM_MSGQ_SPSC_ENABLE > 0U))
+#include "fsl_component_spsc_queue.h"
+#endif
 #include <string.h>
 
 /*! *********************************************************************************
@@ -63,6 +66,9 @@ typedef struct TaskControlBlock
     osa_task_priority_t priority; /*!< Task's priority                        */
     osa_task_param_t param;       /*!< Task's parameter                       */
     uint8_t haveToRun;            /*!< Task was signaled                      */
+#if (defined(FSL_OSA_BM_TASK_STATS_ENABLE) && (FSL_OSA_BM_TASK_STATS_ENABLE > 0U))
+    osa_task_stats_t stats;       /*!< Task's run-time statistics             */
+#endif
 } task_control_block_t;
 
 /*! @brief Type for a task pointer */
@@ -129,11 +135,15 @@ typedef struct MsgQueue
 #if (defined(FSL_OSA_TASK_ENABLE) && (FSL_OSA_TASK_ENABLE > 0U))
     task_handler_t waitingTask; /*!< Handler to the waiting task          */
 #endif
+#if (defined(FSL_OSA_BM_MSGQ_SPSC_ENABLE) && (FSL_OSA_BM_MSGQ_SPSC_ENABLE > 0U))
+    spsc_queue_t ring;          /*!< Lock-free queue of the messages      */
+#else
     uint8_t *queueMem;          /*!< Points to the queue memory           */
     uint16_t number;            /*!< The number of messages in the queue  */
     uint16_t max;               /*!< The max number of queue messages     */
     uint16_t head;              /*!< Index of the next message to be read */
     uint16_t tail;              /*!< Index of the next place to write to  */
+#endif
 } msg_queue_t;
 
 /*! @brief Type for a message queue handler */
@@ -145,6 +155,12 @@ typedef struct _osa_state
 #if (defined(FSL_OSA_TASK_ENABLE) && (FSL_OSA_TASK_ENABLE > 0U))
     list_label_t taskList;
     task_handler_t curTaskHandler;
+#if (defined(FSL_OSA_BM_READY_BITMAP_ENABLE) && (FSL_OSA_BM_READY_BITMAP_ENABLE > 0U))
+    volatile uint32_t readyBitmap;                        /*!< Bit n is set when a task of priority n is ready */
+    task_handler_t priorityHead[FSL_OSA_BM_PRIORITY_NUM]; /*!< First task of each priority in the task list   */
+    task_handler_t priorityLast[FSL_OSA_BM_PRIORITY_NUM]; /*!< Task of each priority that ran last            */
+    volatile uint8_t readyCount[FSL_OSA_BM_PRIORITY_NUM]; /*!< Number of ready tasks of each priority         */
+#endif
 #endif
     volatile uint32_t interruptDisableCount;
     volatile uint32_t interruptRegPrimask;
@@ -174,6 +190,17 @@ __WEAK_FUNC void main_task(osa_task_param_t arg)
 }
 __WEAK_FUNC void OSA_TimeInit(void);
 __WEAK_FUNC uint32_t OSA_TimeDiff(uint32_t time_start, uint32_t time_end);
+#if (defined(FSL_OSA_TASK_ENABLE) && (FSL_OSA_TASK_ENABLE > 0U))
+static void OSA_TaskSetReadyState(task_handler_t task, uint8_t ready);
+static void OSA_TaskRun(task_handler_t task);
+#if (defined(FSL_OSA_BM_READY_BITMAP_ENABLE) && (FSL_OSA_BM_READY_BITMAP_ENABLE > 0U))
+static void OSA_TaskUpdatePriority(osa_task_priority_t priority);
+static task_handler_t OSA_TaskFindReady(osa_task_priority_t priority);
+#endif
+#if (defined(FSL_OSA_BM_TASK_STATS_ENABLE) && (FSL_OSA_BM_TASK_STATS_ENABLE > 0U))
+__WEAK_FUNC uint32_t OSA_TaskStatsGetTime(void);
+#endif
+#endif
 
 /*! *********************************************************************************
 *************************************************************************************
@@ -188,6 +215,18 @@ const uint8_t gUseRtos_c = USE_RTOS; /* USE_RTOS = 0 for BareMetal and 1 for OS
 *************************************************************************************
 ********************************************************************************** */
 static osa_state_t s_osaState;
+#if (defined(FSL_OSA_TASK_ENABLE) && (FSL_OSA_TASK_ENABLE > 0U))
+#if (defined(FSL_OSA_BM_READY_BITMAP_ENABLE) && (FSL_OSA_BM_READY_BITMAP_ENABLE > 0U))
+#if (FSL_OSA_BM_PRIORITY_NUM > 32U)
+#error "FSL_OSA_BM_PRIORITY_NUM must not be greater than 32."
+#endif
+/* Index of the single set bit of x, looked up with the de Bruijn sequence 0x077CB531: (x * 0x077CB531) >> 27. The
+   Cortex-M0+ has no CLZ instruction. */
+static const uint8_t s_osaBitIndex[32] = {0U,  1U,  28U, 2U,  29U, 14U, 24U, 3U, 30U, 22U, 20U,
+                                          15U, 25U, 17U, 4U,  8U,  31U, 27U, 13U, 23U, 21U, 19U,
+                                          16U, 7U,  26U, 12U, 18U, 6U,  11U, 5U,  10U, 9U};
+#endif
+#endif
 /*! *********************************************************************************
 *************************************************************************************
 * Public functions
@@ -412,6 +451,11 @@ osa_status_t OSA_TaskSetPriority(osa_task_handle_t taskHandle, osa_task_priority
 #endif
     task_control_block_t *ptaskStruct = (task_control_block_t *)taskHandle;
     uint32_t regPrimask;
+#if (defined(FSL_OSA_BM_READY_BITMAP_ENABLE) && (FSL_OSA_BM_READY_BITMAP_ENABLE > 0U))
+    osa_task_priority_t oldPriority = ptaskStruct->priority;
+
+    assert(taskPriority < FSL_OSA_BM_PRIORITY_NUM);
+#endif
 
     ptaskStruct->priority = taskPriority;
     (void)LIST_RemoveElement(&ptaskStruct->link);
@@ -444,12 +488,16 @@ osa_status_t OSA_TaskSetPriority(osa_task_handle_t taskHandle, osa_task_priority
 #endif
         list_element = LIST_GetNext(list_element);
     }
-    if (ptaskStruct->priority > tcb->priority)
+    if ((NULL == tcb) || (ptaskStruct->priority > tcb->priority))
     {
         OSA_EnterCritical(&regPrimask);
         (void)LIST_AddTail(&s_osaState.taskList, (list_element_handle_t)(void *)&(ptaskStruct->link));
         OSA_ExitCritical(regPrimask);
     }
+#if (defined(FSL_OSA_BM_READY_BITMAP_ENABLE) && (FSL_OSA_BM_READY_BITMAP_ENABLE > 0U))
+    OSA_TaskUpdatePriority(oldPriority);
+    OSA_TaskUpdatePriority(taskPriority);
+#endif
 
     return KOSA_StatusSuccess;
 }
@@ -484,6 +532,12 @@ osa_status_t OSA_TaskCreate(osa_task_handle_t taskHandle, const osa_task_def_t *
     ptaskStruct->haveToRun = 1U;
     ptaskStruct->priority  = (uint16_t)PRIORITY_OSA_TO_RTOS(thread_def->tpriority);
     ptaskStruct->param     = task_param;
+#if (defined(FSL_OSA_BM_TASK_STATS_ENABLE) && (FSL_OSA_BM_TASK_STATS_ENABLE > 0U))
+    (void)memset(&ptaskStruct->stats, 0, sizeof(ptaskStruct->stats));
+#endif
+#if (defined(FSL_OSA_BM_READY_BITMAP_ENABLE) && (FSL_OSA_BM_READY_BITMAP_ENABLE > 0U))
+    assert(ptaskStruct->priority < FSL_OSA_BM_PRIORITY_NUM);
+#endif
 
     list_element = LIST_GetHead(&s_osaState.taskList);
     while (NULL != list_element)
@@ -505,6 +559,9 @@ osa_status_t OSA_TaskCreate(osa_task_handle_t taskHandle, const osa_task_def_t *
             (&ptaskStruct->link)->next = (struct list_element_tag *)(void *)tcb;
             (&ptaskStruct->link)->list->size++;
             OSA_ExitCritical(regPrimask);
+#if (defined(FSL_OSA_BM_READY_BITMAP_ENABLE) && (FSL_OSA_BM_READY_BITMAP_ENABLE > 0U))
+            OSA_TaskUpdatePriority(ptaskStruct->priority);
+#endif
             return KOSA_StatusSuccess;
 #else
             listStatus = LIST_AddPrevElement(&tcb->link, &ptaskStruct->link);
@@ -530,6 +587,9 @@ osa_status_t OSA_TaskCreate(osa_task_handle_t taskHandle, const osa_task_def_t *
         assert(listStatus == kLIST_Ok);
         OSA_ExitCritical(regPrimask);
     }
+#if (defined(FSL_OSA_BM_READY_BITMAP_ENABLE) && (FSL_OSA_BM_READY_BITMAP_ENABLE > 0U))
+    OSA_TaskUpdatePriority(ptaskStruct->priority);
+#endif
 
     return KOSA_StatusSuccess;
 }
@@ -552,6 +612,9 @@ osa_status_t OSA_TaskDestroy(osa_task_handle_t taskHandle)
     OSA_EnterCritical(&regPrimask);
     (void)LIST_RemoveElement(taskHandle);
     OSA_ExitCritical(regPrimask);
+#if (defined(FSL_OSA_BM_READY_BITMAP_ENABLE) && (FSL_OSA_BM_READY_BITMAP_ENABLE > 0U))
+    OSA_TaskUpdatePriority(((task_handler_t)taskHandle)->priority);
+#endif
     return KOSA_StatusSuccess;
 }
 #endif
@@ -788,7 +851,7 @@ osa_status_t OSA_SemaphoreWait(osa_semaphore_handle_t semaphoreHandle, uint32_t
         else
         {
 #if (defined(FSL_OSA_TASK_ENABLE) && (FSL_OSA_TASK_ENABLE > 0U))
-            pSemStruct->waitingTask->haveToRun = 0U;
+            OSA_TaskSetReadyState(pSemStruct->waitingTask, 0U);
 #endif
         }
     }
@@ -824,7 +887,7 @@ osa_status_t OSA_SemaphorePost(osa_semaphore_handle_t semaphoreHandle)
 #if (defined(FSL_OSA_TASK_ENABLE) && (FSL_OSA_TASK_ENABLE > 0U))
     if (pSemStruct->waitingTask != NULL)
     {
-        pSemStruct->waitingTask->haveToRun = 1U;
+        OSA_TaskSetReadyState(pSemStruct->waitingTask, 1U);
     }
 #endif
 
@@ -1020,7 +1083,7 @@ osa_status_t OSA_EventSet(osa_event_handle_t eventHandle, osa_event_flags_t flag
 #if (defined(FSL_OSA_TASK_ENABLE) && (FSL_OSA_TASK_ENABLE > 0U))
     if (pEventStruct->waitingTask != NULL)
     {
-        pEventStruct->waitingTask->haveToRun = 1U;
+        OSA_TaskSetReadyState(pEventStruct->waitingTask, 1U);
     }
 #endif
     OSA_ExitCritical(regPrimask);
@@ -1047,7 +1110,7 @@ osa_status_t OSA_EventClear(osa_event_handle_t eventHandle, osa_event_flags_t fl
 #if (defined(FSL_OSA_TASK_ENABLE) && (FSL_OSA_TASK_ENABLE > 0U))
         if (NULL != pEventStruct->waitingTask)
         {
-            pEventStruct->waitingTask->haveToRun = 1U;
+            OSA_TaskSetReadyState(pEventStruct->waitingTask, 1U);
         }
 #endif
     }
@@ -1132,7 +1195,7 @@ osa_status_t OSA_EventWait(osa_event_handle_t eventHandle,
         {
             pEventStruct->flags &= ~flagsToWait;
 #if (defined(FSL_OSA_TASK_ENABLE) && (FSL_OSA_TASK_ENABLE > 0U))
-            pEventStruct->waitingTask->haveToRun = 0U;
+            OSA_TaskSetReadyState(pEventStruct->waitingTask, 0U);
 #endif
         }
         retVal = KOSA_StatusSuccess;
@@ -1166,7 +1229,7 @@ osa_status_t OSA_EventWait(osa_event_handle_t eventHandle,
         else
         {
 #if (defined(FSL_OSA_TASK_ENABLE) && (FSL_OSA_TASK_ENABLE > 0U))
-            pEventStruct->waitingTask->haveToRun = 0U;
+            OSA_TaskSetReadyState(pEventStruct->waitingTask, 0U);
 #endif
         }
     }
@@ -1208,12 +1271,17 @@ osa_status_t OSA_MsgQCreate(osa_msgq_handle_t msgqHandle, uint32_t msgNo, uint32
     assert(sizeof(msg_queue_t) == OSA_MSGQ_HANDLE_SIZE);
     assert(msgqHandle);
 
+#if (defined(FSL_OSA_BM_MSGQ_SPSC_ENABLE) && (FSL_OSA_BM_MSGQ_SPSC_ENABLE > 0U))
+    pMsgQStruct->size = msgSize;
+    SPSC_QueueInit(&pMsgQStruct->ring, (uint8_t *)((uint8_t *)msgqHandle + sizeof(msg_queue_t)), msgNo * msgSize);
+#else
     pMsgQStruct->max      = (uint16_t)msgNo;
     pMsgQStruct->number   = 0;
     pMsgQStruct->head     = 0;
     pMsgQStruct->tail     = 0;
     pMsgQStruct->size     = msgSize;
     pMsgQStruct->queueMem = (uint8_t *)((uint8_t *)msgqHandle + sizeof(msg_queue_t));
+#endif
     return KOSA_StatusSuccess;
 }
 
@@ -1229,6 +1297,31 @@ osa_status_t OSA_MsgQPut(osa_msgq_handle_t msgqHandle, osa_msg_handle_t pMessage
     assert(msgqHandle);
     msg_queue_t *pQueue;
     osa_status_t status = KOSA_StatusSuccess;
+#if (defined(FSL_OSA_BM_MSGQ_SPSC_ENABLE) && (FSL_OSA_BM_MSGQ_SPSC_ENABLE > 0U))
+
+    pQueue = (msg_queue_t *)msgqHandle;
+
+    if (NULL == pQueue->ring.buffer)
+    {
+        return KOSA_StatusError;
+    }
+
+    /* Single producer, the free space can only grow until the message is written. */
+    if (SPSC_QueueGetFree(&pQueue->ring) < pQueue->size)
+    {
+        status = KOSA_StatusError;
+    }
+    else
+    {
+        (void)SPSC_QueuePut(&pQueue->ring, pMessage, pQueue->size);
+#if (defined(FSL_OSA_TASK_ENABLE) && (FSL_OSA_TASK_ENABLE > 0U))
+        if (NULL != pQueue->waitingTask)
+        {
+            OSA_TaskSetReadyState(pQueue->waitingTask, 1U);
+        }
+#endif
+    }
+#else
     uint32_t regPrimask;
 
     uint8_t *pMsgArray;
@@ -1263,11 +1356,12 @@ osa_status_t OSA_MsgQPut(osa_msgq_handle_t msgqHandle, osa_msg_handle_t pMessage
 #if (defined(FSL_OSA_TASK_ENABLE) && (FSL_OSA_TASK_ENABLE > 0U))
         if (NULL != pQueue->waitingTask)
         {
-            pQueue->waitingTask->haveToRun = 1U;
+            OSA_TaskSetReadyState(pQueue->waitingTask, 1U);
         }
 #endif
     }
     OSA_ExitCritical(regPrimask);
+#endif
     return status;
 }
 /*FUNCTION**********************************************************************
@@ -1288,9 +1382,11 @@ osa_status_t OSA_MsgQGet(osa_msgq_handle_t msgqHandle, osa_msg_handle_t pMessage
     assert(msgqHandle);
     msg_queue_t *pQueue;
     osa_status_t status = KOSA_StatusSuccess;
+#if !(defined(FSL_OSA_BM_MSGQ_SPSC_ENABLE) && (FSL_OSA_BM_MSGQ_SPSC_ENABLE > 0U))
     uint32_t regPrimask;
 
     uint8_t *pMsgArray;
+#endif
 
 #if (FSL_OSA_BM_TIMER_CONFIG != FSL_OSA_BM_TIMER_NONE)
     uint32_t currentTime;
@@ -1298,7 +1394,11 @@ osa_status_t OSA_MsgQGet(osa_msgq_handle_t msgqHandle, osa_msg_handle_t pMessage
 
     pQueue = (msg_queue_t *)msgqHandle;
 
+#if (defined(FSL_OSA_BM_MSGQ_SPSC_ENABLE) && (FSL_OSA_BM_MSGQ_SPSC_ENABLE > 0U))
+    if (NULL == pQueue->ring.buffer)
+#else
     if (NULL == pQueue->queueMem)
+#endif
     {
         return KOSA_StatusError;
     }
@@ -1307,6 +1407,16 @@ osa_status_t OSA_MsgQGet(osa_msgq_handle_t msgqHandle, osa_msg_handle_t pMessage
     pQueue->waitingTask = OSA_TaskGetCurrentHandle();
 #endif
 
+#if (defined(FSL_OSA_BM_MSGQ_SPSC_ENABLE) && (FSL_OSA_BM_MSGQ_SPSC_ENABLE > 0U))
+    /* Single consumer, the queue indices need no critical section. */
+    if (SPSC_QueueGetUsed(&pQueue->ring) >= pQueue->size)
+    {
+        (void)SPSC_QueueGet(&pQueue->ring, pMessage, pQueue->size);
+
+        pQueue->isWaiting = 0U;
+        status            = KOSA_StatusSuccess;
+    }
+#else
     OSA_EnterCritical(&regPrimask);
     if (0U != pQueue->number)
     {
@@ -1326,6 +1436,7 @@ osa_status_t OSA_MsgQGet(osa_msgq_handle_t msgqHandle, osa_msg_handle_t pMessage
         }
         status = KOSA_StatusSuccess;
     }
+#endif
     else
     {
         if (0U == millisec)
@@ -1357,12 +1468,21 @@ osa_status_t OSA_MsgQGet(osa_msgq_handle_t msgqHandle, osa_msg_handle_t pMessage
         else
         {
 #if (defined(FSL_OSA_TASK_ENABLE) && (FSL_OSA_TASK_ENABLE > 0U))
-            pQueue->waitingTask->haveToRun = 0U;
+            OSA_TaskSetReadyState(pQueue->waitingTask, 0U);
+#if (defined(FSL_OSA_BM_MSGQ_SPSC_ENABLE) && (FSL_OSA_BM_MSGQ_SPSC_ENABLE > 0U))
+            /* Don't miss the signal of a message put since the check above. */
+            if (SPSC_QueueGetUsed(&pQueue->ring) >= pQueue->size)
+            {
+                OSA_TaskSetReadyState(pQueue->waitingTask, 1U);
+            }
+#endif
 #endif
             status = KOSA_StatusIdle;
         }
     }
+#if !(defined(FSL_OSA_BM_MSGQ_SPSC_ENABLE) && (FSL_OSA_BM_MSGQ_SPSC_ENABLE > 0U))
     OSA_ExitCritical(regPrimask);
+#endif
 
     return status;
 }
@@ -1379,7 +1499,11 @@ int OSA_MsgQAvailableMsgs(osa_msgq_handle_t msgqHandle)
     assert(msgqHandle);
     msg_queue_t *pQueue = (msg_queue_t *)msgqHandle;
 
+#if (defined(FSL_OSA_BM_MSGQ_SPSC_ENABLE) && (FSL_OSA_BM_MSGQ_SPSC_ENABLE > 0U))
+    return (int)(SPSC_QueueGetUsed(&pQueue->ring) / pQueue->size);
+#else
     return (int)pQueue->number;
+#endif
 }
 
 /*FUNCTION**********************************************************************
@@ -1464,6 +1588,176 @@ int main(void)
     return 0;
 }
 #endif /*(defined(FSL_OSA_MAIN_FUNC_ENABLE) && (FSL_OSA_MAIN_FUNC_ENABLE > 0U))*/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSA_TaskSetReadyState
+ * Description   : This function marks a task ready to run or waiting, and
+ * keeps the ready bitmap up to date. It may be called from an ISR.
+ *
+ *END**************************************************************************/
+static void OSA_TaskSetReadyState(task_handler_t task, uint8_t ready)
+{
+#if (defined(FSL_OSA_BM_READY_BITMAP_ENABLE) && (FSL_OSA_BM_READY_BITMAP_ENABLE > 0U))
+    uint32_t regPrimask;
+    uint32_t priorityMask = 1UL << task->priority;
+
+    OSA_EnterCritical(&regPrimask);
+    if (ready != task->haveToRun)
+    {
+        task->haveToRun = ready;
+        /* A task that is not in the task list is counted when it is added */
+        if (NULL != task->link.list)
+        {
+            if (0U != ready)
+            {
+                s_osaState.readyCount[task->priority]++;
+                s_osaState.readyBitmap |= priorityMask;
+            }
+            else
+            {
+                s_osaState.readyCount[task->priority]--;
+                if (0U == s_osaState.readyCount[task->priority])
+                {
+                    s_osaState.readyBitmap &= ~priorityMask;
+                }
+            }
+        }
+    }
+    OSA_ExitCritical(regPrimask);
+#else
+    task->haveToRun = ready;
+#endif
+}
+
+#if (defined(FSL_OSA_BM_READY_BITMAP_ENABLE) && (FSL_OSA_BM_READY_BITMAP_ENABLE > 0U))
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSA_TaskUpdatePriority
+ * Description   : This function recounts the ready tasks of a priority and
+ * finds its first task, after the task list was changed.
+ *
+ *END**************************************************************************/
+static void OSA_TaskUpdatePriority(osa_task_priority_t priority)
+{
+    list_element_handle_t list_element;
+    task_control_block_t *tcb;
+    task_control_block_t *head = NULL;
+    uint8_t readyCount         = 0U;
+    uint32_t regPrimask;
+
+    assert(priority < FSL_OSA_BM_PRIORITY_NUM);
+
+    OSA_EnterCritical(&regPrimask);
+    list_element = LIST_GetHead(&s_osaState.taskList);
+    while (NULL != list_element)
+    {
+        tcb = (task_control_block_t *)(void *)list_element;
+        if (priority == tcb->priority)
+        {
+            if (NULL == head)
+            {
+                head = tcb;
+            }
+            if (0U != tcb->haveToRun)
+            {
+                readyCount++;
+            }
+        }
+        list_element = LIST_GetNext(list_element);
+    }
+    s_osaState.priorityHead[priority] = head;
+    s_osaState.priorityLast[priority] = NULL;
+    s_osaState.readyCount[priority]   = readyCount;
+    if (0U != readyCount)
+    {
+        s_osaState.readyBitmap |= 1UL << priority;
+    }
+    else
+    {
+        s_osaState.readyBitmap &= ~(1UL << priority);
+    }
+    OSA_ExitCritical(regPrimask);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSA_TaskFindReady
+ * Description   : This function finds the next ready task of a priority. The
+ * scan resumes after the task of this priority that ran last, so that ready
+ * tasks of the same priority take turns.
+ *
+ *END**************************************************************************/
+static task_handler_t OSA_TaskFindReady(osa_task_priority_t priority)
+{
+    task_control_block_t *last = s_osaState.priorityLast[priority];
+    task_control_block_t *tcb  = NULL;
+
+    /* From the task after the one that ran last to the end of the priority */
+    if (NULL != last)
+    {
+        tcb = (task_control_block_t *)(void *)LIST_GetNext(&last->link);
+    }
+    while ((NULL != tcb) && (priority == tcb->priority))
+    {
+        if (0U != tcb->haveToRun)
+        {
+            return tcb;
+        }
+        tcb = (task_control_block_t *)(void *)LIST_GetNext(&tcb->link);
+    }
+
+    /* Then from the first task of the priority up to the one that ran last */
+    tcb = s_osaState.priorityHead[priority];
+    while ((NULL != tcb) && (priority == tcb->priority))
+    {
+        if (0U != tcb->haveToRun)
+        {
+            return tcb;
+        }
+        if (tcb == last)
+        {
+            break;
+        }
+        tcb = (task_control_block_t *)(void *)LIST_GetNext(&tcb->link);
+    }
+
+    return NULL;
+}
+#endif
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSA_TaskRun
+ * Description   : This function calls the task function once and updates the
+ * run-time statistics of the task.
+ *
+ *END**************************************************************************/
+static void OSA_TaskRun(task_handler_t task)
+{
+#if (defined(FSL_OSA_BM_TASK_STATS_ENABLE) && (FSL_OSA_BM_TASK_STATS_ENABLE > 0U))
+    uint32_t startTime;
+    uint32_t runTime;
+#endif
+
+    if (NULL != task->p_func)
+    {
+#if (defined(FSL_OSA_BM_TASK_STATS_ENABLE) && (FSL_OSA_BM_TASK_STATS_ENABLE > 0U))
+        startTime = OSA_TaskStatsGetTime();
+        task->p_func(task->param);
+        runTime = OSA_TaskStatsGetTime() - startTime;
+
+        task->stats.runCount++;
+        task->stats.runTime += runTime;
+        if (runTime > task->stats.maxRunTime)
+        {
+            task->stats.maxRunTime = runTime;
+        }
+#else
+        task->p_func(task->param);
+#endif
+    }
+}
 #endif /* FSL_OSA_TASK_ENABLE */
 
 /*FUNCTION**********************************************************************
@@ -1478,6 +1772,12 @@ void OSA_Init(void)
 {
     LIST_Init((&s_osaState.taskList), 0);
     s_osaState.curTaskHandler        = NULL;
+#if (defined(FSL_OSA_BM_READY_BITMAP_ENABLE) && (FSL_OSA_BM_READY_BITMAP_ENABLE > 0U))
+    s_osaState.readyBitmap = 0U;
+    (void)memset(s_osaState.priorityHead, 0, sizeof(s_osaState.priorityHead));
+    (void)memset(s_osaState.priorityLast, 0, sizeof(s_osaState.priorityLast));
+    (void)memset((void *)s_osaState.readyCount, 0, sizeof(s_osaState.readyCount));
+#endif
     s_osaState.interruptDisableCount = 0U;
     s_osaState.tickCounter           = 0U;
 }
@@ -1492,12 +1792,26 @@ void OSA_Init(void)
 #if (defined(FSL_OSA_TASK_ENABLE) && (FSL_OSA_TASK_ENABLE > 0U))
 void OSA_Start(void)
 {
+#if (defined(FSL_OSA_BM_IDLE_SLEEP_ENABLE) && (FSL_OSA_BM_IDLE_SLEEP_ENABLE > 0U))
+    uint32_t regPrimask;
+#endif
+
 #if (FSL_OSA_BM_TIMER_CONFIG != FSL_OSA_BM_TIMER_NONE)
     OSA_TimeInit();
 #endif
     while (true)
     {
         OSA_ProcessTasks();
+#if (defined(FSL_OSA_BM_IDLE_SLEEP_ENABLE) && (FSL_OSA_BM_IDLE_SLEEP_ENABLE > 0U))
+        /* Check and sleep with the interrupts masked, so that a task signaled by an ISR in between is not missed.
+           A pending interrupt still wakes the core up, its handler runs once the interrupts are unmasked. */
+        OSA_EnterCritical(&regPrimask);
+        if (0U == OSA_TaskShouldYield())
+        {
+            __WFI();
+        }
+        OSA_ExitCritical(regPrimask);
+#endif
     }
 }
 
@@ -1509,6 +1823,31 @@ void OSA_Start(void)
  *END**************************************************************************/
 void OSA_ProcessTasks(void)
 {
+#if (defined(FSL_OSA_BM_READY_BITMAP_ENABLE) && (FSL_OSA_BM_READY_BITMAP_ENABLE > 0U))
+    task_control_block_t *tcb;
+    uint32_t readyBitmap;
+    osa_task_priority_t priority;
+
+    readyBitmap = s_osaState.readyBitmap;
+    while (0U != readyBitmap)
+    {
+        /* The highest priority is the lowest set bit, isolate it and look its index up */
+        priority = s_osaBitIndex[((readyBitmap & (0U - readyBitmap)) * 0x077CB531U) >> 27U];
+        tcb      = OSA_TaskFindReady(priority);
+        if (NULL != tcb)
+        {
+            s_osaState.priorityLast[priority] = tcb;
+            s_osaState.curTaskHandler         = (osa_task_handle_t)tcb;
+            OSA_TaskRun(tcb);
+        }
+        else
+        {
+            /* The count is out of date, the task list was changed from an ISR */
+            OSA_TaskUpdatePriority(priority);
+        }
+        readyBitmap = s_osaState.readyBitmap;
+    }
+#else
     list_element_handle_t list_element;
     task_control_block_t *tcb;
 
@@ -1519,10 +1858,7 @@ void OSA_ProcessTasks(void)
         s_osaState.curTaskHandler = (osa_task_handle_t)tcb;
         if (0U != tcb->haveToRun)
         {
-            if (NULL != tcb->p_func)
-            {
-                tcb->p_func(tcb->param);
-            }
+            OSA_TaskRun(tcb);
             list_element = LIST_GetHead(&s_osaState.taskList);
         }
         else
@@ -1530,6 +1866,7 @@ void OSA_ProcessTasks(void)
             list_element = LIST_GetNext(list_element);
         }
     }
+#endif
 }
 
 /*FUNCTION**********************************************************************
@@ -1540,6 +1877,9 @@ void OSA_ProcessTasks(void)
  *END**************************************************************************/
 uint8_t OSA_TaskShouldYield(void)
 {
+#if (defined(FSL_OSA_BM_READY_BITMAP_ENABLE) && (FSL_OSA_BM_READY_BITMAP_ENABLE > 0U))
+    return (0U != s_osaState.readyBitmap) ? 1U : 0U;
+#else
     list_element_handle_t list_element;
     uint8_t status = 0;
     task_control_block_t *tcb;
@@ -1556,7 +1896,54 @@ uint8_t OSA_TaskShouldYield(void)
         list_element = LIST_GetNext(list_element);
     }
     return status;
+#endif
+}
+
+#if (defined(FSL_OSA_BM_TASK_STATS_ENABLE) && (FSL_OSA_BM_TASK_STATS_ENABLE > 0U))
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSA_TaskGetStats
+ * Description   : This function gets the run-time statistics of a task.
+ *
+ *END**************************************************************************/
+osa_status_t OSA_TaskGetStats(osa_task_handle_t taskHandle, osa_task_stats_t *stats)
+{
+    task_handler_t handler = (task_handler_t)taskHandle;
+
+    assert(taskHandle);
+    assert(stats);
+
+    *stats = handler->stats;
+    return KOSA_StatusSuccess;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSA_TaskClearStats
+ * Description   : This function clears the run-time statistics of a task.
+ *
+ *END**************************************************************************/
+void OSA_TaskClearStats(osa_task_handle_t taskHandle)
+{
+    task_handler_t handler = (task_handler_t)taskHandle;
+
+    assert(taskHandle);
+
+    (void)memset(&handler->stats, 0, sizeof(handler->stats));
 }
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSA_TaskStatsGetTime
+ * Description   : This function gets the time stamp of the task statistics,
+ * in milliseconds unless it is overridden.
+ *
+ *END**************************************************************************/
+__WEAK_FUNC uint32_t OSA_TaskStatsGetTime(void)
+{
+    return OSA_TimeGetMsec();
+}
+#endif
 #endif
 
 /*FUNCTION**********************************************************************
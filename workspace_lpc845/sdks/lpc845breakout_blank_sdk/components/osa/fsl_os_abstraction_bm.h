@@ -1,6 +1,6 @@
 /*
  * Copyright (c) 2013 - 2014, Freescale Semiconductor, Inc.
- * Copyright 2016-2020 NXP
+ * Copyright 2016-2020, 2024 NXP
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -44,6 +44,19 @@ typedef uint32_t event_flags_t;
 #define TASK_MAX_NUM 7
 #endif
 
+/*! @brief How many task priorities the ready bitmap of the bare metal scheduler supports, 32 at most. */
+#ifndef FSL_OSA_BM_PRIORITY_NUM
+#define FSL_OSA_BM_PRIORITY_NUM (OSA_TASK_PRIORITY_MIN + 1U)
+#endif
+
+/*! @brief Run-time statistics of a bare metal task, the times are in units of OSA_TaskStatsGetTime(). */
+typedef struct _osa_task_stats
+{
+    uint32_t runCount;   /*!< Number of times the task function was called */
+    uint32_t runTime;    /*!< Total time spent in the task function         */
+    uint32_t maxRunTime; /*!< Longest single call of the task function      */
+} osa_task_stats_t;
+
 /*! @brief OSA's time range in millisecond, OSA time wraps if exceeds this value. */
 #define FSL_OSA_TIME_RANGE 0xFFFFFFFFU
 
@@ -73,10 +86,42 @@ void OSA_ProcessTasks(void);
  *
  * This function is used to check task should yield, When this function returns 1, an OSA task has to run.
  * This function is typically used with Interrupt disabled before executing WFI instruction.
+ * With FSL_OSA_BM_READY_BITMAP_ENABLE set, it only reads the ready bitmap.
  *
  */
 uint8_t OSA_TaskShouldYield(void);
 
+/*!
+ * @brief Get the run-time statistics of an OSA task
+ *
+ * This function is available when FSL_OSA_BM_TASK_STATS_ENABLE is set.
+ *
+ * @param taskHandle The task handle.
+ * @param stats Pointer to the structure the statistics are copied to.
+ * @retval KOSA_StatusSuccess The statistics are copied.
+ */
+osa_status_t OSA_TaskGetStats(osa_task_handle_t taskHandle, osa_task_stats_t *stats);
+
+/*!
+ * @brief Clear the run-time statistics of an OSA task
+ *
+ * This function is available when FSL_OSA_BM_TASK_STATS_ENABLE is set.
+ *
+ * @param taskHandle The task handle.
+ */
+void OSA_TaskClearStats(osa_task_handle_t taskHandle);
+
+/*!
+ * @brief Get the time stamp used for the task statistics
+ *
+ * The default implementation returns OSA_TimeGetMsec(). It is a weak function, override it with a free running
+ * counter of a finer resolution, such as a timer clocked by the core clock, to measure tasks that run for less than
+ * a millisecond. The counter must wrap at 32 bits.
+ *
+ * @return The current time stamp.
+ */
+uint32_t OSA_TaskStatsGetTime(void);
+
 /*!
  * @brief Correct OSA tick counter for when exiting sleep
  *
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#if !defined(__FSL_OS_ABSTRACTION_BM_COROUTINE_H__)
+#define __FSL_OS_ABSTRACTION_BM_COROUTINE_H__
+
+#include "fsl_os_abstraction.h"
+
+/*!
+ * @addtogroup os_abstraction_bm
+ * @{
+ */
+
+/*!
+ * @name Stackless coroutine tasks
+ *
+ * A bare metal task function is called again and again by OSA_ProcessTasks() while the task is ready, and it must
+ * return before any other task can run. These macros turn the task function into a stackless coroutine: an await
+ * returns from the function when the wait object is not ready, and the next call resumes at that await. The wait
+ * functions of the bare metal OSA already mark the task as waiting when they return KOSA_StatusIdle, and ready again
+ * when the object is posted, so an awaiting task costs nothing until it can go on.
+ *
+ * The coroutine keeps only its resume point and a time stamp, 8 bytes, next to the task handle. Local variables are
+ * not kept across an await, keep the data that must survive in static variables or in the context structure. The
+ * resume point is a case label of a switch, so a switch statement of the task must not contain an await, and there
+ * can be only one await per source line.
+ *
+ * @code
+ *   static osa_coroutine_t s_appCoroutine;
+ *
+ *   static void app_task(osa_task_param_t param)
+ *   {
+ *       osa_status_t status;
+ *
+ *       OSA_COROUTINE_BEGIN(&s_appCoroutine);
+ *       while (true)
+ *       {
+ *           OSA_COROUTINE_AWAIT_EVENT(&s_appCoroutine, s_dmaEvent, DMA_DONE_FLAG, 0U, osaWaitForever_c,
+ *                                     &s_dmaFlags, status);
+ *           OSA_COROUTINE_DELAY(&s_appCoroutine, 10U);
+ *       }
+ *       OSA_COROUTINE_END(&s_appCoroutine);
+ *   }
+ *
+ *   static OSA_TASK_DEFINE(app_task, OSA_PRIORITY_NORMAL, 1, 0, 0);
+ * @endcode
+ *
+ * The stack size of OSA_TASK_DEFINE is not used by the bare metal OSA, all the coroutines run on the main stack.
+ * Compared with an RTX thread, which needs a stack of OS_STACK_SIZE (3072 bytes by default) and a control block, a
+ * coroutine task needs the task handle and the coroutine context, 36 bytes. Resuming a coroutine is a function call
+ * and a jump through the switch, there is no context switch, but a coroutine is not preempted: a higher priority
+ * task runs when the running one awaits or returns.
+ *
+ * To await the completion of a DMA transfer, set an event or post a semaphore in the DMA callback and await it.
+ * OSA_COROUTINE_AWAIT_UNTIL() also works with a flag, but the task stays ready and polls the flag. The same holds for
+ * OSA_COROUTINE_DELAY() and OSA_COROUTINE_YIELD(): a polling task keeps the lower priority tasks from running and the
+ * core from sleeping, so give it the lowest priority, or post a semaphore from a timer_manager callback instead.
+ * @{
+ */
+
+/*! @brief Context of a stackless coroutine task. */
+typedef struct _osa_coroutine
+{
+    uint32_t timeStart; /*!< Time stamp of OSA_COROUTINE_DELAY        */
+    uint16_t line;      /*!< Resume point, 0 at the start of the task */
+} osa_coroutine_t;
+
+/*! @brief Initializer of a coroutine context, a zeroed context starts at OSA_COROUTINE_BEGIN. */
+#define OSA_COROUTINE_INIT \
+    {                      \
+        0U, 0U             \
+    }
+
+/*! @brief Restarts the coroutine at OSA_COROUTINE_BEGIN on its next call. */
+#define OSA_COROUTINE_RESET(co) ((co)->line = 0U)
+
+/*! @brief Starts the body of a coroutine task, resumes at the last await. */
+#define OSA_COROUTINE_BEGIN(co) \
+    switch ((co)->line)         \
+    {                           \
+        case 0U:
+
+/*! @brief Ends the body of a coroutine task, the next call starts again at OSA_COROUTINE_BEGIN. */
+#define OSA_COROUTINE_END(co) \
+    default:                  \
+        break;                \
+    }                         \
+    (co)->line = 0U
+
+/*! @brief Returns from the task, and resumes here on the next call. The task stays ready. */
+#define OSA_COROUTINE_YIELD(co)            \
+    do                                     \
+    {                                      \
+        (co)->line = (uint16_t)(__LINE__); \
+        return;                            \
+        case (__LINE__):;                  \
+    } while (false)
+
+/*! @brief Returns from the task until condition is true, the task stays ready and polls the condition. */
+#define OSA_COROUTINE_AWAIT_UNTIL(co, condition) \
+    do                                           \
+    {                                            \
+        (co)->line = (uint16_t)(__LINE__);       \
+        SUPPRESS_FALL_THROUGH_WARNING();         \
+        case (__LINE__):                         \
+            if (!(condition))                    \
+            {                                    \
+                return;                          \
+            }                                    \
+    } while (false)
+
+/*!
+ * @brief Calls a bare metal OSA wait function until it does not return KOSA_StatusIdle, its result is left in status.
+ *
+ * While the call returns KOSA_StatusIdle, the task returns and calls it again when it is resumed.
+ */
+#define OSA_COROUTINE_AWAIT_STATUS(co, call, status) \
+    do                                               \
+    {                                                \
+        (co)->line = (uint16_t)(__LINE__);           \
+        SUPPRESS_FALL_THROUGH_WARNING();             \
+        case (__LINE__):                             \
+            (status) = (call);                       \
+            if (KOSA_StatusIdle == (status))         \
+            {                                        \
+                return;                              \
+            }                                        \
+    } while (false)
+
+/*! @brief Awaits a semaphore, see OSA_SemaphoreWait(). */
+#define OSA_COROUTINE_AWAIT_SEMAPHORE(co, semaphoreHandle, millisec, status) \
+    OSA_COROUTINE_AWAIT_STATUS(co, OSA_SemaphoreWait((semaphoreHandle), (millisec)), status)
+
+/*! @brief Awaits a message, see OSA_MsgQGet(). */
+#define OSA_COROUTINE_AWAIT_MSGQ(co, msgqHandle, pMessage, millisec, status) \
+    OSA_COROUTINE_AWAIT_STATUS(co, OSA_MsgQGet((msgqHandle), (pMessage), (millisec)), status)
+
+/*! @brief Awaits event flags, see OSA_EventWait(). */
+#define OSA_COROUTINE_AWAIT_EVENT(co, eventHandle, flagsToWait, waitAll, millisec, pSetFlags, status)                 \
+    OSA_COROUTINE_AWAIT_STATUS(co, OSA_EventWait((eventHandle), (flagsToWait), (waitAll), (millisec), (pSetFlags)), \
+                               status)
+
+/*!
+ * @brief Returns from the task until millisec milliseconds have elapsed, the task stays ready.
+ *
+ * It requires an OSA timer, see FSL_OSA_BM_TIMER_CONFIG.
+ */
+#define OSA_COROUTINE_DELAY(co, millisec)                                                             \
+    do                                                                                                \
+    {                                                                                                 \
+        (co)->timeStart = OSA_TimeGetMsec();                                                          \
+        OSA_COROUTINE_AWAIT_UNTIL(co, (OSA_TimeGetMsec() - (co)->timeStart) >= (uint32_t)(millisec)); \
+    } while (false)
+
+/*! @} */
+/*! @} */
+#endif /* __FSL_OS_ABSTRACTION_BM_COROUTINE_H__ */
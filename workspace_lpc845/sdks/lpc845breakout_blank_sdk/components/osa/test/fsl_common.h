@@ -0,0 +1,70 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of fsl_common.h for the bare-metal OSA tests, see fsl_os_abstraction_bm_test.c and
+ * fsl_os_abstraction_bm_coroutine_test.c. */
+
+#ifndef _FSL_COMMON_H_
+#define _FSL_COMMON_H_
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef int32_t status_t;
+
+#define MAKE_STATUS(group, code) ((((group)*100) + (code)))
+
+enum _status_groups
+{
+    kStatusGroup_Generic = 0,
+    kStatusGroup_LIST    = 142,
+    kStatusGroup_OSA     = 143,
+};
+
+enum
+{
+    kStatus_Success = MAKE_STATUS(kStatusGroup_Generic, 0),
+};
+
+#define SDK_ALIGN(var, alignbytes) var __attribute__((aligned(alignbytes)))
+#define SUPPRESS_FALL_THROUGH_WARNING() __attribute__((fallthrough))
+
+/* The tests call the OSA from a single thread, the interrupts are the test calling the handlers */
+static inline uint32_t DisableGlobalIRQ(void)
+{
+    return 0U;
+}
+
+static inline void EnableGlobalIRQ(uint32_t primask)
+{
+    (void)primask;
+}
+
+/* The core sleeps in the test, which plays the interrupt that wakes it up */
+void TestWaitForInterrupt(void);
+#define __WFI() TestWaitForInterrupt()
+
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t LOAD;
+    volatile uint32_t VAL;
+} SysTick_Type;
+
+static SysTick_Type s_testSysTick;
+static uint32_t SystemCoreClock = 12000000U;
+
+#define SysTick                    (&s_testSysTick)
+#define SysTick_CTRL_ENABLE_Msk    (1UL << 0U)
+#define SysTick_CTRL_TICKINT_Msk   (1UL << 1U)
+#define SysTick_CTRL_CLKSOURCE_Msk (1UL << 2U)
+
+#endif /* _FSL_COMMON_H_ */
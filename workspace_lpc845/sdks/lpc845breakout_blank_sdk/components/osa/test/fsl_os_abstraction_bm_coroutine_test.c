@@ -0,0 +1,235 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host test of the stackless coroutine tasks of the bare-metal OSA.
+ *
+ * Build and run from this directory, with the task list scan and with the ready bitmap:
+ *   gcc -O2 -I. -I.. -I../config -I../../lists -o osa_coroutine_test fsl_os_abstraction_bm_coroutine_test.c && \
+ *       ./osa_coroutine_test
+ *   gcc -O2 -I. -I.. -I../config -I../../lists -DFSL_OSA_BM_READY_BITMAP_ENABLE=1U -o osa_coroutine_test \
+ *       fsl_os_abstraction_bm_coroutine_test.c && ./osa_coroutine_test
+ *
+ * Coroutine A of the higher priority awaits a semaphore three times, delays 5 ms and yields after each, then awaits
+ * an event flag and ends. Coroutine B of the lower priority prints every message of a message queue. The main loop
+ * posts them at fixed ticks, the SysTick also fires every few task calls as the delays poll. The order of the
+ * resumes is printed and checked, every delay has to take 5 ticks, the coroutines must not be called while they
+ * await, and no task may be left ready. The exit code is 0 on success.
+ */
+
+#include <stdio.h>
+
+/* The OSA tasks as built with the OSA component, the SysTick is the time base and the test calls its handler */
+#define OSA_USED
+#define FSL_OSA_BM_TIMER_CONFIG (1U)
+
+#include "fsl_os_abstraction.h"
+
+/* The handle sizes of the OSA are those of 32-bit targets, the host ones are taken from the structures */
+#undef OSA_TASK_HANDLE_SIZE
+#undef OSA_SEM_HANDLE_SIZE
+#undef OSA_MUTEX_HANDLE_SIZE
+#undef OSA_EVENT_HANDLE_SIZE
+#undef OSA_MSGQ_HANDLE_SIZE
+#define OSA_TASK_HANDLE_SIZE  (sizeof(task_control_block_t))
+#define OSA_SEM_HANDLE_SIZE   (sizeof(semaphore_t))
+#define OSA_MUTEX_HANDLE_SIZE (sizeof(mutex_t))
+#define OSA_EVENT_HANDLE_SIZE (sizeof(event_t))
+#define OSA_MSGQ_HANDLE_SIZE  (sizeof(msg_queue_t))
+
+#include "fsl_os_abstraction_bm.c"
+#include "fsl_component_generic_list.c"
+#include "fsl_os_abstraction_bm_coroutine.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_LOOP_NUM       (60U)
+#define TEST_CALLS_PER_TICK (4U)
+#define TEST_DELAY_MS       (5U)
+#define TEST_EVENT_FLAG     (2U)
+#define TEST_LOG_SIZE       (128U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static OSA_TASK_HANDLE_DEFINE(testTaskHandleA);
+static OSA_TASK_HANDLE_DEFINE(testTaskHandleB);
+static OSA_SEMAPHORE_HANDLE_DEFINE(testSemaphore);
+static OSA_MSGQ_HANDLE_DEFINE(testMsgQ, 4U, sizeof(uint32_t));
+static OSA_EVENT_HANDLE_DEFINE(testEvent);
+
+static osa_coroutine_t testCoroutineA = OSA_COROUTINE_INIT;
+static osa_coroutine_t testCoroutineB = OSA_COROUTINE_INIT;
+
+/* Kept across the awaits, so static */
+static uint32_t testIndex;
+static uint32_t testMessage;
+static osa_event_flags_t testFlags;
+static uint32_t testDelayStart;
+
+static char testLog[TEST_LOG_SIZE];
+static uint32_t testLogLength;
+static uint32_t testCalls;
+static uint32_t testCallsA;
+static uint32_t testCallsB;
+static uint32_t testDelayErrors;
+
+static int testFailures;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void TestLog(const char *text, uint32_t value)
+{
+    int length = snprintf(&testLog[testLogLength], TEST_LOG_SIZE - testLogLength, "%s%s%u",
+                          (testLogLength != 0U) ? " " : "", text, (unsigned)value);
+
+    if (length > 0)
+    {
+        testLogLength += (uint32_t)length;
+        testLogLength = (testLogLength < TEST_LOG_SIZE) ? testLogLength : (TEST_LOG_SIZE - 1U);
+    }
+}
+
+/* Every task call takes time, the SysTick fires every few calls */
+static void TestTaskCall(void)
+{
+    if ((++testCalls % TEST_CALLS_PER_TICK) == 0U)
+    {
+        SysTick_Handler();
+    }
+}
+
+static void TestTaskA(osa_task_param_t param)
+{
+    osa_status_t status;
+
+    TestTaskCall();
+    testCallsA++;
+
+    OSA_COROUTINE_BEGIN(&testCoroutineA);
+    for (testIndex = 0U; testIndex < 3U; testIndex++)
+    {
+        OSA_COROUTINE_AWAIT_SEMAPHORE(&testCoroutineA, testSemaphore, osaWaitForever_c, status);
+        TestLog((KOSA_StatusSuccess == status) ? "A" : "A?", testIndex);
+        testDelayStart = OSA_TimeGetMsec();
+        OSA_COROUTINE_DELAY(&testCoroutineA, TEST_DELAY_MS);
+        if ((OSA_TimeGetMsec() - testDelayStart) != TEST_DELAY_MS)
+        {
+            testDelayErrors++;
+        }
+        TestLog("d", OSA_TimeGetMsec() - testDelayStart);
+        OSA_COROUTINE_YIELD(&testCoroutineA);
+    }
+    OSA_COROUTINE_AWAIT_EVENT(&testCoroutineA, testEvent, TEST_EVENT_FLAG, 0U, osaWaitForever_c, &testFlags, status);
+    TestLog((KOSA_StatusSuccess == status) ? "E" : "E?", testFlags);
+    OSA_COROUTINE_END(&testCoroutineA);
+}
+
+static void TestTaskB(osa_task_param_t param)
+{
+    osa_status_t status;
+
+    TestTaskCall();
+    testCallsB++;
+
+    OSA_COROUTINE_BEGIN(&testCoroutineB);
+    while (true)
+    {
+        OSA_COROUTINE_AWAIT_MSGQ(&testCoroutineB, testMsgQ, &testMessage, osaWaitForever_c, status);
+        TestLog((KOSA_StatusSuccess == status) ? "B" : "B?", testMessage);
+    }
+    OSA_COROUTINE_END(&testCoroutineB);
+}
+
+static OSA_TASK_DEFINE(TestTaskA, OSA_PRIORITY_NORMAL, 1, 0, false);
+static OSA_TASK_DEFINE(TestTaskB, OSA_PRIORITY_NORMAL, 1, 0, false);
+
+/* OSA_Start() is not run by this test, its idle sleep is never reached */
+void TestWaitForInterrupt(void)
+{
+    testFailures++;
+}
+
+static void TestCoroutines(void)
+{
+    uint32_t loop;
+    uint32_t message;
+    uint32_t idleCalls = 0U;
+
+    OSA_Init();
+    (void)OSA_SemaphoreCreate((osa_semaphore_handle_t)testSemaphore, 0U);
+    (void)OSA_MsgQCreate((osa_msgq_handle_t)testMsgQ, 4U, sizeof(uint32_t));
+    (void)OSA_EventCreate((osa_event_handle_t)testEvent, 1U);
+    (void)OSA_TaskCreate((osa_task_handle_t)testTaskHandleA, OSA_TASK(TestTaskA), NULL);
+    (void)OSA_TaskCreate((osa_task_handle_t)testTaskHandleB, OSA_TASK(TestTaskB), NULL);
+    (void)OSA_TaskSetPriority((osa_task_handle_t)testTaskHandleA, 1U);
+    (void)OSA_TaskSetPriority((osa_task_handle_t)testTaskHandleB, 2U);
+
+    for (loop = 0U; loop < TEST_LOOP_NUM; loop++)
+    {
+        if ((3U == loop) || (4U == loop) || (30U == loop))
+        {
+            (void)OSA_SemaphorePost((osa_semaphore_handle_t)testSemaphore);
+        }
+        if (4U == loop)
+        {
+            /* B is ready while A delays, it runs when A yields and awaits again */
+            message = 11U;
+            (void)OSA_MsgQPut((osa_msgq_handle_t)testMsgQ, &message);
+            message = 12U;
+            (void)OSA_MsgQPut((osa_msgq_handle_t)testMsgQ, &message);
+        }
+        if (50U == loop)
+        {
+            (void)OSA_EventSet((osa_event_handle_t)testEvent, TEST_EVENT_FLAG);
+        }
+        if (31U == loop)
+        {
+            idleCalls = testCallsA + testCallsB;
+        }
+        if (49U == loop)
+        {
+            /* Both await, A the event and B a message, neither has been called since */
+            idleCalls = testCallsA + testCallsB - idleCalls;
+        }
+
+        OSA_ProcessTasks();
+        SysTick_Handler();
+    }
+
+    printf("coroutines: %s\n", testLog);
+    printf("%u calls of A, %u of B, %u while awaiting, %u delay errors\n", (unsigned)testCallsA,
+           (unsigned)testCallsB, (unsigned)idleCalls, (unsigned)testDelayErrors);
+    if (0 != strcmp(testLog, "A0 d5 A1 d5 B11 B12 A2 d5 E2"))
+    {
+        printf("FAIL: A0 d5 A1 d5 B11 B12 A2 d5 E2 expected\n");
+        testFailures++;
+    }
+    if ((0U != idleCalls) || (0U != testDelayErrors))
+    {
+        testFailures++;
+    }
+    if (0U != OSA_TaskShouldYield())
+    {
+        printf("FAIL: a task is left ready\n");
+        testFailures++;
+    }
+}
+
+int main(void)
+{
+    printf("FSL_OSA_BM_READY_BITMAP_ENABLE %u\n", (unsigned)FSL_OSA_BM_READY_BITMAP_ENABLE);
+    TestCoroutines();
+
+    printf("%s\n", testFailures == 0 ? "PASS" : "FAIL");
+    return testFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,450 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host test of the bare-metal OSA task scheduling.
+ *
+ * Build and run from this directory, with the task list scan and with the ready bitmap, idle sleep and statistics:
+ *   gcc -O2 -I. -I.. -I../config -I../../lists -o osa_bm_test fsl_os_abstraction_bm_test.c && ./osa_bm_test
+ *   gcc -O2 -I. -I.. -I../config -I../../lists -DFSL_OSA_BM_READY_BITMAP_ENABLE=1U -DFSL_OSA_BM_IDLE_SLEEP_ENABLE=1U \
+ *       -DFSL_OSA_BM_TASK_STATS_ENABLE=1U -o osa_bm_test fsl_os_abstraction_bm_test.c && ./osa_bm_test
+ *
+ * Three always ready tasks of one priority run five times each, the run order is printed and checked: the list scan
+ * runs the first task of the list until it waits, the ready bitmap lets the tasks take turns. A low priority task then
+ * signals a high priority one, which has to run right after every signal. Random tasks of random priorities then post
+ * each other's semaphores, wait on their own and burn SysTick ticks, while the test changes their priorities and posts
+ * semaphores in between. Every dispatched task has to be of the highest ready priority and, with the ready bitmap, a
+ * task must not run twice while another ready task of its priority waits. The statistics have to match the runs and
+ * ticks of every task, and with the idle sleep the core has to sleep only when no task is ready. The exit code is 0
+ * on success.
+ */
+
+#include <setjmp.h>
+#include <stdio.h>
+
+/* The OSA tasks as built with the OSA component, the SysTick is the time base and the test calls its handler */
+#define OSA_USED
+#define FSL_OSA_BM_TIMER_CONFIG (1U)
+
+#include "fsl_os_abstraction.h"
+
+/* The handle sizes of the OSA are those of 32-bit targets, the host ones are taken from the structures */
+#undef OSA_TASK_HANDLE_SIZE
+#undef OSA_SEM_HANDLE_SIZE
+#undef OSA_MUTEX_HANDLE_SIZE
+#undef OSA_EVENT_HANDLE_SIZE
+#undef OSA_MSGQ_HANDLE_SIZE
+#define OSA_TASK_HANDLE_SIZE  (sizeof(task_control_block_t))
+#define OSA_SEM_HANDLE_SIZE   (sizeof(semaphore_t))
+#define OSA_MUTEX_HANDLE_SIZE (sizeof(mutex_t))
+#define OSA_EVENT_HANDLE_SIZE (sizeof(event_t))
+#define OSA_MSGQ_HANDLE_SIZE  (sizeof(msg_queue_t))
+
+#include "fsl_os_abstraction_bm.c"
+#include "fsl_component_generic_list.c"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_TASK_NUM     (6U)
+#define TEST_ROUND_NUM    (20000U)
+#define TEST_IDLE_NUM     (2000U)
+#define TEST_LOG_SIZE     (64U)
+#define TEST_PRIORITY_LOW (4U)
+
+typedef void (*test_behaviour_t)(uint32_t task);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint32_t testTaskHandles[TEST_TASK_NUM][(sizeof(task_control_block_t) + 3U) / 4U];
+static uint32_t testSemaphores[TEST_TASK_NUM][(sizeof(semaphore_t) + 3U) / 4U];
+static test_behaviour_t testBehaviour;
+
+static char testLog[TEST_LOG_SIZE];
+static uint32_t testLogLength;
+static uint32_t testRunsLeft[TEST_TASK_NUM];
+
+static uint32_t testRunCount;
+static uint32_t testLastRun[TEST_TASK_NUM];
+static uint32_t testReadySince[TEST_TASK_NUM];
+static uint32_t testRuns[TEST_TASK_NUM];
+static uint32_t testTicks[TEST_TASK_NUM];
+static uint32_t testMaxTicks[TEST_TASK_NUM];
+static uint32_t testPriorityErrors;
+static uint32_t testTurnErrors;
+static uint32_t testPosts;
+
+static jmp_buf testIdleExit;
+static uint32_t testSleeps;
+static uint32_t testSleepErrors;
+
+static unsigned long testSeed = 1U;
+static int testFailures;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t TestRandom(void)
+{
+    testSeed = (testSeed * 1103515245U + 12345U) & 0xFFFFFFFFU;
+    return (uint32_t)(testSeed >> 8);
+}
+
+static task_control_block_t *TestTcb(uint32_t task)
+{
+    return (task_control_block_t *)(void *)testTaskHandles[task];
+}
+
+/* Posts the semaphore of a task and notes when the post makes it ready */
+static void TestPost(uint32_t task)
+{
+    uint8_t wasReady = TestTcb(task)->haveToRun;
+
+    (void)OSA_SemaphorePost((osa_semaphore_handle_t)testSemaphores[task]);
+    if ((0U == wasReady) && (0U != TestTcb(task)->haveToRun))
+    {
+        testReadySince[task] = testRunCount;
+    }
+    testPosts++;
+}
+
+/* Checks the dispatch of a task against the ready state of all the others, then runs its behaviour */
+static void TestTaskRun(uint32_t task)
+{
+    task_control_block_t *tcb = TestTcb(task);
+    uint32_t other;
+
+    testRunCount++;
+    for (other = 0U; other < TEST_TASK_NUM; other++)
+    {
+        task_control_block_t *otherTcb = TestTcb(other);
+
+        if ((other == task) || (NULL == otherTcb->p_func) || (0U == otherTcb->haveToRun))
+        {
+            continue;
+        }
+        if (otherTcb->priority < tcb->priority)
+        {
+            testPriorityErrors++;
+        }
+#if (defined(FSL_OSA_BM_READY_BITMAP_ENABLE) && (FSL_OSA_BM_READY_BITMAP_ENABLE > 0U))
+        /* Ready at the previous run of this task and not run since */
+        if ((otherTcb->priority == tcb->priority) && (testLastRun[task] != 0U) &&
+            (testReadySince[other] < testLastRun[task]) && (testLastRun[other] < testLastRun[task]))
+        {
+            testTurnErrors++;
+        }
+#endif
+    }
+    testLastRun[task] = testRunCount;
+
+    testBehaviour(task);
+}
+
+static void TestTask0(osa_task_param_t param)
+{
+    TestTaskRun(0U);
+}
+
+static void TestTask1(osa_task_param_t param)
+{
+    TestTaskRun(1U);
+}
+
+static void TestTask2(osa_task_param_t param)
+{
+    TestTaskRun(2U);
+}
+
+static void TestTask3(osa_task_param_t param)
+{
+    TestTaskRun(3U);
+}
+
+static void TestTask4(osa_task_param_t param)
+{
+    TestTaskRun(4U);
+}
+
+static void TestTask5(osa_task_param_t param)
+{
+    TestTaskRun(5U);
+}
+
+static OSA_TASK_DEFINE(TestTask0, OSA_PRIORITY_NORMAL, 1, 0, false);
+static OSA_TASK_DEFINE(TestTask1, OSA_PRIORITY_NORMAL, 1, 0, false);
+static OSA_TASK_DEFINE(TestTask2, OSA_PRIORITY_NORMAL, 1, 0, false);
+static OSA_TASK_DEFINE(TestTask3, OSA_PRIORITY_NORMAL, 1, 0, false);
+static OSA_TASK_DEFINE(TestTask4, OSA_PRIORITY_NORMAL, 1, 0, false);
+static OSA_TASK_DEFINE(TestTask5, OSA_PRIORITY_NORMAL, 1, 0, false);
+
+static const osa_task_def_t *const testTaskDefs[TEST_TASK_NUM] = {OSA_TASK(TestTask0), OSA_TASK(TestTask1),
+                                                                  OSA_TASK(TestTask2), OSA_TASK(TestTask3),
+                                                                  OSA_TASK(TestTask4), OSA_TASK(TestTask5)};
+
+/* Creates count tasks of the given priorities, in task order, each with its own semaphore */
+static void TestSetUp(uint32_t count, const osa_task_priority_t *priorities, test_behaviour_t behaviour)
+{
+    uint32_t task;
+
+    (void)memset(testTaskHandles, 0, sizeof(testTaskHandles));
+    (void)memset(testLastRun, 0, sizeof(testLastRun));
+    (void)memset(testReadySince, 0, sizeof(testReadySince));
+    (void)memset(testRuns, 0, sizeof(testRuns));
+    (void)memset(testTicks, 0, sizeof(testTicks));
+    (void)memset(testMaxTicks, 0, sizeof(testMaxTicks));
+    testRunCount       = 0U;
+    testPriorityErrors = 0U;
+    testTurnErrors     = 0U;
+    testPosts          = 0U;
+    testLogLength      = 0U;
+    testBehaviour      = behaviour;
+
+    OSA_Init();
+    for (task = 0U; task < count; task++)
+    {
+        (void)OSA_SemaphoreCreate((osa_semaphore_handle_t)testSemaphores[task], 0U);
+        (void)OSA_TaskCreate((osa_task_handle_t)testTaskHandles[task], testTaskDefs[task], NULL);
+        (void)OSA_TaskSetPriority((osa_task_handle_t)testTaskHandles[task], priorities[task]);
+    }
+}
+
+static void TestLogTask(uint32_t task)
+{
+    if (testLogLength < (TEST_LOG_SIZE - 1U))
+    {
+        testLog[testLogLength++] = (char)('A' + task);
+    }
+    testLog[testLogLength] = '\0';
+}
+
+static void TestCheckLog(const char *name, const char *expected)
+{
+    printf("%s: %s\n", name, testLog);
+    if (0 != strcmp(testLog, expected))
+    {
+        printf("FAIL: %s expected\n", expected);
+        testFailures++;
+    }
+}
+
+/* Runs a number of times, then waits forever */
+static void TestBehaviourTurns(uint32_t task)
+{
+    TestLogTask(task);
+    if (--testRunsLeft[task] == 0U)
+    {
+        (void)OSA_SemaphoreWait((osa_semaphore_handle_t)testSemaphores[task], osaWaitForever_c);
+    }
+}
+
+static void TestTurns(void)
+{
+    static const osa_task_priority_t priorities[] = {3U, 3U, 3U};
+
+    TestSetUp(3U, priorities, TestBehaviourTurns);
+    testRunsLeft[0] = 5U;
+    testRunsLeft[1] = 5U;
+    testRunsLeft[2] = 5U;
+    OSA_ProcessTasks();
+
+    /* A new task goes before the tasks of its priority, the list is C B A */
+#if (defined(FSL_OSA_BM_READY_BITMAP_ENABLE) && (FSL_OSA_BM_READY_BITMAP_ENABLE > 0U))
+    TestCheckLog("same priority", "CBACBACBACBACBA");
+#else
+    TestCheckLog("same priority", "CCCCCBBBBBAAAAA");
+#endif
+}
+
+/* Task A signals task B of a higher priority five times, B logs every signal it takes */
+static void TestBehaviourSignal(uint32_t task)
+{
+    if (0U == task)
+    {
+        TestLogTask(task);
+        TestPost(1U);
+        if (--testRunsLeft[task] == 0U)
+        {
+            (void)OSA_SemaphoreWait((osa_semaphore_handle_t)testSemaphores[task], osaWaitForever_c);
+        }
+    }
+    else if (KOSA_StatusSuccess == OSA_SemaphoreWait((osa_semaphore_handle_t)testSemaphores[task], osaWaitForever_c))
+    {
+        TestLogTask(task);
+    }
+}
+
+static void TestSignal(void)
+{
+    static const osa_task_priority_t priorities[] = {TEST_PRIORITY_LOW, 1U};
+
+    TestSetUp(2U, priorities, TestBehaviourSignal);
+    testRunsLeft[0] = 5U;
+    OSA_ProcessTasks();
+    TestCheckLog("higher priority signaled", "ABABABABAB");
+}
+
+/* Posts, waits or spends time at random. A post can both count and ready a task, it takes two waits to block
+ * again, so there are fewer posts than waits for OSA_ProcessTasks() to come back. */
+static void TestBehaviourRandom(uint32_t task)
+{
+    uint32_t ticks = TestRandom() % 4U;
+    uint32_t action = TestRandom() % 8U;
+    uint32_t k;
+
+    for (k = 0U; k < ticks; k++)
+    {
+        SysTick_Handler();
+    }
+    testRuns[task]++;
+    testTicks[task] += ticks;
+    testMaxTicks[task] = (ticks > testMaxTicks[task]) ? ticks : testMaxTicks[task];
+
+    if (action < 2U)
+    {
+        TestPost(TestRandom() % TEST_TASK_NUM);
+    }
+    else if (action < 7U)
+    {
+        (void)OSA_SemaphoreWait((osa_semaphore_handle_t)testSemaphores[task], osaWaitForever_c);
+    }
+}
+
+static void TestRandomTasks(void)
+{
+    osa_task_priority_t priorities[TEST_TASK_NUM];
+    uint32_t round, task, k;
+
+    for (task = 0U; task < TEST_TASK_NUM; task++)
+    {
+        priorities[task] = (osa_task_priority_t)(1U + TestRandom() % 3U);
+    }
+    TestSetUp(TEST_TASK_NUM, priorities, TestBehaviourRandom);
+
+    for (round = 0U; round < TEST_ROUND_NUM; round++)
+    {
+        /* The same priority check restarts when the priorities are recounted */
+        if (TestRandom() % 16U == 0U)
+        {
+            task = TestRandom() % TEST_TASK_NUM;
+            (void)OSA_TaskSetPriority((osa_task_handle_t)testTaskHandles[task],
+                                      (osa_task_priority_t)(1U + TestRandom() % 3U));
+            for (k = 0U; k < TEST_TASK_NUM; k++)
+            {
+                testReadySince[k] = testRunCount;
+            }
+        }
+        for (k = TestRandom() % 3U; k > 0U; k--)
+        {
+            TestPost(TestRandom() % TEST_TASK_NUM);
+        }
+
+        OSA_ProcessTasks();
+        if (0U != OSA_TaskShouldYield())
+        {
+            printf("FAIL: a task is left ready\n");
+            testFailures++;
+        }
+    }
+
+    printf("random tasks: %u rounds, %u runs, %u posts, %u priority errors, %u same priority turn errors\n",
+           (unsigned)TEST_ROUND_NUM, (unsigned)testRunCount, (unsigned)testPosts, (unsigned)testPriorityErrors,
+           (unsigned)testTurnErrors);
+    if ((0U != testPriorityErrors) || (0U != testTurnErrors))
+    {
+        testFailures++;
+    }
+
+#if (defined(FSL_OSA_BM_TASK_STATS_ENABLE) && (FSL_OSA_BM_TASK_STATS_ENABLE > 0U))
+    {
+        osa_task_stats_t stats;
+        uint32_t mismatches = 0U;
+
+        for (task = 0U; task < TEST_TASK_NUM; task++)
+        {
+            (void)OSA_TaskGetStats((osa_task_handle_t)testTaskHandles[task], &stats);
+            if ((stats.runCount != testRuns[task]) || (stats.runTime != testTicks[task]) ||
+                (stats.maxRunTime != testMaxTicks[task]))
+            {
+                mismatches++;
+            }
+        }
+        (void)OSA_TaskGetStats((osa_task_handle_t)testTaskHandles[0], &stats);
+        printf("statistics: task A %u runs, %u ticks, %u at most, %u tasks mismatch\n", (unsigned)stats.runCount,
+               (unsigned)stats.runTime, (unsigned)stats.maxRunTime, (unsigned)mismatches);
+        if (0U != mismatches)
+        {
+            testFailures++;
+        }
+    }
+#endif
+}
+
+/* The idle loop of OSA_Start() sleeps here, an interrupt posts a semaphore or the test ends */
+void TestWaitForInterrupt(void)
+{
+    uint32_t task;
+
+    for (task = 0U; task < TEST_TASK_NUM; task++)
+    {
+        if ((NULL != TestTcb(task)->p_func) && (0U != TestTcb(task)->haveToRun))
+        {
+            testSleepErrors++;
+        }
+    }
+    if (++testSleeps == TEST_IDLE_NUM)
+    {
+        longjmp(testIdleExit, 1);
+    }
+    TestPost(TestRandom() % TEST_TASK_NUM);
+}
+
+static void TestIdleSleep(void)
+{
+#if (defined(FSL_OSA_BM_IDLE_SLEEP_ENABLE) && (FSL_OSA_BM_IDLE_SLEEP_ENABLE > 0U))
+    osa_task_priority_t priorities[TEST_TASK_NUM];
+    uint32_t task;
+
+    for (task = 0U; task < TEST_TASK_NUM; task++)
+    {
+        priorities[task] = (osa_task_priority_t)(1U + TestRandom() % 3U);
+    }
+    TestSetUp(TEST_TASK_NUM, priorities, TestBehaviourRandom);
+    testSleeps      = 0U;
+    testSleepErrors = 0U;
+
+    if (0 == setjmp(testIdleExit))
+    {
+        OSA_Start();
+    }
+
+    printf("idle sleep: %u sleeps, %u task runs, %u sleeps with a ready task\n", (unsigned)testSleeps,
+           (unsigned)testRunCount, (unsigned)testSleepErrors);
+    if ((0U != testSleepErrors) || (0U != testPriorityErrors) || (0U != testTurnErrors))
+    {
+        testFailures++;
+    }
+#endif
+}
+
+int main(void)
+{
+    printf("FSL_OSA_BM_READY_BITMAP_ENABLE %u, FSL_OSA_BM_IDLE_SLEEP_ENABLE %u, FSL_OSA_BM_TASK_STATS_ENABLE %u\n",
+           (unsigned)FSL_OSA_BM_READY_BITMAP_ENABLE, (unsigned)FSL_OSA_BM_IDLE_SLEEP_ENABLE,
+           (unsigned)FSL_OSA_BM_TASK_STATS_ENABLE);
+    TestTurns();
+    TestSignal();
+    TestRandomTasks();
+    TestIdleSleep();
+
+    printf("%s\n", testFailures == 0 ? "PASS" : "FAIL");
+    return testFailures == 0 ? 0 : 1;
+}
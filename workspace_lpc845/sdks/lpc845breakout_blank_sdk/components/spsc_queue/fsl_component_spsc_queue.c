@@ -0,0 +1,155 @@
+/*
+ * Copyright 2024 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*! *********************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+********************************************************************************** */
+#include "fsl_component_spsc_queue.h"
+#include <string.h>
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private functions
+*************************************************************************************
+********************************************************************************** */
+
+/* Maps a queue index to a buffer offset. */
+static inline uint32_t SPSC_QueueOffset(spsc_queue_handle_t queue, uint32_t index)
+{
+    return (index >= queue->size) ? (index - queue->size) : index;
+}
+
+/* Moves a queue index forward, wrapping at twice the buffer size. */
+static inline uint32_t SPSC_QueueAdvance(spsc_queue_handle_t queue, uint32_t index, uint32_t length)
+{
+    index += length;
+    if (index >= (2U * queue->size))
+    {
+        index -= 2U * queue->size;
+    }
+    return index;
+}
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+********************************************************************************** */
+/*!
+ * @brief Initialize the queue.
+ *
+ * @param queue - Queue handle to initialize.
+ * @param buffer - Queue storage.
+ * @param size - Storage size in bytes, at most 0x7FFFFFFF.
+ */
+void SPSC_QueueInit(spsc_queue_handle_t queue, uint8_t *buffer, uint32_t size)
+{
+    assert(NULL != queue);
+    assert((NULL != buffer) || (0U == size));
+    assert(size <= 0x7FFFFFFFU);
+
+    queue->buffer = buffer;
+    queue->size   = size;
+    queue->head   = 0U;
+    queue->tail   = 0U;
+}
+
+/*!
+ * @brief Writes data to the queue, producer side.
+ *
+ * @param queue - Handle of the queue.
+ * @param data - Data to write.
+ * @param length - Number of bytes to write.
+ *
+ * @retval Number of bytes written.
+ */
+uint32_t SPSC_QueuePut(spsc_queue_handle_t queue, const void *data, uint32_t length)
+{
+    uint32_t head = queue->head;
+    uint32_t offset;
+    uint32_t first;
+
+    length = MIN(length, SPSC_QueueGetFree(queue));
+    if (0U == length)
+    {
+        return 0U;
+    }
+
+    /* The free space may wrap around the end of the buffer. */
+    offset = SPSC_QueueOffset(queue, head);
+    first  = MIN(length, queue->size - offset);
+    (void)memcpy(&queue->buffer[offset], data, first);
+    if (first < length)
+    {
+        (void)memcpy(queue->buffer, (const uint8_t *)data + first, length - first);
+    }
+
+    /* Data must be in the buffer before the consumer sees the new head. */
+    SPSC_QUEUE_BARRIER();
+    queue->head = SPSC_QueueAdvance(queue, head, length);
+
+    return length;
+}
+
+/*!
+ * @brief Reads data from the queue, consumer side.
+ *
+ * @param queue - Handle of the queue.
+ * @param data - Buffer to copy the data to.
+ * @param length - Maximum number of bytes to read.
+ *
+ * @retval Number of bytes read.
+ */
+uint32_t SPSC_QueueGet(spsc_queue_handle_t queue, void *data, uint32_t length)
+{
+    uint32_t tail = queue->tail;
+    uint32_t offset;
+    uint32_t first;
+
+    length = MIN(length, SPSC_QueueGetUsed(queue));
+    if (0U == length)
+    {
+        return 0U;
+    }
+
+    /* Data is read only after the head has been seen. */
+    SPSC_QUEUE_BARRIER();
+    offset = SPSC_QueueOffset(queue, tail);
+    first  = MIN(length, queue->size - offset);
+    (void)memcpy(data, &queue->buffer[offset], first);
+    if (first < length)
+    {
+        (void)memcpy((uint8_t *)data + first, queue->buffer, length - first);
+    }
+
+    /* Data must be copied out before the producer may overwrite it. */
+    SPSC_QUEUE_BARRIER();
+    queue->tail = SPSC_QueueAdvance(queue, tail, length);
+
+    return length;
+}
+
+/*!
+ * @brief Drops data from the queue without copying it, consumer side.
+ *
+ * @param queue - Handle of the queue.
+ * @param length - Maximum number of bytes to drop.
+ *
+ * @retval Number of bytes dropped.
+ */
+uint32_t SPSC_QueueSkip(spsc_queue_handle_t queue, uint32_t length)
+{
+    length = MIN(length, SPSC_QueueGetUsed(queue));
+    if (0U != length)
+    {
+        queue->tail = SPSC_QueueAdvance(queue, queue->tail, length);
+    }
+
+    return length;
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright 2024 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_COMPONENT_SPSC_QUEUE_H_
+#define _FSL_COMPONENT_SPSC_QUEUE_H_
+
+#ifndef SDK_COMPONENT_DEPENDENCY_FSL_COMMON
+#define SDK_COMPONENT_DEPENDENCY_FSL_COMMON (1U)
+#endif
+#if (defined(SDK_COMPONENT_DEPENDENCY_FSL_COMMON) && (SDK_COMPONENT_DEPENDENCY_FSL_COMMON > 0U))
+#include "fsl_common.h"
+#else
+#endif
+
+/*!
+ * @addtogroup SpscQueue
+ * @{
+ */
+
+/**********************************************************************************
+ * Public macro definitions
+ ***********************************************************************************/
+
+/*! @brief Orders the queue memory accesses against the index updates.
+ *
+ * A data memory barrier is enough on single and multi core Cortex-M parts, it can be redefined to a compiler barrier
+ * when both sides run on the same in-order core.
+ */
+#ifndef SPSC_QUEUE_BARRIER
+#define SPSC_QUEUE_BARRIER() __DMB()
+#endif
+
+/**********************************************************************************
+ * Public type definitions
+ ***********************************************************************************/
+
+/*! @brief Single producer single consumer byte queue.
+ *
+ * The producer only writes @p head and the consumer only writes @p tail, so one producer and one consumer, for
+ * example an ISR and a task, can use the queue concurrently without a critical section. The indices run over twice
+ * the buffer size, which tells a full queue from an empty one without losing a byte and avoids any division, so the
+ * buffer size does not have to be a power of two.
+ */
+typedef struct spsc_queue
+{
+    uint8_t *buffer;        /*!< Queue storage */
+    uint32_t size;          /*!< Storage size in bytes */
+    volatile uint32_t head; /*!< Write index in [0, 2 * size), written by the producer only */
+    volatile uint32_t tail; /*!< Read index in [0, 2 * size), written by the consumer only */
+} spsc_queue_t, *spsc_queue_handle_t;
+
+/**********************************************************************************
+ * API
+ **********************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* _cplusplus */
+
+/*!
+ * @brief Initialize the queue.
+ *
+ * This function initialize the queue, the queue is empty afterwards. It must not run concurrently with the producer
+ * or the consumer.
+ *
+ * @param queue - Queue handle to initialize.
+ * @param buffer - Queue storage.
+ * @param size - Storage size in bytes, at most 0x7FFFFFFF.
+ */
+void SPSC_QueueInit(spsc_queue_handle_t queue, uint8_t *buffer, uint32_t size);
+
+/*!
+ * @brief Gets the number of bytes in the queue.
+ *
+ * The value is exact for the consumer, the producer may only see it shrink afterwards.
+ *
+ * @param queue - Handle of the queue.
+ *
+ * @retval Number of bytes that can be read.
+ */
+static inline uint32_t SPSC_QueueGetUsed(spsc_queue_handle_t queue)
+{
+    uint32_t head = queue->head;
+    uint32_t tail = queue->tail;
+
+    return (head >= tail) ? (head - tail) : (head + (2U * queue->size) - tail);
+}
+
+/*!
+ * @brief Gets the number of free bytes in the queue.
+ *
+ * The value is exact for the producer, the consumer may only see it shrink afterwards.
+ *
+ * @param queue - Handle of the queue.
+ *
+ * @retval Number of bytes that can be written.
+ */
+static inline uint32_t SPSC_QueueGetFree(spsc_queue_handle_t queue)
+{
+    return queue->size - SPSC_QueueGetUsed(queue);
+}
+
+/*!
+ * @brief Writes data to the queue, producer side.
+ *
+ * Copies as many bytes as fit, with at most two memcpy() calls, then publishes them with a single index update.
+ * Check SPSC_QueueGetFree() first to write a message as a whole.
+ *
+ * @param queue - Handle of the queue.
+ * @param data - Data to write.
+ * @param length - Number of bytes to write.
+ *
+ * @retval Number of bytes written.
+ */
+uint32_t SPSC_QueuePut(spsc_queue_handle_t queue, const void *data, uint32_t length);
+
+/*!
+ * @brief Reads data from the queue, consumer side.
+ *
+ * Copies as many bytes as available, with at most two memcpy() calls, then releases them with a single index update.
+ * Check SPSC_QueueGetUsed() first to read a message as a whole.
+ *
+ * @param queue - Handle of the queue.
+ * @param data - Buffer to copy the data to.
+ * @param length - Maximum number of bytes to read.
+ *
+ * @retval Number of bytes read.
+ */
+uint32_t SPSC_QueueGet(spsc_queue_handle_t queue, void *data, uint32_t length);
+
+/*!
+ * @brief Drops data from the queue without copying it, consumer side.
+ *
+ * @param queue - Handle of the queue.
+ * @param length - Maximum number of bytes to drop.
+ *
+ * @retval Number of bytes dropped.
+ */
+uint32_t SPSC_QueueSkip(spsc_queue_handle_t queue, uint32_t length);
+
+#if defined(__cplusplus)
+}
+#endif
+/*! @}*/
+#endif /* _FSL_COMPONENT_SPSC_QUEUE_H_ */
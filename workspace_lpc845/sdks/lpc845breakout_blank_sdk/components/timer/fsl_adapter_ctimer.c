@@ -11,6 +11,8 @@
 #include "fsl_ctimer.h"
 
 #define gStackTimerChannel_c (kCTIMER_Match_0)
+/* Counts kept between the counter and the match values when the match is moved */
+#define gStackTimerMoveGuardUs_c (10U)
 typedef struct _hal_timer_handle_struct_t
 {
     uint32_t timeout;
@@ -168,7 +170,64 @@ uint32_t HAL_TimerGetCurrentTimerCount(hal_timer_handle_t halTimerHandle)
 
 hal_timer_status_t HAL_TimerUpdateTimeout(hal_timer_handle_t halTimerHandle, uint32_t timeout)
 {
-    return HAL_CTimerConfigTimeout(halTimerHandle, timeout);
+    uint32_t matchValue;
+    assert(halTimerHandle);
+    hal_timer_handle_struct_t *halTimerState = halTimerHandle;
+    matchValue = (uint32_t)USEC_TO_COUNT(timeout, halTimerState->timerClock_Hz);
+    if ((matchValue < 1U) || (matchValue > 0xFFFFFFF0U))
+    {
+        return kStatus_HAL_TimerOutOfRanger;
+    }
+    halTimerState->timeout = timeout;
+    /* The match channel was set up by HAL_TimerInit, only the match value and the counter need to be updated
+     * instead of resetting the whole peripheral. */
+    CTIMER_StopTimer(s_CtimerBase[halTimerState->instance]);
+    CTIMER_Reset(s_CtimerBase[halTimerState->instance]);
+    /* A match of the count that was just reset must not be reported any more. */
+    CTIMER_ClearStatusFlags(s_CtimerBase[halTimerState->instance], (uint32_t)kCTIMER_Match0Flag);
+    s_CtimerBase[halTimerState->instance]->MR[gStackTimerChannel_c] = matchValue;
+    return kStatus_HAL_TimerSuccess;
+}
+
+hal_timer_status_t HAL_TimerMoveTimeout(hal_timer_handle_t halTimerHandle, uint32_t timeout)
+{
+    uint32_t matchValue;
+    uint32_t counterValue;
+    uint32_t regPrimask;
+    hal_timer_status_t status = kStatus_HAL_TimerSuccess;
+    assert(halTimerHandle);
+    hal_timer_handle_struct_t *halTimerState = halTimerHandle;
+    CTIMER_Type *base                        = s_CtimerBase[halTimerState->instance];
+
+    matchValue = (uint32_t)USEC_TO_COUNT(timeout, halTimerState->timerClock_Hz);
+    if ((matchValue < 1U) || (matchValue > 0xFFFFFFF0U))
+    {
+        return kStatus_HAL_TimerOutOfRanger;
+    }
+    regPrimask = DisableGlobalIRQ();
+    counterValue =
+        base->TC + (uint32_t)USEC_TO_COUNT(gStackTimerMoveGuardUs_c, halTimerState->timerClock_Hz) + 1U;
+    /* The counter must neither have matched nor be about to match the current value, else the counter would be
+     * reset behind the caller's back, and it must not pass the new value before it is written. */
+    if ((0U != (base->IR & CTIMER_IR_MR0INT_MASK)) || (counterValue >= base->MR[gStackTimerChannel_c]) ||
+        (counterValue >= matchValue))
+    {
+        status = kStatus_HAL_TimerOutOfRanger;
+    }
+    else
+    {
+        base->MR[gStackTimerChannel_c] = matchValue;
+        halTimerState->timeout         = timeout;
+    }
+    EnableGlobalIRQ(regPrimask);
+    return status;
+}
+
+bool HAL_TimerIsTimeoutPending(hal_timer_handle_t halTimerHandle)
+{
+    assert(halTimerHandle);
+    hal_timer_handle_struct_t *halTimerState = halTimerHandle;
+    return (0U != (CTIMER_GetStatusFlags(s_CtimerBase[halTimerState->instance]) & (uint32_t)kCTIMER_Match0Flag));
 }
 
 void HAL_TimerExitLowpower(hal_timer_handle_t halTimerHandle)
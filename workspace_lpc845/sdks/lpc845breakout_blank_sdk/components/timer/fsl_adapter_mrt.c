@@ -10,6 +10,8 @@
 #include "fsl_adapter_timer.h"
 #include "fsl_mrt.h"
 
+/* Counts kept between the channel and its reload when the interval is moved */
+#define gStackTimerMoveGuardUs_c (10U)
 typedef struct _hal_timer_handle_struct_t
 {
     uint32_t timeout;
@@ -26,6 +28,11 @@ typedef struct _hal_timer_handle_struct_t
 static MRT_Type *const s_MrtBase[] = MRT_BASE_PTRS;
 
 static hal_timer_handle_t s_timerHandle[sizeof(s_MrtBase) / sizeof(MRT_Type *)];
+
+/* The channel counts down, these give the count elapsed since the last restart like an up-counter: the interval
+ * the channel reloads with, and the elapsed count kept while the channel is stopped. */
+static uint32_t s_timerPeriodCount[sizeof(s_MrtBase) / sizeof(MRT_Type *)];
+static uint32_t s_timerStopCount[sizeof(s_MrtBase) / sizeof(MRT_Type *)];
 /************************************************************************************
 *************************************************************************************
 * Private prototypes
@@ -37,6 +44,16 @@ static hal_timer_handle_t s_timerHandle[sizeof(s_MrtBase) / sizeof(MRT_Type *)];
 * Private memory declarations
 *************************************************************************************
 ************************************************************************************/
+/* Count elapsed since the channel was last restarted, the channel reloads with IVALUE - 1 */
+static uint32_t HAL_MrtGetElapsedCount(uint8_t instance)
+{
+    if (0U == (MRT_GetStatusFlags(s_MrtBase[instance], kMRT_Channel_0) & (uint32_t)kMRT_TimerRunFlag))
+    {
+        return s_timerStopCount[instance];
+    }
+    return s_timerPeriodCount[instance] - 1U - MRT_GetCurrentTimerCount(s_MrtBase[instance], kMRT_Channel_0);
+}
+
 static void HAL_TimerInterruptHandle(uint8_t instance)
 {
     hal_timer_handle_struct_t *halTimerState = (hal_timer_handle_struct_t *)s_timerHandle[instance];
@@ -87,8 +104,9 @@ hal_timer_status_t HAL_TimerInit(hal_timer_handle_t halTimerHandle, hal_timer_co
     /* Enable timer interrupts for channel 0 */
     MRT_EnableInterrupts(s_MrtBase[halTimerState->instance], kMRT_Channel_0, (uint32_t)kMRT_TimerInterruptEnable);
 
-    halTimerState->timerClock_Hz           = halTimerConfig->srcClock_Hz;
-    s_timerHandle[halTimerState->instance] = halTimerHandle;
+    halTimerState->timerClock_Hz              = halTimerConfig->srcClock_Hz;
+    s_timerHandle[halTimerState->instance]    = halTimerHandle;
+    s_timerStopCount[halTimerState->instance] = 0U;
     /* Enable at the irq */
     NVIC_SetPriority((IRQn_Type)instanceIrq[halTimerState->instance], HAL_TIMER_ISR_PRIORITY);
     (void)EnableIRQ(instanceIrq[halTimerState->instance]);
@@ -107,8 +125,9 @@ void HAL_TimerEnable(hal_timer_handle_t halTimerHandle)
 {
     assert(halTimerHandle);
     hal_timer_handle_struct_t *halTimerState = halTimerHandle;
-    MRT_StartTimer(s_MrtBase[halTimerState->instance], kMRT_Channel_0,
-                   (uint32_t)USEC_TO_COUNT(halTimerState->timeout, halTimerState->timerClock_Hz));
+    s_timerPeriodCount[halTimerState->instance] =
+        (uint32_t)USEC_TO_COUNT(halTimerState->timeout, halTimerState->timerClock_Hz);
+    MRT_StartTimer(s_MrtBase[halTimerState->instance], kMRT_Channel_0, s_timerPeriodCount[halTimerState->instance]);
 }
 
 /*************************************************************************************/
@@ -116,6 +135,8 @@ void HAL_TimerDisable(hal_timer_handle_t halTimerHandle)
 {
     assert(halTimerHandle);
     hal_timer_handle_struct_t *halTimerState = halTimerHandle;
+    /* The stop clears the count, keep the elapsed one for HAL_TimerGetCurrentTimerCount */
+    s_timerStopCount[halTimerState->instance] = HAL_MrtGetElapsedCount(halTimerState->instance);
     /* Stop channel 0 */
     MRT_StopTimer(s_MrtBase[halTimerState->instance], kMRT_Channel_0);
     /* Clear interrupt flag.*/
@@ -140,7 +161,9 @@ uint32_t HAL_TimerGetMaxTimeout(hal_timer_handle_t halTimerHandle)
     hal_timer_handle_struct_t *halTimerState = halTimerHandle;
     reserveCount                             = (uint32_t)MSEC_TO_COUNT((reserveMs), (halTimerState->timerClock_Hz));
 
-    retValue = COUNT_TO_USEC(((uint64_t)0xFFFFFFFF - (uint64_t)reserveCount), (uint64_t)halTimerState->timerClock_Hz);
+    /* The interval of the channel is 24 bits wide */
+    retValue = COUNT_TO_USEC(((uint64_t)(MRT_CHANNEL_INTVAL_IVALUE_MASK - 0x10U) - (uint64_t)reserveCount),
+                             (uint64_t)halTimerState->timerClock_Hz);
     return (uint32_t)((retValue > 0xFFFFFFFFU) ? (0xFFFFFFFFU - reserveMs * 1000U) : (uint32_t)retValue);
 }
 /* return micro us */
@@ -148,9 +171,8 @@ uint32_t HAL_TimerGetCurrentTimerCount(hal_timer_handle_t halTimerHandle)
 {
     assert(halTimerHandle);
     hal_timer_handle_struct_t *halTimerState = halTimerHandle;
-    return (uint32_t)COUNT_TO_USEC(
-        (uint64_t)MRT_GetCurrentTimerCount(s_MrtBase[halTimerState->instance], kMRT_Channel_0),
-        halTimerState->timerClock_Hz);
+    return (uint32_t)COUNT_TO_USEC((uint64_t)HAL_MrtGetElapsedCount(halTimerState->instance),
+                                   halTimerState->timerClock_Hz);
 }
 
 hal_timer_status_t HAL_TimerUpdateTimeout(hal_timer_handle_t halTimerHandle, uint32_t timeout)
@@ -165,9 +187,70 @@ hal_timer_status_t HAL_TimerUpdateTimeout(hal_timer_handle_t halTimerHandle, uin
         return kStatus_HAL_TimerOutOfRanger;
     }
     MRT_StopTimer(s_MrtBase[halTimerState->instance], kMRT_Channel_0);
+    s_timerStopCount[halTimerState->instance] = 0U;
     return kStatus_HAL_TimerSuccess;
 }
 
+hal_timer_status_t HAL_TimerMoveTimeout(hal_timer_handle_t halTimerHandle, uint32_t timeout)
+{
+    uint32_t tickCount;
+    uint32_t guardCount;
+    uint32_t periodCount;
+    uint32_t counterValue;
+    uint32_t regPrimask;
+    hal_timer_status_t status = kStatus_HAL_TimerSuccess;
+    assert(halTimerHandle);
+    hal_timer_handle_struct_t *halTimerState = halTimerHandle;
+    MRT_Type *base                           = s_MrtBase[halTimerState->instance];
+
+    tickCount = (uint32_t)USEC_TO_COUNT(timeout, halTimerState->timerClock_Hz);
+    if ((tickCount < 1U) || (tickCount > (MRT_CHANNEL_INTVAL_IVALUE_MASK - 0x10U)))
+    {
+        return kStatus_HAL_TimerOutOfRanger;
+    }
+    guardCount = (uint32_t)USEC_TO_COUNT(gStackTimerMoveGuardUs_c, halTimerState->timerClock_Hz) + 1U;
+    regPrimask = DisableGlobalIRQ();
+    if (0U == (MRT_GetStatusFlags(base, kMRT_Channel_0) & (uint32_t)kMRT_TimerRunFlag))
+    {
+        /* A stopped channel is started by a load, it has to be restarted instead. */
+        status = kStatus_HAL_TimerNotSupport;
+    }
+    else
+    {
+        periodCount  = s_timerPeriodCount[halTimerState->instance];
+        counterValue = MRT_GetCurrentTimerCount(base, kMRT_Channel_0);
+        /* The channel must neither have reloaded nor be about to reload, else the elapsed count would be taken from
+         * the wrong interval, and the elapsed count must not reach the new interval before it is loaded. */
+        if ((0U != (MRT_GetStatusFlags(base, kMRT_Channel_0) & (uint32_t)kMRT_TimerInterruptFlag)) ||
+            (counterValue <= guardCount) || ((periodCount - 1U - counterValue + guardCount) >= tickCount))
+        {
+            status = kStatus_HAL_TimerOutOfRanger;
+        }
+        else
+        {
+            /* The channel loads IVALUE - 1 and counts down, the remainder of the new interval is force loaded with
+             * the count read back right before it, then the new interval is set for the following reloads. Only the
+             * few cycles between the read and the load are lost. */
+            MRT_StartTimer(base, kMRT_Channel_0,
+                           (tickCount - (periodCount - 1U - MRT_GetCurrentTimerCount(base, kMRT_Channel_0))) |
+                               MRT_CHANNEL_INTVAL_LOAD_MASK);
+            MRT_UpdateTimerPeriod(base, kMRT_Channel_0, tickCount, false);
+            s_timerPeriodCount[halTimerState->instance] = tickCount;
+            halTimerState->timeout                      = timeout;
+        }
+    }
+    EnableGlobalIRQ(regPrimask);
+    return status;
+}
+
+bool HAL_TimerIsTimeoutPending(hal_timer_handle_t halTimerHandle)
+{
+    assert(halTimerHandle);
+    hal_timer_handle_struct_t *halTimerState = halTimerHandle;
+    return (0U != (MRT_GetStatusFlags(s_MrtBase[halTimerState->instance], kMRT_Channel_0) &
+                   (uint32_t)kMRT_TimerInterruptFlag));
+}
+
 void HAL_TimerExitLowpower(hal_timer_handle_t halTimerHandle)
 {
     assert(halTimerHandle);
@@ -218,6 +218,33 @@ uint32_t HAL_TimerGetCurrentTimerCount(hal_timer_handle_t halTimerHandle);
  */
 hal_timer_status_t HAL_TimerUpdateTimeout(hal_timer_handle_t halTimerHandle, uint32_t timeout);
 
+/*!
+ * @brief Move the next timeout interrupt of the running timer adapter without restarting the count.
+ *
+ * @note The count goes on from its current value and the timeout interrupt is generated when it reaches the new
+ *       timeout, so no time is lost as when the timer is restarted by HAL_TimerUpdateTimeout. The timeout must be
+ *       ahead of the current count.
+ *
+ * @param halTimerHandle     HAL timer adapter handle
+ * @param timeout            Timeout time counted from the last timeout or restart, should be used microseconds.
+ * @retval kStatus_HAL_TimerSuccess The timer adapter module move timeout succeed.
+ * @retval kStatus_HAL_TimerOutOfRanger The timeout is out of ranger or too close to the current count.
+ * @retval kStatus_HAL_TimerNotSupport The timer adapter cannot move the timeout of a running count.
+ */
+hal_timer_status_t HAL_TimerMoveTimeout(hal_timer_handle_t halTimerHandle, uint32_t timeout);
+
+/*!
+ * @brief Check whether the timeout interrupt of the timer adapter is pending.
+ *
+ * @note This API lets the caller tell a count that restarted at the timeout from a count that did not, while the
+ *       timeout interrupt is masked.
+ *
+ * @param halTimerHandle     HAL timer adapter handle
+ * @retval true The count has reached the timeout and the timeout interrupt has not been handled yet.
+ * @retval false No timeout interrupt is pending.
+ */
+bool HAL_TimerIsTimeoutPending(hal_timer_handle_t halTimerHandle);
+
 /*!
  * @brief Get maximum Timer timeout
  *
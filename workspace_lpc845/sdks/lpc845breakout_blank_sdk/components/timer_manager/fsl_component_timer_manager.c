@@ -76,6 +76,12 @@
 #define TM_MIN_TIMER_INTERVAL 300U
 #endif
 
+#if (defined(TM_ENABLE_TIMER_HEAP) && (TM_ENABLE_TIMER_HEAP > 0U))
+#if ((TM_TIMER_HEAP_SIZE < 1U) || (TM_TIMER_HEAP_SIZE > 255U))
+#error "TM_TIMER_HEAP_SIZE should be in range 1 - 255."
+#endif
+#endif
+
 /**@brief Timer status. */
 typedef enum _timer_state
 {
@@ -98,8 +104,15 @@ typedef struct _timer_handle_struct_t
     struct _timer_handle_struct_t *next; /*!< LIST_ element of the link */
     volatile uint8_t tmrStatus;          /*!< Timer status */
     volatile uint8_t tmrType;            /*!< Timer mode*/
+#if (defined(TM_ENABLE_TIMER_HEAP) && (TM_ENABLE_TIMER_HEAP > 0U))
+    uint8_t heapIndex;                   /*!< Position in the timer heap plus one, 0 if the timer is not queued */
+#endif
     uint64_t timeoutInUs;                /*!< Time out of the timer, should be microseconds */
+#if (defined(TM_ENABLE_TIMER_HEAP) && (TM_ENABLE_TIMER_HEAP > 0U))
+    uint64_t expireUs;                   /*!< Absolute expiry time of the timer, should be microseconds */
+#else
     uint64_t remainingUs;                /*!< Remaining of the timer, should be microseconds */
+#endif
     timer_callback_t pfCallBack;         /*!< Callback function of the timer */
     void *param;                         /*!< Parameter of callback function of the timer */
 } timer_handle_struct_t;
@@ -110,6 +123,10 @@ typedef struct _timermanager_state
     uint32_t mUsActiveInTimerInterval;            /*!< Timer active intervl in microseconds */
     uint32_t previousTimeInUs;                    /*!< Previous timer count in microseconds */
     timer_handle_struct_t *timerHead;             /*!< Timer list head */
+#if (defined(TM_ENABLE_TIMER_HEAP) && (TM_ENABLE_TIMER_HEAP > 0U))
+    uint64_t timeBaseUs;                          /*!< Time elapsed since init in microseconds */
+    timer_handle_struct_t *timerHeap[TM_TIMER_HEAP_SIZE]; /*!< Active timers ordered by expiry time */
+#endif
     TIMER_HANDLE_DEFINE(halTimerHandle);          /*!< Timer handle buffer */
 #if (defined(TM_ENABLE_TIME_STAMP) && (TM_ENABLE_TIME_STAMP > 0U))
     TIME_STAMP_HANDLE_DEFINE(halTimeStampHandle); /*!< Time stamp handle buffer */
@@ -125,6 +142,9 @@ typedef struct _timermanager_state
     volatile uint8_t numberOfActiveTimers;         /*!< Number of active Timers*/
     volatile uint8_t numberOfLowPowerActiveTimers; /*!< Number of low power active Timers */
     volatile uint8_t timerHardwareIsRunning;       /*!< Hardware timer is runnig */
+#if (defined(TM_ENABLE_TIMER_HEAP) && (TM_ENABLE_TIMER_HEAP > 0U))
+    uint8_t timerHeapCount;                        /*!< Number of timers in the timer heap */
+#endif
     uint8_t initialized;                           /*!< Timer is initialized */
 } timermanager_state_t;
 
@@ -156,7 +176,7 @@ static void TimerManagerTask(void *param);
 void TimerManagerTask(void *param);
 #endif /* TIMER_MANAGER_TASK_PUBLIC */
 
-TIMER_MANAGER_STATIC void TimerEnable(timer_handle_t timerHandle);
+TIMER_MANAGER_STATIC timer_status_t TimerEnable(timer_handle_t timerHandle);
 
 static timer_status_t TimerStop(timer_handle_t timerHandle);
 
@@ -257,6 +277,122 @@ static void TimerMarkTimerFree(timer_handle_t timerHandle)
     timer->tmrStatus             = 0;
 }
 
+#if (defined(TM_ENABLE_TIMER_HEAP) && (TM_ENABLE_TIMER_HEAP > 0U))
+/*! -------------------------------------------------------------------------
+ * \brief     Store a timer at the given position of the timer heap
+ * \param[in] position - the position in the timer heap
+ * \param[in] th - the timer
+ *---------------------------------------------------------------------------*/
+static void TimerHeapSet(uint32_t position, timer_handle_struct_t *th)
+{
+    s_timermanager.timerHeap[position] = th;
+    th->heapIndex                      = (uint8_t)(position + 1U);
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief     Move the timer at the given position towards the heap root until its parent expires earlier
+ * \param[in] position - the position in the timer heap
+ *---------------------------------------------------------------------------*/
+static void TimerHeapSiftUp(uint32_t position)
+{
+    timer_handle_struct_t *th = s_timermanager.timerHeap[position];
+    uint32_t parent;
+
+    while (position > 0U)
+    {
+        parent = (position - 1U) >> 1U;
+        if (s_timermanager.timerHeap[parent]->expireUs <= th->expireUs)
+        {
+            break;
+        }
+        TimerHeapSet(position, s_timermanager.timerHeap[parent]);
+        position = parent;
+    }
+    TimerHeapSet(position, th);
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief     Move the timer at the given position towards the heap leaves until its children expire later
+ * \param[in] position - the position in the timer heap
+ *---------------------------------------------------------------------------*/
+static void TimerHeapSiftDown(uint32_t position)
+{
+    timer_handle_struct_t *th = s_timermanager.timerHeap[position];
+    uint32_t count            = s_timermanager.timerHeapCount;
+    uint32_t child;
+
+    while (true)
+    {
+        child = (position << 1U) + 1U;
+        if (child >= count)
+        {
+            break;
+        }
+        if (((child + 1U) < count) &&
+            (s_timermanager.timerHeap[child + 1U]->expireUs < s_timermanager.timerHeap[child]->expireUs))
+        {
+            child++;
+        }
+        if (th->expireUs <= s_timermanager.timerHeap[child]->expireUs)
+        {
+            break;
+        }
+        TimerHeapSet(position, s_timermanager.timerHeap[child]);
+        position = child;
+    }
+    TimerHeapSet(position, th);
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief     Queue a timer in the timer heap according to its expiry time
+ * \param[in] th - the timer
+ * \return    see definition of timer_status_t
+ *---------------------------------------------------------------------------*/
+static timer_status_t TimerHeapInsert(timer_handle_struct_t *th)
+{
+    if (s_timermanager.timerHeapCount >= TM_TIMER_HEAP_SIZE)
+    {
+        return kStatus_TimerOutOfRange;
+    }
+    s_timermanager.timerHeap[s_timermanager.timerHeapCount] = th;
+    s_timermanager.timerHeapCount++;
+    TimerHeapSiftUp((uint32_t)s_timermanager.timerHeapCount - 1U);
+    return kStatus_TimerSuccess;
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief     Remove a timer from the timer heap, nothing is done if the timer is not queued
+ * \param[in] th - the timer
+ *---------------------------------------------------------------------------*/
+static void TimerHeapRemove(timer_handle_struct_t *th)
+{
+    uint32_t position;
+    timer_handle_struct_t *last;
+
+    if (0U == th->heapIndex)
+    {
+        return;
+    }
+    position      = (uint32_t)th->heapIndex - 1U;
+    th->heapIndex = 0U;
+    s_timermanager.timerHeapCount--;
+    last                                                    = s_timermanager.timerHeap[s_timermanager.timerHeapCount];
+    s_timermanager.timerHeap[s_timermanager.timerHeapCount] = NULL;
+    if (last != th)
+    {
+        TimerHeapSet(position, last);
+        if ((position > 0U) && (s_timermanager.timerHeap[(position - 1U) >> 1U]->expireUs > last->expireUs))
+        {
+            TimerHeapSiftUp(position);
+        }
+        else
+        {
+            TimerHeapSiftDown(position);
+        }
+    }
+}
+#endif /* TM_ENABLE_TIMER_HEAP */
+
 /*! -------------------------------------------------------------------------
  * \brief  Notify Timer task to run.
  * \return
@@ -281,6 +417,14 @@ static void NotifyTimersTask(void)
  *---------------------------------------------------------------------------*/
 TIMER_MANAGER_STATIC void TimersUpdate(bool updateRemainingUs, bool updateOnlyPowerTimer, uint32_t remainingUs)
 {
+#if (defined(TM_ENABLE_TIMER_HEAP) && (TM_ENABLE_TIMER_HEAP > 0U))
+    /* The timers hold absolute expiry times, only the time base has to move forward. */
+    (void)updateOnlyPowerTimer;
+    if (updateRemainingUs)
+    {
+        s_timermanager.timeBaseUs += remainingUs;
+    }
+#else
     timer_handle_struct_t *th = s_timermanager.timerHead;
 
     if ((s_timermanager.numberOfLowPowerActiveTimers != 0U) || (s_timermanager.numberOfActiveTimers != 0U))
@@ -309,7 +453,113 @@ TIMER_MANAGER_STATIC void TimersUpdate(bool updateRemainingUs, bool updateOnlyPo
             th = th->next;
         }
     }
+#endif /* TM_ENABLE_TIMER_HEAP */
+}
+
+#if (defined(TM_ENABLE_ABSOLUTE_DEADLINE) && (TM_ENABLE_ABSOLUTE_DEADLINE > 0U))
+/*! -------------------------------------------------------------------------
+ * \brief     Bring the time base up to date with the counter, called with the interrupts disabled
+ * \details   Once the counter has restarted at the match, only the timer interrupt may update the time base, else
+ *            the period would be counted twice. The pending flag is read before the counter so that a counter value
+ *            read after the restart is never taken for a value read before it.
+ * \param[out] pendingUs - the time elapsed since the time base that the pending timer interrupt has not accounted for
+ * \return    true when the time base is up to date, false when the counter has restarted
+ *---------------------------------------------------------------------------*/
+static bool TimersSyncTimeBase(uint32_t *pendingUs)
+{
+    hal_timer_handle_t halTimerHandle = (hal_timer_handle_t)s_timermanager.halTimerHandle;
+    bool restarted                    = HAL_TimerIsTimeoutPending(halTimerHandle);
+    uint32_t currentTimeInUs          = HAL_TimerGetCurrentTimerCount(halTimerHandle);
+
+    if (restarted || (currentTimeInUs < s_timermanager.previousTimeInUs))
+    {
+        *pendingUs = (s_timermanager.mUsActiveInTimerInterval - s_timermanager.previousTimeInUs) + currentTimeInUs;
+        return false;
+    }
+    TimersUpdate(true, false, (currentTimeInUs - s_timermanager.previousTimeInUs));
+    s_timermanager.previousTimeInUs = currentTimeInUs;
+    *pendingUs                      = 0U;
+    return true;
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief     Program the hardware timer for the earliest deadline, called with the interrupts disabled
+ * \details   The counter restarts from zero at each match, so it next matches at the time of its last restart plus
+ *            the active interval. Nothing is done when this already is the earliest deadline, which is the case of
+ *            a lone interval timer. Otherwise the match is moved while the counter keeps running, so the time base
+ *            never loses the time spent reprogramming. The counter is only restarted when it is stopped or when
+ *            the adapter cannot move the match.
+ * \param[in] expireUs - the earliest deadline
+ *---------------------------------------------------------------------------*/
+static void TimerProgramDeadline(uint64_t expireUs)
+{
+    hal_timer_handle_t halTimerHandle = (hal_timer_handle_t)s_timermanager.halTimerHandle;
+    uint32_t maxTimeoutUs             = HAL_TimerGetMaxTimeout(halTimerHandle);
+    uint32_t currentTimeInUs;
+    uint32_t pendingUs;
+    uint64_t counterStartUs;
+    uint64_t timeoutUs;
+    hal_timer_status_t status;
+
+    if (!TimersSyncTimeBase(&pendingUs))
+    {
+        /* The counter has restarted, the pending timer interrupt will program the next deadline. */
+        return;
+    }
+
+    if (0U != s_timermanager.timerHardwareIsRunning)
+    {
+        counterStartUs = s_timermanager.timeBaseUs - s_timermanager.previousTimeInUs;
+        if (expireUs > (counterStartUs + maxTimeoutUs))
+        {
+            expireUs = counterStartUs + maxTimeoutUs;
+        }
+        if (expireUs == (counterStartUs + s_timermanager.mUsActiveInTimerInterval))
+        {
+            return;
+        }
+        if (expireUs < (s_timermanager.timeBaseUs + TM_MIN_TIMER_INTERVAL))
+        {
+            expireUs = s_timermanager.timeBaseUs + TM_MIN_TIMER_INTERVAL;
+        }
+        status = HAL_TimerMoveTimeout(halTimerHandle, (uint32_t)(expireUs - counterStartUs));
+        if (kStatus_HAL_TimerSuccess == status)
+        {
+            s_timermanager.mUsActiveInTimerInterval = (uint32_t)(expireUs - counterStartUs);
+            return;
+        }
+        if (kStatus_HAL_TimerNotSupport != status)
+        {
+            /* The counter is about to match, the timer interrupt will program the next deadline. */
+            return;
+        }
+    }
+
+    HAL_TimerDisable(halTimerHandle);
+    currentTimeInUs = HAL_TimerGetCurrentTimerCount(halTimerHandle);
+    if (currentTimeInUs > s_timermanager.previousTimeInUs)
+    {
+        TimersUpdate(true, false, (currentTimeInUs - s_timermanager.previousTimeInUs));
+    }
+    timeoutUs = (expireUs > s_timermanager.timeBaseUs) ? (expireUs - s_timermanager.timeBaseUs) : 0U;
+    if (timeoutUs > maxTimeoutUs)
+    {
+        timeoutUs = maxTimeoutUs;
+    }
+    else if (timeoutUs < TM_MIN_TIMER_INTERVAL)
+    {
+        timeoutUs = TM_MIN_TIMER_INTERVAL;
+    }
+    else
+    {
+        /* The deadline can be reached by the hardware timer. */
+    }
+    (void)HAL_TimerUpdateTimeout(halTimerHandle, (uint32_t)timeoutUs);
+    s_timermanager.mUsActiveInTimerInterval = (uint32_t)timeoutUs;
+    HAL_TimerEnable(halTimerHandle);
+    s_timermanager.previousTimeInUs = 0U;
 }
+#endif /* TM_ENABLE_ABSOLUTE_DEADLINE */
 
 /*! -------------------------------------------------------------------------
  * \brief  Internal process of Timer Task
@@ -321,12 +571,91 @@ TIMER_MANAGER_STATIC void TimersUpdate(bool updateRemainingUs, bool updateOnlyPo
 static void TimerManagerTaskProcess(bool isInTaskContext)
 {
     uint8_t timerType;
-    timer_state_t state;
+#if !(defined(TM_ENABLE_ABSOLUTE_DEADLINE) && (TM_ENABLE_ABSOLUTE_DEADLINE > 0U))
     uint32_t previousBeforeEnableTimeInUs;
+#endif
     uint8_t activeLPTimerNum, activeTimerNum;
     uint32_t regPrimask               = DisableGlobalIRQ();
     s_timermanager.mUsInTimerInterval = HAL_TimerGetMaxTimeout((hal_timer_handle_t)s_timermanager.halTimerHandle);
-    timer_handle_struct_t *th         = s_timermanager.timerHead;
+#if (defined(TM_ENABLE_TIMER_HEAP) && (TM_ENABLE_TIMER_HEAP > 0U))
+    timer_handle_struct_t *th;
+#if (defined(TM_ENABLE_ABSOLUTE_DEADLINE) && (TM_ENABLE_ABSOLUTE_DEADLINE > 0U))
+    uint64_t nextExpireUs = s_timermanager.timeBaseUs + s_timermanager.mUsInTimerInterval;
+#endif
+
+    /* Active timers expiration will be processed only in the TimerManager task context
+     * this is to ensure the timers callbacks are called only in the task context */
+    while ((isInTaskContext == true) && (0U != s_timermanager.timerHeapCount) &&
+           (s_timermanager.timerHeap[0]->expireUs <= s_timermanager.timeBaseUs))
+    {
+        th        = s_timermanager.timerHeap[0];
+        timerType = TimerGetTimerType(th);
+        /* If this is an interval timer, restart it. Otherwise, mark it as inactive. */
+        if (0U != (timerType & (uint32_t)(kTimerModeSingleShot)))
+        {
+            (void)TimerStop(th);
+        }
+        else
+        {
+#if (defined(TM_ENABLE_ABSOLUTE_DEADLINE) && (TM_ENABLE_ABSOLUTE_DEADLINE > 0U))
+            /* Reload from the previous deadline rather than from now so the period does not drift, and keep
+             * the phase if several periods have been missed. */
+            th->expireUs += th->timeoutInUs;
+            if ((th->expireUs <= s_timermanager.timeBaseUs) && (0U != th->timeoutInUs))
+            {
+                th->expireUs = s_timermanager.timeBaseUs + th->timeoutInUs -
+                               ((s_timermanager.timeBaseUs - th->expireUs) % th->timeoutInUs);
+            }
+            else if (0U == th->timeoutInUs)
+            {
+                th->expireUs = s_timermanager.timeBaseUs + 1U;
+            }
+            else
+            {
+                /* The next deadline is in the future. */
+            }
+#else
+            /* A zero period is moved one microsecond ahead so the loop cannot spin on the same timer. */
+            th->expireUs = s_timermanager.timeBaseUs + ((0U != th->timeoutInUs) ? th->timeoutInUs : 1U);
+#endif
+            TimerHeapSiftDown(0U);
+        }
+
+        /* This timer has expired. */
+        /*Call callback if it is not NULL*/
+        EnableGlobalIRQ(regPrimask);
+        if (NULL != th->pfCallBack)
+        {
+            th->pfCallBack(th->param);
+        }
+        regPrimask = DisableGlobalIRQ();
+    }
+
+    if (0U != s_timermanager.timerHeapCount)
+    {
+        th = s_timermanager.timerHeap[0];
+        if (th->expireUs <= s_timermanager.timeBaseUs)
+        {
+            s_timermanager.mUsInTimerInterval = 0U;
+        }
+        else if ((th->expireUs - s_timermanager.timeBaseUs) < s_timermanager.mUsInTimerInterval)
+        {
+            s_timermanager.mUsInTimerInterval = (uint32_t)(th->expireUs - s_timermanager.timeBaseUs);
+        }
+        else
+        {
+            /* The earliest timer expires after the maximum timeout of the hardware timer. */
+        }
+#if (defined(TM_ENABLE_ABSOLUTE_DEADLINE) && (TM_ENABLE_ABSOLUTE_DEADLINE > 0U))
+        if (th->expireUs < nextExpireUs)
+        {
+            nextExpireUs = th->expireUs;
+        }
+#endif
+    }
+#else
+    timer_state_t state;
+    timer_handle_struct_t *th = s_timermanager.timerHead;
     timer_handle_struct_t *th_next;
     while (NULL != th)
     {
@@ -381,6 +710,7 @@ static void TimerManagerTaskProcess(bool isInTaskContext)
         }
         th = th_next;
     }
+#endif /* TM_ENABLE_TIMER_HEAP */
     if (s_timermanager.mUsInTimerInterval < TM_MIN_TIMER_INTERVAL)
     {
         s_timermanager.mUsInTimerInterval = TM_MIN_TIMER_INTERVAL;
@@ -391,6 +721,11 @@ static void TimerManagerTaskProcess(bool isInTaskContext)
 
     if ((0U != activeLPTimerNum) || (0U != activeTimerNum))
     {
+#if (defined(TM_ENABLE_ABSOLUTE_DEADLINE) && (TM_ENABLE_ABSOLUTE_DEADLINE > 0U))
+        regPrimask = DisableGlobalIRQ();
+        TimerProgramDeadline(nextExpireUs);
+        EnableGlobalIRQ(regPrimask);
+#else
         if ((s_timermanager.mUsInTimerInterval != s_timermanager.mUsActiveInTimerInterval) ||
             (0U == s_timermanager.timerHardwareIsRunning))
         {
@@ -419,6 +754,7 @@ static void TimerManagerTaskProcess(bool isInTaskContext)
             }
             EnableGlobalIRQ(regPrimask);
         }
+#endif /* TM_ENABLE_ABSOLUTE_DEADLINE */
         s_timermanager.timerHardwareIsRunning = (uint8_t) true;
     }
 }
@@ -441,6 +777,14 @@ static void TimersCheckAndUpdate(uint32_t remainingUs)
  *---------------------------------------------------------------------------*/
 static void TimersUpdateWithoutSyncTask(uint32_t remainingUs)
 {
+#if (defined(TM_ENABLE_ABSOLUTE_DEADLINE) && (TM_ENABLE_ABSOLUTE_DEADLINE > 0U))
+    if ((remainingUs < s_timermanager.previousTimeInUs) ||
+        HAL_TimerIsTimeoutPending((hal_timer_handle_t)s_timermanager.halTimerHandle))
+    {
+        /* The counter has restarted, the pending timer interrupt accounts for the elapsed time. */
+        return;
+    }
+#endif
     TimersCheckAndUpdate(remainingUs);
     s_timermanager.previousTimeInUs = remainingUs;
 }
@@ -460,8 +804,7 @@ static void TimersUpdateSyncTask(uint32_t remainingUs)
  *---------------------------------------------------------------------------*/
 static void TimersUpdateDirectSync(uint32_t remainingUs)
 {
-    TimersCheckAndUpdate(remainingUs);
-    s_timermanager.previousTimeInUs = remainingUs;
+    TimersUpdateWithoutSyncTask(remainingUs);
     TimerManagerTaskProcess(false);
 }
 
@@ -471,6 +814,25 @@ static void TimersUpdateDirectSync(uint32_t remainingUs)
 static void HAL_TIMER_Callback(void *param)
 {
     uint32_t currentTimerCount = HAL_TimerGetCurrentTimerCount((hal_timer_handle_t)s_timermanager.halTimerHandle);
+#if (defined(TM_ENABLE_ABSOLUTE_DEADLINE) && (TM_ENABLE_ABSOLUTE_DEADLINE > 0U))
+    /* The time base must match the counter before the timers are processed, as they may program the hardware
+     * timer. */
+    if (currentTimerCount < s_timermanager.mUsActiveInTimerInterval)
+    {
+        TimersUpdate(true, false,
+                     (s_timermanager.mUsActiveInTimerInterval - s_timermanager.previousTimeInUs) + currentTimerCount);
+        s_timermanager.previousTimeInUs = currentTimerCount;
+    }
+    else
+    {
+        TimersCheckAndUpdate(currentTimerCount);
+        (void)HAL_TimerUpdateTimeout((hal_timer_handle_t)s_timermanager.halTimerHandle,
+                                     s_timermanager.mUsActiveInTimerInterval);
+        HAL_TimerEnable((hal_timer_handle_t)s_timermanager.halTimerHandle);
+        s_timermanager.previousTimeInUs = 0U;
+    }
+    NotifyTimersTask();
+#else
     if (currentTimerCount < s_timermanager.mUsActiveInTimerInterval)
     {
         TimersUpdateSyncTask(s_timermanager.mUsActiveInTimerInterval + currentTimerCount);
@@ -482,6 +844,7 @@ static void HAL_TIMER_Callback(void *param)
         TimersUpdateSyncTask(currentTimerCount);
     }
     s_timermanager.previousTimeInUs = currentTimerCount;
+#endif /* TM_ENABLE_ABSOLUTE_DEADLINE */
 }
 
 /*! -------------------------------------------------------------------------
@@ -536,6 +899,9 @@ static timer_status_t TimerStop(timer_handle_t timerHandle)
         if ((state == kTimerStateActive_c) || (state == kTimerStateReady_c))
         {
             TimerSetTimerStatus(timerHandle, (uint8_t)kTimerStateInactive_c);
+#if (defined(TM_ENABLE_TIMER_HEAP) && (TM_ENABLE_TIMER_HEAP > 0U))
+            TimerHeapRemove((timer_handle_struct_t *)timerHandle);
+#endif
             DecrementActiveTimerNumber(TimerGetTimerType(timerHandle));
             /* if no sw active timers are enabled, */
             /* call the TimerManagerTask() to countdown the ticks and stop the hw timer*/
@@ -555,22 +921,45 @@ static timer_status_t TimerStop(timer_handle_t timerHandle)
 /*! -------------------------------------------------------------------------
  * \brief     Enable the specified timer
  * \param[in] timerHandle - the handle of the timer
+ * \return    see definition of timer_status_t
  *---------------------------------------------------------------------------*/
-TIMER_MANAGER_STATIC void TimerEnable(timer_handle_t timerHandle)
+TIMER_MANAGER_STATIC timer_status_t TimerEnable(timer_handle_t timerHandle)
 {
+    timer_status_t status = kStatus_TimerSuccess;
     uint32_t currentTimerCount;
     assert(timerHandle);
     uint32_t regPrimask = DisableGlobalIRQ();
 
     if ((uint8_t)kTimerStateInactive_c == TimerGetTimerStatus(timerHandle))
     {
+#if (defined(TM_ENABLE_TIMER_HEAP) && (TM_ENABLE_TIMER_HEAP > 0U))
+        timer_handle_struct_t *th = timerHandle;
+
+        /* Bring the time base up to date first, the expiry time is absolute. */
+#if (defined(TM_ENABLE_ABSOLUTE_DEADLINE) && (TM_ENABLE_ABSOLUTE_DEADLINE > 0U))
+        (void)TimersSyncTimeBase(&currentTimerCount);
+        th->expireUs = s_timermanager.timeBaseUs + currentTimerCount + th->timeoutInUs;
+#else
+        currentTimerCount = HAL_TimerGetCurrentTimerCount((hal_timer_handle_t)s_timermanager.halTimerHandle);
+        TimersUpdateWithoutSyncTask(currentTimerCount);
+        th->expireUs = s_timermanager.timeBaseUs + th->timeoutInUs;
+#endif
+        status       = TimerHeapInsert(th);
+        if (kStatus_TimerSuccess == status)
+        {
+            IncrementActiveTimerNumber(TimerGetTimerType(timerHandle));
+            TimerSetTimerStatus(timerHandle, (uint8_t)kTimerStateActive_c);
+        }
+#else
         IncrementActiveTimerNumber(TimerGetTimerType(timerHandle));
         TimerSetTimerStatus(timerHandle, (uint8_t)kTimerStateReady_c);
         currentTimerCount = HAL_TimerGetCurrentTimerCount((hal_timer_handle_t)s_timermanager.halTimerHandle);
         TimersUpdateWithoutSyncTask(currentTimerCount);
+#endif
     }
     EnableGlobalIRQ(regPrimask);
     NotifyTimersTask();
+    return status;
 }
 
 /*****************************************************************************
@@ -714,16 +1103,34 @@ void TM_EnterTickless(timer_handle_t timerHandle, uint64_t timerTimeout)
 
     if (timerTimeout > 0U)
     {
+#if (defined(TM_ENABLE_TIMER_HEAP) && (TM_ENABLE_TIMER_HEAP > 0U))
+        /* The timer must not be queued twice in the timer heap. It is stopped before its type is changed so the
+         * active timer counters are decremented for the type it was started with. */
+        (void)TimerStop(timerHandle);
+#endif
         /* Set current timer as a single shot timer */
         TimerSetTimerType(timerHandle, timerType);
 
         /* Register timeout */
         th->timeoutInUs = timerTimeout;
+#if (defined(TM_ENABLE_TIMER_HEAP) && (TM_ENABLE_TIMER_HEAP > 0U))
+        remainingUs = HAL_TimerGetCurrentTimerCount((hal_timer_handle_t)s_timermanager.halTimerHandle);
+        TimersUpdateWithoutSyncTask(remainingUs);
+        th->expireUs = s_timermanager.timeBaseUs + timerTimeout;
+
+        /* Enable timer */
+        if (kStatus_TimerSuccess == TimerHeapInsert(th))
+        {
+            ++s_timermanager.numberOfActiveTimers;
+            TimerSetTimerStatus(timerHandle, (uint8_t)kTimerStateActive_c);
+        }
+#else
         th->remainingUs = timerTimeout;
 
         /* Enable timer */
         ++s_timermanager.numberOfActiveTimers;
         TimerSetTimerStatus(timerHandle, (uint8_t)kTimerStateReady_c);
+#endif
     }
 
     /* Sync directly the timer manager ressources while bypassing the task
@@ -769,6 +1176,15 @@ uint64_t TM_GetTimestamp(void)
 {
 #if (defined(TM_ENABLE_TIME_STAMP) && (TM_ENABLE_TIME_STAMP > 0U))
     return HAL_GetTimeStamp((hal_time_stamp_handle_t)s_timermanager.halTimeStampHandle);
+#elif (defined(TM_ENABLE_ABSOLUTE_DEADLINE) && (TM_ENABLE_ABSOLUTE_DEADLINE > 0U))
+    uint64_t timestamp;
+    uint32_t regPrimask = DisableGlobalIRQ();
+
+    timestamp = s_timermanager.timeBaseUs +
+                (uint32_t)(HAL_TimerGetCurrentTimerCount((hal_timer_handle_t)s_timermanager.halTimerHandle) -
+                           s_timermanager.previousTimeInUs);
+    EnableGlobalIRQ(regPrimask);
+    return timestamp;
 #else
     return HAL_TimerGetCurrentTimerCount((hal_timer_handle_t)s_timermanager.halTimerHandle);
 #endif /* TM_ENABLE_TIME_STAMP */
@@ -944,26 +1360,25 @@ timer_status_t TM_Start(timer_handle_t timerHandle, uint8_t timerType, uint32_t
     if (0U != ((uint8_t)timerType & (uint8_t)kTimerModeSetMinuteTimer))
     {
         th->timeoutInUs = (uint64_t)1000U * 1000U * 60U * timerTimeout;
-        th->remainingUs = (uint64_t)1000U * 1000U * 60U * timerTimeout;
     }
     else if (0U != ((uint8_t)timerType & (uint8_t)kTimerModeSetSecondTimer))
     {
         th->timeoutInUs = (uint64_t)1000U * 1000U * timerTimeout;
-        th->remainingUs = (uint64_t)1000U * 1000U * timerTimeout;
     }
     else if (0U != ((uint8_t)timerType & (uint8_t)kTimerModeSetMicrosTimer))
     {
         th->timeoutInUs = (uint64_t)timerTimeout;
-        th->remainingUs = (uint64_t)timerTimeout;
     }
     else
     {
         th->timeoutInUs = (uint64_t)1000U * timerTimeout;
-        th->remainingUs = (uint64_t)1000U * timerTimeout;
     }
+#if !(defined(TM_ENABLE_TIMER_HEAP) && (TM_ENABLE_TIMER_HEAP > 0U))
+    th->remainingUs = th->timeoutInUs;
+#endif
 
     /* Enable timer, the timer task will do the rest of the work. */
-    TimerEnable(timerHandle);
+    status = TimerEnable(timerHandle);
 
     return status;
 }
@@ -1001,9 +1416,25 @@ uint32_t TM_GetRemainingTime(timer_handle_t timerHandle)
 {
     timer_handle_struct_t *timerState = timerHandle;
     assert(timerHandle);
+#if (defined(TM_ENABLE_TIMER_HEAP) && (TM_ENABLE_TIMER_HEAP > 0U))
+    uint64_t currentTimeUs;
+    uint32_t remainingTimeUs = 0U;
+    uint32_t regPrimask      = DisableGlobalIRQ();
+
+    currentTimeUs = s_timermanager.timeBaseUs +
+                    (uint32_t)(HAL_TimerGetCurrentTimerCount((hal_timer_handle_t)s_timermanager.halTimerHandle) -
+                               s_timermanager.previousTimeInUs);
+    if (timerState->expireUs > currentTimeUs)
+    {
+        remainingTimeUs = (uint32_t)(timerState->expireUs - currentTimeUs);
+    }
+    EnableGlobalIRQ(regPrimask);
+    return remainingTimeUs;
+#else
     return ((uint32_t)(timerState->remainingUs) -
             (uint32_t)(HAL_TimerGetCurrentTimerCount((hal_timer_handle_t)s_timermanager.halTimerHandle) -
                        s_timermanager.previousTimeInUs));
+#endif
 }
 
 /*!
@@ -90,6 +90,44 @@
 #define TM_ENABLE_TIME_STAMP (0)
 #endif
 
+/*
+ * @brief   Enable/Disable absolute deadline timekeeping
+ * If enabled, the timers are kept on absolute deadlines against the free-running counter returned by
+ * TM_GetTimestamp(): the interval timers are reloaded from their previous deadline so they do not accumulate
+ * drift, and the hardware timer is only reprogrammed when the earliest deadline changes.
+ * The min-heap timer scheduler is enabled as well with this option.
+ * VALID RANGE: TRUE/FALSE
+ */
+#ifndef TM_ENABLE_ABSOLUTE_DEADLINE
+#define TM_ENABLE_ABSOLUTE_DEADLINE (0)
+#endif
+
+#if (defined(TM_ENABLE_ABSOLUTE_DEADLINE) && (TM_ENABLE_ABSOLUTE_DEADLINE > 0U))
+#undef TM_ENABLE_TIMER_HEAP
+#define TM_ENABLE_TIMER_HEAP (1)
+#endif
+
+/*
+ * @brief   Enable/Disable the min-heap timer scheduler
+ * If enabled, the active timers are kept in a binary min-heap keyed on their absolute expiry time instead of
+ * being walked one by one on every tick, so the tick, start and stop operations cost O(log n) with interrupts
+ * disabled instead of O(n).
+ * VALID RANGE: TRUE/FALSE
+ */
+#ifndef TM_ENABLE_TIMER_HEAP
+#define TM_ENABLE_TIMER_HEAP (0)
+#endif
+
+#if (defined(TM_ENABLE_TIMER_HEAP) && (TM_ENABLE_TIMER_HEAP > 0U))
+/*
+ * @brief   Configures the maximum number of timers that can be active at the same time with the min-heap scheduler.
+ * VALID RANGE: 1 - 255
+ */
+#ifndef TM_TIMER_HEAP_SIZE
+#define TM_TIMER_HEAP_SIZE (16U)
+#endif
+#endif
+
 /*! @brief Definition of timer manager handle size. */
 #define TIMER_HANDLE_SIZE (32U)
 
@@ -325,6 +363,7 @@ timer_status_t TM_InstallCallback(timer_handle_t timerHandle, timer_callback_t c
  *                       kTimerModeSetMicrosTimer is used.
  *
  * @retval kStatus_TimerSuccess    Timer start succeed.
+ * @retval kStatus_TimerOutOfRange No free slot left in the timer heap, only when TM_ENABLE_TIMER_HEAP is enabled.
  * @retval kStatus_TimerError      An error occurred.
  */
 timer_status_t TM_Start(timer_handle_t timerHandle, uint8_t timerType, uint32_t timerTimeout);
@@ -420,6 +459,8 @@ void TM_MakeTimerTaskReady(void);
 /*!
  * @brief Get a time-stamp value
  *
+ * When TM_ENABLE_ABSOLUTE_DEADLINE is enabled and TM_ENABLE_TIME_STAMP is not, the value is the free-running
+ * time in microseconds since TM_Init() the timer deadlines are kept against.
  */
 uint64_t TM_GetTimestamp(void);
 
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of fsl_common.h for the timer manager test, see timer_manager_test.c. */
+
+#ifndef _FSL_COMMON_H_
+#define _FSL_COMMON_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef int32_t status_t;
+
+#define MAKE_STATUS(group, code) ((((group)*100) + (code)))
+
+enum
+{
+    kStatusGroup_Generic      = 0,
+    kStatusGroup_HAL_TIMER    = 300,
+    kStatusGroup_TIMERMANAGER = 301,
+};
+
+#define kStatus_Success MAKE_STATUS(kStatusGroup_Generic, 0)
+
+#define USEC_TO_COUNT(us, clockFreqInHz)    (uint64_t)(((uint64_t)(us) * (clockFreqInHz)) / 1000000U)
+#define COUNT_TO_USEC(count, clockFreqInHz) (uint64_t)((uint64_t)(count)*1000000U / (clockFreqInHz))
+#define MSEC_TO_COUNT(ms, clockFreqInHz)    (uint64_t)((uint64_t)(ms) * (clockFreqInHz) / 1000U)
+
+#define SDK_ISR_EXIT_BARRIER
+
+/* The handle size checks only hold for the 32-bit target, the test allocates larger handles. */
+void TestAssert(bool condition, const char *expression, const char *file, int line);
+#define assert(x) TestAssert((x) ? true : false, #x, __FILE__, __LINE__)
+
+/* The interrupt mask of the simulated core, the test measures the time spent with the interrupts disabled. */
+uint32_t DisableGlobalIRQ(void);
+void EnableGlobalIRQ(uint32_t primask);
+
+#endif /* _FSL_COMMON_H_ */
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of fsl_device_registers.h for the timer manager test, see timer_manager_test.c. */
+
+#ifndef _FSL_DEVICE_REGISTERS_H_
+#define _FSL_DEVICE_REGISTERS_H_
+
+#include "fsl_common.h"
+
+typedef enum IRQn
+{
+    MRT0_IRQn = 10,
+} IRQn_Type;
+
+/* The MRT channel is simulated by the test behind the fsl_mrt functions, its registers are never accessed. */
+typedef struct
+{
+    uint32_t reserved;
+} MRT_Type;
+
+extern MRT_Type g_testMrt;
+
+#define MRT_BASE_PTRS {&g_testMrt}
+#define MRT_IRQS      {MRT0_IRQn}
+
+#define MRT_CHANNEL_INTVAL_IVALUE_MASK (0xFFFFFFU)
+#define MRT_CHANNEL_INTVAL_LOAD_MASK   (0x80000000U)
+#define MRT_CHANNEL_CTRL_INTEN_MASK    (0x1U)
+#define MRT_CHANNEL_STAT_INTFLAG_MASK  (0x1U)
+#define MRT_CHANNEL_STAT_RUN_MASK      (0x2U)
+
+static inline void NVIC_SetPriority(IRQn_Type irq, uint32_t priority)
+{
+    (void)irq;
+    (void)priority;
+}
+
+static inline status_t EnableIRQ(IRQn_Type irq)
+{
+    (void)irq;
+    return kStatus_Success;
+}
+
+#endif /* _FSL_DEVICE_REGISTERS_H_ */
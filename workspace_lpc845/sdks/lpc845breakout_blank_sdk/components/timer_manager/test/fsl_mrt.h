@@ -0,0 +1,55 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of fsl_mrt.h for the timer manager test, see timer_manager_test.c. */
+
+#ifndef _FSL_MRT_H_
+#define _FSL_MRT_H_
+
+#include "fsl_common.h"
+#include "fsl_device_registers.h"
+
+typedef enum _mrt_chnl
+{
+    kMRT_Channel_0 = 0U,
+} mrt_chnl_t;
+
+typedef enum _mrt_timer_mode
+{
+    kMRT_RepeatMode = 0U,
+} mrt_timer_mode_t;
+
+enum
+{
+    kMRT_TimerInterruptEnable = MRT_CHANNEL_CTRL_INTEN_MASK,
+};
+
+enum
+{
+    kMRT_TimerInterruptFlag = MRT_CHANNEL_STAT_INTFLAG_MASK,
+    kMRT_TimerRunFlag       = MRT_CHANNEL_STAT_RUN_MASK,
+};
+
+typedef struct _mrt_config
+{
+    bool enableMultiTask;
+} mrt_config_t;
+
+/* Implemented by the test on a simulated down-counting channel that reloads with IVALUE - 1. */
+void MRT_GetDefaultConfig(mrt_config_t *config);
+void MRT_Init(MRT_Type *base, const mrt_config_t *config);
+void MRT_Deinit(MRT_Type *base);
+void MRT_SetupChannelMode(MRT_Type *base, mrt_chnl_t channel, const mrt_timer_mode_t mode);
+void MRT_EnableInterrupts(MRT_Type *base, mrt_chnl_t channel, uint32_t mask);
+uint32_t MRT_GetStatusFlags(MRT_Type *base, mrt_chnl_t channel);
+void MRT_ClearStatusFlags(MRT_Type *base, mrt_chnl_t channel, uint32_t mask);
+void MRT_UpdateTimerPeriod(MRT_Type *base, mrt_chnl_t channel, uint32_t count, bool immediateLoad);
+uint32_t MRT_GetCurrentTimerCount(MRT_Type *base, mrt_chnl_t channel);
+void MRT_StartTimer(MRT_Type *base, mrt_chnl_t channel, uint32_t count);
+void MRT_StopTimer(MRT_Type *base, mrt_chnl_t channel);
+
+#endif /* _FSL_MRT_H_ */
@@ -0,0 +1,666 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host test of the timer manager scheduling backends against a simulated hardware timer counting microseconds.
+ *
+ * Build and run from this directory, once per backend, against a simulated CTIMER:
+ *   gcc -O2 -I. -I.. -I../../timer -o tm_list timer_manager_test.c && ./tm_list
+ *   gcc -O2 -I. -I.. -I../../timer -DTM_ENABLE_TIMER_HEAP=1 -o tm_heap timer_manager_test.c && ./tm_heap
+ *   gcc -O2 -I. -I.. -I../../timer -DTM_ENABLE_ABSOLUTE_DEADLINE=1 -o tm_abs timer_manager_test.c && ./tm_abs
+ * and against the MRT adapter on a simulated MRT channel by adding -DTEST_MRT_ADAPTER=1, for example:
+ *   gcc -O2 -I. -I.. -I../../timer -DTM_ENABLE_ABSOLUTE_DEADLINE=1 -DTEST_MRT_ADAPTER=1 -o tm_abs_mrt \
+ *       timer_manager_test.c && ./tm_abs_mrt
+ *
+ * The simulated CTIMER counter restarts from zero at its match value like the CTIMER adapter does. The simulated MRT
+ * channel is driven by fsl_adapter_mrt.c itself through the fsl_mrt functions, it loads IVALUE - 1, counts down and
+ * reloads at zero. Every counter read takes one microsecond of simulated time, so the time lost while the timer is
+ * reprogrammed shows up as drift. The test checks that no randomly started timer expires early and, with
+ * TM_ENABLE_ABSOLUTE_DEADLINE, that an interval timer neither drifts nor expires early while the next timeout is moved
+ * and that the hardware timer is not reprogrammed for a lone interval timer. The drift of the other backends is only
+ * reported. It then measures the time spent with the interrupts disabled versus the number of running timers, on the
+ * host. The exit code is 0 on success.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifndef TM_TIMER_HEAP_SIZE
+#define TM_TIMER_HEAP_SIZE (64U)
+#endif
+
+#if (defined(TEST_MRT_ADAPTER) && (TEST_MRT_ADAPTER > 0U))
+#include "fsl_adapter_timer.h"
+#include "fsl_adapter_mrt.c"
+
+/* The timer handle size is the one of 32-bit targets, the host one is taken from the structure */
+#undef HAL_TIMER_HANDLE_SIZE
+#define HAL_TIMER_HANDLE_SIZE (sizeof(hal_timer_handle_struct_t))
+#endif
+
+#include "fsl_component_timer_manager.c"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_TIMER_NUM      (64U)
+#define TEST_EARLY_TOLERANCE (10U)
+#define TEST_SAMPLE_NUM     (1U << 20U)
+
+typedef struct _test_timer
+{
+    uint64_t handle[8]; /* timer_handle_struct_t is larger than TIMER_HANDLE_SIZE on a 64-bit host */
+    uint8_t type;
+    bool running;
+    uint32_t timeoutUs;
+    uint64_t expectedUs;
+    uint64_t lastFireUs;
+    uint32_t fireCount;
+} test_timer_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static struct
+{
+    uint64_t now;
+    uint32_t tc;
+    uint32_t mr;
+    bool running;
+    bool pending;
+    uint32_t updateCount;
+    uint32_t moveCount;
+    hal_timer_callback_t callback;
+    void *callbackParam;
+} s_hw;
+
+static test_timer_t s_timers[TEST_TIMER_NUM];
+static uint32_t s_masked;
+static uint64_t s_maskStartNs;
+static bool s_measure;
+static uint32_t s_sampleCount;
+static uint32_t s_samples[TEST_SAMPLE_NUM];
+static uint32_t s_earlyCount;
+static uint64_t s_maxLateUs;
+static uint32_t s_seed = 1U;
+static int s_failures;
+
+/*******************************************************************************
+ * Simulated core and timer adapter
+ ******************************************************************************/
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+void TestAssert(bool condition, const char *expression, const char *file, int line)
+{
+    if ((!condition) && (NULL == strstr(expression, "HANDLE_SIZE")))
+    {
+        printf("%s:%d: assertion failed: %s\n", file, line, expression);
+        exit(2);
+    }
+}
+
+uint32_t DisableGlobalIRQ(void)
+{
+    uint32_t primask = s_masked;
+
+    if (0U == s_masked)
+    {
+        s_masked      = 1U;
+        s_maskStartNs = NowNs();
+    }
+    return primask;
+}
+
+void EnableGlobalIRQ(uint32_t primask)
+{
+    if ((0U == primask) && (0U != s_masked))
+    {
+        if (s_measure && (s_sampleCount < TEST_SAMPLE_NUM))
+        {
+            s_samples[s_sampleCount++] = (uint32_t)(NowNs() - s_maskStartNs);
+        }
+        s_masked = 0U;
+    }
+}
+
+#if (defined(TEST_MRT_ADAPTER) && (TEST_MRT_ADAPTER > 0U))
+/* The MRT channel: tc is the TIMER register counting down, mr the IVALUE it reloads with. */
+MRT_Type g_testMrt;
+
+static void SimTick(uint32_t ticks)
+{
+    while (ticks-- > 0U)
+    {
+        s_hw.now++;
+        if (s_hw.running)
+        {
+            if (0U == s_hw.tc)
+            {
+                s_hw.tc      = s_hw.mr - 1U;
+                s_hw.pending = true;
+            }
+            else
+            {
+                s_hw.tc--;
+            }
+        }
+    }
+}
+
+static void SimInterrupt(void)
+{
+    MRT0_IRQHandler();
+}
+#else
+/* The CTIMER: tc is the counter counting up, mr the match value it restarts at. */
+static void SimTick(uint32_t ticks)
+{
+    while (ticks-- > 0U)
+    {
+        s_hw.now++;
+        if (s_hw.running)
+        {
+            s_hw.tc++;
+            if (s_hw.tc >= s_hw.mr)
+            {
+                s_hw.tc      = 0U;
+                s_hw.pending = true;
+            }
+        }
+    }
+}
+
+static void SimInterrupt(void)
+{
+    s_hw.pending = false;
+    s_hw.callback(s_hw.callbackParam);
+}
+#endif
+
+/* Runs the simulated time up to untilUs, taking the timer interrupt whenever it is pending. */
+static void SimRun(uint64_t untilUs)
+{
+    while (s_hw.now < untilUs)
+    {
+        SimTick(1U);
+        if (s_hw.pending && (0U == s_masked))
+        {
+            SimInterrupt();
+        }
+    }
+}
+
+#if (defined(TEST_MRT_ADAPTER) && (TEST_MRT_ADAPTER > 0U))
+void MRT_GetDefaultConfig(mrt_config_t *config)
+{
+    config->enableMultiTask = false;
+}
+
+void MRT_Init(MRT_Type *base, const mrt_config_t *config)
+{
+    uint64_t now = s_hw.now;
+
+    (void)base;
+    (void)config;
+    (void)memset(&s_hw, 0, sizeof(s_hw));
+    s_hw.now = now;
+}
+
+void MRT_Deinit(MRT_Type *base)
+{
+    (void)base;
+    s_hw.running = false;
+}
+
+void MRT_SetupChannelMode(MRT_Type *base, mrt_chnl_t channel, const mrt_timer_mode_t mode)
+{
+    (void)base;
+    (void)channel;
+    (void)mode;
+}
+
+void MRT_EnableInterrupts(MRT_Type *base, mrt_chnl_t channel, uint32_t mask)
+{
+    (void)base;
+    (void)channel;
+    (void)mask;
+}
+
+uint32_t MRT_GetStatusFlags(MRT_Type *base, mrt_chnl_t channel)
+{
+    (void)base;
+    (void)channel;
+    return (s_hw.pending ? (uint32_t)kMRT_TimerInterruptFlag : 0U) | (s_hw.running ? (uint32_t)kMRT_TimerRunFlag : 0U);
+}
+
+void MRT_ClearStatusFlags(MRT_Type *base, mrt_chnl_t channel, uint32_t mask)
+{
+    (void)base;
+    (void)channel;
+    if (0U != (mask & (uint32_t)kMRT_TimerInterruptFlag))
+    {
+        s_hw.pending = false;
+    }
+}
+
+uint32_t MRT_GetCurrentTimerCount(MRT_Type *base, mrt_chnl_t channel)
+{
+    (void)base;
+    (void)channel;
+    SimTick(1U);
+    return s_hw.tc;
+}
+
+/* The INTVAL write: a forced load, or any load of an idle channel, takes effect at once, else at the next reload. */
+void MRT_StartTimer(MRT_Type *base, mrt_chnl_t channel, uint32_t count)
+{
+    uint32_t value = count & MRT_CHANNEL_INTVAL_IVALUE_MASK;
+
+    (void)base;
+    (void)channel;
+    s_hw.mr = value;
+    if ((0U != (count & MRT_CHANNEL_INTVAL_LOAD_MASK)) || (!s_hw.running))
+    {
+        if (s_hw.running && (0U != value))
+        {
+            s_hw.moveCount++;
+        }
+        s_hw.running = (0U != value);
+        s_hw.tc      = (0U != value) ? (value - 1U) : 0U;
+    }
+}
+
+void MRT_UpdateTimerPeriod(MRT_Type *base, mrt_chnl_t channel, uint32_t count, bool immediateLoad)
+{
+    MRT_StartTimer(base, channel, count | (immediateLoad ? MRT_CHANNEL_INTVAL_LOAD_MASK : 0U));
+}
+
+void MRT_StopTimer(MRT_Type *base, mrt_chnl_t channel)
+{
+    s_hw.updateCount++;
+    MRT_StartTimer(base, channel, MRT_CHANNEL_INTVAL_LOAD_MASK);
+}
+#else
+hal_timer_status_t HAL_TimerInit(hal_timer_handle_t halTimerHandle, hal_timer_config_t *halTimerConfig)
+{
+    uint64_t now = s_hw.now;
+
+    (void)halTimerHandle;
+    (void)memset(&s_hw, 0, sizeof(s_hw));
+    s_hw.now = now;
+    s_hw.mr  = halTimerConfig->timeout;
+    return kStatus_HAL_TimerSuccess;
+}
+
+void HAL_TimerDeinit(hal_timer_handle_t halTimerHandle)
+{
+    (void)halTimerHandle;
+    s_hw.running = false;
+}
+
+void HAL_TimerEnable(hal_timer_handle_t halTimerHandle)
+{
+    (void)halTimerHandle;
+    s_hw.running = true;
+}
+
+void HAL_TimerDisable(hal_timer_handle_t halTimerHandle)
+{
+    (void)halTimerHandle;
+    s_hw.running = false;
+}
+
+void HAL_TimerInstallCallback(hal_timer_handle_t halTimerHandle, hal_timer_callback_t callback, void *callbackParam)
+{
+    (void)halTimerHandle;
+    s_hw.callback      = callback;
+    s_hw.callbackParam = callbackParam;
+}
+
+uint32_t HAL_TimerGetCurrentTimerCount(hal_timer_handle_t halTimerHandle)
+{
+    (void)halTimerHandle;
+    SimTick(1U);
+    return s_hw.tc;
+}
+
+hal_timer_status_t HAL_TimerUpdateTimeout(hal_timer_handle_t halTimerHandle, uint32_t timeout)
+{
+    (void)halTimerHandle;
+    if (timeout < 1U)
+    {
+        return kStatus_HAL_TimerOutOfRanger;
+    }
+    s_hw.updateCount++;
+    s_hw.running = false;
+    s_hw.pending = false;
+    s_hw.tc      = 0U;
+    s_hw.mr      = timeout;
+    return kStatus_HAL_TimerSuccess;
+}
+
+hal_timer_status_t HAL_TimerMoveTimeout(hal_timer_handle_t halTimerHandle, uint32_t timeout)
+{
+    (void)halTimerHandle;
+    if (s_hw.pending || ((s_hw.tc + 11U) >= s_hw.mr) || ((s_hw.tc + 11U) >= timeout))
+    {
+        return kStatus_HAL_TimerOutOfRanger;
+    }
+    s_hw.moveCount++;
+    s_hw.mr = timeout;
+    return kStatus_HAL_TimerSuccess;
+}
+
+bool HAL_TimerIsTimeoutPending(hal_timer_handle_t halTimerHandle)
+{
+    (void)halTimerHandle;
+    return s_hw.pending;
+}
+
+uint32_t HAL_TimerGetMaxTimeout(hal_timer_handle_t halTimerHandle)
+{
+    (void)halTimerHandle;
+    return 0xFFFFFFFFU - 4000U;
+}
+
+void HAL_TimerExitLowpower(hal_timer_handle_t halTimerHandle)
+{
+    (void)halTimerHandle;
+}
+
+void HAL_TimerEnterLowpower(hal_timer_handle_t halTimerHandle)
+{
+    (void)halTimerHandle;
+}
+#endif
+
+/*******************************************************************************
+ * Test
+ ******************************************************************************/
+
+static uint32_t Random(uint32_t range)
+{
+    s_seed ^= s_seed << 13U;
+    s_seed ^= s_seed >> 17U;
+    s_seed ^= s_seed << 5U;
+    return s_seed % range;
+}
+
+static void TestCallback(void *param)
+{
+    test_timer_t *timer = param;
+    uint64_t now        = s_hw.now;
+    uint64_t missedUs;
+
+    if ((now + TEST_EARLY_TOLERANCE) < timer->expectedUs)
+    {
+        s_earlyCount++;
+    }
+    else if ((now > timer->expectedUs) && ((now - timer->expectedUs) > s_maxLateUs))
+    {
+        s_maxLateUs = now - timer->expectedUs;
+    }
+    else
+    {
+        /* On time. */
+    }
+    timer->lastFireUs = now;
+    timer->fireCount++;
+
+    if (0U != (timer->type & kTimerModeSingleShot))
+    {
+        timer->running = false;
+    }
+    else
+    {
+#if (defined(TM_ENABLE_ABSOLUTE_DEADLINE) && (TM_ENABLE_ABSOLUTE_DEADLINE > 0U))
+        /* The deadlines stay on the grid of the first one, missed periods are skipped. */
+        timer->expectedUs += timer->timeoutUs;
+        if (timer->expectedUs <= now)
+        {
+            missedUs          = now - timer->expectedUs;
+            timer->expectedUs = now + timer->timeoutUs - (missedUs % timer->timeoutUs);
+        }
+#else
+        /* The period restarts when the expiry is processed. */
+        (void)missedUs;
+        timer->expectedUs = now + timer->timeoutUs;
+#endif
+    }
+}
+
+static void TestStart(test_timer_t *timer, uint8_t type, uint32_t timeoutUs)
+{
+    timer->type       = type;
+    timer->timeoutUs  = timeoutUs;
+    timer->expectedUs = s_hw.now + timeoutUs;
+    timer->running    = true;
+    if (kStatus_TimerSuccess != TM_Start(timer->handle, type | kTimerModeSetMicrosTimer, timeoutUs))
+    {
+        printf("TM_Start failed\n");
+        s_failures++;
+    }
+}
+
+static void TestInit(uint32_t timerNum)
+{
+    timer_config_t config;
+    uint32_t i;
+
+    TM_Deinit();
+    (void)memset(s_timers, 0, sizeof(s_timers));
+    (void)memset(&config, 0, sizeof(config));
+    config.srcClock_Hz = 1000000U;
+    (void)TM_Init(&config);
+    for (i = 0U; i < timerNum; i++)
+    {
+        (void)TM_Open(s_timers[i].handle);
+        (void)TM_InstallCallback(s_timers[i].handle, TestCallback, &s_timers[i]);
+    }
+    s_earlyCount = 0U;
+    s_maxLateUs  = 0U;
+}
+
+static void TestFail(const char *message)
+{
+    printf("FAIL: %s\n", message);
+    s_failures++;
+}
+
+/* Random interval and single shot timers started and stopped at random times, none may expire early. */
+static void TestRandomTimers(void)
+{
+    uint64_t eventUs;
+    uint64_t endUs;
+    uint32_t fires = 0U;
+    uint32_t i;
+    test_timer_t *timer;
+
+    TestInit(16U);
+    eventUs = s_hw.now;
+    endUs   = s_hw.now + 20000000U;
+    while (eventUs < endUs)
+    {
+        eventUs += 1U + Random(2000U);
+        SimRun(eventUs);
+        timer = &s_timers[Random(16U)];
+        if (timer->running && (0U == Random(3U)))
+        {
+            (void)TM_Stop(timer->handle);
+            timer->running = false;
+        }
+        else if (!timer->running)
+        {
+            TestStart(timer, (0U != Random(2U)) ? kTimerModeIntervalTimer : kTimerModeSingleShot,
+                      400U + Random(50000U));
+        }
+        else
+        {
+            /* Leave the timer running. */
+        }
+    }
+    for (i = 0U; i < 16U; i++)
+    {
+        fires += s_timers[i].fireCount;
+    }
+    printf("random timers: %u expiries, %u early, latest %u us\n", fires, s_earlyCount, (uint32_t)s_maxLateUs);
+    if (0U != s_earlyCount)
+    {
+        TestFail("a timer expired early");
+    }
+}
+
+/* A 1 ms interval timer while 4 single shot timers keep being restarted, which moves the earliest deadline. */
+static void TestDrift(void)
+{
+    test_timer_t *periodic = &s_timers[0];
+    uint64_t startUs;
+    uint64_t eventUs;
+    uint64_t lateUs;
+    uint64_t firstLateUs = 0U;
+    uint64_t lastLateUs  = 0U;
+    uint32_t lastCount;
+
+    TestInit(5U);
+    startUs = s_hw.now;
+    TestStart(periodic, kTimerModeIntervalTimer, 1000U);
+    eventUs = s_hw.now;
+    while (periodic->fireCount < 100000U)
+    {
+        eventUs += 50U + Random(500U);
+        lastCount = periodic->fireCount;
+        SimRun(eventUs);
+        if (periodic->fireCount != lastCount)
+        {
+            /* Lateness against the ideal grid of the first deadline. */
+            lateUs = periodic->lastFireUs - (startUs + ((uint64_t)periodic->fireCount * 1000U));
+            if (periodic->fireCount <= 1000U)
+            {
+                firstLateUs = (lateUs > firstLateUs) ? lateUs : firstLateUs;
+            }
+            if (periodic->fireCount > 99000U)
+            {
+                lastLateUs = (lateUs > lastLateUs) ? lateUs : lastLateUs;
+            }
+        }
+        (void)TestStart(&s_timers[1U + Random(4U)], kTimerModeSingleShot, 100U + Random(3000U));
+    }
+    printf("interval timer drift: %u expiries, %u early, at most %u us behind the grid over the first 1000"
+           " periods, %u us over the last 1000\n",
+           periodic->fireCount, s_earlyCount, (uint32_t)firstLateUs, (uint32_t)lastLateUs);
+#if (defined(TM_ENABLE_ABSOLUTE_DEADLINE) && (TM_ENABLE_ABSOLUTE_DEADLINE > 0U))
+    if (lastLateUs > (firstLateUs + 20U))
+    {
+        TestFail("the interval timer drifts");
+    }
+    if (0U != s_earlyCount)
+    {
+        TestFail("a timer expired early");
+    }
+#endif
+}
+
+/* A lone interval timer, the hardware timer should be left running. */
+static void TestLoneInterval(void)
+{
+    uint32_t updates;
+
+    TestInit(1U);
+    TestStart(&s_timers[0], kTimerModeIntervalTimer, 1000U);
+    SimRun(s_hw.now + 10000000U);
+    updates = s_hw.updateCount + s_hw.moveCount;
+    printf("lone 1 ms interval timer: %u expiries, hardware timer programmed %u times\n", s_timers[0].fireCount,
+           updates);
+#if (defined(TM_ENABLE_ABSOLUTE_DEADLINE) && (TM_ENABLE_ABSOLUTE_DEADLINE > 0U))
+    if (updates > 2U)
+    {
+        TestFail("the hardware timer is reprogrammed for a lone interval timer");
+    }
+#endif
+}
+
+static int CompareSamples(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+/* Time spent with the interrupts disabled while n interval timers run, started and stopped in turn. */
+static void TestBenchmark(void)
+{
+    static const uint32_t counts[] = {1U, 2U, 4U, 8U, 16U, 32U, 64U};
+    uint64_t sum;
+    uint64_t eventUs;
+    uint64_t endUs;
+    uint32_t i;
+    uint32_t k;
+    uint32_t n;
+
+    printf("\n timers  sections  mean ns  p99 ns  max ns  (host time with the interrupts disabled)\n");
+    for (k = 0U; k < (sizeof(counts) / sizeof(counts[0])); k++)
+    {
+        n = counts[k];
+        TestInit(n);
+        for (i = 0U; i < n; i++)
+        {
+            TestStart(&s_timers[i], kTimerModeIntervalTimer, 2000U + Random(20000U));
+        }
+        s_sampleCount = 0U;
+        s_measure     = true;
+        eventUs       = s_hw.now;
+        endUs         = s_hw.now + 5000000U;
+        while (eventUs < endUs)
+        {
+            eventUs += 1000U;
+            SimRun(eventUs);
+            i = Random(n);
+            (void)TM_Stop(s_timers[i].handle);
+            TestStart(&s_timers[i], kTimerModeIntervalTimer, 2000U + Random(20000U));
+        }
+        s_measure = false;
+        qsort(s_samples, s_sampleCount, sizeof(s_samples[0]), CompareSamples);
+        sum = 0U;
+        for (i = 0U; i < s_sampleCount; i++)
+        {
+            sum += s_samples[i];
+        }
+        printf("%7u %9u %8u %7u %7u\n", n, s_sampleCount, (uint32_t)(sum / s_sampleCount),
+               s_samples[(s_sampleCount * 99U) / 100U], s_samples[s_sampleCount - 1U]);
+    }
+}
+
+int main(void)
+{
+#if (defined(TM_ENABLE_ABSOLUTE_DEADLINE) && (TM_ENABLE_ABSOLUTE_DEADLINE > 0U))
+    printf("backend: min-heap, absolute deadlines\n");
+#elif (defined(TM_ENABLE_TIMER_HEAP) && (TM_ENABLE_TIMER_HEAP > 0U))
+    printf("backend: min-heap\n");
+#else
+    printf("backend: list\n");
+#endif
+#if (defined(TEST_MRT_ADAPTER) && (TEST_MRT_ADAPTER > 0U))
+    printf("hardware timer: MRT adapter\n");
+#else
+    printf("hardware timer: CTIMER\n");
+#endif
+    TestRandomTimers();
+    TestDrift();
+    TestLoneInterval();
+    TestBenchmark();
+    printf("%s\n", (0 == s_failures) ? "PASS" : "FAIL");
+    return (0 == s_failures) ? 0 : 1;
+}
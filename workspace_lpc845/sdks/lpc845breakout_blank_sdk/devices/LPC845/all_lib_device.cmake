@@ -14,6 +14,9 @@
 #  # description: CMSIS-DSP Library
 #  set(CONFIG_USE_CMSIS_DSP_Source true)
 
+#  # description: CMSIS-DSP FFT tables limited to the listed transforms, see CMSIS/DSP/Scripts/gen_fft_tables.py
+#  set(CONFIG_CMSIS_DSP_FFT_TABLES cfft_q15_256 rfft_fast_f32_512)
+
 #set.CMSIS
 #  # description: Device interrupt controller interface
 #  set(CONFIG_USE_CMSIS_Device_API_OSTick true)
@@ -157,6 +160,9 @@
 #  # description: SCT Driver
 #  set(CONFIG_USE_driver_sctimer true)
 
+#  # description: SCT DMA Driver
+#  set(CONFIG_USE_driver_sctimer_dma true)
+
 #  # description: PINT Driver
 #  set(CONFIG_USE_driver_pint true)
 
@@ -166,9 +172,15 @@
 #  # description: USART Driver
 #  set(CONFIG_USE_driver_lpc_miniusart true)
 
+#  # description: USART DMA Driver
+#  set(CONFIG_USE_driver_lpc_miniusart_dma true)
+
 #  # description: SPI Driver
 #  set(CONFIG_USE_driver_lpc_minispi true)
 
+#  # description: SPI DMA Driver
+#  set(CONFIG_USE_driver_lpc_minispi_dma true)
+
 #  # description: IOCON Driver
 #  set(CONFIG_USE_driver_lpc_iocon_lite true)
 
@@ -190,6 +202,9 @@
 #  # description: CRC Driver
 #  set(CONFIG_USE_driver_lpc_crc true)
 
+#  # description: CRC DMA Driver
+#  set(CONFIG_USE_driver_lpc_crc_dma true)
+
 #  # description: ADC Driver
 #  set(CONFIG_USE_driver_lpc_adc true)
 
@@ -232,9 +247,18 @@
 #  # description: Component mem_manager_light
 #  set(CONFIG_USE_component_mem_manager_light true)
 
+#  # description: Component mem_manager_tlsf
+#  set(CONFIG_USE_component_mem_manager_tlsf true)
+
 #  # description: Component lists
 #  set(CONFIG_USE_component_lists true)
 
+#  # description: Component spsc_queue
+#  set(CONFIG_USE_component_spsc_queue true)
+
+#  # description: Component adc_acquisition
+#  set(CONFIG_USE_component_adc_acquisition true)
+
 #  # description: Component led
 #  set(CONFIG_USE_component_led true)
 
@@ -324,6 +348,8 @@ list(APPEND CMAKE_MODULE_PATH
   ${CMAKE_CURRENT_LIST_DIR}/../../components/pwm
   ${CMAKE_CURRENT_LIST_DIR}/../../components/reset
   ${CMAKE_CURRENT_LIST_DIR}/../../components/rng
+  ${CMAKE_CURRENT_LIST_DIR}/../../components/spsc_queue
+  ${CMAKE_CURRENT_LIST_DIR}/../../components/adc_acquisition
   ${CMAKE_CURRENT_LIST_DIR}/../../components/timer
   ${CMAKE_CURRENT_LIST_DIR}/../../components/timer_manager
   ${CMAKE_CURRENT_LIST_DIR}/../../components/uart
@@ -371,12 +397,15 @@ include_if_use(component_i2c_adapter_interface.LPC845)
 include_if_use(component_i2c_mux_pca954x.LPC845)
 include_if_use(component_led.LPC845)
 include_if_use(component_lists.LPC845)
+include_if_use(component_spsc_queue.LPC845)
+include_if_use(component_adc_acquisition.LPC845)
 include_if_use(component_lpc_crc_adapter.LPC845)
 include_if_use(component_lpc_gpio_adapter.LPC845)
 include_if_use(component_lpc_i2c_adapter.LPC845)
 include_if_use(component_mem_manager.LPC845)
 include_if_use(component_mem_manager_legacy.LPC845)
 include_if_use(component_mem_manager_light.LPC845)
+include_if_use(component_mem_manager_tlsf.LPC845)
 include_if_use(component_miniusart_adapter.LPC845)
 include_if_use(component_mrt_adapter.LPC845)
 include_if_use(component_osa)
@@ -404,6 +433,7 @@ include_if_use(driver_inputmux_connections.LPC845)
 include_if_use(driver_lpc_acomp.LPC845)
 include_if_use(driver_lpc_adc.LPC845)
 include_if_use(driver_lpc_crc.LPC845)
+include_if_use(driver_lpc_crc_dma.LPC845)
 include_if_use(driver_lpc_dac.LPC845)
 include_if_use(driver_lpc_dma.LPC845)
 include_if_use(driver_lpc_gpio.LPC845)
@@ -411,12 +441,15 @@ include_if_use(driver_lpc_i2c.LPC845)
 include_if_use(driver_lpc_i2c_dma.LPC845)
 include_if_use(driver_lpc_iocon_lite.LPC845)
 include_if_use(driver_lpc_minispi.LPC845)
+include_if_use(driver_lpc_minispi_dma.LPC845)
 include_if_use(driver_lpc_miniusart.LPC845)
+include_if_use(driver_lpc_miniusart_dma.LPC845)
 include_if_use(driver_mrt.LPC845)
 include_if_use(driver_pint.LPC845)
 include_if_use(driver_power.LPC845)
 include_if_use(driver_reset.LPC845)
 include_if_use(driver_sctimer.LPC845)
+include_if_use(driver_sctimer_dma.LPC845)
 include_if_use(driver_swm.LPC845)
 include_if_use(driver_swm_connections.LPC845)
 include_if_use(driver_syscon.LPC845)
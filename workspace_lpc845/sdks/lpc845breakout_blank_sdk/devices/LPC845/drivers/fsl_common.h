@@ -211,6 +211,9 @@ enum _status_groups
     kStatusGroup_ENDAT3     	= 171, /*!< Group number for ENDAT3 status codes. */
     kStatusGroup_HIPERFACE      = 172, /*!< Group number for HIPERFACE status codes. */
     kStatusGroup_NPX            = 173, /*!< Group number for NPX status codes. */
+    kStatusGroup_ADC_ACQ        = 174, /*!< Group number for ADC acquisition status codes. */
+    kStatusGroup_KV_STORE       = 175, /*!< Group number for key value store status codes. */
+    kStatusGroup_FLASH_WRITER   = 176, /*!< Group number for flash writer status codes. */
 };
 
 /*! \public
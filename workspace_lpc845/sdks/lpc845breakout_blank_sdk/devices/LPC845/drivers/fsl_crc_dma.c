@@ -0,0 +1,322 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_crc_dma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.lpc_crc_dma"
+#endif
+
+/*! @brief Segments of one DMA batch: the channel head descriptor plus the link descriptors. */
+#define CRC_DMA_BATCH_SEGMENTS (CRC_DMA_LINK_DESCRIPTOR_COUNT + 1U)
+
+/*<! @brief CRC DMA transfer state. */
+enum
+{
+    kCRC_DmaStateIdle = 0x0U, /*!< No transfer in progress. */
+    kCRC_DmaStateBusy,        /*!< DMA is feeding the CRC engine. */
+};
+
+/*<! @brief One segment of a DMA batch. */
+typedef struct _crc_dma_segment
+{
+    const uint8_t *src; /*!< Segment start address. */
+    uint32_t bytes;     /*!< Segment length in bytes. */
+    uint8_t width;      /*!< Transfer width in bytes. */
+} crc_dma_segment_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void CRC_TransferCallbackDMA(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/*! @brief Link descriptors chained behind the channel head descriptor. */
+DMA_ALLOCATE_LINK_DESCRIPTORS(s_crcDmaLinkDescriptor, CRC_DMA_LINK_DESCRIPTOR_COUNT);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*!
+ * @brief Prepares and starts the next DMA batch of the transfer.
+ *
+ * Walks the scatter list from the current position and splits it the same way CRC_WriteData() does: 8-bit
+ * transfers up to the next word boundary, 32-bit transfers for the aligned words and 8-bit transfers for the tail.
+ * Segments are chained through the link descriptors, only the last one raises the interrupt.
+ *
+ * @param handle Pointer to crc_dma_handle_t structure.
+ * @return true if a batch was started, false if all data has been fed.
+ */
+static bool CRC_StartBatchDMA(crc_dma_handle_t *handle)
+{
+    crc_dma_segment_t segment[CRC_DMA_BATCH_SEGMENTS];
+    uint32_t segmentCount = 0U;
+    uint32_t batchBytes   = 0U;
+    uint32_t i;
+    uint32_t xferCfg;
+    size_t remaining;
+    size_t bytes;
+    uint32_t misalign;
+    uint8_t width;
+    const uint8_t *src;
+    bool last;
+    void *dst = (void *)(uint32_t)&handle->base->WR_DATA;
+
+    while ((segmentCount < CRC_DMA_BATCH_SEGMENTS) && (handle->bufferIndex < handle->bufferCount))
+    {
+        remaining = handle->buffers[handle->bufferIndex].dataSize - handle->bufferOffset;
+        if (0U == remaining)
+        {
+            handle->bufferIndex++;
+            handle->bufferOffset = 0U;
+            continue;
+        }
+
+        src      = &handle->buffers[handle->bufferIndex].data[handle->bufferOffset];
+        misalign = (uint32_t)src & 3U;
+        if (0U != misalign)
+        {
+            /* 8-bit transfers till source address is aligned 4 bytes */
+            width = (uint8_t)kDMA_Transfer8BitWidth;
+            bytes = MIN(remaining, 4U - misalign);
+        }
+        else if (remaining < sizeof(uint32_t))
+        {
+            /* 8-bit transfers till end of data buffer */
+            width = (uint8_t)kDMA_Transfer8BitWidth;
+            bytes = remaining;
+        }
+        else
+        {
+            /* 32-bit transfers as long as possible */
+            width = (uint8_t)kDMA_Transfer32BitWidth;
+            bytes = MIN(remaining & ~(size_t)3U, DMA_MAX_TRANSFER_COUNT * sizeof(uint32_t));
+        }
+
+        segment[segmentCount].src   = src;
+        segment[segmentCount].bytes = (uint32_t)bytes;
+        segment[segmentCount].width = width;
+        segmentCount++;
+        batchBytes += (uint32_t)bytes;
+        handle->bufferOffset += bytes;
+    }
+
+    if (0U == segmentCount)
+    {
+        return false;
+    }
+
+    handle->batchBytes = batchBytes;
+
+    /* Link descriptors from the tail, the last segment clears the trigger and raises the interrupt. */
+    for (i = segmentCount; i > 0U; i--)
+    {
+        last    = (i == segmentCount);
+        xferCfg = DMA_CHANNEL_XFER(!last, last, last, false, segment[i - 1U].width,
+                                   (uint8_t)kDMA_AddressInterleave1xWidth, (uint8_t)kDMA_AddressInterleave0xWidth,
+                                   segment[i - 1U].bytes);
+        if (i > 1U)
+        {
+            DMA_SetupDescriptor(&s_crcDmaLinkDescriptor[i - 2U], xferCfg, (void *)(uint32_t)segment[i - 1U].src, dst,
+                                last ? NULL : &s_crcDmaLinkDescriptor[i - 1U]);
+        }
+    }
+
+    /* The head segment goes to the channel descriptor, xferCfg holds its configuration after the loop. */
+    DMA_SubmitChannelTransferParameter(handle->dmaHandle, xferCfg, (void *)(uint32_t)segment[0].src, dst,
+                                       (segmentCount > 1U) ? &s_crcDmaLinkDescriptor[0] : NULL);
+    DMA_StartTransfer(handle->dmaHandle);
+
+    return true;
+}
+
+static void CRC_TransferCallbackDMA(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode)
+{
+    crc_dma_handle_t *crcHandle = (crc_dma_handle_t *)userData;
+    status_t status             = kStatus_Success;
+
+    /* Don't do anything if we don't have a valid handle. */
+    if ((crcHandle == NULL) || (crcHandle->state != (uint8_t)kCRC_DmaStateBusy))
+    {
+        return;
+    }
+
+    if (transferDone)
+    {
+        crcHandle->transferredBytes += crcHandle->batchBytes;
+        crcHandle->batchBytes = 0U;
+        if (CRC_StartBatchDMA(crcHandle))
+        {
+            return;
+        }
+    }
+    else
+    {
+        /* Descriptor or bus error, the checksum is not valid. */
+        DMA_AbortTransfer(handle);
+        status = kStatus_Fail;
+    }
+
+    crcHandle->state = (uint8_t)kCRC_DmaStateIdle;
+
+    if (crcHandle->callback != NULL)
+    {
+        crcHandle->callback(crcHandle->base, crcHandle, status, crcHandle->userData);
+    }
+}
+
+/*!
+ * brief Initializes the CRC handle which is used in transactional functions.
+ *
+ * param base CRC peripheral base address.
+ * param handle Pointer to crc_dma_handle_t structure.
+ * param callback Pointer to user callback function.
+ * param userData User parameter passed to the callback function.
+ * param dmaHandle DMA handle pointer.
+ */
+void CRC_TransferCreateHandleDMA(CRC_Type *base,
+                                 crc_dma_handle_t *handle,
+                                 crc_dma_transfer_callback_t callback,
+                                 void *userData,
+                                 dma_handle_t *dmaHandle)
+{
+    assert(handle != NULL);
+    assert(dmaHandle != NULL);
+
+    /* Zero handle. */
+    (void)memset(handle, 0, sizeof(*handle));
+
+    handle->base      = base;
+    handle->dmaHandle = dmaHandle;
+    handle->callback  = callback;
+    handle->userData  = userData;
+
+    /* Memory to peripheral register, no peripheral request. */
+    DMA_SetChannelConfig(dmaHandle->base, dmaHandle->channel, NULL, false);
+    DMA_EnableChannelInterrupts(dmaHandle->base, dmaHandle->channel);
+    DMA_SetCallback(dmaHandle, CRC_TransferCallbackDMA, handle);
+}
+
+/*!
+ * brief Writes data to the CRC module using DMA, non-blocking.
+ *
+ * param base CRC peripheral base address.
+ * param handle Pointer to crc_dma_handle_t structure.
+ * param data Input data stream, MSByte in data[0]. Must stay valid until the transfer is completed.
+ * param dataSize Size of the input data buffer in bytes.
+ * retval kStatus_Success The transfer has been started.
+ * retval kStatus_Busy The previous transfer is still ongoing.
+ * retval kStatus_InvalidArgument The input buffer is empty.
+ */
+status_t CRC_WriteDataDMA(CRC_Type *base, crc_dma_handle_t *handle, const uint8_t *data, size_t dataSize)
+{
+    assert(handle != NULL);
+
+    if (handle->state != (uint8_t)kCRC_DmaStateIdle)
+    {
+        return kStatus_Busy;
+    }
+
+    handle->singleBuffer.data     = data;
+    handle->singleBuffer.dataSize = dataSize;
+
+    return CRC_WriteDataScatterDMA(base, handle, &handle->singleBuffer, 1U);
+}
+
+/*!
+ * brief Writes a scatter list of buffers to the CRC module using DMA, non-blocking.
+ *
+ * param base CRC peripheral base address.
+ * param handle Pointer to crc_dma_handle_t structure.
+ * param buffers Scatter list. The list and the buffers must stay valid until the transfer is completed.
+ * param bufferCount Number of entries in the scatter list.
+ * retval kStatus_Success The transfer has been started.
+ * retval kStatus_Busy The previous transfer is still ongoing.
+ * retval kStatus_InvalidArgument The scatter list holds no data.
+ */
+status_t CRC_WriteDataScatterDMA(CRC_Type *base,
+                                 crc_dma_handle_t *handle,
+                                 const crc_dma_buffer_t *buffers,
+                                 size_t bufferCount)
+{
+    assert(handle != NULL);
+    assert((buffers != NULL) || (0U == bufferCount));
+
+    if (handle->state != (uint8_t)kCRC_DmaStateIdle)
+    {
+        return kStatus_Busy;
+    }
+
+    handle->base             = base;
+    handle->buffers          = buffers;
+    handle->bufferCount      = bufferCount;
+    handle->bufferIndex      = 0U;
+    handle->bufferOffset     = 0U;
+    handle->transferredBytes = 0U;
+    handle->state            = (uint8_t)kCRC_DmaStateBusy;
+
+    if (!CRC_StartBatchDMA(handle))
+    {
+        handle->state = (uint8_t)kCRC_DmaStateIdle;
+        return kStatus_InvalidArgument;
+    }
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Gets the number of bytes fed to the CRC engine by the ongoing transfer.
+ *
+ * param base CRC peripheral base address.
+ * param handle Pointer to crc_dma_handle_t structure.
+ * param count Number of bytes fed so far by the non-blocking transfer.
+ * retval kStatus_Success Get successfully.
+ * retval kStatus_NoTransferInProgress No transfer is in progress.
+ */
+status_t CRC_TransferGetCountDMA(CRC_Type *base, crc_dma_handle_t *handle, size_t *count)
+{
+    assert(handle != NULL);
+    assert(count != NULL);
+
+    if (handle->state == (uint8_t)kCRC_DmaStateIdle)
+    {
+        *count = 0U;
+        return kStatus_NoTransferInProgress;
+    }
+
+    *count = handle->transferredBytes;
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Aborts the ongoing non-blocking transfer.
+ *
+ * param base CRC peripheral base address.
+ * param handle Pointer to crc_dma_handle_t structure.
+ */
+void CRC_TransferAbortDMA(CRC_Type *base, crc_dma_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    if (handle->state != (uint8_t)kCRC_DmaStateIdle)
+    {
+        DMA_AbortTransfer(handle->dmaHandle);
+        handle->state      = (uint8_t)kCRC_DmaStateIdle;
+        handle->batchBytes = 0U;
+    }
+}
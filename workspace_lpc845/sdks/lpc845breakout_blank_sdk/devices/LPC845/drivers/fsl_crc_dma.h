@@ -0,0 +1,170 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef FSL_CRC_DMA_H_
+#define FSL_CRC_DMA_H_
+
+#include "fsl_crc.h"
+#include "fsl_dma.h"
+
+/*!
+ * @addtogroup crc_dma_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*! @{ */
+/*! @brief CRC DMA driver version. */
+#define FSL_CRC_DMA_DRIVER_VERSION (MAKE_VERSION(2, 0, 0))
+/*! @} */
+
+/*! @brief Number of link descriptors chained behind the channel head descriptor.
+ *
+ * One DMA batch covers up to (CRC_DMA_LINK_DESCRIPTOR_COUNT + 1) segments, each segment being at most
+ * DMA_MAX_TRANSFER_COUNT words. Longer transfers are split into several batches by the driver.
+ */
+#ifndef CRC_DMA_LINK_DESCRIPTOR_COUNT
+#define CRC_DMA_LINK_DESCRIPTOR_COUNT (4U)
+#endif
+
+/*! @brief CRC DMA handle typedef. */
+typedef struct _crc_dma_handle crc_dma_handle_t;
+
+/*! @brief CRC DMA transfer callback typedef. */
+typedef void (*crc_dma_transfer_callback_t)(CRC_Type *base, crc_dma_handle_t *handle, status_t status, void *userData);
+
+/*! @brief CRC DMA input buffer, one entry of a scatter list. */
+typedef struct _crc_dma_buffer
+{
+    const uint8_t *data; /*!< Input data, MSByte in data[0]. */
+    size_t dataSize;     /*!< Size of the input data in bytes. */
+} crc_dma_buffer_t;
+
+/*! @brief CRC DMA handle structure. */
+struct _crc_dma_handle
+{
+    CRC_Type *base;                       /*!< CRC peripheral base address. */
+    dma_handle_t *dmaHandle;              /*!< The DMA handle used. */
+    crc_dma_transfer_callback_t callback; /*!< Callback function called after the transfer finished. */
+    void *userData;                       /*!< Callback parameter passed to callback function. */
+    const crc_dma_buffer_t *buffers;      /*!< Scatter list of the current transfer. */
+    size_t bufferCount;                   /*!< Number of entries in the scatter list. */
+    size_t bufferIndex;                   /*!< Scatter list entry the next batch starts from. */
+    size_t bufferOffset;                  /*!< Offset in that entry the next batch starts from. */
+    size_t transferredBytes;              /*!< Bytes fed to the CRC engine by completed batches. */
+    size_t batchBytes;                    /*!< Bytes of the batch in flight. */
+    crc_dma_buffer_t singleBuffer;        /*!< Storage for the single buffer transfer. */
+    volatile uint8_t state;               /*!< Transfer state. */
+};
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus. */
+
+/*!
+ * @name CRC DMA Transactional Operation
+ * @{
+ */
+
+/*!
+ * @brief Initializes the CRC handle which is used in transactional functions.
+ *
+ * The DMA channel is used as a software triggered memory to peripheral channel writing the CRC WR_DATA register.
+ * The DMA module must be initialized and the channel enabled by the application, the DMA handle must be created
+ * with DMA_CreateHandle() before calling this function.
+ *
+ * @param base CRC peripheral base address.
+ * @param handle Pointer to crc_dma_handle_t structure.
+ * @param callback Pointer to user callback function.
+ * @param userData User parameter passed to the callback function.
+ * @param dmaHandle DMA handle pointer.
+ */
+void CRC_TransferCreateHandleDMA(CRC_Type *base,
+                                 crc_dma_handle_t *handle,
+                                 crc_dma_transfer_callback_t callback,
+                                 void *userData,
+                                 dma_handle_t *dmaHandle);
+
+/*!
+ * @brief Writes data to the CRC module using DMA, non-blocking.
+ *
+ * Same data ordering as CRC_WriteData(): the unaligned head and the tail of the buffer are written with 8-bit
+ * transfers, the rest with 32-bit transfers. The callback is invoked once the whole buffer has been fed to the
+ * CRC engine, CRC_Get32bitResult() or CRC_Get16bitResult() can then be used to read the checksum.
+ *
+ * The CRC engine is not reset or re-seeded by this function, so consecutive calls update the checksum
+ * incrementally. The CPU must not access the CRC module until the callback is invoked.
+ *
+ * @param base CRC peripheral base address.
+ * @param handle Pointer to crc_dma_handle_t structure.
+ * @param data Input data stream, MSByte in data[0]. Must stay valid until the transfer is completed.
+ * @param dataSize Size of the input data buffer in bytes.
+ * @retval kStatus_Success The transfer has been started.
+ * @retval kStatus_Busy The previous transfer is still ongoing.
+ * @retval kStatus_InvalidArgument The input buffer is empty.
+ */
+status_t CRC_WriteDataDMA(CRC_Type *base, crc_dma_handle_t *handle, const uint8_t *data, size_t dataSize);
+
+/*!
+ * @brief Writes a scatter list of buffers to the CRC module using DMA, non-blocking.
+ *
+ * The buffers are fed to the CRC engine in order as one continuous data stream, the callback is invoked once
+ * after the last buffer. Empty entries are skipped.
+ *
+ * @param base CRC peripheral base address.
+ * @param handle Pointer to crc_dma_handle_t structure.
+ * @param buffers Scatter list. The list and the buffers must stay valid until the transfer is completed.
+ * @param bufferCount Number of entries in the scatter list.
+ * @retval kStatus_Success The transfer has been started.
+ * @retval kStatus_Busy The previous transfer is still ongoing.
+ * @retval kStatus_InvalidArgument The scatter list holds no data.
+ */
+status_t CRC_WriteDataScatterDMA(CRC_Type *base,
+                                 crc_dma_handle_t *handle,
+                                 const crc_dma_buffer_t *buffers,
+                                 size_t bufferCount);
+
+/*!
+ * @brief Gets the number of bytes fed to the CRC engine by the ongoing transfer.
+ *
+ * The count is updated at DMA batch boundaries.
+ *
+ * @param base CRC peripheral base address.
+ * @param handle Pointer to crc_dma_handle_t structure.
+ * @param count Number of bytes fed so far by the non-blocking transfer.
+ * @retval kStatus_Success Get successfully.
+ * @retval kStatus_NoTransferInProgress No transfer is in progress.
+ */
+status_t CRC_TransferGetCountDMA(CRC_Type *base, crc_dma_handle_t *handle, size_t *count);
+
+/*!
+ * @brief Aborts the ongoing non-blocking transfer.
+ *
+ * The CRC engine keeps the checksum of the data fed before the abort, reseed it before starting a new
+ * computation.
+ *
+ * @param base CRC peripheral base address.
+ * @param handle Pointer to crc_dma_handle_t structure.
+ */
+void CRC_TransferAbortDMA(CRC_Type *base, crc_dma_handle_t *handle);
+
+/*! @} */
+
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus. */
+
+/*! @} */
+
+#endif /* FSL_CRC_DMA_H_ */
@@ -451,6 +451,68 @@ void SCTIMER_UpdatePwmDutycycle(SCT_Type *base, sctimer_out_t output, uint8_t du
     SCTIMER_StartTimer(base, (uint32_t)kSCTIMER_Counter_U);
 }
 
+/*!
+ * brief Updates the duty cycle of an active PWM signal as a Q15 fraction.
+ *
+ * Same as SCTIMER_UpdatePwmPulsePeriod() with the pulse width given as a fraction of the PWM period. The conversion
+ * uses 32-bit multiplications only.
+ *
+ * param base          SCTimer peripheral base address
+ * param event         Event number associated with this PWM signal. This was returned to the user by the
+ *                      function SCTIMER_SetupPwm().
+ * param dutyCycleQ15  New duty cycle, 0 is 0% and 0x8000 is 100%
+ */
+void SCTIMER_UpdatePwmDutycycleQ15(SCT_Type *base, uint32_t event, uint16_t dutyCycleQ15)
+{
+    assert(dutyCycleQ15 <= 0x8000U);
+    assert(1U == (base->CONFIG & SCT_CONFIG_UNIFY_MASK));
+
+    uint32_t period = SCTIMER_GetPwmPeriodValue(base, event);
+    uint32_t pulsePeriod;
+
+    /* For 100% dutycyle, make pulse period greater than period so the event will never occur */
+    if (dutyCycleQ15 >= 0x8000U)
+    {
+        pulsePeriod = period + 2U;
+    }
+    else
+    {
+        /* period * duty >> 15 split in two 32-bit products */
+        pulsePeriod = ((period >> 15U) * dutyCycleQ15) + (((period & 0x7FFFU) * dutyCycleQ15) >> 15U);
+    }
+
+    SCTIMER_UpdatePwmPulsePeriod(base, event, pulsePeriod);
+}
+
+/*!
+ * brief Updates the pulse width of several active PWM signals at once.
+ *
+ * The match reload is held off while the reload registers are written, so all signals switch to their new pulse
+ * width at the same PWM period boundary. The counter keeps running.
+ *
+ * param base    SCTimer peripheral base address
+ * param pulses  New pulse widths, one entry per PWM signal
+ * param count   Number of entries in p pulses
+ */
+void SCTIMER_UpdatePwmPulsePeriods(SCT_Type *base, const sctimer_pwm_pulse_t *pulses, uint32_t count)
+{
+    assert((NULL != pulses) || (0U == count));
+    assert(1U == (base->CONFIG & SCT_CONFIG_UNIFY_MASK));
+
+    uint32_t config = base->CONFIG;
+    uint32_t i;
+
+    /* NORELOAD_L covers the whole match registers when the counter is unified. */
+    base->CONFIG = config | SCT_CONFIG_NORELOAD_L_MASK;
+
+    for (i = 0U; i < count; i++)
+    {
+        SCTIMER_UpdatePwmPulsePeriod(base, pulses[i].event, pulses[i].pulsePeriod);
+    }
+
+    base->CONFIG = config;
+}
+
 /*!
  * brief Create an event that is triggered on a match or IO and schedule in current state.
  *
@@ -23,7 +23,7 @@
 
 /*! @name Driver version */
 /*! @{ */
-#define FSL_SCTIMER_DRIVER_VERSION (MAKE_VERSION(2, 5, 1)) /*!< Version */
+#define FSL_SCTIMER_DRIVER_VERSION (MAKE_VERSION(2, 6, 0)) /*!< Version */
 /*! @} */
 
 #ifndef SCT_EV_STATE_STATEMSKn
@@ -90,6 +90,13 @@ typedef struct _sctimer_pwm_signal_param
                                            100 = always active signal (100% duty cycle).*/
 } sctimer_pwm_signal_param_t;
 
+/*! @brief New pulse width of one PWM signal, see SCTIMER_UpdatePwmPulsePeriods() */
+typedef struct _sctimer_pwm_pulse
+{
+    uint32_t event;       /*!< PWM period event returned by SCTIMER_SetupPwm() */
+    uint32_t pulsePeriod; /*!< Pulse width in counter ticks, a value greater than the PWM period gives 100% */
+} sctimer_pwm_pulse_t;
+
 /*! @brief SCTimer clock mode options */
 typedef enum _sctimer_clock_mode
 {
@@ -400,6 +407,64 @@ status_t SCTIMER_SetupPwm(SCT_Type *base,
  */
 void SCTIMER_UpdatePwmDutycycle(SCT_Type *base, sctimer_out_t output, uint8_t dutyCyclePercent, uint32_t event);
 
+/*!
+ * @brief Gets the period of a PWM signal in counter ticks.
+ *
+ * For an edge-aligned PWM, the signal period is this value plus one, for a center-aligned PWM it is twice this value.
+ *
+ * @param base  SCTimer peripheral base address
+ * @param event Event number associated with this PWM signal. This was returned to the user by the
+ *              function SCTIMER_SetupPwm().
+ *
+ * @return The PWM period match value
+ */
+static inline uint32_t SCTIMER_GetPwmPeriodValue(SCT_Type *base, uint32_t event)
+{
+    return base->MATCHREL[base->EV[event].CTRL & SCT_EV_CTRL_MATCHSEL_MASK];
+}
+
+/*!
+ * @brief Updates the pulse width of an active PWM signal in counter ticks.
+ *
+ * Only the reload register of the pulse match is written: the counter keeps running and the new pulse width takes
+ * effect at the next PWM period boundary, so the signal has no glitch and no phase shift.
+ *
+ * @param base        SCTimer peripheral base address
+ * @param event       Event number associated with this PWM signal. This was returned to the user by the
+ *                    function SCTIMER_SetupPwm().
+ * @param pulsePeriod Pulse width in counter ticks, between 0 and SCTIMER_GetPwmPeriodValue(). A value greater
+ *                    than the PWM period gives a 100% duty cycle.
+ */
+static inline void SCTIMER_UpdatePwmPulsePeriod(SCT_Type *base, uint32_t event, uint32_t pulsePeriod)
+{
+    base->MATCHREL[base->EV[event + 1U].CTRL & SCT_EV_CTRL_MATCHSEL_MASK] = pulsePeriod;
+}
+
+/*!
+ * @brief Updates the duty cycle of an active PWM signal as a Q15 fraction.
+ *
+ * Same as SCTIMER_UpdatePwmPulsePeriod() with the pulse width given as a fraction of the PWM period. The conversion
+ * uses 32-bit multiplications only.
+ *
+ * @param base          SCTimer peripheral base address
+ * @param event         Event number associated with this PWM signal. This was returned to the user by the
+ *                      function SCTIMER_SetupPwm().
+ * @param dutyCycleQ15  New duty cycle, 0 is 0% and 0x8000 is 100%
+ */
+void SCTIMER_UpdatePwmDutycycleQ15(SCT_Type *base, uint32_t event, uint16_t dutyCycleQ15);
+
+/*!
+ * @brief Updates the pulse width of several active PWM signals at once.
+ *
+ * The match reload is held off while the reload registers are written, so all signals switch to their new pulse
+ * width at the same PWM period boundary. The counter keeps running.
+ *
+ * @param base    SCTimer peripheral base address
+ * @param pulses  New pulse widths, one entry per PWM signal
+ * @param count   Number of entries in @p pulses
+ */
+void SCTIMER_UpdatePwmPulsePeriods(SCT_Type *base, const sctimer_pwm_pulse_t *pulses, uint32_t count);
+
 /*!
  * @name Interrupt Interface
  * @{
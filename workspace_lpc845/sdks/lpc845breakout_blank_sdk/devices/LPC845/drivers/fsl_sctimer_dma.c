@@ -0,0 +1,260 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_sctimer_dma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.sctimer_dma"
+#endif
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void SCTIMER_SequencerDMACallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*!
+ * @brief Transfer configuration of one pass over a table.
+ *
+ * 32-bit words go from the incrementing table to the fixed match reload register, the trigger is cleared at the end
+ * of the table so every entry waits for its own period event.
+ */
+static uint32_t SCTIMER_SequencerXferCfg(uint32_t count, bool interrupt)
+{
+    return DMA_CHANNEL_XFER(true, true, interrupt, false, kDMA_Transfer32BitWidth, kDMA_AddressInterleave1xWidth,
+                            kDMA_AddressInterleave0xWidth, count * sizeof(uint32_t));
+}
+
+/*!
+ * brief Initialize the SCTimer DMA sequencer handle.
+ *
+ * param base SCTimer peripheral base address.
+ * param handle SCTimer DMA handle pointer.
+ * param callback User callback function called when a table update took effect, may be NULL.
+ * param userData User data for callback.
+ * param dmaHandle DMA handle pointer, the handle shall be static allocated by users.
+ * param descriptors SCTIMER_DMA_SEQUENCER_DESCRIPTOR_COUNT link descriptors allocated with
+ *                   DMA_ALLOCATE_LINK_DESCRIPTORS(), owned by the sequencer afterwards.
+ * retval kStatus_Success Handle created successfully.
+ */
+status_t SCTIMER_SequencerCreateHandleDMA(SCT_Type *base,
+                                          sctimer_dma_handle_t *handle,
+                                          sctimer_dma_callback_t callback,
+                                          void *userData,
+                                          dma_handle_t *dmaHandle,
+                                          dma_descriptor_t *descriptors)
+{
+    assert((NULL != handle) && (NULL != dmaHandle) && (NULL != descriptors));
+
+    (void)memset(handle, 0, sizeof(*handle));
+
+    handle->base        = base;
+    handle->dmaHandle   = dmaHandle;
+    handle->descriptors = descriptors;
+    handle->callback    = callback;
+    handle->userData    = userData;
+
+    DMA_SetCallback(dmaHandle, SCTIMER_SequencerDMACallback, handle);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Starts playing a pulse width table on a PWM signal.
+ *
+ * param base SCTimer peripheral base address.
+ * param handle SCTimer DMA handle pointer.
+ * param event Event number associated with the PWM signal, returned by SCTIMER_SetupPwm().
+ * param dmaNumber SCTimer DMA request used, 0 or 1.
+ * param table Pulse widths in counter ticks, as for SCTIMER_UpdatePwmPulsePeriod().
+ * param count Number of entries in the table, at most DMA_MAX_TRANSFER_COUNT.
+ * retval kStatus_Success Sequencer started.
+ * retval kStatus_InvalidArgument Input argument is invalid.
+ * retval kStatus_Busy The sequencer is already running.
+ */
+status_t SCTIMER_SequencerStartDMA(SCT_Type *base,
+                                   sctimer_dma_handle_t *handle,
+                                   uint32_t event,
+                                   uint32_t dmaNumber,
+                                   const uint32_t *table,
+                                   uint32_t count)
+{
+    assert(NULL != handle);
+
+    dma_channel_config_t transferConfig;
+    dma_channel_trigger_t trigger;
+    uint32_t xferCfg;
+
+    if ((NULL == table) || (0U == count) || (count > DMA_MAX_TRANSFER_COUNT) || (dmaNumber > 1U) ||
+        ((event + 1U) >= (uint32_t)FSL_FEATURE_SCT_NUMBER_OF_EVENTS))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    if (handle->running)
+    {
+        return kStatus_Busy;
+    }
+
+    handle->event            = event;
+    handle->dmaNumber        = dmaNumber;
+    handle->matchReload      = &base->MATCHREL[base->EV[event + 1U].CTRL & SCT_EV_CTRL_MATCHSEL_MASK];
+    handle->activeDescriptor = 0U;
+    handle->updatePending    = false;
+
+    /* One word per period event. */
+    trigger.type  = kDMA_RisingEdgeTrigger;
+    trigger.burst = kDMA_EdgeBurstTransfer1;
+    trigger.wrap  = kDMA_NoWrap;
+
+    /* The head descriptor plays the table once, then the channel loops on link descriptor 0. */
+    xferCfg = SCTIMER_SequencerXferCfg(count, false);
+    DMA_SetupDescriptor(&handle->descriptors[0], xferCfg, (void *)(uintptr_t)table, (void *)handle->matchReload,
+                        &handle->descriptors[0]);
+    DMA_PrepareChannelTransfer(&transferConfig, (void *)(uintptr_t)table, (void *)handle->matchReload, xferCfg,
+                               kDMA_MemoryToMemory, &trigger, &handle->descriptors[0]);
+    if (kStatus_Success != DMA_SubmitChannelTransfer(handle->dmaHandle, &transferConfig))
+    {
+        return kStatus_Busy;
+    }
+
+    DMA_EnableChannelInterrupts(handle->dmaHandle->base, handle->dmaHandle->channel);
+    handle->running = true;
+    DMA_StartTransfer(handle->dmaHandle);
+
+    SCTIMER_SetupDmaTriggerAction(base, dmaNumber, event);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Sets the next pulse width table of a running sequencer.
+ *
+ * param base SCTimer peripheral base address.
+ * param handle SCTimer DMA handle pointer.
+ * param table Pulse widths in counter ticks.
+ * param count Number of entries in the table, at most DMA_MAX_TRANSFER_COUNT.
+ * retval kStatus_Success Table update queued.
+ * retval kStatus_InvalidArgument Input argument is invalid.
+ * retval kStatus_Fail The sequencer is not running.
+ * retval kStatus_Busy The previous table update has not taken effect yet.
+ */
+status_t SCTIMER_SequencerSetTableDMA(SCT_Type *base,
+                                      sctimer_dma_handle_t *handle,
+                                      const uint32_t *table,
+                                      uint32_t count)
+{
+    assert(NULL != handle);
+
+    dma_descriptor_t *next;
+
+    if ((NULL == table) || (0U == count) || (count > DMA_MAX_TRANSFER_COUNT))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    if (!handle->running)
+    {
+        return kStatus_Fail;
+    }
+
+    if (handle->updatePending)
+    {
+        return kStatus_Busy;
+    }
+
+    /*
+     * The idle descriptor loops on itself with the new table, it interrupts at the end of its first pass to tell the
+     * update took effect. Relinking the active descriptor is a single word write, so the DMA reloads either the old
+     * or the new chain, never a mix of both.
+     */
+    next = &handle->descriptors[1U - handle->activeDescriptor];
+    DMA_SetupDescriptor(next, SCTIMER_SequencerXferCfg(count, true), (void *)(uintptr_t)table,
+                        (void *)handle->matchReload, next);
+
+    handle->updatePending                                        = true;
+    handle->descriptors[handle->activeDescriptor].linkToNextDesc = next;
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Stops the sequencer.
+ *
+ * param base SCTimer peripheral base address.
+ * param handle SCTimer DMA handle pointer.
+ */
+void SCTIMER_SequencerStopDMA(SCT_Type *base, sctimer_dma_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    if (!handle->running)
+    {
+        return;
+    }
+
+    if (handle->dmaNumber == 0U)
+    {
+        base->DMAREQ0 &= ~(1UL << handle->event);
+    }
+    else
+    {
+        base->DMAREQ1 &= ~(1UL << handle->event);
+    }
+
+    DMA_DisableChannelInterrupts(handle->dmaHandle->base, handle->dmaHandle->channel);
+    DMA_AbortTransfer(handle->dmaHandle);
+
+    handle->updatePending = false;
+    handle->running       = false;
+}
+
+static void SCTIMER_SequencerDMACallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode)
+{
+    sctimer_dma_handle_t *sctHandle = (sctimer_dma_handle_t *)userData;
+    uint8_t next;
+
+    if (!sctHandle->running)
+    {
+        return;
+    }
+
+    if (!transferDone)
+    {
+        SCTIMER_SequencerStopDMA(sctHandle->base, sctHandle);
+        if (sctHandle->callback != NULL)
+        {
+            sctHandle->callback(sctHandle->base, sctHandle, kStatus_Fail, sctHandle->userData);
+        }
+        return;
+    }
+
+    if (!sctHandle->updatePending)
+    {
+        return;
+    }
+
+    /* The new table played once, it is the active one and needs no further interrupt. */
+    next = 1U - sctHandle->activeDescriptor;
+    sctHandle->descriptors[next].xfercfg &= ~DMA_CHANNEL_XFERCFG_SETINTA_MASK;
+    sctHandle->activeDescriptor = next;
+    sctHandle->updatePending    = false;
+
+    if (sctHandle->callback != NULL)
+    {
+        sctHandle->callback(sctHandle->base, sctHandle, kStatus_Success, sctHandle->userData);
+    }
+}
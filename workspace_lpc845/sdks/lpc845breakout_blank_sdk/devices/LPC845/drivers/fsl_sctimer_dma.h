@@ -0,0 +1,160 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef FSL_SCTIMER_DMA_H_
+#define FSL_SCTIMER_DMA_H_
+
+#include "fsl_sctimer.h"
+#include "fsl_dma.h"
+
+/*!
+ * @addtogroup sctimer_dma
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*! @{ */
+/*! @brief SCTimer DMA driver version. */
+#define FSL_SCTIMER_DMA_DRIVER_VERSION (MAKE_VERSION(2, 0, 0))
+/*! @} */
+
+/*! @brief Number of link descriptors the application allocates for one sequencer.
+ *
+ * Allocate them with DMA_ALLOCATE_LINK_DESCRIPTORS(name, SCTIMER_DMA_SEQUENCER_DESCRIPTOR_COUNT).
+ */
+#define SCTIMER_DMA_SEQUENCER_DESCRIPTOR_COUNT (2U)
+
+/*! @brief SCTimer DMA sequencer handle typedef. */
+typedef struct _sctimer_dma_handle sctimer_dma_handle_t;
+
+/*! @brief SCTimer DMA callback, called once the table passed to SCTIMER_SequencerSetTableDMA() plays and the
+ * previous table is released. */
+typedef void (*sctimer_dma_callback_t)(SCT_Type *base, sctimer_dma_handle_t *handle, status_t status, void *userData);
+
+/*! @brief SCTimer DMA sequencer handle, users should not touch the content of the handle.*/
+struct _sctimer_dma_handle
+{
+    SCT_Type *base;                  /*!< SCTimer peripheral base address. */
+    dma_handle_t *dmaHandle;         /*!< DMA handle writing the pulse width reload register */
+    dma_descriptor_t *descriptors;   /*!< Two link descriptors, one per table */
+    sctimer_dma_callback_t callback; /*!< Callback for table updates */
+    void *userData;                  /*!< User Data for callback */
+    volatile uint32_t *matchReload;  /*!< Pulse width reload register of the PWM signal */
+    uint32_t event;                  /*!< PWM period event requesting the DMA */
+    uint32_t dmaNumber;              /*!< SCTimer DMA request, 0 or 1 */
+    uint8_t activeDescriptor;        /*!< Link descriptor the DMA loops on */
+    volatile bool updatePending;     /*!< A new table is linked but has not played yet */
+    volatile bool running;           /*!< Sequencer started */
+};
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @name DMA Waveform Sequencer
+ * @{
+ */
+
+/*!
+ * @brief Initialize the SCTimer DMA sequencer handle.
+ *
+ * The sequencer writes a table of pulse widths to the match reload register of a PWM signal created by
+ * SCTIMER_SetupPwm(), one entry per PWM period, so arbitrary duty cycle waveforms play without CPU involvement.
+ *
+ * The DMA channel must be created with DMA_CreateHandle() and enabled with DMA_EnableChannel(), and the SCTimer DMA
+ * request used in SCTIMER_SequencerStartDMA() must be routed to this channel trigger, for example with
+ * INPUTMUX_AttachSignal(INPUTMUX, channel, kINPUTMUX_SctDma0ToDma).
+ *
+ * @param base SCTimer peripheral base address.
+ * @param handle SCTimer DMA handle pointer.
+ * @param callback User callback function called when a table update took effect, may be NULL.
+ * @param userData User data for callback.
+ * @param dmaHandle DMA handle pointer, the handle shall be static allocated by users.
+ * @param descriptors SCTIMER_DMA_SEQUENCER_DESCRIPTOR_COUNT link descriptors allocated with
+ *                    DMA_ALLOCATE_LINK_DESCRIPTORS(), owned by the sequencer afterwards.
+ * @retval kStatus_Success Handle created successfully.
+ */
+status_t SCTIMER_SequencerCreateHandleDMA(SCT_Type *base,
+                                          sctimer_dma_handle_t *handle,
+                                          sctimer_dma_callback_t callback,
+                                          void *userData,
+                                          dma_handle_t *dmaHandle,
+                                          dma_descriptor_t *descriptors);
+
+/*!
+ * @brief Starts playing a pulse width table on a PWM signal.
+ *
+ * Every PWM period event requests one DMA transfer, which writes the next table entry to the match reload register
+ * of the pulse. The SCTimer loads it at the following period boundary, so entry n sets the pulse width of the period
+ * after the next one. The table wraps around until the sequencer is stopped or another table is set.
+ *
+ * @param base SCTimer peripheral base address.
+ * @param handle SCTimer DMA handle pointer.
+ * @param event Event number associated with the PWM signal, returned by SCTIMER_SetupPwm().
+ * @param dmaNumber SCTimer DMA request used, 0 or 1.
+ * @param table Pulse widths in counter ticks, as for SCTIMER_UpdatePwmPulsePeriod(). The table is read by the DMA
+ *              while it plays and must stay valid until it is released.
+ * @param count Number of entries in the table, at most DMA_MAX_TRANSFER_COUNT.
+ * @retval kStatus_Success Sequencer started.
+ * @retval kStatus_InvalidArgument Input argument is invalid.
+ * @retval kStatus_Busy The sequencer is already running.
+ */
+status_t SCTIMER_SequencerStartDMA(SCT_Type *base,
+                                   sctimer_dma_handle_t *handle,
+                                   uint32_t event,
+                                   uint32_t dmaNumber,
+                                   const uint32_t *table,
+                                   uint32_t count);
+
+/*!
+ * @brief Sets the next pulse width table of a running sequencer.
+ *
+ * The new table is linked behind the one playing and starts at a table boundary, the waveform never glitches. The
+ * current table may play once more before the switch. The callback is called with kStatus_Success once the new
+ * table played, from then on the previous table is no longer read and can be refilled for the next update.
+ *
+ * @param base SCTimer peripheral base address.
+ * @param handle SCTimer DMA handle pointer.
+ * @param table Pulse widths in counter ticks.
+ * @param count Number of entries in the table, at most DMA_MAX_TRANSFER_COUNT.
+ * @retval kStatus_Success Table update queued.
+ * @retval kStatus_InvalidArgument Input argument is invalid.
+ * @retval kStatus_Fail The sequencer is not running.
+ * @retval kStatus_Busy The previous table update has not taken effect yet.
+ */
+status_t SCTIMER_SequencerSetTableDMA(SCT_Type *base,
+                                      sctimer_dma_handle_t *handle,
+                                      const uint32_t *table,
+                                      uint32_t count);
+
+/*!
+ * @brief Stops the sequencer.
+ *
+ * The DMA request of the period event is removed and the DMA transfer aborted, the PWM signal keeps the last pulse
+ * width written.
+ *
+ * @param base SCTimer peripheral base address.
+ * @param handle SCTimer DMA handle pointer.
+ */
+void SCTIMER_SequencerStopDMA(SCT_Type *base, sctimer_dma_handle_t *handle);
+
+/*! @} */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @} */
+
+#endif /* FSL_SCTIMER_DMA_H_ */
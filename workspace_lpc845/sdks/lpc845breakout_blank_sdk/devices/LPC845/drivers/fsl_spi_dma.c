@@ -0,0 +1,429 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_spi_dma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.lpc_minispi_dma"
+#endif
+
+/*! @brief Segments of one DMA batch: the channel head descriptor plus the link descriptors. */
+#define SPI_DMA_BATCH_SEGMENTS (SPI_DMA_LINK_DESCRIPTOR_COUNT + 1U)
+
+/*<! @brief One segment of a DMA batch. */
+typedef struct _spi_dma_segment
+{
+    void *src;      /*!< Source start address. */
+    void *dst;      /*!< Destination start address. */
+    uint32_t count; /*!< Number of transfers. */
+    uint8_t width;  /*!< Transfer width in bytes. */
+    uint8_t srcInc; /*!< Source address interleave. */
+    uint8_t dstInc; /*!< Destination address interleave. */
+} spi_dma_segment_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void SPI_TxDMACallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode);
+static void SPI_RxDMACallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/*! @brief TX link descriptors per SPI instance. */
+DMA_ALLOCATE_LINK_DESCRIPTORS(s_spiTxLinkDescriptor[FSL_FEATURE_SOC_SPI_COUNT], SPI_DMA_LINK_DESCRIPTOR_COUNT);
+
+/*! @brief RX link descriptors per SPI instance. */
+DMA_ALLOCATE_LINK_DESCRIPTORS(s_spiRxLinkDescriptor[FSL_FEATURE_SOC_SPI_COUNT], SPI_DMA_LINK_DESCRIPTOR_COUNT);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*!
+ * @brief Chains the segments of a batch and starts the DMA channel.
+ *
+ * The first segment goes to the channel head descriptor, the others to the link descriptors. Only the last segment
+ * clears the trigger and raises the interrupt.
+ */
+static void SPI_SubmitBatchDMA(dma_handle_t *dmaHandle,
+                               dma_descriptor_t *linkDescriptor,
+                               const spi_dma_segment_t *segment,
+                               uint32_t segmentCount)
+{
+    uint32_t xferCfg = 0U;
+    uint32_t i;
+    bool last;
+
+    for (i = segmentCount; i > 0U; i--)
+    {
+        last    = (i == segmentCount);
+        xferCfg = DMA_CHANNEL_XFER(!last, last, last, false, segment[i - 1U].width, segment[i - 1U].srcInc,
+                                   segment[i - 1U].dstInc, segment[i - 1U].count * segment[i - 1U].width);
+        if (i > 1U)
+        {
+            DMA_SetupDescriptor(&linkDescriptor[i - 2U], xferCfg, segment[i - 1U].src, segment[i - 1U].dst,
+                                last ? NULL : &linkDescriptor[i - 1U]);
+        }
+    }
+
+    /* xferCfg holds the head segment configuration after the loop. */
+    DMA_SubmitChannelTransferParameter(dmaHandle, xferCfg, segment[0].src, segment[0].dst,
+                                       (segmentCount > 1U) ? &linkDescriptor[0] : NULL);
+    DMA_StartTransfer(dmaHandle);
+}
+
+/*!
+ * @brief Queues the next TX batch.
+ *
+ * All frames but the last one are written to TXDAT, the last frame is written to TXDATCTL with its control bits.
+ */
+static void SPI_StartTxBatchDMA(spi_dma_handle_t *handle)
+{
+    spi_dma_segment_t segment[SPI_DMA_BATCH_SEGMENTS];
+    uint32_t instance = SPI_GetInstance(handle->base);
+    uint32_t queued   = handle->txFramesDone;
+    uint32_t segmentCount;
+    uint32_t count;
+
+    for (segmentCount = 0U; (segmentCount < SPI_DMA_BATCH_SEGMENTS) && (queued < handle->frameCount); segmentCount++)
+    {
+        if (queued == (handle->frameCount - 1U))
+        {
+            segment[segmentCount].src    = &handle->lastWord;
+            segment[segmentCount].dst    = (void *)(uint32_t)&handle->base->TXDATCTL;
+            segment[segmentCount].count  = 1U;
+            segment[segmentCount].width  = (uint8_t)kDMA_Transfer32BitWidth;
+            segment[segmentCount].srcInc = (uint8_t)kDMA_AddressInterleave0xWidth;
+            count                        = 1U;
+        }
+        else
+        {
+            count = MIN(handle->frameCount - 1U - queued, DMA_MAX_TRANSFER_COUNT);
+            if (handle->txData != NULL)
+            {
+                segment[segmentCount].src    = (void *)(uint32_t)&handle->txData[queued * handle->frameBytes];
+                segment[segmentCount].srcInc = (uint8_t)kDMA_AddressInterleave1xWidth;
+            }
+            else
+            {
+                /* Clock the dummy data out, no TX buffer is read. */
+                segment[segmentCount].src    = (void *)(uint32_t)&s_dummyData[instance];
+                segment[segmentCount].srcInc = (uint8_t)kDMA_AddressInterleave0xWidth;
+            }
+            segment[segmentCount].dst   = (void *)(uint32_t)&handle->base->TXDAT;
+            segment[segmentCount].count = count;
+            segment[segmentCount].width = handle->frameBytes;
+        }
+        segment[segmentCount].dstInc = (uint8_t)kDMA_AddressInterleave0xWidth;
+        queued += count;
+    }
+
+    handle->txBatchFrames = queued - handle->txFramesDone;
+    SPI_SubmitBatchDMA(handle->txHandle, s_spiTxLinkDescriptor[instance], segment, segmentCount);
+}
+
+/*!
+ * @brief Queues the next RX batch.
+ */
+static void SPI_StartRxBatchDMA(spi_dma_handle_t *handle)
+{
+    spi_dma_segment_t segment[SPI_DMA_BATCH_SEGMENTS];
+    uint32_t queued = handle->rxFramesDone;
+    uint32_t segmentCount;
+    uint32_t count;
+
+    for (segmentCount = 0U; (segmentCount < SPI_DMA_BATCH_SEGMENTS) && (queued < handle->frameCount); segmentCount++)
+    {
+        count                        = MIN(handle->frameCount - queued, DMA_MAX_TRANSFER_COUNT);
+        segment[segmentCount].src    = (void *)(uint32_t)&handle->base->RXDAT;
+        segment[segmentCount].dst    = &handle->rxData[queued * handle->frameBytes];
+        segment[segmentCount].count  = count;
+        segment[segmentCount].width  = handle->frameBytes;
+        segment[segmentCount].srcInc = (uint8_t)kDMA_AddressInterleave0xWidth;
+        segment[segmentCount].dstInc = (uint8_t)kDMA_AddressInterleave1xWidth;
+        queued += count;
+    }
+
+    handle->rxBatchFrames = queued - handle->rxFramesDone;
+    SPI_SubmitBatchDMA(handle->rxHandle, s_spiRxLinkDescriptor[SPI_GetInstance(handle->base)], segment, segmentCount);
+}
+
+/*!
+ * @brief Reports the end of the transfer once both directions are done.
+ */
+static void SPI_TransferCompleteDMA(spi_dma_handle_t *handle, status_t status)
+{
+    if ((status == kStatus_Success) && (handle->txInProgress || handle->rxInProgress))
+    {
+        return;
+    }
+
+    if (handle->callback != NULL)
+    {
+        handle->callback(handle->base, handle, status, handle->userData);
+    }
+}
+
+static void SPI_TxDMACallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode)
+{
+    spi_dma_handle_t *spiHandle = (spi_dma_handle_t *)userData;
+
+    if (!spiHandle->txInProgress)
+    {
+        return;
+    }
+
+    if (!transferDone)
+    {
+        SPI_MasterTransferAbortDMA(spiHandle->base, spiHandle);
+        SPI_TransferCompleteDMA(spiHandle, kStatus_SPI_Error);
+        return;
+    }
+
+    spiHandle->txFramesDone += spiHandle->txBatchFrames;
+    spiHandle->txBatchFrames = 0U;
+    if (spiHandle->txFramesDone < spiHandle->frameCount)
+    {
+        SPI_StartTxBatchDMA(spiHandle);
+        return;
+    }
+
+    spiHandle->txInProgress = false;
+    SPI_TransferCompleteDMA(spiHandle, kStatus_Success);
+}
+
+static void SPI_RxDMACallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode)
+{
+    spi_dma_handle_t *spiHandle = (spi_dma_handle_t *)userData;
+
+    if (!spiHandle->rxInProgress)
+    {
+        return;
+    }
+
+    if (!transferDone)
+    {
+        SPI_MasterTransferAbortDMA(spiHandle->base, spiHandle);
+        SPI_TransferCompleteDMA(spiHandle, kStatus_SPI_Error);
+        return;
+    }
+
+    spiHandle->rxFramesDone += spiHandle->rxBatchFrames;
+    spiHandle->rxBatchFrames = 0U;
+    if (spiHandle->rxFramesDone < spiHandle->frameCount)
+    {
+        SPI_StartRxBatchDMA(spiHandle);
+        return;
+    }
+
+    spiHandle->rxInProgress = false;
+    SPI_TransferCompleteDMA(spiHandle, kStatus_Success);
+}
+
+/*!
+ * brief Initialize the SPI master DMA handle.
+ *
+ * param base SPI peripheral base address.
+ * param handle SPI handle pointer.
+ * param callback User callback function called at the end of a transfer.
+ * param userData User data for callback.
+ * param txHandle DMA handle pointer for SPI Tx, the handle shall be static allocated by users.
+ * param rxHandle DMA handle pointer for SPI Rx, the handle shall be static allocated by users.
+ */
+status_t SPI_MasterTransferCreateHandleDMA(SPI_Type *base,
+                                           spi_dma_handle_t *handle,
+                                           spi_dma_callback_t callback,
+                                           void *userData,
+                                           dma_handle_t *txHandle,
+                                           dma_handle_t *rxHandle)
+{
+    assert(NULL != base);
+    assert(NULL != handle);
+    assert(NULL != txHandle);
+
+    /* Zero the handle */
+    (void)memset(handle, 0, sizeof(*handle));
+
+    handle->base     = base;
+    handle->txHandle = txHandle;
+    handle->rxHandle = rxHandle;
+    handle->callback = callback;
+    handle->userData = userData;
+
+    /* The channels are paced by the SPI TXRDY/RXRDY requests. */
+    DMA_SetChannelConfig(txHandle->base, txHandle->channel, NULL, true);
+    DMA_EnableChannelInterrupts(txHandle->base, txHandle->channel);
+    DMA_SetCallback(txHandle, SPI_TxDMACallback, handle);
+
+    if (rxHandle != NULL)
+    {
+        DMA_SetChannelConfig(rxHandle->base, rxHandle->channel, NULL, true);
+        DMA_EnableChannelInterrupts(rxHandle->base, rxHandle->channel);
+        DMA_SetCallback(rxHandle, SPI_RxDMACallback, handle);
+    }
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Perform a non-blocking SPI transfer using DMA.
+ *
+ * param base SPI peripheral base address.
+ * param handle SPI DMA handle pointer.
+ * param xfer Pointer to dma transfer structure.
+ * retval kStatus_Success Successfully start a transfer.
+ * retval kStatus_InvalidArgument Input argument is invalid.
+ * retval kStatus_SPI_Busy SPI is not idle, is running another transfer.
+ */
+status_t SPI_MasterTransferDMA(SPI_Type *base, spi_dma_handle_t *handle, spi_transfer_t *xfer)
+{
+    assert(NULL != base);
+    assert(NULL != handle);
+    assert(NULL != xfer);
+
+    uint32_t txCtrl;
+    uint32_t lastCtrl;
+    uint32_t lastData;
+    uint8_t frameBytes;
+
+    /* Check if the device is busy */
+    if (handle->txInProgress || handle->rxInProgress)
+    {
+        return kStatus_SPI_Busy;
+    }
+
+    /* Read datawidth and ssel info from TXCTL. */
+    txCtrl     = base->TXCTL & (SPI_TXCTL_LEN_MASK | (uint32_t)kSPI_SselDeAssertAll);
+    frameBytes = (((txCtrl & SPI_TXCTL_LEN_MASK) >> SPI_TXCTL_LEN_SHIFT) > (uint32_t)kSPI_Data8Bits) ? 2U : 1U;
+
+    /* Check params */
+    if ((0U == xfer->dataSize) || (0U != (xfer->dataSize % frameBytes)) ||
+        ((NULL == xfer->txData) && (NULL == xfer->rxData)) || ((NULL != xfer->rxData) && (NULL == handle->rxHandle)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* 16-bit frames are moved with 16-bit transfers. */
+    if ((frameBytes > 1U) &&
+        ((0U != ((uint32_t)xfer->txData & 1U)) || (0U != ((uint32_t)xfer->rxData & 1U))))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* Set end of frame and ignore configuration. */
+    txCtrl |= (xfer->configFlags & ((uint32_t)kSPI_EndOfFrame | (uint32_t)kSPI_ReceiveIgnore));
+    if (NULL == xfer->rxData)
+    {
+        /* TX-only, the receiver does not stall the master and no RX DMA is needed. */
+        txCtrl |= (uint32_t)kSPI_ReceiveIgnore;
+    }
+    lastCtrl = txCtrl | (xfer->configFlags & (uint32_t)kSPI_EndOfTransfer);
+
+    handle->txData       = xfer->txData;
+    handle->rxData       = ((txCtrl & (uint32_t)kSPI_ReceiveIgnore) != 0U) ? NULL : xfer->rxData;
+    handle->frameBytes   = frameBytes;
+    handle->frameCount   = (uint32_t)xfer->dataSize / frameBytes;
+    handle->txFramesDone = 0U;
+    handle->rxFramesDone = 0U;
+
+    /* The last frame is written with its control bits, EOT deasserts SSEL after it. */
+    if (NULL != xfer->txData)
+    {
+        lastData = xfer->txData[xfer->dataSize - frameBytes];
+        if (frameBytes > 1U)
+        {
+            lastData |= ((uint32_t)xfer->txData[xfer->dataSize - 1U]) << 8U;
+        }
+    }
+    else
+    {
+        lastData = (uint32_t)s_dummyData[SPI_GetInstance(base)];
+    }
+    handle->lastWord = lastData | lastCtrl;
+
+    SPI_WriteConfigFlags(base, txCtrl);
+
+    handle->txInProgress = true;
+    handle->rxInProgress = (NULL != handle->rxData);
+
+    /* Arm the receiver first so no frame is missed. */
+    if (handle->rxInProgress)
+    {
+        SPI_StartRxBatchDMA(handle);
+    }
+    SPI_StartTxBatchDMA(handle);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Abort a SPI transfer using DMA.
+ *
+ * param base SPI peripheral base address.
+ * param handle SPI DMA handle pointer.
+ */
+void SPI_MasterTransferAbortDMA(SPI_Type *base, spi_dma_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    if (handle->txInProgress)
+    {
+        DMA_AbortTransfer(handle->txHandle);
+    }
+    if (handle->rxInProgress)
+    {
+        DMA_AbortTransfer(handle->rxHandle);
+    }
+
+    handle->txInProgress = false;
+    handle->rxInProgress = false;
+}
+
+/*!
+ * brief Gets the master DMA transfer remaining bytes.
+ *
+ * param base SPI peripheral base address.
+ * param handle A pointer to the spi_dma_handle_t structure which stores the transfer state.
+ * param count A number of bytes transferred by the non-blocking transaction.
+ * return status of status_t.
+ */
+status_t SPI_MasterTransferGetCountDMA(SPI_Type *base, spi_dma_handle_t *handle, size_t *count)
+{
+    assert(NULL != handle);
+
+    if (NULL == count)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* Catch when there is not an active transfer. */
+    if ((!handle->txInProgress) && (!handle->rxInProgress))
+    {
+        *count = 0;
+        return kStatus_NoTransferInProgress;
+    }
+
+    /* The receiver lags behind the transmitter, count what has been received when receiving. */
+    if (NULL != handle->rxData)
+    {
+        *count = (size_t)handle->rxFramesDone * handle->frameBytes;
+    }
+    else
+    {
+        *count = (size_t)handle->txFramesDone * handle->frameBytes;
+    }
+
+    return kStatus_Success;
+}
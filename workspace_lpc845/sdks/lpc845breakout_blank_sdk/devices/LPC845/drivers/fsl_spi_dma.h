@@ -0,0 +1,214 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef FSL_SPI_DMA_H_
+#define FSL_SPI_DMA_H_
+
+#include "fsl_spi.h"
+#include "fsl_dma.h"
+
+/*!
+ * @addtogroup spi_dma_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*! @{ */
+/*! @brief SPI DMA driver version. */
+#define FSL_SPI_DMA_DRIVER_VERSION (MAKE_VERSION(2, 0, 0))
+/*! @} */
+
+/*! @brief Number of link descriptors per direction and SPI instance.
+ *
+ * One DMA batch moves up to (SPI_DMA_LINK_DESCRIPTOR_COUNT + 1) * DMA_MAX_TRANSFER_COUNT frames, longer transfers
+ * are split into several batches by the driver.
+ */
+#ifndef SPI_DMA_LINK_DESCRIPTOR_COUNT
+#define SPI_DMA_LINK_DESCRIPTOR_COUNT (2U)
+#endif
+
+/*! @brief SPI DMA handle typedef. */
+typedef struct _spi_dma_handle spi_dma_handle_t;
+
+/*! @brief SPI DMA callback called at the end of transfer. */
+typedef void (*spi_dma_callback_t)(SPI_Type *base, spi_dma_handle_t *handle, status_t status, void *userData);
+
+/*! @brief SPI DMA transfer handle, users should not touch the content of the handle.*/
+struct _spi_dma_handle
+{
+    SPI_Type *base;              /*!< SPI peripheral base address. */
+    dma_handle_t *txHandle;      /*!< DMA handler for SPI send */
+    dma_handle_t *rxHandle;      /*!< DMA handler for SPI receive */
+    spi_dma_callback_t callback; /*!< Callback for SPI DMA transfer */
+    void *userData;              /*!< User Data for SPI DMA callback */
+    const uint8_t *txData;       /*!< Send buffer, NULL to send the dummy data */
+    uint8_t *rxData;             /*!< Receive buffer, NULL to ignore the received data */
+    uint32_t frameCount;         /*!< Number of frames of the transfer */
+    uint32_t txFramesDone;       /*!< Frames sent by completed TX batches */
+    uint32_t rxFramesDone;       /*!< Frames received by completed RX batches */
+    uint32_t txBatchFrames;      /*!< Frames of the TX batch in flight */
+    uint32_t rxBatchFrames;      /*!< Frames of the RX batch in flight */
+    uint32_t lastWord;           /*!< Last frame with its control bits, written to TXDATCTL */
+    uint8_t frameBytes;          /*!< Bytes per frame, 1 or 2 */
+    volatile bool txInProgress;  /*!< Send transfer in progress */
+    volatile bool rxInProgress;  /*!< Receive transfer in progress */
+};
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @name DMA Transactional
+ * @{
+ */
+
+/*!
+ * @brief Initialize the SPI master DMA handle.
+ *
+ * This function initializes the SPI master DMA handle which can be used for other SPI master transactional APIs.
+ * Usually, for a specified SPI instance, user need only call this API once to get the initialized handle.
+ * The DMA channels must be the channels serving the SPI requests, created with DMA_CreateHandle() and enabled with
+ * DMA_EnableChannel().
+ *
+ * @param base SPI peripheral base address.
+ * @param handle SPI handle pointer.
+ * @param callback User callback function called at the end of a transfer.
+ * @param userData User data for callback.
+ * @param txHandle DMA handle pointer for SPI Tx, the handle shall be static allocated by users.
+ * @param rxHandle DMA handle pointer for SPI Rx, the handle shall be static allocated by users. May be NULL when
+ *                 only TX-only transfers are used.
+ * @retval kStatus_Success Handle created successfully.
+ */
+status_t SPI_MasterTransferCreateHandleDMA(SPI_Type *base,
+                                           spi_dma_handle_t *handle,
+                                           spi_dma_callback_t callback,
+                                           void *userData,
+                                           dma_handle_t *txHandle,
+                                           dma_handle_t *rxHandle);
+
+/*!
+ * @brief Perform a non-blocking SPI transfer using DMA.
+ *
+ * The frame data goes to TXDAT through chained DMA descriptors, the last frame is written to TXDATCTL together with
+ * the slave select, frame length and end of transfer control bits, so kSPI_EndOfTransfer deasserts SSEL without CPU
+ * involvement.
+ *
+ * - Full-duplex: both txData and rxData are set.
+ * - TX-only: rxData is NULL, kSPI_ReceiveIgnore is applied so no RX DMA is used and no data is read back.
+ * - RX-only: txData is NULL, the dummy data set by SPI_SetDummyData() is clocked out without any TX buffer.
+ *
+ * @note This interface returned immediately after transfer initiates, users should call
+ * SPI_MasterTransferGetCountDMA to poll the transfer status to check whether SPI transfer finished.
+ *
+ * @param base SPI peripheral base address.
+ * @param handle SPI DMA handle pointer.
+ * @param xfer Pointer to dma transfer structure.
+ * @retval kStatus_Success Successfully start a transfer.
+ * @retval kStatus_InvalidArgument Input argument is invalid.
+ * @retval kStatus_SPI_Busy SPI is not idle, is running another transfer.
+ */
+status_t SPI_MasterTransferDMA(SPI_Type *base, spi_dma_handle_t *handle, spi_transfer_t *xfer);
+
+/*!
+ * @brief Initialize the SPI slave DMA handle.
+ *
+ * @param base SPI peripheral base address.
+ * @param handle SPI handle pointer.
+ * @param callback User callback function called at the end of a transfer.
+ * @param userData User data for callback.
+ * @param txHandle DMA handle pointer for SPI Tx, the handle shall be static allocated by users.
+ * @param rxHandle DMA handle pointer for SPI Rx, the handle shall be static allocated by users.
+ * @retval kStatus_Success Handle created successfully.
+ */
+static inline status_t SPI_SlaveTransferCreateHandleDMA(SPI_Type *base,
+                                                        spi_dma_handle_t *handle,
+                                                        spi_dma_callback_t callback,
+                                                        void *userData,
+                                                        dma_handle_t *txHandle,
+                                                        dma_handle_t *rxHandle)
+{
+    return SPI_MasterTransferCreateHandleDMA(base, handle, callback, userData, txHandle, rxHandle);
+}
+
+/*!
+ * @brief Perform a non-blocking SPI transfer using DMA.
+ *
+ * @note In slave mode, a transfer longer than one DMA batch may overrun the receiver while the driver queues the
+ * next batch, keep slave transfers within (SPI_DMA_LINK_DESCRIPTOR_COUNT + 1) * DMA_MAX_TRANSFER_COUNT frames.
+ *
+ * @param base SPI peripheral base address.
+ * @param handle SPI DMA handle pointer.
+ * @param xfer Pointer to dma transfer structure.
+ * @retval kStatus_Success Successfully start a transfer.
+ * @retval kStatus_InvalidArgument Input argument is invalid.
+ * @retval kStatus_SPI_Busy SPI is not idle, is running another transfer.
+ */
+static inline status_t SPI_SlaveTransferDMA(SPI_Type *base, spi_dma_handle_t *handle, spi_transfer_t *xfer)
+{
+    return SPI_MasterTransferDMA(base, handle, xfer);
+}
+
+/*!
+ * @brief Abort a SPI transfer using DMA.
+ *
+ * @param base SPI peripheral base address.
+ * @param handle SPI DMA handle pointer.
+ */
+void SPI_MasterTransferAbortDMA(SPI_Type *base, spi_dma_handle_t *handle);
+
+/*!
+ * @brief Gets the master DMA transfer remaining bytes.
+ *
+ * The count is updated at DMA batch boundaries.
+ *
+ * @param base SPI peripheral base address.
+ * @param handle A pointer to the spi_dma_handle_t structure which stores the transfer state.
+ * @param count A number of bytes transferred by the non-blocking transaction.
+ * @return status of status_t.
+ */
+status_t SPI_MasterTransferGetCountDMA(SPI_Type *base, spi_dma_handle_t *handle, size_t *count);
+
+/*!
+ * @brief Abort a SPI transfer using DMA.
+ *
+ * @param base SPI peripheral base address.
+ * @param handle SPI DMA handle pointer.
+ */
+static inline void SPI_SlaveTransferAbortDMA(SPI_Type *base, spi_dma_handle_t *handle)
+{
+    SPI_MasterTransferAbortDMA(base, handle);
+}
+
+/*!
+ * @brief Gets the slave DMA transfer remaining bytes.
+ *
+ * @param base SPI peripheral base address.
+ * @param handle A pointer to the spi_dma_handle_t structure which stores the transfer state.
+ * @param count A number of bytes transferred by the non-blocking transaction.
+ * @return status of status_t.
+ */
+static inline status_t SPI_SlaveTransferGetCountDMA(SPI_Type *base, spi_dma_handle_t *handle, size_t *count)
+{
+    return SPI_MasterTransferGetCountDMA(base, handle, count);
+}
+
+/*! @} */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @} */
+
+#endif /* FSL_SPI_DMA_H_ */
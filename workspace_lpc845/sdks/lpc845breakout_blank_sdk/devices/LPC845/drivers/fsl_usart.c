@@ -152,6 +152,7 @@ void USART_TransferStartRingBuffer(USART_Type *base, usart_handle_t *handle, uin
     handle->rxRingBufferSize = ringBufferSize;
     handle->rxRingBufferHead = 0U;
     handle->rxRingBufferTail = 0U;
+    (void)memset(&handle->rxOverrunCount, 0, sizeof(handle->rxOverrunCount));
 
     /* Start receive data read interrupt and reveive overrun interrupt. */
     USART_EnableInterrupts(base,
@@ -183,6 +184,126 @@ void USART_TransferStopRingBuffer(USART_Type *base, usart_handle_t *handle)
     handle->rxRingBufferHead = 0U;
     handle->rxRingBufferTail = 0U;
 }
+
+/*!
+ * brief Gets the received data in the RX ring buffer without copying it.
+ *
+ * The unread data is returned as at most two contiguous spans: span[0] from the read position up to the end of the
+ * ring buffer, and span[1] from the start of the ring buffer when the data wraps around. The data stays in the ring
+ * buffer until it is released with USART_TransferCommitRxRingBuffer(), so a parser can work on it in place.
+ *
+ * param handle USART handle pointer.
+ * param span Array of two spans filled by the function.
+ * return Total number of bytes in the spans.
+ */
+size_t USART_TransferPeekRxRingBuffer(usart_handle_t *handle, usart_ring_buffer_span_t span[2])
+{
+    /* Check arguments */
+    assert(NULL != handle);
+    assert(NULL != span);
+
+    /* Read the head once, the IRQ handler may move it meanwhile. */
+    uint16_t tmprxRingBufferTail = handle->rxRingBufferTail;
+    uint16_t tmprxRingBufferHead = handle->rxRingBufferHead;
+
+    span[0].data   = &handle->rxRingBuffer[tmprxRingBufferTail];
+    span[1].data   = handle->rxRingBuffer;
+    span[1].length = 0U;
+
+    if (tmprxRingBufferTail > tmprxRingBufferHead)
+    {
+        span[0].length = handle->rxRingBufferSize - (size_t)tmprxRingBufferTail;
+        span[1].length = (size_t)tmprxRingBufferHead;
+    }
+    else
+    {
+        span[0].length = (size_t)tmprxRingBufferHead - (size_t)tmprxRingBufferTail;
+    }
+
+    return span[0].length + span[1].length;
+}
+
+/*!
+ * brief Releases data from the RX ring buffer.
+ *
+ * Releases the oldest p length bytes of the ring buffer, usually after processing the spans returned by
+ * USART_TransferPeekRxRingBuffer(). The length is limited to the data in the ring buffer, which may be smaller than
+ * the peeked data after an overflow with the kUSART_RingBufferOverwriteOldest policy.
+ *
+ * param base USART peripheral base address.
+ * param handle USART handle pointer.
+ * param length Number of bytes to release.
+ * return Number of bytes released.
+ */
+size_t USART_TransferCommitRxRingBuffer(USART_Type *base, usart_handle_t *handle, size_t length)
+{
+    size_t tail;
+
+    /* Check arguments */
+    assert(NULL != base);
+    assert(NULL != handle);
+    assert(NULL != handle->rxRingBuffer);
+
+    /* The IRQ handler moves the tail when it overwrites the oldest data. */
+    USART_DisableInterrupts(base, (uint32_t)kUSART_RxReadyInterruptEnable);
+
+    length = MIN(length, USART_TransferGetRxRingBufferLength(handle));
+    tail   = (size_t)handle->rxRingBufferTail + length;
+    /* Wrap to 0. Not use modulo (%) because it might be large and slow. */
+    if (tail >= handle->rxRingBufferSize)
+    {
+        tail -= handle->rxRingBufferSize;
+    }
+    handle->rxRingBufferTail = (uint16_t)tail;
+
+    USART_EnableInterrupts(base, (uint32_t)kUSART_RxReadyInterruptEnable);
+
+    return length;
+}
+
+/*!
+ * brief Sets the RX ring buffer watermark.
+ *
+ * When a received byte brings the ring buffer length to p watermark, the callback is called with
+ * kStatus_USART_RxRingBufferWatermark from the IRQ handler. The callback is called again the next time the length
+ * reaches the watermark, so the ring buffer must be drained below the watermark to re-arm it.
+ *
+ * param handle USART handle pointer.
+ * param watermark Number of bytes, 0 to disable the watermark. Must be smaller than the ring buffer size.
+ */
+void USART_TransferSetRxRingBufferWatermark(usart_handle_t *handle, size_t watermark)
+{
+    assert(NULL != handle);
+
+    handle->rxRingBufferWatermark = watermark;
+}
+
+/*!
+ * brief Sets what the RX ring buffer does when it overflows.
+ *
+ * param handle USART handle pointer.
+ * param overflow Overflow policy.
+ */
+void USART_TransferSetRxRingBufferOverflow(usart_handle_t *handle, usart_ring_buffer_overflow_t overflow)
+{
+    assert(NULL != handle);
+
+    handle->rxRingBufferOverflow = (uint8_t)overflow;
+}
+
+/*!
+ * brief Gets the RX overrun counters.
+ *
+ * param handle USART handle pointer.
+ * param count Pointer to the structure to store the counters.
+ */
+void USART_TransferGetRxOverrunCount(usart_handle_t *handle, usart_rx_overrun_count_t *count)
+{
+    assert(NULL != handle);
+    assert(NULL != count);
+
+    *count = handle->rxOverrunCount;
+}
 #endif /* FSL_SDK_ENABLE_USART_DRIVER_TRANSACTIONAL_APIS */
 
 /*!
@@ -894,12 +1015,14 @@ void USART_TransferHandleIRQ(USART_Type *base, usart_handle_t *handle)
     bool sendEnabled    = (handle->txDataSize != 0U);
     uint32_t status     = USART_GetStatusFlags(base);
     uint8_t tmpdata     = (uint8_t)base->RXDAT;
+    bool storeData      = true;
 
     /* If RX overrun. */
     if (((uint32_t)kUSART_HardwareOverrunFlag & status) != 0U)
     {
         /* Clear rx error state. */
         base->STAT |= USART_STAT_OVERRUNINT_MASK;
+        handle->rxOverrunCount.hardware++;
         /* Trigger callback. */
         if (handle->callback != NULL)
         {
@@ -955,11 +1078,17 @@ void USART_TransferHandleIRQ(USART_Type *base, usart_handle_t *handle)
                         handle->callback(base, handle, kStatus_USART_RxRingBufferOverrun, handle->userData);
                     }
                 }
-                /* If ring buffer is still full after callback function, the oldest data is overridden. */
+                /* If ring buffer is still full after callback function, one byte is lost. */
                 if (USART_TransferIsRxRingBufferFull(handle))
                 {
+                    handle->rxOverrunCount.ringBuffer++;
+                    if (handle->rxRingBufferOverflow == (uint8_t)kUSART_RingBufferDropNewest)
+                    {
+                        /* Keep the buffered data, the new byte is discarded. */
+                        storeData = false;
+                    }
                     /* Increase handle->rxRingBufferTail to make room for new data. */
-                    if ((size_t)handle->rxRingBufferTail + 1U == handle->rxRingBufferSize)
+                    else if ((size_t)handle->rxRingBufferTail + 1U == handle->rxRingBufferSize)
                     {
                         handle->rxRingBufferTail = 0U;
                     }
@@ -969,16 +1098,26 @@ void USART_TransferHandleIRQ(USART_Type *base, usart_handle_t *handle)
                     }
                 }
 
-                handle->rxRingBuffer[handle->rxRingBufferHead] = tmpdata;
-
-                /* Increase handle->rxRingBufferHead. */
-                if ((size_t)handle->rxRingBufferHead + 1U == handle->rxRingBufferSize)
+                if (storeData)
                 {
-                    handle->rxRingBufferHead = 0U;
-                }
-                else
-                {
-                    handle->rxRingBufferHead++;
+                    handle->rxRingBuffer[handle->rxRingBufferHead] = tmpdata;
+
+                    /* Increase handle->rxRingBufferHead. */
+                    if ((size_t)handle->rxRingBufferHead + 1U == handle->rxRingBufferSize)
+                    {
+                        handle->rxRingBufferHead = 0U;
+                    }
+                    else
+                    {
+                        handle->rxRingBufferHead++;
+                    }
+
+                    /* Notify once each time the ring buffer length reaches the watermark. */
+                    if ((handle->rxRingBufferWatermark != 0U) && (handle->callback != NULL) &&
+                        (USART_TransferGetRxRingBufferLength(handle) == handle->rxRingBufferWatermark))
+                    {
+                        handle->callback(base, handle, kStatus_USART_RxRingBufferWatermark, handle->userData);
+                    }
                 }
             }
         }
@@ -21,7 +21,7 @@
 /*! @name Driver version */
 /*! @{ */
 /*! @brief USART driver version. */
-#define FSL_USART_DRIVER_VERSION (MAKE_VERSION(2, 5, 1))
+#define FSL_USART_DRIVER_VERSION (MAKE_VERSION(2, 6, 0))
 /*! @} */
 
 /*! @brief Macro gate for enable transaction API.  1 for enable, 0 for disable. */
@@ -88,6 +88,8 @@ enum
 #if defined(FSL_FEATURE_USART_HAS_RXIDLETO_CHECK) && FSL_FEATURE_USART_HAS_RXIDLETO_CHECK
     kStatus_USART_RxIdleTimeout = MAKE_STATUS(kStatusGroup_LPC_USART, 13), /*!< USART receive idle times out. */
 #endif
+    kStatus_USART_RxRingBufferWatermark =
+        MAKE_STATUS(kStatusGroup_LPC_USART, 14), /*!< RX ring buffer holds the watermark number of bytes. */
 };
 
 /*! @brief USART parity mode. */
@@ -230,6 +232,27 @@ typedef struct _usart_transfer
     size_t dataSize; /*!< The byte count to be transfer. */
 } usart_transfer_t;
 
+/*! @brief RX ring buffer behavior when a byte is received while the ring buffer is full. */
+typedef enum _usart_ring_buffer_overflow
+{
+    kUSART_RingBufferOverwriteOldest = 0x0U, /*!< Discard the oldest byte to store the new one. */
+    kUSART_RingBufferDropNewest      = 0x1U, /*!< Discard the new byte, the buffered data is left untouched. */
+} usart_ring_buffer_overflow_t;
+
+/*! @brief Contiguous span of the RX ring buffer. */
+typedef struct _usart_ring_buffer_span
+{
+    const uint8_t *data; /*!< Start of the span in the ring buffer. */
+    size_t length;       /*!< Number of bytes in the span, 0 if empty. */
+} usart_ring_buffer_span_t;
+
+/*! @brief RX overrun counters. */
+typedef struct _usart_rx_overrun_count
+{
+    uint32_t ringBuffer; /*!< Bytes lost because the RX ring buffer was full. */
+    uint32_t hardware;   /*!< Hardware receiver overruns. */
+} usart_rx_overrun_count_t;
+
 /* Forward declaration of the handle typedef. */
 typedef struct _usart_handle usart_handle_t;
 
@@ -246,10 +269,13 @@ struct _usart_handle
     volatile size_t rxDataSize;     /*!< Size of the remaining data to receive. */
     size_t rxDataSizeAll;           /*!< Size of the data to receive. */
 
-    uint8_t *rxRingBuffer;              /*!< Start address of the receiver ring buffer. */
-    size_t rxRingBufferSize;            /*!< Size of the ring buffer. */
-    volatile uint16_t rxRingBufferHead; /*!< Index for the driver to store received data into ring buffer. */
-    volatile uint16_t rxRingBufferTail; /*!< Index for the user to get data from the ring buffer. */
+    uint8_t *rxRingBuffer;                   /*!< Start address of the receiver ring buffer. */
+    size_t rxRingBufferSize;                 /*!< Size of the ring buffer. */
+    volatile uint16_t rxRingBufferHead;      /*!< Index for the driver to store received data into ring buffer. */
+    volatile uint16_t rxRingBufferTail;      /*!< Index for the user to get data from the ring buffer. */
+    size_t rxRingBufferWatermark;            /*!< Ring buffer length reporting kStatus_USART_RxRingBufferWatermark. */
+    uint8_t rxRingBufferOverflow;            /*!< Ring buffer overflow policy, see usart_ring_buffer_overflow_t. */
+    usart_rx_overrun_count_t rxOverrunCount; /*!< RX overrun counters. */
 
     usart_transfer_callback_t callback; /*!< Callback function. */
     void *userData;                     /*!< USART callback function parameter.*/
@@ -720,6 +746,70 @@ void USART_TransferStopRingBuffer(USART_Type *base, usart_handle_t *handle);
  */
 size_t USART_TransferGetRxRingBufferLength(usart_handle_t *handle);
 
+/*!
+ * @brief Gets the received data in the RX ring buffer without copying it.
+ *
+ * The unread data is returned as at most two contiguous spans: span[0] from the read position up to the end of the
+ * ring buffer, and span[1] from the start of the ring buffer when the data wraps around. The data stays in the ring
+ * buffer until it is released with USART_TransferCommitRxRingBuffer(), so a parser can work on it in place.
+ *
+ * @note With the kUSART_RingBufferOverwriteOldest policy, a ring buffer overflow overwrites the oldest data, which
+ * may be data already returned by this function. Use kUSART_RingBufferDropNewest to keep the spans stable.
+ *
+ * @param handle USART handle pointer.
+ * @param span Array of two spans filled by the function.
+ * @return Total number of bytes in the spans.
+ */
+size_t USART_TransferPeekRxRingBuffer(usart_handle_t *handle, usart_ring_buffer_span_t span[2]);
+
+/*!
+ * @brief Releases data from the RX ring buffer.
+ *
+ * Releases the oldest @p length bytes of the ring buffer, usually after processing the spans returned by
+ * USART_TransferPeekRxRingBuffer(). The length is limited to the data in the ring buffer, which may be smaller than
+ * the peeked data after an overflow with the kUSART_RingBufferOverwriteOldest policy.
+ *
+ * @param base USART peripheral base address.
+ * @param handle USART handle pointer.
+ * @param length Number of bytes to release.
+ * @return Number of bytes released.
+ */
+size_t USART_TransferCommitRxRingBuffer(USART_Type *base, usart_handle_t *handle, size_t length);
+
+/*!
+ * @brief Sets the RX ring buffer watermark.
+ *
+ * When a received byte brings the ring buffer length to @p watermark, the callback is called with
+ * kStatus_USART_RxRingBufferWatermark from the IRQ handler. The callback is called again the next time the length
+ * reaches the watermark, so the ring buffer must be drained below the watermark to re-arm it.
+ *
+ * @param handle USART handle pointer.
+ * @param watermark Number of bytes, 0 to disable the watermark. Must be smaller than the ring buffer size.
+ */
+void USART_TransferSetRxRingBufferWatermark(usart_handle_t *handle, size_t watermark);
+
+/*!
+ * @brief Sets what the RX ring buffer does when it overflows.
+ *
+ * The default policy is kUSART_RingBufferOverwriteOldest. Either way, the callback is called with
+ * kStatus_USART_RxRingBufferOverrun before the byte is stored and the lost byte is counted, see
+ * USART_TransferGetRxOverrunCount().
+ *
+ * @param handle USART handle pointer.
+ * @param overflow Overflow policy.
+ */
+void USART_TransferSetRxRingBufferOverflow(usart_handle_t *handle, usart_ring_buffer_overflow_t overflow);
+
+/*!
+ * @brief Gets the RX overrun counters.
+ *
+ * The counters are cleared by USART_TransferCreateHandle() and USART_TransferStartRingBuffer(), and wrap around.
+ *
+ * @param handle USART handle pointer.
+ * @param count Pointer to the structure to store the counters.
+ */
+void USART_TransferGetRxOverrunCount(usart_handle_t *handle, usart_rx_overrun_count_t *count);
+
 /*!
  * @brief Aborts the interrupt-driven data transmit.
  *
@@ -0,0 +1,705 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_usart_dma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.lpc_miniusart_dma"
+#endif
+
+/*! @brief Ring buffer halves the receive positions are counted over. A power of two, so the positions stay consistent
+ * when the DMA half count wraps, and four laps of the ring buffer, so a reader the DMA has lapped is told from one
+ * that is up to date. */
+#define USART_DMA_RX_RING_POSITION_HALVES (8U)
+
+/*<! @brief USART DMA transfer state. */
+enum
+{
+    kUSART_TxIdle,       /* TX idle. */
+    kUSART_TxBusy,       /* TX busy. */
+    kUSART_RxIdle,       /* RX idle. */
+    kUSART_RxBusy,       /* RX busy. */
+    kUSART_RxRingBuffer, /* RX circular reception into the ring buffer. */
+};
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void USART_TransferSendDMACallback(dma_handle_t *handle, void *param, bool transferDone, uint32_t intmode);
+static void USART_TransferReceiveDMACallback(dma_handle_t *handle, void *param, bool transferDone, uint32_t intmode);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/*! @brief TX link descriptors chained behind the channel head descriptor, per USART instance. */
+DMA_ALLOCATE_LINK_DESCRIPTORS(s_usartTxLinkDescriptor[FSL_FEATURE_SOC_USART_COUNT],
+                              USART_DMA_TX_LINK_DESCRIPTOR_COUNT);
+
+/*! @brief RX ping-pong descriptors of the ring buffer reception, per USART instance. */
+DMA_ALLOCATE_LINK_DESCRIPTORS(s_usartRxRingDescriptor[FSL_FEATURE_SOC_USART_COUNT], 2U);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*!
+ * @brief Prepares and starts the next TX batch.
+ *
+ * Up to USART_DMA_TX_LINK_DESCRIPTOR_COUNT + 1 descriptors of DMA_MAX_TRANSFER_COUNT bytes are chained, only the
+ * last one raises the interrupt.
+ */
+static void USART_StartSendBatchDMA(usart_dma_handle_t *handle)
+{
+    dma_descriptor_t *linkDescriptor = s_usartTxLinkDescriptor[USART_GetInstance(handle->base)];
+    const uint8_t *data              = &handle->txData[handle->txDataSent];
+    void *txdat                      = (void *)(uint32_t)&handle->base->TXDAT;
+    size_t remaining                 = handle->txDataSizeAll - handle->txDataSent;
+    uint32_t xferCfg                 = 0U;
+    uint32_t segmentCount;
+    uint32_t bytes;
+    uint32_t i;
+    bool last;
+
+    segmentCount = (uint32_t)((remaining + DMA_MAX_TRANSFER_COUNT - 1U) / DMA_MAX_TRANSFER_COUNT);
+    if (segmentCount > (USART_DMA_TX_LINK_DESCRIPTOR_COUNT + 1U))
+    {
+        segmentCount = USART_DMA_TX_LINK_DESCRIPTOR_COUNT + 1U;
+    }
+
+    handle->txBatchBytes = MIN(remaining, (size_t)segmentCount * DMA_MAX_TRANSFER_COUNT);
+
+    /* Link descriptors from the tail, the last segment clears the trigger and raises the interrupt. */
+    for (i = segmentCount; i > 0U; i--)
+    {
+        last    = (i == segmentCount);
+        bytes   = last ? (uint32_t)(handle->txBatchBytes - (i - 1U) * DMA_MAX_TRANSFER_COUNT) : DMA_MAX_TRANSFER_COUNT;
+        xferCfg = DMA_CHANNEL_XFER(!last, last, last, false, (uint8_t)kDMA_Transfer8BitWidth,
+                                   (uint8_t)kDMA_AddressInterleave1xWidth, (uint8_t)kDMA_AddressInterleave0xWidth, bytes);
+        if (i > 1U)
+        {
+            DMA_SetupDescriptor(&linkDescriptor[i - 2U], xferCfg,
+                                (void *)(uint32_t)&data[(i - 1U) * DMA_MAX_TRANSFER_COUNT], txdat,
+                                last ? NULL : &linkDescriptor[i - 1U]);
+        }
+    }
+
+    /* The head segment goes to the channel descriptor, xferCfg holds its configuration after the loop. */
+    DMA_SubmitChannelTransferParameter(handle->txDmaHandle, xferCfg, (void *)(uint32_t)data, txdat,
+                                       (segmentCount > 1U) ? &linkDescriptor[0] : NULL);
+    DMA_StartTransfer(handle->txDmaHandle);
+}
+
+/*!
+ * @brief Prepares and starts the next RX batch, a single descriptor so the received count is exact.
+ */
+static void USART_StartReceiveBatchDMA(usart_dma_handle_t *handle)
+{
+    size_t remaining = handle->rxDataSizeAll - handle->rxDataReceived;
+
+    handle->rxBatchBytes = MIN(remaining, (size_t)DMA_MAX_TRANSFER_COUNT);
+
+    DMA_SubmitChannelTransferParameter(
+        handle->rxDmaHandle,
+        DMA_CHANNEL_XFER(false, true, true, false, (uint8_t)kDMA_Transfer8BitWidth,
+                         (uint8_t)kDMA_AddressInterleave0xWidth, (uint8_t)kDMA_AddressInterleave1xWidth,
+                         (uint32_t)handle->rxBatchBytes),
+        (void *)(uint32_t)&handle->base->RXDAT, &handle->rxData[handle->rxDataReceived], NULL);
+    DMA_StartTransfer(handle->rxDmaHandle);
+}
+
+/*!
+ * @brief Gets the position the DMA writes next into the ring buffer, counted over USART_DMA_RX_RING_POSITION_HALVES.
+ *
+ * A pending INTA flag means a half has been completed but the DMA interrupt has not counted it yet, so the remaining
+ * count already belongs to the next half. The sample is retried when the interrupt ran meanwhile.
+ */
+static uint32_t USART_GetRxRingBufferWritePositionDMA(usart_dma_handle_t *handle)
+{
+    dma_handle_t *dmaHandle = handle->rxDmaHandle;
+    uint32_t mask           = 1UL << DMA_CHANNEL_INDEX(dmaHandle->base, dmaHandle->channel);
+    uint32_t halfSize       = (uint32_t)handle->rxRingBufferSize / 2U;
+    uint32_t halfCount;
+    uint32_t pending;
+    uint32_t remaining;
+
+    do
+    {
+        halfCount = handle->rxRingHalfCount;
+        pending   = DMA_COMMON_CONST_REG_GET(dmaHandle->base, dmaHandle->channel, INTA) & mask;
+        remaining = DMA_GetRemainingBytes(dmaHandle->base, dmaHandle->channel);
+    } while ((halfCount != handle->rxRingHalfCount) ||
+             (pending != (DMA_COMMON_CONST_REG_GET(dmaHandle->base, dmaHandle->channel, INTA) & mask)));
+
+    if (0U != pending)
+    {
+        halfCount++;
+    }
+
+    return ((halfCount % USART_DMA_RX_RING_POSITION_HALVES) * halfSize) + (halfSize - remaining);
+}
+
+/*!
+ * @brief Gets the distance from one ring buffer position forward to another.
+ */
+static uint32_t USART_GetRxRingBufferDistanceDMA(usart_dma_handle_t *handle, uint32_t from, uint32_t to)
+{
+    uint32_t span = ((uint32_t)handle->rxRingBufferSize / 2U) * USART_DMA_RX_RING_POSITION_HALVES;
+
+    return (to >= from) ? (to - from) : (to + span - from);
+}
+
+/*!
+ * @brief Drops the unread data of the half the DMA has started to fill, called from the DMA interrupt.
+ *
+ * The reader keeps the half just filled, like the interrupt driven ring buffer drops the oldest data.
+ *
+ * @retval true The DMA has lapped the reader and the read position has been moved.
+ * @retval false The half the DMA fills holds no unread data.
+ */
+static bool USART_CheckRxRingBufferOverrunDMA(usart_dma_handle_t *handle)
+{
+    uint32_t halfSize = (uint32_t)handle->rxRingBufferSize / 2U;
+    uint32_t filledStart;
+
+    /* Start of the half just filled, one half behind the one the DMA fills now. */
+    filledStart = ((handle->rxRingHalfCount - 1U) % USART_DMA_RX_RING_POSITION_HALVES) * halfSize;
+
+    /* The reader is up to date when it is at most a ring buffer size ahead of the start of the half just filled. */
+    if (USART_GetRxRingBufferDistanceDMA(handle, filledStart, handle->rxRingBufferRead) <=
+        (uint32_t)handle->rxRingBufferSize)
+    {
+        return false;
+    }
+
+    handle->rxRingBufferRead = filledStart;
+
+    return true;
+}
+
+/*!
+ * @brief Gets the receive position of the ongoing request or ring buffer reception.
+ */
+static size_t USART_GetRxPositionDMA(usart_dma_handle_t *handle)
+{
+    dma_handle_t *dmaHandle = handle->rxDmaHandle;
+
+    if (handle->rxState == (uint8_t)kUSART_RxRingBuffer)
+    {
+        return (size_t)USART_GetRxRingBufferWritePositionDMA(handle);
+    }
+
+    return handle->rxDataReceived + handle->rxBatchBytes -
+           (size_t)DMA_GetRemainingBytes(dmaHandle->base, dmaHandle->channel);
+}
+
+static void USART_TransferSendDMACallback(dma_handle_t *handle, void *param, bool transferDone, uint32_t intmode)
+{
+    assert(handle != NULL);
+    assert(param != NULL);
+
+    usart_dma_handle_t *usartHandle = (usart_dma_handle_t *)param;
+    status_t status                 = kStatus_USART_TxIdle;
+
+    if (usartHandle->txState != (uint8_t)kUSART_TxBusy)
+    {
+        return;
+    }
+
+    if (transferDone)
+    {
+        usartHandle->txDataSent += usartHandle->txBatchBytes;
+        usartHandle->txBatchBytes = 0U;
+        if (usartHandle->txDataSent < usartHandle->txDataSizeAll)
+        {
+            USART_StartSendBatchDMA(usartHandle);
+            return;
+        }
+    }
+    else
+    {
+        DMA_AbortTransfer(handle);
+        status = kStatus_USART_TxError;
+    }
+
+    usartHandle->txState = (uint8_t)kUSART_TxIdle;
+
+    if (usartHandle->callback != NULL)
+    {
+        usartHandle->callback(usartHandle->base, usartHandle, status, usartHandle->userData);
+    }
+}
+
+static void USART_TransferReceiveDMACallback(dma_handle_t *handle, void *param, bool transferDone, uint32_t intmode)
+{
+    assert(handle != NULL);
+    assert(param != NULL);
+
+    usart_dma_handle_t *usartHandle = (usart_dma_handle_t *)param;
+    status_t status                 = kStatus_USART_RxIdle;
+
+    if (usartHandle->rxState == (uint8_t)kUSART_RxIdle)
+    {
+        return;
+    }
+
+    if (!transferDone)
+    {
+        DMA_AbortTransfer(handle);
+        status = kStatus_USART_RxError;
+    }
+    else if (usartHandle->rxState == (uint8_t)kUSART_RxRingBuffer)
+    {
+        /* One half filled, the DMA goes on with the other one. */
+        usartHandle->rxRingHalfCount++;
+        status = USART_CheckRxRingBufferOverrunDMA(usartHandle) ? kStatus_USART_RxRingBufferOverrun : kStatus_Success;
+        if (usartHandle->callback != NULL)
+        {
+            usartHandle->callback(usartHandle->base, usartHandle, status, usartHandle->userData);
+        }
+        return;
+    }
+    else
+    {
+        usartHandle->rxDataReceived += usartHandle->rxBatchBytes;
+        usartHandle->rxBatchBytes = 0U;
+        if (usartHandle->rxDataReceived < usartHandle->rxDataSizeAll)
+        {
+            USART_StartReceiveBatchDMA(usartHandle);
+            return;
+        }
+    }
+
+    usartHandle->rxState = (uint8_t)kUSART_RxIdle;
+
+    if (usartHandle->callback != NULL)
+    {
+        usartHandle->callback(usartHandle->base, usartHandle, status, usartHandle->userData);
+    }
+}
+
+/*!
+ * brief Initializes the USART handle which is used in transactional functions.
+ *
+ * param base USART peripheral base address.
+ * param handle Pointer to usart_dma_handle_t structure.
+ * param callback Callback function.
+ * param userData User data.
+ * param txDmaHandle User-requested DMA handle for TX DMA transfer.
+ * param rxDmaHandle User-requested DMA handle for RX DMA transfer.
+ */
+status_t USART_TransferCreateHandleDMA(USART_Type *base,
+                                       usart_dma_handle_t *handle,
+                                       usart_dma_transfer_callback_t callback,
+                                       void *userData,
+                                       dma_handle_t *txDmaHandle,
+                                       dma_handle_t *rxDmaHandle)
+{
+    assert(NULL != handle);
+
+    (void)memset(handle, 0, sizeof(*handle));
+
+    handle->base     = base;
+    handle->callback = callback;
+    handle->userData = userData;
+    handle->rxState  = (uint8_t)kUSART_RxIdle;
+    handle->txState  = (uint8_t)kUSART_TxIdle;
+
+    handle->txDmaHandle = txDmaHandle;
+    handle->rxDmaHandle = rxDmaHandle;
+
+    /* The channels are paced by the USART TXRDY/RXRDY requests. */
+    if (txDmaHandle != NULL)
+    {
+        DMA_SetChannelConfig(txDmaHandle->base, txDmaHandle->channel, NULL, true);
+        DMA_EnableChannelInterrupts(txDmaHandle->base, txDmaHandle->channel);
+        DMA_SetCallback(txDmaHandle, USART_TransferSendDMACallback, handle);
+    }
+    if (rxDmaHandle != NULL)
+    {
+        DMA_SetChannelConfig(rxDmaHandle->base, rxDmaHandle->channel, NULL, true);
+        DMA_EnableChannelInterrupts(rxDmaHandle->base, rxDmaHandle->channel);
+        DMA_SetCallback(rxDmaHandle, USART_TransferReceiveDMACallback, handle);
+    }
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Sends data using DMA.
+ *
+ * param base USART peripheral base address.
+ * param handle USART handle pointer.
+ * param xfer USART DMA transfer structure. See #usart_transfer_t.
+ * retval kStatus_Success if succeed, others failed.
+ * retval kStatus_USART_TxBusy Previous transfer on going.
+ * retval kStatus_InvalidArgument Invalid argument.
+ */
+status_t USART_TransferSendDMA(USART_Type *base, usart_dma_handle_t *handle, usart_transfer_t *xfer)
+{
+    assert(handle != NULL);
+    assert(handle->txDmaHandle != NULL);
+
+    /* Check arguments */
+    if ((NULL == xfer) || (0U == xfer->dataSize) || (NULL == xfer->txData))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* If previous TX not finished. */
+    if ((uint8_t)kUSART_TxBusy == handle->txState)
+    {
+        return kStatus_USART_TxBusy;
+    }
+
+    handle->txState       = (uint8_t)kUSART_TxBusy;
+    handle->txData        = xfer->txData;
+    handle->txDataSizeAll = xfer->dataSize;
+    handle->txDataSent    = 0U;
+
+    USART_StartSendBatchDMA(handle);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Receives data using DMA.
+ *
+ * param base USART peripheral base address.
+ * param handle Pointer to usart_dma_handle_t structure.
+ * param xfer USART DMA transfer structure. See #usart_transfer_t.
+ * retval kStatus_Success if succeed, others failed.
+ * retval kStatus_USART_RxBusy Previous transfer on going.
+ * retval kStatus_InvalidArgument Invalid argument.
+ */
+status_t USART_TransferReceiveDMA(USART_Type *base, usart_dma_handle_t *handle, usart_transfer_t *xfer)
+{
+    assert(handle != NULL);
+    assert(handle->rxDmaHandle != NULL);
+
+    /* Check arguments */
+    if ((NULL == xfer) || (0U == xfer->dataSize) || (NULL == xfer->rxData))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* If previous RX not finished. */
+    if ((uint8_t)kUSART_RxIdle != handle->rxState)
+    {
+        return kStatus_USART_RxBusy;
+    }
+
+    handle->rxState        = (uint8_t)kUSART_RxBusy;
+    handle->rxData         = xfer->rxData;
+    handle->rxDataSizeAll  = xfer->dataSize;
+    handle->rxDataReceived = 0U;
+    handle->rxCheckCount   = 0U;
+    handle->rxIdleCount    = 0U;
+
+    USART_StartReceiveBatchDMA(handle);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Starts the circular DMA receive into a ring buffer.
+ *
+ * param base USART peripheral base address.
+ * param handle Pointer to usart_dma_handle_t structure.
+ * param ringBuffer Start address of the ring buffer.
+ * param ringBufferSize Size of the ring buffer, even and at most USART_DMA_RX_RING_BUFFER_MAX_SIZE.
+ * retval kStatus_Success if succeed, others failed.
+ * retval kStatus_USART_RxBusy Previous transfer on going.
+ * retval kStatus_InvalidArgument Invalid argument.
+ */
+status_t USART_TransferStartRingBufferDMA(USART_Type *base,
+                                          usart_dma_handle_t *handle,
+                                          uint8_t *ringBuffer,
+                                          size_t ringBufferSize)
+{
+    assert(handle != NULL);
+    assert(handle->rxDmaHandle != NULL);
+
+    dma_descriptor_t *ringDescriptor = s_usartRxRingDescriptor[USART_GetInstance(base)];
+    void *rxdat                      = (void *)(uint32_t)&base->RXDAT;
+    uint32_t halfSize                = (uint32_t)ringBufferSize / 2U;
+    uint32_t xferCfg;
+
+    if ((NULL == ringBuffer) || (ringBufferSize < 2U) || (0U != (ringBufferSize & 1U)) ||
+        (ringBufferSize > USART_DMA_RX_RING_BUFFER_MAX_SIZE))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    if ((uint8_t)kUSART_RxIdle != handle->rxState)
+    {
+        return kStatus_USART_RxBusy;
+    }
+
+    handle->rxData           = ringBuffer;
+    handle->rxRingBufferSize = ringBufferSize;
+    handle->rxRingBufferRead = 0U;
+    handle->rxRingHalfCount  = 0U;
+    handle->rxCheckCount     = 0U;
+    handle->rxIdleCount      = 0U;
+    handle->rxState          = (uint8_t)kUSART_RxRingBuffer;
+
+    /* Two halves reloading each other, each one raises the interrupt when filled. */
+    xferCfg = DMA_CHANNEL_XFER(true, false, true, false, (uint8_t)kDMA_Transfer8BitWidth,
+                               (uint8_t)kDMA_AddressInterleave0xWidth, (uint8_t)kDMA_AddressInterleave1xWidth, halfSize);
+    DMA_SetupDescriptor(&ringDescriptor[0], xferCfg, rxdat, &ringBuffer[0], &ringDescriptor[1]);
+    DMA_SetupDescriptor(&ringDescriptor[1], xferCfg, rxdat, &ringBuffer[halfSize], &ringDescriptor[0]);
+
+    DMA_SubmitChannelDescriptor(handle->rxDmaHandle, &ringDescriptor[0]);
+    DMA_StartTransfer(handle->rxDmaHandle);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Gets the number of unread bytes in the receive ring buffer.
+ *
+ * param base USART peripheral base address.
+ * param handle Pointer to usart_dma_handle_t structure.
+ * return Length of the received data in the ring buffer.
+ */
+size_t USART_TransferGetRxRingBufferLengthDMA(USART_Type *base, usart_dma_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    uint32_t length;
+
+    if (handle->rxState != (uint8_t)kUSART_RxRingBuffer)
+    {
+        return 0U;
+    }
+
+    length = USART_GetRxRingBufferDistanceDMA(handle, handle->rxRingBufferRead,
+                                              USART_GetRxRingBufferWritePositionDMA(handle));
+    if (length > (uint32_t)handle->rxRingBufferSize)
+    {
+        /* The DMA has overwritten unread data, nothing is valid until the DMA interrupt drops it. */
+        return 0U;
+    }
+
+    return (size_t)length;
+}
+
+/*!
+ * brief Reads data from the receive ring buffer.
+ *
+ * param base USART peripheral base address.
+ * param handle Pointer to usart_dma_handle_t structure.
+ * param data Buffer to copy the data to.
+ * param length Maximum number of bytes to read.
+ * return Number of bytes copied.
+ */
+size_t USART_TransferReadRingBufferDMA(USART_Type *base, usart_dma_handle_t *handle, uint8_t *data, size_t length)
+{
+    assert(handle != NULL);
+    assert((data != NULL) || (0U == length));
+
+    uint32_t read = handle->rxRingBufferRead;
+    size_t count  = MIN(length, USART_TransferGetRxRingBufferLengthDMA(base, handle));
+    size_t tail   = (size_t)read % handle->rxRingBufferSize;
+    size_t chunk  = MIN(count, handle->rxRingBufferSize - tail);
+    uint32_t span = ((uint32_t)handle->rxRingBufferSize / 2U) * USART_DMA_RX_RING_POSITION_HALVES;
+    uint32_t regPrimask;
+
+    if (0U != count)
+    {
+        /* Copy up to the end of the ring buffer, then the wrapped part. */
+        (void)memcpy(data, &handle->rxData[tail], chunk);
+        (void)memcpy(&data[chunk], handle->rxData, count - chunk);
+
+        /* The copy is only valid when the DMA has not lapped the reader meanwhile. */
+        regPrimask = DisableGlobalIRQ();
+        if ((read == handle->rxRingBufferRead) && (0U != USART_TransferGetRxRingBufferLengthDMA(base, handle)))
+        {
+            handle->rxRingBufferRead = (read + (uint32_t)count) % span;
+        }
+        else
+        {
+            count = 0U;
+        }
+        EnableGlobalIRQ(regPrimask);
+    }
+
+    return count;
+}
+
+/*!
+ * brief Checks the receiver for the end of a frame.
+ *
+ * param base USART peripheral base address.
+ * param handle Pointer to usart_dma_handle_t structure.
+ * retval true The end of a frame has been detected.
+ * retval false No new frame end.
+ */
+bool USART_TransferHandleIdleDMA(USART_Type *base, usart_dma_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    size_t count;
+    bool idle;
+
+    if (handle->rxState == (uint8_t)kUSART_RxIdle)
+    {
+        return false;
+    }
+
+    count = USART_GetRxPositionDMA(handle);
+
+#if defined(FSL_FEATURE_USART_HAS_RXIDLETO_CHECK) && FSL_FEATURE_USART_HAS_RXIDLETO_CHECK
+    idle = (0U != (USART_GetStatusFlags(base) & (uint32_t)kUSART_RxIdleTimeoutFlag));
+    if (idle)
+    {
+        USART_ClearStatusFlags(base, (uint32_t)kUSART_RxIdleTimeoutFlag);
+    }
+#else
+    /* Nothing received during the whole check period and no character being shifted in. */
+    idle = (count == handle->rxCheckCount) &&
+           ((uint32_t)kUSART_RxIdleFlag == (USART_GetStatusFlags(base) & ((uint32_t)kUSART_RxIdleFlag |
+                                                                           (uint32_t)kUSART_RxReady)));
+#endif
+    handle->rxCheckCount = count;
+
+    if ((!idle) || (count == handle->rxIdleCount))
+    {
+        return false;
+    }
+
+    handle->rxIdleCount = count;
+
+    if (handle->rxState == (uint8_t)kUSART_RxBusy)
+    {
+        /* Complete the request with the frame received so far. */
+        DMA_AbortTransfer(handle->rxDmaHandle);
+        handle->rxDataReceived = count;
+        handle->rxBatchBytes   = 0U;
+        handle->rxState        = (uint8_t)kUSART_RxIdle;
+    }
+
+    if (handle->callback != NULL)
+    {
+        handle->callback(base, handle, kStatus_USART_RxIdle, handle->userData);
+    }
+
+    return true;
+}
+
+/*!
+ * brief Aborts the sent data using DMA.
+ *
+ * param base USART peripheral base address
+ * param handle Pointer to usart_dma_handle_t structure
+ */
+void USART_TransferAbortSendDMA(USART_Type *base, usart_dma_handle_t *handle)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->txDmaHandle);
+
+    if (handle->txState != (uint8_t)kUSART_TxIdle)
+    {
+        DMA_AbortTransfer(handle->txDmaHandle);
+        handle->txBatchBytes = 0U;
+        handle->txState      = (uint8_t)kUSART_TxIdle;
+    }
+}
+
+/*!
+ * brief Aborts the received data using DMA.
+ *
+ * param base USART peripheral base address
+ * param handle Pointer to usart_dma_handle_t structure
+ */
+void USART_TransferAbortReceiveDMA(USART_Type *base, usart_dma_handle_t *handle)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->rxDmaHandle);
+
+    if (handle->rxState != (uint8_t)kUSART_RxIdle)
+    {
+        DMA_AbortTransfer(handle->rxDmaHandle);
+        handle->rxBatchBytes = 0U;
+        handle->rxState      = (uint8_t)kUSART_RxIdle;
+    }
+}
+
+/*!
+ * brief Gets the number of bytes that have been sent.
+ *
+ * param base USART peripheral base address.
+ * param handle USART handle pointer.
+ * param count Sent bytes count.
+ * retval kStatus_NoTransferInProgress No send in progress.
+ * retval kStatus_InvalidArgument Parameter is invalid.
+ * retval kStatus_Success Get successfully through the parameter \p count;
+ */
+status_t USART_TransferGetSendCountDMA(USART_Type *base, usart_dma_handle_t *handle, uint32_t *count)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->txDmaHandle);
+
+    if (NULL == count)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    if ((uint8_t)kUSART_TxIdle == handle->txState)
+    {
+        return kStatus_NoTransferInProgress;
+    }
+
+    *count = (uint32_t)handle->txDataSent;
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Gets the number of bytes that have been received.
+ *
+ * param base USART peripheral base address.
+ * param handle USART handle pointer.
+ * param count Receive bytes count.
+ * retval kStatus_NoTransferInProgress No receive in progress, count is the length of the last request.
+ * retval kStatus_InvalidArgument Parameter is invalid.
+ * retval kStatus_Success Get successfully through the parameter \p count;
+ */
+status_t USART_TransferGetReceiveCountDMA(USART_Type *base, usart_dma_handle_t *handle, uint32_t *count)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->rxDmaHandle);
+
+    if (NULL == count)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    if ((uint8_t)kUSART_RxIdle == handle->rxState)
+    {
+        *count = (uint32_t)handle->rxDataReceived;
+        return kStatus_NoTransferInProgress;
+    }
+
+    if ((uint8_t)kUSART_RxRingBuffer == handle->rxState)
+    {
+        *count = (uint32_t)USART_TransferGetRxRingBufferLengthDMA(base, handle);
+    }
+    else
+    {
+        *count = (uint32_t)USART_GetRxPositionDMA(handle);
+    }
+
+    return kStatus_Success;
+}
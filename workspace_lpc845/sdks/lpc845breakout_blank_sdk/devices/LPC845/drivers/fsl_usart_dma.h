@@ -0,0 +1,276 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef FSL_USART_DMA_H_
+#define FSL_USART_DMA_H_
+
+#include "fsl_usart.h"
+#include "fsl_dma.h"
+
+/*!
+ * @addtogroup usart_dma_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*! @{ */
+/*! @brief USART DMA driver version. */
+#define FSL_USART_DMA_DRIVER_VERSION (MAKE_VERSION(2, 0, 0))
+/*! @} */
+
+/*! @brief Number of TX link descriptors per USART instance.
+ *
+ * One TX batch covers up to (USART_DMA_TX_LINK_DESCRIPTOR_COUNT + 1) * DMA_MAX_TRANSFER_COUNT bytes, longer
+ * transfers are split into several batches by the driver.
+ */
+#ifndef USART_DMA_TX_LINK_DESCRIPTOR_COUNT
+#define USART_DMA_TX_LINK_DESCRIPTOR_COUNT (1U)
+#endif
+
+/*! @brief Maximum size of the DMA receive ring buffer, two halves of at most DMA_MAX_TRANSFER_COUNT bytes. */
+#define USART_DMA_RX_RING_BUFFER_MAX_SIZE (2UL * DMA_MAX_TRANSFER_COUNT)
+
+/* Forward declaration of the handle typedef. */
+typedef struct _usart_dma_handle usart_dma_handle_t;
+
+/*! @brief USART DMA transfer callback function.
+ *
+ * The status reported is:
+ *  - kStatus_USART_TxIdle: the send request has been completed.
+ *  - kStatus_USART_RxIdle: the receive request has been completed, or an idle line ended a frame.
+ *  - kStatus_Success: one half of the receive ring buffer has been filled and the line is still active.
+ *  - kStatus_USART_RxRingBufferOverrun: one half of the receive ring buffer has been filled and the DMA now
+ *    overwrites unread data, which has been dropped.
+ *  - kStatus_USART_TxError/kStatus_USART_RxError: the DMA reported an error.
+ */
+typedef void (*usart_dma_transfer_callback_t)(USART_Type *base,
+                                              usart_dma_handle_t *handle,
+                                              status_t status,
+                                              void *userData);
+
+/*!
+ * @brief USART DMA handle
+ */
+struct _usart_dma_handle
+{
+    USART_Type *base; /*!< USART peripheral base address. */
+
+    usart_dma_transfer_callback_t callback; /*!< Callback function. */
+    void *userData;                         /*!< USART callback function parameter.*/
+
+    dma_handle_t *txDmaHandle; /*!< The DMA TX channel used. */
+    dma_handle_t *rxDmaHandle; /*!< The DMA RX channel used. */
+
+    const uint8_t *txData;              /*!< Start of the data to send. */
+    size_t txDataSizeAll;               /*!< Size of the data to send out. */
+    size_t txDataSent;                  /*!< Bytes sent by completed TX batches. */
+    size_t txBatchBytes;                /*!< Bytes of the TX batch in flight. */
+    uint8_t *rxData;                    /*!< Start of the receive buffer or of the ring buffer. */
+    size_t rxDataSizeAll;               /*!< Size of the data to receive. */
+    size_t rxDataReceived;              /*!< Bytes received by completed RX batches. */
+    size_t rxBatchBytes;                /*!< Bytes of the RX batch in flight. */
+    size_t rxCheckCount;                /*!< Receive position at the previous idle line check. */
+    size_t rxIdleCount;                 /*!< Receive position at the last detected frame end. */
+    size_t rxRingBufferSize;            /*!< Size of the receive ring buffer. */
+    volatile uint32_t rxRingBufferRead; /*!< Bytes read from the ring buffer since the start. */
+    volatile uint32_t rxRingHalfCount;  /*!< Ring buffer halves filled by the DMA since the start. */
+
+    volatile uint8_t txState; /*!< TX transfer state. */
+    volatile uint8_t rxState; /*!< RX transfer state */
+};
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* _cplusplus */
+
+/*!
+ * @name DMA transactional
+ * @{
+ */
+
+/*!
+ * @brief Initializes the USART handle which is used in transactional functions.
+ *
+ * The DMA channels must be the channels serving the USART requests, created with DMA_CreateHandle() and enabled
+ * with DMA_EnableChannel(). Either handle may be NULL when the direction is not used.
+ *
+ * @param base USART peripheral base address.
+ * @param handle Pointer to usart_dma_handle_t structure.
+ * @param callback Callback function.
+ * @param userData User data.
+ * @param txDmaHandle User-requested DMA handle for TX DMA transfer.
+ * @param rxDmaHandle User-requested DMA handle for RX DMA transfer.
+ * @retval kStatus_Success Handle created successfully.
+ */
+status_t USART_TransferCreateHandleDMA(USART_Type *base,
+                                       usart_dma_handle_t *handle,
+                                       usart_dma_transfer_callback_t callback,
+                                       void *userData,
+                                       dma_handle_t *txDmaHandle,
+                                       dma_handle_t *rxDmaHandle);
+
+/*!
+ * @brief Sends data using DMA.
+ *
+ * This function sends data using DMA. This is a non-blocking function, which returns right away. The data is
+ * chained through link descriptors, so one DMA interrupt is taken per (USART_DMA_TX_LINK_DESCRIPTOR_COUNT + 1)
+ * KiB of data. When all data is sent, the send callback function is called.
+ *
+ * @param base USART peripheral base address.
+ * @param handle USART handle pointer.
+ * @param xfer USART DMA transfer structure. See #usart_transfer_t.
+ * @retval kStatus_Success if succeed, others failed.
+ * @retval kStatus_USART_TxBusy Previous transfer on going.
+ * @retval kStatus_InvalidArgument Invalid argument.
+ */
+status_t USART_TransferSendDMA(USART_Type *base, usart_dma_handle_t *handle, usart_transfer_t *xfer);
+
+/*!
+ * @brief Receives data using DMA.
+ *
+ * This function receives data using DMA. This is a non-blocking function, which returns right away. When all data
+ * is received, or when USART_TransferHandleIdleDMA() detects the end of a shorter frame, the receive callback
+ * function is called with kStatus_USART_RxIdle.
+ *
+ * @param base USART peripheral base address.
+ * @param handle Pointer to usart_dma_handle_t structure.
+ * @param xfer USART DMA transfer structure. See #usart_transfer_t.
+ * @retval kStatus_Success if succeed, others failed.
+ * @retval kStatus_USART_RxBusy Previous transfer on going.
+ * @retval kStatus_InvalidArgument Invalid argument.
+ */
+status_t USART_TransferReceiveDMA(USART_Type *base, usart_dma_handle_t *handle, usart_transfer_t *xfer);
+
+/*!
+ * @brief Starts the circular DMA receive into a ring buffer.
+ *
+ * The ring buffer is split in two halves filled alternately by two descriptors linked to each other, so reception
+ * never stops and one DMA interrupt is taken per half buffer. Received data is read with
+ * USART_TransferReadRingBufferDMA(). When the DMA starts a half that still holds unread data, the unread data up to
+ * the half just filled is dropped and the callback is called with kStatus_USART_RxRingBufferOverrun.
+ *
+ * @param base USART peripheral base address.
+ * @param handle Pointer to usart_dma_handle_t structure.
+ * @param ringBuffer Start address of the ring buffer.
+ * @param ringBufferSize Size of the ring buffer, even and at most USART_DMA_RX_RING_BUFFER_MAX_SIZE.
+ * @retval kStatus_Success if succeed, others failed.
+ * @retval kStatus_USART_RxBusy Previous transfer on going.
+ * @retval kStatus_InvalidArgument Invalid argument.
+ */
+status_t USART_TransferStartRingBufferDMA(USART_Type *base,
+                                          usart_dma_handle_t *handle,
+                                          uint8_t *ringBuffer,
+                                          size_t ringBufferSize);
+
+/*!
+ * @brief Gets the number of unread bytes in the receive ring buffer.
+ *
+ * Nothing can be read once the DMA has overwritten unread data, until the DMA interrupt drops it.
+ *
+ * @param base USART peripheral base address.
+ * @param handle Pointer to usart_dma_handle_t structure.
+ * @return Length of the received data in the ring buffer.
+ */
+size_t USART_TransferGetRxRingBufferLengthDMA(USART_Type *base, usart_dma_handle_t *handle);
+
+/*!
+ * @brief Reads data from the receive ring buffer.
+ *
+ * @param base USART peripheral base address.
+ * @param handle Pointer to usart_dma_handle_t structure.
+ * @param data Buffer to copy the data to.
+ * @param length Maximum number of bytes to read.
+ * @return Number of bytes copied.
+ */
+size_t USART_TransferReadRingBufferDMA(USART_Type *base, usart_dma_handle_t *handle, uint8_t *data, size_t length);
+
+/*!
+ * @brief Checks the receiver for the end of a frame.
+ *
+ * A frame ends when new data is pending, nothing has been received since the previous check and the receiver is
+ * idle. On devices with the receive idle timeout feature, kUSART_RxIdleTimeoutFlag is used instead of the receiver
+ * idle status. When the end of a frame is detected, a pending USART_TransferReceiveDMA() request is completed early
+ * and the callback is called with kStatus_USART_RxIdle. In ring buffer mode the callback is called with
+ * kStatus_USART_RxIdle and the frame can be read with USART_TransferReadRingBufferDMA().
+ *
+ * Call this function periodically, for example from a timer tick running at a few character times: a frame ends
+ * when no character has been received during a whole tick. The cost of frame reception is then one check per tick
+ * instead of one interrupt per byte. The function must not preempt the DMA interrupt handler.
+ *
+ * @param base USART peripheral base address.
+ * @param handle Pointer to usart_dma_handle_t structure.
+ * @retval true The end of a frame has been detected.
+ * @retval false No new frame end.
+ */
+bool USART_TransferHandleIdleDMA(USART_Type *base, usart_dma_handle_t *handle);
+
+/*!
+ * @brief Aborts the sent data using DMA.
+ *
+ * This function aborts send data using DMA.
+ *
+ * @param base USART peripheral base address
+ * @param handle Pointer to usart_dma_handle_t structure
+ */
+void USART_TransferAbortSendDMA(USART_Type *base, usart_dma_handle_t *handle);
+
+/*!
+ * @brief Aborts the received data using DMA.
+ *
+ * This function aborts the receive request or stops the ring buffer reception.
+ *
+ * @param base USART peripheral base address
+ * @param handle Pointer to usart_dma_handle_t structure
+ */
+void USART_TransferAbortReceiveDMA(USART_Type *base, usart_dma_handle_t *handle);
+
+/*!
+ * @brief Gets the number of bytes that have been sent.
+ *
+ * The count is updated at TX batch boundaries.
+ *
+ * @param base USART peripheral base address.
+ * @param handle USART handle pointer.
+ * @param count Sent bytes count.
+ * @retval kStatus_NoTransferInProgress No send in progress.
+ * @retval kStatus_InvalidArgument Parameter is invalid.
+ * @retval kStatus_Success Get successfully through the parameter \p count;
+ */
+status_t USART_TransferGetSendCountDMA(USART_Type *base, usart_dma_handle_t *handle, uint32_t *count);
+
+/*!
+ * @brief Gets the number of bytes that have been received.
+ *
+ * When no receive is in progress, \p count holds the length of the last completed request, so a frame ended by
+ * USART_TransferHandleIdleDMA() can be measured from the callback. In ring buffer mode, \p count is the number of
+ * unread bytes in the ring buffer.
+ *
+ * @param base USART peripheral base address.
+ * @param handle USART handle pointer.
+ * @param count Receive bytes count.
+ * @retval kStatus_NoTransferInProgress No receive in progress, \p count is the length of the last request.
+ * @retval kStatus_InvalidArgument Parameter is invalid.
+ * @retval kStatus_Success Get successfully through the parameter \p count;
+ */
+status_t USART_TransferGetReceiveCountDMA(USART_Type *base, usart_dma_handle_t *handle, uint32_t *count);
+
+/*! @} */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @} */
+
+#endif /* FSL_USART_DMA_H_ */
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of fsl_common.h for the USART DMA driver test, see fsl_usart_dma_test.c. The include guard is
+   the one of the real header, so the real header next to the driver is skipped. */
+
+#ifndef FSL_COMMON_H_
+#define FSL_COMMON_H_
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef int32_t status_t;
+
+#define MAKE_STATUS(group, code) ((((group)*100) + (code)))
+
+enum _status_groups
+{
+    kStatusGroup_Generic   = 0,
+    kStatusGroup_LPC_USART = 57,
+};
+
+enum
+{
+    kStatus_Success              = MAKE_STATUS(kStatusGroup_Generic, 0),
+    kStatus_Fail                 = MAKE_STATUS(kStatusGroup_Generic, 1),
+    kStatus_InvalidArgument      = MAKE_STATUS(kStatusGroup_Generic, 4),
+    kStatus_NoTransferInProgress = MAKE_STATUS(kStatusGroup_Generic, 6),
+};
+
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+
+#define SDK_ALIGN(var, alignbytes) var __attribute__((aligned(alignbytes)))
+
+#define FSL_FEATURE_SOC_USART_COUNT (5)
+
+/* The registers the driver touches */
+typedef struct
+{
+    volatile uint32_t STAT;
+    volatile uint32_t RXDAT;
+    volatile uint32_t TXDAT;
+} USART_Type;
+
+typedef struct
+{
+    struct
+    {
+        volatile uint32_t INTA;
+    } COMMON[1];
+} DMA_Type;
+
+#define USART_STAT_RXRDY_MASK  (0x1U)
+#define USART_STAT_RXIDLE_MASK (0x2U)
+
+/* The test runs the DMA interrupt from its main loop, so there is nothing to mask */
+static inline uint32_t DisableGlobalIRQ(void)
+{
+    return 0U;
+}
+
+static inline void EnableGlobalIRQ(uint32_t primask)
+{
+    (void)primask;
+}
+
+#endif /* FSL_COMMON_H_ */
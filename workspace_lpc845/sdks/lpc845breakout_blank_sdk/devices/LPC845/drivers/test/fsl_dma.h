@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of fsl_dma.h for the USART DMA driver test, the DMA channels are simulated by
+   fsl_usart_dma_test.c. */
+
+#ifndef FSL_DMA_H_
+#define FSL_DMA_H_
+
+#include "fsl_common.h"
+
+#define DMA_MAX_TRANSFER_COUNT                     0x400U
+#define FSL_FEATURE_DMA_LINK_DESCRIPTOR_ALIGN_SIZE (16U)
+
+#define DMA_ALLOCATE_LINK_DESCRIPTORS(name, number) \
+    SDK_ALIGN(dma_descriptor_t name[number], FSL_FEATURE_DMA_LINK_DESCRIPTOR_ALIGN_SIZE)
+
+#define DMA_CHANNEL_GROUP(channel)       (((uint8_t)(channel)) >> 5U)
+#define DMA_CHANNEL_INDEX(base, channel) (((uint8_t)(channel)) & 0x1FU)
+#define DMA_COMMON_CONST_REG_GET(base, channel, reg) \
+    (((volatile const uint32_t *)(&((base)->COMMON[0].reg)))[DMA_CHANNEL_GROUP(channel)])
+
+#define DMA_CHANNEL_XFERCFG_CFGVALID_MASK  (0x1U)
+#define DMA_CHANNEL_XFERCFG_RELOAD_MASK    (0x2U)
+#define DMA_CHANNEL_XFERCFG_CLRTRIG_MASK   (0x8U)
+#define DMA_CHANNEL_XFERCFG_SETINTA_MASK   (0x10U)
+#define DMA_CHANNEL_XFERCFG_SETINTB_MASK   (0x20U)
+#define DMA_CHANNEL_XFERCFG_WIDTH_SHIFT    (8U)
+#define DMA_CHANNEL_XFERCFG_SRCINC_SHIFT   (12U)
+#define DMA_CHANNEL_XFERCFG_DSTINC_SHIFT   (14U)
+#define DMA_CHANNEL_XFERCFG_XFERCOUNT_SHIFT (16U)
+
+#define DMA_CHANNEL_XFER(reload, clrTrig, intA, intB, width, srcInc, dstInc, bytes) \
+    (DMA_SetChannelXferConfig(reload, clrTrig, intA, intB, width, srcInc, dstInc, bytes))
+
+enum
+{
+    kDMA_AddressInterleave0xWidth = 0U,
+    kDMA_AddressInterleave1xWidth = 1U,
+};
+
+enum
+{
+    kDMA_Transfer8BitWidth = 1U,
+};
+
+enum
+{
+    kDMA_IntA,
+    kDMA_IntB,
+};
+
+/* The simulation keeps the start addresses instead of the end addresses */
+typedef struct _dma_descriptor
+{
+    volatile uint32_t xfercfg;
+    void *srcStartAddr;
+    void *dstStartAddr;
+    void *linkToNextDesc;
+} dma_descriptor_t;
+
+typedef struct _dma_channel_trigger
+{
+    uint32_t type;
+} dma_channel_trigger_t;
+
+struct _dma_handle;
+
+typedef void (*dma_callback)(struct _dma_handle *handle, void *userData, bool transferDone, uint32_t intmode);
+
+typedef struct _dma_handle
+{
+    dma_callback callback;
+    void *userData;
+    DMA_Type *base;
+    uint8_t channel;
+} dma_handle_t;
+
+static inline uint32_t DMA_SetChannelXferConfig(
+    bool reload, bool clrTrig, bool intA, bool intB, uint8_t width, uint8_t srcInc, uint8_t dstInc, uint32_t bytes)
+{
+    assert(((uint32_t)bytes / (uint32_t)width) <= DMA_MAX_TRANSFER_COUNT);
+    return DMA_CHANNEL_XFERCFG_CFGVALID_MASK | (reload ? DMA_CHANNEL_XFERCFG_RELOAD_MASK : 0U) |
+           (clrTrig ? DMA_CHANNEL_XFERCFG_CLRTRIG_MASK : 0U) | (intA ? DMA_CHANNEL_XFERCFG_SETINTA_MASK : 0U) |
+           (intB ? DMA_CHANNEL_XFERCFG_SETINTB_MASK : 0U) | (((uint32_t)width - 1U) << DMA_CHANNEL_XFERCFG_WIDTH_SHIFT) |
+           ((uint32_t)srcInc << DMA_CHANNEL_XFERCFG_SRCINC_SHIFT) |
+           ((uint32_t)dstInc << DMA_CHANNEL_XFERCFG_DSTINC_SHIFT) |
+           (((uint32_t)bytes / (uint32_t)width - 1U) << DMA_CHANNEL_XFERCFG_XFERCOUNT_SHIFT);
+}
+
+void DMA_SetChannelConfig(DMA_Type *base, uint32_t channel, dma_channel_trigger_t *trigger, bool isPeriph);
+void DMA_EnableChannelInterrupts(DMA_Type *base, uint32_t channel);
+void DMA_SetCallback(dma_handle_t *handle, dma_callback callback, void *userData);
+void DMA_SetupDescriptor(dma_descriptor_t *desc, uint32_t xfercfg, void *srcStartAddr, void *dstStartAddr,
+                         void *nextDesc);
+void DMA_SubmitChannelTransferParameter(dma_handle_t *handle, uint32_t xferCfg, void *srcStartAddr,
+                                        void *dstStartAddr, void *nextDesc);
+void DMA_SubmitChannelDescriptor(dma_handle_t *handle, dma_descriptor_t *descriptor);
+void DMA_StartTransfer(dma_handle_t *handle);
+void DMA_AbortTransfer(dma_handle_t *handle);
+uint32_t DMA_GetRemainingBytes(DMA_Type *base, uint32_t channel);
+
+#endif /* FSL_DMA_H_ */
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of fsl_usart.h for the USART DMA driver test, see fsl_usart_dma_test.c. */
+
+#ifndef FSL_USART_H_
+#define FSL_USART_H_
+
+#include "fsl_common.h"
+
+enum
+{
+    kStatus_USART_TxBusy              = MAKE_STATUS(kStatusGroup_LPC_USART, 0),
+    kStatus_USART_RxBusy              = MAKE_STATUS(kStatusGroup_LPC_USART, 1),
+    kStatus_USART_TxIdle              = MAKE_STATUS(kStatusGroup_LPC_USART, 2),
+    kStatus_USART_RxIdle              = MAKE_STATUS(kStatusGroup_LPC_USART, 3),
+    kStatus_USART_TxError             = MAKE_STATUS(kStatusGroup_LPC_USART, 4),
+    kStatus_USART_RxError             = MAKE_STATUS(kStatusGroup_LPC_USART, 5),
+    kStatus_USART_RxRingBufferOverrun = MAKE_STATUS(kStatusGroup_LPC_USART, 6),
+};
+
+enum _usart_flags
+{
+    kUSART_RxReady    = (USART_STAT_RXRDY_MASK),
+    kUSART_RxIdleFlag = (USART_STAT_RXIDLE_MASK),
+};
+
+typedef struct _usart_transfer
+{
+    union
+    {
+        uint8_t *data;
+        uint8_t *rxData;
+        const uint8_t *txData;
+    };
+    size_t dataSize;
+} usart_transfer_t;
+
+uint32_t USART_GetInstance(USART_Type *base);
+
+static inline uint32_t USART_GetStatusFlags(USART_Type *base)
+{
+    return base->STAT;
+}
+
+static inline void USART_ClearStatusFlags(USART_Type *base, uint32_t mask)
+{
+    base->STAT &= ~mask;
+}
+
+#endif /* FSL_USART_H_ */
@@ -0,0 +1,504 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host test of the USART DMA driver over simulated DMA channels.
+ *
+ * Build and run from this directory, the driver casts the buffer addresses to 32 bits so the test is not position
+ * independent:
+ *   gcc -O2 -no-pie -Wno-pointer-to-int-cast -Wno-int-to-pointer-cast -I. -o usart_dma_test fsl_usart_dma_test.c && \
+ *       ./usart_dma_test
+ *
+ * The simulated channels move one byte per step through the descriptor chain the driver sets up, reload the linked
+ * descriptor and raise INTA like the LPC DMA does. The DMA interrupt runs at random points, but always before the
+ * channel completes the next descriptor. The test checks:
+ *  - sends of 1 to 9000 bytes, split into batches, come out intact with a single kStatus_USART_TxIdle callback,
+ *  - the ring buffer reception with readers of random speed: the bytes read are in order and intact, the length is
+ *    never above the ring buffer size, and data is only skipped after a kStatus_USART_RxRingBufferOverrun callback,
+ *  - the idle line detection reports every frame once, in the ring buffer and in a request,
+ *  - a request over several batches completes, or ends early at an idle line with the count received.
+ * The exit code is 0 on success.
+ */
+
+#include <stdio.h>
+
+#include "fsl_common.h"
+#include "fsl_dma.h"
+#include "fsl_usart.h"
+#include "../fsl_usart_dma.c"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_SEND_NUM     (300U)
+#define TEST_SEND_MAX     (9000U)
+#define TEST_RING_NUM     (60U)
+#define TEST_RING_STEPS   (300000U)
+#define TEST_FRAME_NUM    (2000U)
+#define TEST_RX_CHANNEL   (0U)
+#define TEST_TX_CHANNEL   (1U)
+#define TEST_CHANNEL_NUM  (2U)
+
+typedef struct _test_channel
+{
+    dma_descriptor_t desc; /* Descriptor being executed */
+    uint32_t remaining;    /* Bytes left in the descriptor */
+    uint32_t offset;       /* Bytes done in the descriptor */
+    bool active;
+} test_channel_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static USART_Type testUsart;
+static DMA_Type testDma;
+static dma_handle_t testRxDmaHandle = {.base = &testDma, .channel = TEST_RX_CHANNEL};
+static dma_handle_t testTxDmaHandle = {.base = &testDma, .channel = TEST_TX_CHANNEL};
+static test_channel_t testChannel[TEST_CHANNEL_NUM];
+static usart_dma_handle_t testHandle;
+
+static uint8_t testTxData[TEST_SEND_MAX];
+static uint8_t testTxLine[TEST_SEND_MAX];
+static uint8_t testRing[USART_DMA_RX_RING_BUFFER_MAX_SIZE];
+static uint32_t testRingSeq[USART_DMA_RX_RING_BUFFER_MAX_SIZE];
+static uint8_t testRead[512];
+static uint8_t testRxData[3U * DMA_MAX_TRANSFER_COUNT];
+
+static uint32_t testTxLength;
+static uint32_t testTxIdleCount;
+static uint32_t testRxIdleCount;
+static uint32_t testOverrunCount;
+static unsigned long testSeed = 1U;
+static int testFailures;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t TestRandom(void)
+{
+    testSeed = (testSeed * 1103515245U + 12345U) & 0xFFFFFFFFU;
+    return (uint32_t)(testSeed >> 8);
+}
+
+static void TestCheck(bool condition, const char *what)
+{
+    if (!condition)
+    {
+        if (testFailures < 10)
+        {
+            printf("FAIL: %s\n", what);
+        }
+        testFailures++;
+    }
+}
+
+uint32_t USART_GetInstance(USART_Type *base)
+{
+    return 0U;
+}
+
+/* Simulated DMA channels */
+
+static void TestLoadDescriptor(test_channel_t *channel, const dma_descriptor_t *desc)
+{
+    channel->desc      = *desc;
+    channel->remaining = ((desc->xfercfg >> DMA_CHANNEL_XFERCFG_XFERCOUNT_SHIFT) & 0x3FFU) + 1U;
+    channel->offset    = 0U;
+}
+
+void DMA_SetChannelConfig(DMA_Type *base, uint32_t channel, dma_channel_trigger_t *trigger, bool isPeriph)
+{
+}
+
+void DMA_EnableChannelInterrupts(DMA_Type *base, uint32_t channel)
+{
+}
+
+void DMA_SetCallback(dma_handle_t *handle, dma_callback callback, void *userData)
+{
+    handle->callback = callback;
+    handle->userData = userData;
+}
+
+void DMA_SetupDescriptor(dma_descriptor_t *desc, uint32_t xfercfg, void *srcStartAddr, void *dstStartAddr,
+                         void *nextDesc)
+{
+    desc->xfercfg        = xfercfg;
+    desc->srcStartAddr   = srcStartAddr;
+    desc->dstStartAddr   = dstStartAddr;
+    desc->linkToNextDesc = nextDesc;
+}
+
+void DMA_SubmitChannelTransferParameter(dma_handle_t *handle, uint32_t xferCfg, void *srcStartAddr,
+                                        void *dstStartAddr, void *nextDesc)
+{
+    dma_descriptor_t desc;
+
+    DMA_SetupDescriptor(&desc, xferCfg, srcStartAddr, dstStartAddr, nextDesc);
+    TestLoadDescriptor(&testChannel[handle->channel], &desc);
+}
+
+void DMA_SubmitChannelDescriptor(dma_handle_t *handle, dma_descriptor_t *descriptor)
+{
+    TestLoadDescriptor(&testChannel[handle->channel], descriptor);
+}
+
+void DMA_StartTransfer(dma_handle_t *handle)
+{
+    testChannel[handle->channel].active = true;
+}
+
+void DMA_AbortTransfer(dma_handle_t *handle)
+{
+    testChannel[handle->channel].active = false;
+    testDma.COMMON[0].INTA &= ~(1UL << handle->channel);
+}
+
+uint32_t DMA_GetRemainingBytes(DMA_Type *base, uint32_t channel)
+{
+    return testChannel[channel].active ? testChannel[channel].remaining : 0U;
+}
+
+/* Runs the DMA interrupt of the channel if its INTA flag is set */
+static void TestDmaIrq(dma_handle_t *handle)
+{
+    if (0U != (testDma.COMMON[0].INTA & (1UL << handle->channel)))
+    {
+        testDma.COMMON[0].INTA &= ~(1UL << handle->channel);
+        handle->callback(handle, handle->userData, true, kDMA_IntA);
+    }
+}
+
+/* Moves one byte through the channel, from *data for RX or to *data for TX. Returns false when the channel is idle. */
+static bool TestDmaStep(dma_handle_t *handle, uint8_t *data)
+{
+    test_channel_t *channel = &testChannel[handle->channel];
+    uint32_t xfercfg;
+
+    /* The interrupt is served before the channel completes another descriptor, or when it starts the next batch */
+    if ((!channel->active) || (channel->remaining == 1U))
+    {
+        TestDmaIrq(handle);
+    }
+    if (!channel->active)
+    {
+        return false;
+    }
+
+    xfercfg = channel->desc.xfercfg;
+    if (0U != ((xfercfg >> DMA_CHANNEL_XFERCFG_DSTINC_SHIFT) & 3U))
+    {
+        ((uint8_t *)channel->desc.dstStartAddr)[channel->offset] = *data;
+    }
+    else
+    {
+        *data = ((const uint8_t *)channel->desc.srcStartAddr)[channel->offset];
+    }
+    channel->offset++;
+    channel->remaining--;
+
+    if (channel->remaining == 0U)
+    {
+        if (0U != (xfercfg & DMA_CHANNEL_XFERCFG_SETINTA_MASK))
+        {
+            testDma.COMMON[0].INTA |= 1UL << handle->channel;
+        }
+        if (0U != (xfercfg & DMA_CHANNEL_XFERCFG_RELOAD_MASK))
+        {
+            TestLoadDescriptor(channel, (const dma_descriptor_t *)channel->desc.linkToNextDesc);
+        }
+        else
+        {
+            channel->active = false;
+        }
+    }
+
+    return true;
+}
+
+static void TestCallback(USART_Type *base, usart_dma_handle_t *handle, status_t status, void *userData)
+{
+    if (status == kStatus_USART_TxIdle)
+    {
+        testTxIdleCount++;
+    }
+    else if (status == kStatus_USART_RxIdle)
+    {
+        testRxIdleCount++;
+    }
+    else if (status == kStatus_USART_RxRingBufferOverrun)
+    {
+        testOverrunCount++;
+    }
+    else
+    {
+        TestCheck(status == kStatus_Success, "unexpected callback status");
+    }
+}
+
+static void TestSetUp(void)
+{
+    (void)memset(testChannel, 0, sizeof(testChannel));
+    testDma.COMMON[0].INTA = 0U;
+    testUsart.STAT         = 0U;
+    (void)USART_TransferCreateHandleDMA(&testUsart, &testHandle, TestCallback, NULL, &testTxDmaHandle,
+                                        &testRxDmaHandle);
+}
+
+/* Sends random data of random sizes and compares the line output */
+static void TestSend(void)
+{
+    usart_transfer_t xfer;
+    uint32_t bytes = 0U;
+    uint32_t count;
+    uint32_t run, i;
+
+    TestSetUp();
+    for (run = 0U; run < TEST_SEND_NUM; run++)
+    {
+        xfer.txData   = testTxData;
+        xfer.dataSize = 1U + TestRandom() % TEST_SEND_MAX;
+        for (i = 0U; i < xfer.dataSize; i++)
+        {
+            testTxData[i] = (uint8_t)TestRandom();
+        }
+
+        testTxLength    = 0U;
+        testTxIdleCount = 0U;
+        TestCheck(USART_TransferSendDMA(&testUsart, &testHandle, &xfer) == kStatus_Success, "send is not started");
+        TestCheck(USART_TransferSendDMA(&testUsart, &testHandle, &xfer) == kStatus_USART_TxBusy,
+                  "a second send is not busy");
+
+        while (testTxLength < TEST_SEND_MAX && TestDmaStep(&testTxDmaHandle, &testTxLine[testTxLength]))
+        {
+            testTxLength++;
+            if (TestRandom() % 64U == 0U)
+            {
+                TestDmaIrq(&testTxDmaHandle);
+                if (USART_TransferGetSendCountDMA(&testUsart, &testHandle, &count) == kStatus_Success)
+                {
+                    TestCheck(count <= testTxLength, "send count is ahead of the line");
+                }
+            }
+        }
+        TestDmaIrq(&testTxDmaHandle);
+
+        TestCheck(testTxLength == xfer.dataSize, "send length differs");
+        TestCheck(memcmp(testTxLine, testTxData, xfer.dataSize) == 0, "sent data differs");
+        TestCheck(testTxIdleCount == 1U, "send completion is not reported once");
+        TestCheck(USART_TransferGetSendCountDMA(&testUsart, &testHandle, &count) == kStatus_NoTransferInProgress,
+                  "send is still in progress");
+        bytes += testTxLength;
+    }
+
+    printf("send: %u transfers, %u bytes\n", (unsigned)TEST_SEND_NUM, (unsigned)bytes);
+}
+
+/* Receives a numbered byte stream into ring buffers of random sizes, read by readers of random speed */
+static void TestRing(void)
+{
+    uint64_t received = 0U;
+    uint64_t read     = 0U;
+    uint64_t skipped  = 0U;
+    uint32_t overruns = 0U;
+    uint32_t run, step;
+
+    TestSetUp();
+    for (run = 0U; run < TEST_RING_NUM; run++)
+    {
+        size_t size         = 2U * (1U + TestRandom() % DMA_MAX_TRANSFER_COUNT);
+        uint32_t readerRate = 1U + TestRandom() % 8U;
+        uint32_t stream     = 0U;
+        uint32_t expected   = 0U;
+        uint32_t seenOverruns;
+        uint8_t byte;
+
+        USART_TransferAbortReceiveDMA(&testUsart, &testHandle);
+        TestCheck(USART_TransferStartRingBufferDMA(&testUsart, &testHandle, testRing, size) == kStatus_Success,
+                  "ring buffer reception is not started");
+        testOverrunCount = 0U;
+        seenOverruns     = 0U;
+
+        for (step = 0U; step < TEST_RING_STEPS; step++)
+        {
+            uint32_t op = TestRandom() % 16U;
+
+            if (op >= 9U && TestRandom() % 64U >= readerRate)
+            {
+                continue;
+            }
+
+            if (op < 6U)
+            {
+                /* The numbered byte lands where the channel writes next */
+                test_channel_t *channel = &testChannel[TEST_RX_CHANNEL];
+                size_t index = ((channel->desc.dstStartAddr == (void *)testRing) ? 0U : size / 2U) + channel->offset;
+
+                byte               = (uint8_t)stream;
+                testRingSeq[index] = stream;
+                (void)TestDmaStep(&testRxDmaHandle, &byte);
+                stream++;
+            }
+            else if (op < 9U)
+            {
+                TestDmaIrq(&testRxDmaHandle);
+            }
+            else
+            {
+                size_t length = USART_TransferGetRxRingBufferLengthDMA(&testUsart, &testHandle);
+                size_t tail   = testHandle.rxRingBufferRead % size;
+                uint32_t first = testRingSeq[tail];
+                size_t want   = TestRandom() % sizeof(testRead);
+                size_t got    = USART_TransferReadRingBufferDMA(&testUsart, &testHandle, testRead, want);
+                size_t k;
+
+                TestCheck(length <= size, "ring buffer length is above its size");
+                TestCheck(got == MIN(want, length), "read count differs from the length");
+                if (got == 0U)
+                {
+                    continue;
+                }
+
+                if (testOverrunCount == seenOverruns)
+                {
+                    TestCheck(first == expected, "data is skipped without an overrun");
+                    TestCheck(length == stream - expected, "length differs from the unread data");
+                }
+                else
+                {
+                    TestCheck(first > expected, "data is read again after an overrun");
+                    skipped += first - expected;
+                }
+                for (k = 0U; k < got; k++)
+                {
+                    TestCheck(testRead[k] == (uint8_t)(first + k) && testRingSeq[(tail + k) % size] == first + k,
+                              "read data is out of order");
+                }
+                expected     = first + (uint32_t)got;
+                seenOverruns = testOverrunCount;
+                read += got;
+            }
+        }
+
+        received += stream;
+        overruns += testOverrunCount;
+    }
+
+    printf("ring buffer: %u runs, %llu bytes received, %llu read, %u overruns, %llu bytes skipped\n",
+           (unsigned)TEST_RING_NUM, (unsigned long long)received, (unsigned long long)read, (unsigned)overruns,
+           (unsigned long long)skipped);
+}
+
+/* Receives frames of random length and checks the idle line reports them once */
+static void TestIdle(void)
+{
+    uint32_t frames = 0U;
+    uint32_t run, i, length;
+    uint8_t byte = 0x55U;
+
+    TestSetUp();
+    TestCheck(USART_TransferStartRingBufferDMA(&testUsart, &testHandle, testRing, 256U) == kStatus_Success,
+              "ring buffer reception is not started");
+    testRxIdleCount = 0U;
+
+    for (run = 0U; run < TEST_FRAME_NUM; run++)
+    {
+        length = 1U + TestRandom() % 300U;
+        for (i = 0U; i < length; i++)
+        {
+            (void)TestDmaStep(&testRxDmaHandle, &byte);
+            TestDmaIrq(&testRxDmaHandle);
+            (void)USART_TransferReadRingBufferDMA(&testUsart, &testHandle, testRead, sizeof(testRead));
+            if (TestRandom() % 32U == 0U)
+            {
+                TestCheck(!USART_TransferHandleIdleDMA(&testUsart, &testHandle), "idle line while receiving");
+            }
+        }
+
+        /* Characters shifted in, then the line goes idle for a few check periods */
+        testUsart.STAT = kUSART_RxReady;
+        TestCheck(!USART_TransferHandleIdleDMA(&testUsart, &testHandle), "idle line while a character comes in");
+        testUsart.STAT = kUSART_RxIdleFlag;
+        for (i = 0U; i < 4U; i++)
+        {
+            frames += USART_TransferHandleIdleDMA(&testUsart, &testHandle) ? 1U : 0U;
+        }
+        testUsart.STAT = 0U;
+    }
+
+    TestCheck(frames == TEST_FRAME_NUM && testRxIdleCount == TEST_FRAME_NUM, "frames are not reported once");
+    printf("idle line: %u frames, %u reported\n", (unsigned)TEST_FRAME_NUM, (unsigned)frames);
+}
+
+/* Receives a request over several batches, in full and ended early by an idle line */
+static void TestReceive(void)
+{
+    usart_transfer_t xfer;
+    uint32_t count;
+    uint32_t run, i, length;
+    uint8_t byte;
+
+    for (run = 0U; run < 2U; run++)
+    {
+        TestSetUp();
+        testRxIdleCount = 0U;
+        (void)memset(testRxData, 0, sizeof(testRxData));
+        xfer.rxData   = testRxData;
+        xfer.dataSize = sizeof(testRxData) - 100U;
+        length        = run == 0U ? (uint32_t)xfer.dataSize : 2500U;
+
+        TestCheck(USART_TransferReceiveDMA(&testUsart, &testHandle, &xfer) == kStatus_Success,
+                  "receive is not started");
+        TestCheck(USART_TransferReceiveDMA(&testUsart, &testHandle, &xfer) == kStatus_USART_RxBusy,
+                  "a second receive is not busy");
+        for (i = 0U; i < length; i++)
+        {
+            byte = (uint8_t)(i * 7U);
+            TestCheck(TestDmaStep(&testRxDmaHandle, &byte), "receive channel stopped early");
+            TestDmaIrq(&testRxDmaHandle);
+        }
+        if (run == 0U)
+        {
+            TestCheck(testRxIdleCount == 1U, "receive completion is not reported once");
+        }
+        else
+        {
+            TestCheck(USART_TransferGetReceiveCountDMA(&testUsart, &testHandle, &count) == kStatus_Success &&
+                          count == length,
+                      "receive count differs while receiving");
+            testUsart.STAT = kUSART_RxIdleFlag;
+            (void)USART_TransferHandleIdleDMA(&testUsart, &testHandle);
+            TestCheck(USART_TransferHandleIdleDMA(&testUsart, &testHandle) && testRxIdleCount == 1U,
+                      "idle line does not end the receive");
+        }
+
+        TestCheck(USART_TransferGetReceiveCountDMA(&testUsart, &testHandle, &count) == kStatus_NoTransferInProgress &&
+                      count == length,
+                  "receive count differs");
+        for (i = 0U; i < length; i++)
+        {
+            TestCheck(testRxData[i] == (uint8_t)(i * 7U), "received data differs");
+        }
+        TestCheck(testRxData[length] == 0U, "data is received past the end");
+        printf("receive: %u of %u bytes, %s\n", (unsigned)count, (unsigned)xfer.dataSize,
+               run == 0U ? "complete" : "ended by the idle line");
+    }
+}
+
+int main(void)
+{
+    TestSend();
+    TestRing();
+    TestIdle();
+    TestReceive();
+
+    printf("%s\n", testFailures == 0 ? "PASS" : "FAIL");
+    return testFailures == 0 ? 0 : 1;
+}
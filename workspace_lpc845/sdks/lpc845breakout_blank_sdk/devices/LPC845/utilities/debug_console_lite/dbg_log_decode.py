@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 NXP
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+"""Decodes the deferred binary log of the debug console lite.
+
+DbgConsole_DeferredLog() sends the address of the format string and the raw arguments of each message, this script
+reads the format strings, and the strings passed to %s, from the ELF file of the application and prints the text.
+Bytes outside of the log entries, the output of PRINTF for example, are printed as they are.
+
+Usage:
+
+    dbg_log_decode.py app.elf capture.bin           decode a capture file, - reads stdin
+    dbg_log_decode.py app.elf /dev/ttyACM0 115200   decode a serial port, requires pyserial
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+ENTRY_HEADER = 0xA0
+DROP_HEADER = 0xAF
+MAX_ARGS = 6
+
+SHT_PROGBITS = 1
+SHF_ALLOC = 0x2
+
+CONVERSION = re.compile(r"%([-+ #0]*)(\d*)(?:\.(\d*))?(hh|h|ll|l|j|z|t|L)?([diuxXocspfFeEgGaAn%])")
+
+
+class Elf:
+    """Reads the initialized data of the allocated sections of an ELF file, by address."""
+
+    def __init__(self, path):
+        with open(path, "rb") as handle:
+            data = handle.read()
+        if data[:4] != b"\x7fELF":
+            raise ValueError("%s is not an ELF file" % path)
+        is64 = data[4] == 2
+        endian = "<" if data[5] == 1 else ">"
+        if is64:
+            shoff, = struct.unpack_from(endian + "Q", data, 0x28)
+            shentsize, shnum = struct.unpack_from(endian + "HH", data, 0x3A)
+            layout = endian + "IIQQQQ"
+        else:
+            shoff, = struct.unpack_from(endian + "I", data, 0x20)
+            shentsize, shnum = struct.unpack_from(endian + "HH", data, 0x2E)
+            layout = endian + "IIIIII"
+        self.sections = []
+        for index in range(shnum):
+            _, kind, flags, address, offset, size = struct.unpack_from(layout, data, shoff + index * shentsize)
+            if kind == SHT_PROGBITS and (flags & SHF_ALLOC) and size > 0:
+                self.sections.append((address, data[offset:offset + size]))
+
+    def string(self, address):
+        """Returns the NUL terminated string at address, or None if the address is not in the file."""
+        for start, content in self.sections:
+            if start <= address < start + len(content):
+                end = content.find(b"\0", address - start)
+                if end < 0:
+                    return None
+                return content[address - start:end].decode("latin-1")
+        return None
+
+
+def to_signed(value):
+    return value - (1 << 32) if value & 0x80000000 else value
+
+
+def format_message(elf, fmt, args):
+    """Formats a message as DbgConsole_Printf does, the arguments are 32-bit words."""
+    pending = list(args)
+    result = []
+    position = 0
+    for match in CONVERSION.finditer(fmt):
+        result.append(fmt[position:match.start()])
+        position = match.end()
+        flags, width, precision, _, specifier = match.groups()
+        if specifier == "%":
+            result.append("%")
+            continue
+        value = pending.pop(0) if pending else 0
+        spec = "%" + flags + width + ("." + precision if precision is not None else "")
+        if specifier in "di":
+            result.append((spec + "d") % to_signed(value))
+        elif specifier in "uxXo":
+            result.append((spec + specifier.replace("u", "d")) % value)
+        elif specifier == "c":
+            result.append((spec + "c") % chr(value & 0xFF))
+        elif specifier == "s":
+            text = elf.string(value)
+            result.append((spec + "s") % (text if text is not None else "<0x%08X>" % value))
+        elif specifier == "p":
+            result.append("0x%08X" % value)
+        else:
+            # Floats are not supported by the deferred log
+            result.append("<%s:0x%08X>" % (match.group(0), value))
+    result.append(fmt[position:])
+    return "".join(result)
+
+
+def decode(elf, read, write):
+    """Decodes the stream given by read(n) and writes the text with write(str)."""
+    pending = b""
+    while True:
+        chunk = read(256)
+        if not chunk:
+            break
+        pending += chunk
+        index = 0
+        while index < len(pending):
+            header = pending[index]
+            if (header & 0xF0) == ENTRY_HEADER and ((header & 0x0F) <= MAX_ARGS or header == DROP_HEADER):
+                length = 5 if header == DROP_HEADER else 5 + 4 * (header & 0x0F)
+                if index + length > len(pending):
+                    break
+                words = struct.unpack_from("<%dI" % ((length - 1) // 4), pending, index + 1)
+                if header == DROP_HEADER:
+                    write("[%u log messages dropped]\n" % words[0])
+                    index += length
+                    continue
+                fmt = elf.string(words[0])
+                if fmt is not None:
+                    write(format_message(elf, fmt, words[1:]))
+                    index += length
+                    continue
+            write(chr(header))
+            index += 1
+        pending = pending[index:]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("elf", help="ELF file of the application")
+    parser.add_argument("input", help="capture file, - for stdin, or serial port")
+    parser.add_argument("baudrate", nargs="?", type=int, help="baud rate, opens input as a serial port")
+    args = parser.parse_args()
+
+    elf = Elf(args.elf)
+
+    def write(text):
+        sys.stdout.write(text)
+        sys.stdout.flush()
+
+    if args.baudrate is not None:
+        import serial  # pylint: disable=import-outside-toplevel
+
+        with serial.Serial(args.input, args.baudrate, timeout=0.1) as port:
+
+            def read(size):
+                # Wait for data, the port is decoded until interrupted
+                while True:
+                    data = port.read(size)
+                    if data:
+                        return data
+
+            try:
+                decode(elf, read, write)
+            except KeyboardInterrupt:
+                pass
+    elif args.input == "-":
+        decode(elf, sys.stdin.buffer.read1 if hasattr(sys.stdin.buffer, "read1") else sys.stdin.buffer.read, write)
+    else:
+        with open(args.input, "rb") as handle:
+            decode(elf, handle.read, write)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,5 +1,5 @@
 /*
- * Copyright 2017-2018, 2020, 2022 NXP
+ * Copyright 2017-2018, 2020, 2022, 2024 NXP
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -47,6 +47,42 @@ typedef struct DebugConsoleState
 /*! @brief Type of KSDK printf function pointer. */
 typedef int (*PUTCHAR_FUNC)(int a);
 
+#if ((SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK) && (DEBUG_CONSOLE_DEFERRED_LOG_ENABLE > 0U))
+#if ((DEBUG_CONSOLE_DEFERRED_LOG_BUFFER_SIZE & (DEBUG_CONSOLE_DEFERRED_LOG_BUFFER_SIZE - 1U)) != 0U)
+#error "DEBUG_CONSOLE_DEFERRED_LOG_BUFFER_SIZE must be a power of two."
+#endif
+
+/*! @brief Header byte of a deferred log entry, the low nibble is the argument count. */
+#define DEBUG_CONSOLE_DEFERRED_LOG_ENTRY_HEADER 0xA0U
+
+/*! @brief Header byte of a drop record, followed by the number of dropped entries. */
+#define DEBUG_CONSOLE_DEFERRED_LOG_DROP_HEADER 0xAFU
+
+/*! @brief Size of the largest deferred log entry. */
+#define DEBUG_CONSOLE_DEFERRED_LOG_ENTRY_MAX_SIZE (5U + (4U * DEBUG_CONSOLE_DEFERRED_LOG_MAX_ARGS))
+
+/*! @brief State structure storing the deferred log.
+ *
+ * The byte counters run freely and are masked to index the ring. Producers reserve space with interrupts masked,
+ * copy their entry with interrupts enabled, and the last producer to finish, the outermost one when interrupts
+ * nest, makes all the reserved entries visible to the flush.
+ */
+typedef struct _debug_console_deferred_log
+{
+    volatile uint32_t reserved;  /*!< Bytes reserved by the producers. */
+    volatile uint32_t committed; /*!< Bytes of the entries completely written. */
+    volatile uint32_t sent;      /*!< Bytes sent to the UART. */
+    volatile uint32_t writers;   /*!< Producers between reservation and commit. */
+    volatile uint32_t dropped;   /*!< Entries dropped since the last drop record. */
+#if (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U))
+    volatile uint32_t sending; /*!< Length of the ring segment being sent. */
+    volatile bool sendingDrop; /*!< The drop record is being sent. */
+    uint8_t dropRecord[5];     /*!< Drop record being sent. */
+#endif
+    uint8_t buffer[DEBUG_CONSOLE_DEFERRED_LOG_BUFFER_SIZE]; /*!< Ring buffer of the entries. */
+} debug_console_deferred_log_t;
+#endif /* DEBUG_CONSOLE_DEFERRED_LOG_ENABLE */
+
 /*******************************************************************************
  * Variables
  ******************************************************************************/
@@ -55,12 +91,21 @@ typedef int (*PUTCHAR_FUNC)(int a);
 static debug_console_state_t s_debugConsole;
 #endif
 
+#if ((SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK) && (DEBUG_CONSOLE_DEFERRED_LOG_ENABLE > 0U))
+/*! @brief Deferred log state information. */
+static debug_console_deferred_log_t s_debugConsoleDeferredLog;
+#endif
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
 #if (defined(SDK_DEBUGCONSOLE) && (SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK))
 static int DbgConsole_PrintfFormattedData(PUTCHAR_FUNC func_ptr, const char *fmt, va_list ap);
 #endif /* SDK_DEBUGCONSOLE */
+#if ((SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK) && (DEBUG_CONSOLE_DEFERRED_LOG_ENABLE > 0U)) && \
+    (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U))
+static void DbgConsole_DeferredLogCallback(hal_uart_handle_t handle, hal_uart_status_t status, void *callbackParam);
+#endif /* DEBUG_CONSOLE_DEFERRED_LOG_ENABLE */
 
 /*******************************************************************************
  * Code
@@ -100,6 +145,11 @@ status_t DbgConsole_Init(uint8_t instance, uint32_t baudRate, serial_port_type_t
     /* Set the function pointer for send and receive for this kind of device. */
     s_debugConsole.putChar = HAL_UartSendBlocking;
     s_debugConsole.getChar = HAL_UartReceiveBlocking;
+#if ((SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK) && (DEBUG_CONSOLE_DEFERRED_LOG_ENABLE > 0U)) && \
+    (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U))
+    (void)HAL_UartInstallCallback((hal_uart_handle_t)&s_debugConsole.uartHandleBuffer[0],
+                                  DbgConsole_DeferredLogCallback, NULL);
+#endif
 
     return kStatus_Success;
 }
@@ -113,6 +163,12 @@ status_t DbgConsole_Deinit(void)
     }
 
     (void)HAL_UartDeinit((hal_uart_handle_t)&s_debugConsole.uartHandleBuffer[0]);
+#if ((SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK) && (DEBUG_CONSOLE_DEFERRED_LOG_ENABLE > 0U)) && \
+    (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U))
+    /* An interrupted segment is sent again in full after the next init. */
+    s_debugConsoleDeferredLog.sending     = 0U;
+    s_debugConsoleDeferredLog.sendingDrop = false;
+#endif
 
     s_debugConsole.serial_port_type = kSerialPort_None;
     return kStatus_Success;
@@ -262,6 +318,199 @@ int DbgConsole_Getchar(void)
     return (int)dbgConsoleCh;
 }
 
+/*************Code for deferred log*******************************/
+#if (DEBUG_CONSOLE_DEFERRED_LOG_ENABLE > 0U)
+/*!
+ * @brief Stores a 32-bit value in little endian order.
+ *
+ * @param[out] dst      Destination of the four bytes.
+ * @param[in] value     Value to store.
+ */
+static void DbgConsole_DeferredLogPutWord(uint8_t *dst, uint32_t value)
+{
+    dst[0] = (uint8_t)value;
+    dst[1] = (uint8_t)(value >> 8U);
+    dst[2] = (uint8_t)(value >> 16U);
+    dst[3] = (uint8_t)(value >> 24U);
+}
+
+/* See fsl_debug_console.h for documentation of this function. */
+void DbgConsole_DeferredLog(uint32_t argCount, const char *fmt_s, ...)
+{
+    debug_console_deferred_log_t *log = &s_debugConsoleDeferredLog;
+    uint8_t entry[DEBUG_CONSOLE_DEFERRED_LOG_ENTRY_MAX_SIZE];
+    uint32_t length;
+    uint32_t start;
+    uint32_t regPrimask;
+    uint32_t i;
+    va_list ap;
+
+    assert(argCount <= DEBUG_CONSOLE_DEFERRED_LOG_MAX_ARGS);
+
+    entry[0] = (uint8_t)(DEBUG_CONSOLE_DEFERRED_LOG_ENTRY_HEADER | argCount);
+    DbgConsole_DeferredLogPutWord(&entry[1], (uint32_t)(uintptr_t)fmt_s);
+    length = 5U;
+    va_start(ap, fmt_s);
+    for (i = 0U; i < argCount; i++)
+    {
+        DbgConsole_DeferredLogPutWord(&entry[length], va_arg(ap, uint32_t));
+        length += 4U;
+    }
+    va_end(ap);
+
+    regPrimask = DisableGlobalIRQ();
+    if ((log->reserved - log->sent + length) > DEBUG_CONSOLE_DEFERRED_LOG_BUFFER_SIZE)
+    {
+        log->dropped++;
+        EnableGlobalIRQ(regPrimask);
+        return;
+    }
+    start         = log->reserved;
+    log->reserved = start + length;
+    log->writers++;
+    EnableGlobalIRQ(regPrimask);
+
+    for (i = 0U; i < length; i++)
+    {
+        log->buffer[(start + i) & (DEBUG_CONSOLE_DEFERRED_LOG_BUFFER_SIZE - 1U)] = entry[i];
+    }
+
+    regPrimask = DisableGlobalIRQ();
+    log->writers--;
+    if (0U == log->writers)
+    {
+        log->committed = log->reserved;
+    }
+    EnableGlobalIRQ(regPrimask);
+}
+
+/*!
+ * @brief Takes the count of dropped entries and builds the drop record.
+ *
+ * @param[out] record   The five bytes of the drop record.
+ * @return true if entries were dropped since the last drop record.
+ */
+static bool DbgConsole_DeferredLogTakeDropRecord(uint8_t *record)
+{
+    uint32_t regPrimask;
+    uint32_t dropped;
+
+    regPrimask                        = DisableGlobalIRQ();
+    dropped                           = s_debugConsoleDeferredLog.dropped;
+    s_debugConsoleDeferredLog.dropped = 0U;
+    EnableGlobalIRQ(regPrimask);
+
+    record[0] = DEBUG_CONSOLE_DEFERRED_LOG_DROP_HEADER;
+    DbgConsole_DeferredLogPutWord(&record[1], dropped);
+
+    return (0U != dropped);
+}
+
+#if (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U))
+/*!
+ * @brief Starts sending the drop record or the next contiguous segment of the ring if the UART is idle.
+ */
+static void DbgConsole_DeferredLogSendNext(void)
+{
+    debug_console_deferred_log_t *log = &s_debugConsoleDeferredLog;
+    uint32_t regPrimask;
+    uint32_t offset;
+    uint32_t length;
+
+    regPrimask = DisableGlobalIRQ();
+    if ((0U == log->sending) && !log->sendingDrop)
+    {
+        if (DbgConsole_DeferredLogTakeDropRecord(&log->dropRecord[0]))
+        {
+            log->sendingDrop = true;
+            (void)HAL_UartSendNonBlocking((hal_uart_handle_t)&s_debugConsole.uartHandleBuffer[0], &log->dropRecord[0],
+                                          sizeof(log->dropRecord));
+        }
+        else if (log->committed != log->sent)
+        {
+            offset = log->sent & (DEBUG_CONSOLE_DEFERRED_LOG_BUFFER_SIZE - 1U);
+            length       = MIN(log->committed - log->sent, DEBUG_CONSOLE_DEFERRED_LOG_BUFFER_SIZE - offset);
+            log->sending = length;
+            (void)HAL_UartSendNonBlocking((hal_uart_handle_t)&s_debugConsole.uartHandleBuffer[0], &log->buffer[offset],
+                                          length);
+        }
+        else
+        {
+            /* Nothing to send. */
+        }
+    }
+    EnableGlobalIRQ(regPrimask);
+}
+
+/*!
+ * @brief UART callback, releases the segment sent and starts the next one.
+ *
+ * @param[in] handle        UART handle.
+ * @param[in] status        Transfer status.
+ * @param[in] callbackParam Not used.
+ */
+static void DbgConsole_DeferredLogCallback(hal_uart_handle_t handle, hal_uart_status_t status, void *callbackParam)
+{
+    debug_console_deferred_log_t *log = &s_debugConsoleDeferredLog;
+
+    if (kStatus_HAL_UartTxIdle != status)
+    {
+        return;
+    }
+
+    if (log->sendingDrop)
+    {
+        log->sendingDrop = false;
+    }
+    else
+    {
+        log->sent += log->sending;
+        log->sending = 0U;
+    }
+    DbgConsole_DeferredLogSendNext();
+}
+#endif /* UART_ADAPTER_NON_BLOCKING_MODE */
+
+/* See fsl_debug_console.h for documentation of this function. */
+uint32_t DbgConsole_DeferredLogFlush(uint32_t maxBytes)
+{
+    debug_console_deferred_log_t *log = &s_debugConsoleDeferredLog;
+#if !(defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U))
+    uint8_t dropRecord[5];
+    uint32_t offset;
+    uint32_t length;
+#endif
+
+    /* Keep the entries if the debug UART is not initialized. */
+    if (kSerialPort_None != s_debugConsole.serial_port_type)
+    {
+#if (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U))
+        (void)maxBytes;
+        DbgConsole_DeferredLogSendNext();
+#else
+        if (DbgConsole_DeferredLogTakeDropRecord(&dropRecord[0]))
+        {
+            (void)s_debugConsole.putChar((hal_uart_handle_t)&s_debugConsole.uartHandleBuffer[0], &dropRecord[0],
+                                         sizeof(dropRecord));
+        }
+
+        while ((0U != maxBytes) && (log->committed != log->sent))
+        {
+            offset = log->sent & (DEBUG_CONSOLE_DEFERRED_LOG_BUFFER_SIZE - 1U);
+            length = MIN(log->committed - log->sent, DEBUG_CONSOLE_DEFERRED_LOG_BUFFER_SIZE - offset);
+            length = MIN(length, maxBytes);
+            (void)s_debugConsole.putChar((hal_uart_handle_t)&s_debugConsole.uartHandleBuffer[0], &log->buffer[offset],
+                                         length);
+            log->sent += length;
+            maxBytes -= length;
+        }
+#endif
+    }
+
+    return log->committed - log->sent;
+}
+#endif /* DEBUG_CONSOLE_DEFERRED_LOG_ENABLE */
+
 /*************Code for process formatted data*******************************/
 /*!
  * @brief This function puts padding character.
@@ -22,6 +22,7 @@
 #define _FSL_DEBUGCONSOLE_H_
 
 #include "fsl_common.h"
+#include "fsl_str.h"
 
 /*!
  * @addtogroup debugconsolelite
@@ -68,6 +69,19 @@
 #define SCANF_ADVANCED_ENABLE 0U
 #endif /* SCANF_ADVANCED_ENABLE */
 
+/*! @brief Definition to enable the deferred binary log, see DbgConsole_DeferredLog(). */
+#ifndef DEBUG_CONSOLE_DEFERRED_LOG_ENABLE
+#define DEBUG_CONSOLE_DEFERRED_LOG_ENABLE 0U
+#endif /* DEBUG_CONSOLE_DEFERRED_LOG_ENABLE */
+
+/*! @brief Size in bytes of the deferred log ring buffer, must be a power of two. */
+#ifndef DEBUG_CONSOLE_DEFERRED_LOG_BUFFER_SIZE
+#define DEBUG_CONSOLE_DEFERRED_LOG_BUFFER_SIZE 256U
+#endif /* DEBUG_CONSOLE_DEFERRED_LOG_BUFFER_SIZE */
+
+/*! @brief Maximum number of arguments of a deferred log entry. */
+#define DEBUG_CONSOLE_DEFERRED_LOG_MAX_ARGS 6U
+
 /*! @brief Definition to select redirect toolchain printf, scanf to uart or not.
  *
  *  if SDK_DEBUGCONSOLE defined to 0,it represents select toolchain printf, scanf.
@@ -95,6 +109,18 @@ static inline int DbgConsole_Disabled(void)
 #define PUTCHAR putchar
 #define GETCHAR getchar
 #endif /* SDK_DEBUGCONSOLE */
+
+/*! @brief Logs a message in the deferred binary log, or prints it when the deferred log is disabled.
+ *
+ *  DLOG takes a format string and up to DEBUG_CONSOLE_DEFERRED_LOG_MAX_ARGS arguments, see DbgConsole_DeferredLog().
+ */
+#if ((SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK) && (DEBUG_CONSOLE_DEFERRED_LOG_ENABLE > 0U))
+#define DBGCONSOLE_DLOG_ARG_COUNT(...) DBGCONSOLE_DLOG_ARG_COUNT_(__VA_ARGS__, 6U, 5U, 4U, 3U, 2U, 1U, 0U)
+#define DBGCONSOLE_DLOG_ARG_COUNT_(fmt, a1, a2, a3, a4, a5, a6, n, ...) n
+#define DLOG(...)                      DbgConsole_DeferredLog(DBGCONSOLE_DLOG_ARG_COUNT(__VA_ARGS__), __VA_ARGS__)
+#else
+#define DLOG(...) PRINTF(__VA_ARGS__)
+#endif /* DEBUG_CONSOLE_DEFERRED_LOG_ENABLE */
 /*! @} */
 
 /*! @brief serial port type
@@ -212,7 +238,7 @@ static inline status_t DbgConsole_Error(void)
  * @param   fmt_s Format control string.
  * @return  Returns the number of characters printed or a negative value if an error occurs.
  */
-int DbgConsole_Printf(const char *fmt_s, ...);
+int DbgConsole_Printf(const char *fmt_s, ...) STR_PRINTF_FORMAT(1, 2);
 
 /*!
  * @brief Writes formatted output to the standard output stream.
@@ -223,7 +249,7 @@ int DbgConsole_Printf(const char *fmt_s, ...);
  * @param   formatStringArg Format arguments.
  * @return  Returns the number of characters printed or a negative value if an error occurs.
  */
-int DbgConsole_Vprintf(const char *fmt_s, va_list formatStringArg);
+int DbgConsole_Vprintf(const char *fmt_s, va_list formatStringArg) STR_PRINTF_FORMAT(1, 0);
 
 /*!
  * @brief Writes a character to stdout.
@@ -254,6 +280,44 @@ int DbgConsole_Scanf(char *fmt_s, ...);
  */
 int DbgConsole_Getchar(void);
 
+#if (defined(DEBUG_CONSOLE_DEFERRED_LOG_ENABLE) && (DEBUG_CONSOLE_DEFERRED_LOG_ENABLE > 0U))
+/*!
+ * @brief Records a message in the deferred binary log.
+ *
+ * Call this function, usually through the DLOG macro, to log a message without formatting it. The address of the
+ * format string and the raw arguments are copied into a RAM ring buffer in a few microseconds, and
+ * DbgConsole_DeferredLogFlush() sends them later. The host decoder dbg_log_decode.py rebuilds the text from the
+ * ELF file of the application. The function can be called from any context, including interrupts. When the ring
+ * buffer is full the message is dropped and counted, the count is sent with the next flush.
+ *
+ * Each entry is one header byte 0xA0 + argument count, the format string address and the arguments, 32-bit little
+ * endian. A drop record is the byte 0xAF followed by the number of dropped messages.
+ *
+ * @note The format string must be a literal. Arguments are passed as 32-bit words: integers, characters and
+ *       pointers are supported, %s only for strings stored in the ELF file, float arguments are not supported.
+ *
+ * @param   argCount Number of arguments, at most DEBUG_CONSOLE_DEFERRED_LOG_MAX_ARGS.
+ * @param   fmt_s Format control string.
+ */
+void DbgConsole_DeferredLog(uint32_t argCount, const char *fmt_s, ...) STR_PRINTF_FORMAT(2, 3);
+
+/*!
+ * @brief Sends the deferred log entries to the debug console.
+ *
+ * When the UART adapter is built in non-blocking mode (UART_ADAPTER_NON_BLOCKING_MODE), this function starts an
+ * interrupt driven transmission of all the pending entries and returns at once, @p maxBytes is not used. The
+ * transmission goes on with the entries logged meanwhile each time this function is called. Otherwise the entries
+ * are sent with blocking writes, at most @p maxBytes per call, call this function from the idle loop.
+ *
+ * @note Do not mix PRINTF and a non-blocking deferred log transmission, the blocking writes of PRINTF would
+ *       interleave with it.
+ *
+ * @param   maxBytes Maximum number of bytes sent with blocking writes.
+ * @return  Returns the number of bytes still waiting in the ring buffer.
+ */
+uint32_t DbgConsole_DeferredLogFlush(uint32_t maxBytes);
+#endif /* DEBUG_CONSOLE_DEFERRED_LOG_ENABLE */
+
 #endif /* SDK_DEBUGCONSOLE */
 
 /*! @} */
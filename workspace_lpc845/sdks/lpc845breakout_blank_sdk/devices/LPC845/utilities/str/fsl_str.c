@@ -1,12 +1,14 @@
 /*
- * Copyright 2017, 2020, 2022-2023 NXP
+ * Copyright 2017, 2020, 2022-2024 NXP
  *
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
  */
 
+#if (defined(PRINTF_FLOAT_ENABLE) && (PRINTF_FLOAT_ENABLE > 0U)) || (defined(SCANF_FLOAT_ENABLE) && (SCANF_FLOAT_ENABLE > 0U))
 #include <math.h>
+#endif
 #include <stdarg.h>
 #include <stdlib.h>
 #include <errno.h> /* MISRA C-2012 Rule 22.9 */
@@ -506,150 +508,137 @@ static uint32_t ScanIgnoreWhiteSpace(const char **s)
     return count;
 }
 
+/*!
+ * @brief Returns the high word of the 64-bit product of two 32-bit values.
+ *
+ * Built from 16-bit partial products, the Cortex-M0+ has no long multiply instruction.
+ */
+static inline uint32_t ConvertMulHigh32(uint32_t a, uint32_t b)
+{
+    uint32_t aLow   = a & 0xFFFFU;
+    uint32_t aHigh  = a >> 16U;
+    uint32_t bLow   = b & 0xFFFFU;
+    uint32_t bHigh  = b >> 16U;
+    uint32_t cross1 = aLow * bHigh;
+    uint32_t cross2 = aHigh * bLow;
+    uint32_t middle = ((aLow * bLow) >> 16U) + (cross1 & 0xFFFFU) + (cross2 & 0xFFFFU);
+
+    return (aHigh * bHigh) + (cross1 >> 16U) + (cross2 >> 16U) + (middle >> 16U);
+}
+
+/*!
+ * @brief Writes the decimal digits of a 32-bit value, least significant first, and returns their count.
+ *
+ * Two digits are produced per step, the division by 100 is a multiplication by its reciprocal, exact for all
+ * 32-bit values, and the digit pair comes from a table.
+ */
+static int32_t ConvertDecimal32ToString(char *nstrp, uint32_t value)
+{
+    static const char s_digitPairs[201] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+    int32_t nlen = 0;
+    uint32_t quotient;
+    uint32_t pair;
+
+    while (value >= 100U)
+    {
+        quotient      = ConvertMulHigh32(value, 0x51EB851FU) >> 5U;
+        pair          = (value - (quotient * 100U)) * 2U;
+        nstrp[nlen++] = s_digitPairs[pair + 1U];
+        nstrp[nlen++] = s_digitPairs[pair];
+        value         = quotient;
+    }
+    if (value >= 10U)
+    {
+        nstrp[nlen++] = s_digitPairs[(value * 2U) + 1U];
+        nstrp[nlen++] = s_digitPairs[value * 2U];
+    }
+    else
+    {
+        nstrp[nlen++] = (char)('0' + (char)value);
+    }
+
+    return nlen;
+}
+
 static int32_t ConvertRadixNumToString(char *numstr, void *nump, unsigned int neg, unsigned int radix, bool use_caps)
 {
+    STR_FORMAT_PRINTF_UVAL_TYPE ua;
+    char *nstrp;
+    int32_t nlen;
+    uint32_t shift;
+    uint32_t digit;
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
     long long int a;
-    long long int b;
-    long long int c;
-
-    unsigned long long int ua;
     unsigned long long int ub;
-    unsigned long long int uc;
-    unsigned long long int uc_param;
-#else
-    int a;
-    int b;
-    int c;
-
-    unsigned int ua;
-    unsigned int ub;
-    unsigned int uc;
-    unsigned int uc_param;
+    int32_t chunk;
 #endif /* PRINTF_ADVANCED_ENABLE */
 
-    int32_t nlen;
-    char *nstrp;
-
     nlen     = 0;
     nstrp    = numstr;
     *nstrp++ = '\0';
 
-#if !(defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0u))
-    neg = 0U;
-#endif
-
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-    a        = 0;
-    b        = 0;
-    c        = 0;
-    ua       = 0ULL;
-    ub       = 0ULL;
-    uc       = 0ULL;
-    uc_param = 0ULL;
+    if (0U != neg)
+    {
+        /* The sign is added by the caller, convert the magnitude. */
+        a  = *(long long int *)nump;
+        ua = (a < 0) ? (0ULL - (unsigned long long int)a) : (unsigned long long int)a;
+    }
+    else
+    {
+        ua = *(unsigned long long int *)nump;
+    }
 #else
-    a        = 0;
-    b        = 0;
-    c        = 0;
-    ua       = 0U;
-    ub       = 0U;
-    uc       = 0U;
-    uc_param = 0U;
+    (void)neg;
+    ua = *(unsigned int *)nump;
 #endif /* PRINTF_ADVANCED_ENABLE */
 
-    (void)a;
-    (void)b;
-    (void)c;
-    (void)ua;
-    (void)ub;
-    (void)uc;
-    (void)uc_param;
-    (void)neg;
-    /*
-     * Fix MISRA issue: CID 15972928 (#15 of 15): MISRA C-2012 Control Flow Expressions (MISRA C-2012 Rule 14.3)
-     * misra_c_2012_rule_14_3_violation: Execution cannot reach this statement: a = *((int *)nump);
-     */
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-    if (0U != neg)
+    if (10U == radix)
     {
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-        a = *(long long int *)nump;
-#else
-        a = *(int *)nump;
-#endif /* PRINTF_ADVANCED_ENABLE */
-        if (a == 0)
+        /* One 64-bit division per eight digits, the 32-bit conversion does the rest. */
+        while (ua > 0xFFFFFFFFULL)
         {
-            *nstrp = '0';
-            ++nlen;
-            return nlen;
-        }
-        while (a != 0)
-        {
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-            b = (long long int)a / (long long int)radix;
-            c = (long long int)a - ((long long int)b * (long long int)radix);
-            if (c < 0)
+            ub    = ua / 100000000ULL;
+            chunk = ConvertDecimal32ToString(nstrp, (uint32_t)(ua - (ub * 100000000ULL)));
+            while (chunk < 8)
             {
-                uc       = (unsigned long long int)c;
-                uc_param = ~uc;
-                c        = (long long int)uc_param + 1 + (long long int)'0';
+                nstrp[chunk++] = '0';
             }
-#else
-            b = (int)a / (int)radix;
-            c = (int)a - ((int)b * (int)radix);
-            if (c < 0)
-            {
-                uc       = (unsigned int)c;
-                uc_param = ~uc;
-                c        = (int)uc_param + 1 + (int)'0';
-            }
-#endif /* PRINTF_ADVANCED_ENABLE */
-            else
-            {
-                c = c + (int)'0';
-            }
-            a        = b;
-            *nstrp++ = (char)c;
-            ++nlen;
+            nstrp += 8;
+            nlen += 8;
+            ua = ub;
         }
-    }
-    else
 #endif /* PRINTF_ADVANCED_ENABLE */
+        nlen += ConvertDecimal32ToString(nstrp, (uint32_t)ua);
+    }
+    else if ((2U == radix) || (8U == radix) || (16U == radix))
     {
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-        ua = *(unsigned long long int *)nump;
-#else
-        ua = *(unsigned int *)nump;
-#endif /* PRINTF_ADVANCED_ENABLE */
-        if (ua == 0U)
+        shift = (2U == radix) ? 1U : ((8U == radix) ? 3U : 4U);
+        do
         {
-            *nstrp = '0';
+            digit    = (uint32_t)ua & (radix - 1U);
+            *nstrp++ = (char)((digit < 10U) ? ((uint32_t)'0' + digit) :
+                                              ((uint32_t)(use_caps ? 'A' : 'a') + digit - 10U));
             ++nlen;
-            return nlen;
-        }
-        while (ua != 0U)
+            ua >>= shift;
+        } while (ua != 0U);
+    }
+    else
+    {
+        do
         {
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-            ub = (unsigned long long int)ua / (unsigned long long int)radix;
-            uc = (unsigned long long int)ua - ((unsigned long long int)ub * (unsigned long long int)radix);
-#else
-            ub = ua / (unsigned int)radix;
-            uc = ua - (ub * (unsigned int)radix);
-#endif /* PRINTF_ADVANCED_ENABLE */
-
-            if (uc < 10U)
-            {
-                uc = uc + (unsigned int)'0';
-            }
-            else
-            {
-                uc = uc - 10U + (unsigned int)(use_caps ? 'A' : 'a');
-            }
-            ua       = ub;
-            *nstrp++ = (char)uc;
+            digit    = (uint32_t)(ua % radix);
+            *nstrp++ = (char)((digit < 10U) ? ((uint32_t)'0' + digit) :
+                                              ((uint32_t)(use_caps ? 'A' : 'a') + digit - 10U));
             ++nlen;
-        }
+            ua /= radix;
+        } while (ua != 0U);
     }
+
     return nlen;
 }
 
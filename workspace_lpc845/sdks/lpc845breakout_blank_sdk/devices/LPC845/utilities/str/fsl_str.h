@@ -1,5 +1,5 @@
 /*
- * Copyright 2017 NXP
+ * Copyright 2017, 2024 NXP
  *
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -9,6 +9,7 @@
 #ifndef _FSL_STR_H
 #define _FSL_STR_H
 
+#include <stdarg.h>
 #include "fsl_common.h"
 
 /*!
@@ -40,6 +41,22 @@
 #define SCANF_ADVANCED_ENABLE 0U
 #endif /* SCANF_ADVANCED_ENABLE */
 
+/*! @brief Definition to let the compiler check the arguments of printf like functions against the format string. */
+#ifndef PRINTF_FORMAT_CHECK_ENABLE
+#define PRINTF_FORMAT_CHECK_ENABLE 0U
+#endif /* PRINTF_FORMAT_CHECK_ENABLE */
+
+/*!
+ * @brief Marks a printf like function, the format string is parameter fmtIndex and the arguments start at
+ * parameter argIndex, or 0 for a va_list.
+ */
+#if (defined(PRINTF_FORMAT_CHECK_ENABLE) && (PRINTF_FORMAT_CHECK_ENABLE > 0U)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define STR_PRINTF_FORMAT(fmtIndex, argIndex) __attribute__((format(printf, fmtIndex, argIndex)))
+#else
+#define STR_PRINTF_FORMAT(fmtIndex, argIndex)
+#endif /* PRINTF_FORMAT_CHECK_ENABLE */
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -104,7 +121,7 @@ typedef void (*printfCb)(char *buf, int32_t *indicator, char val, int len);
  *
  * @return Number of characters to be print
  */
-int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb);
+int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb) STR_PRINTF_FORMAT(1, 0);
 
 /*!
  * @brief Converts an input line of ASCII characters based upon a provided
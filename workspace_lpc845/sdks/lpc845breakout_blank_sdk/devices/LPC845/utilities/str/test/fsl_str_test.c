@@ -0,0 +1,270 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host test of the integer to string conversion of fsl_str.
+ *
+ * Build and run from this directory, with and without the advanced printf (64-bit and signed conversion):
+ *   gcc -O2 -Wno-incompatible-pointer-types -I. -I.. -DPRINTF_ADVANCED_ENABLE=0U -o str_test fsl_str_test.c && \
+ *       ./str_test
+ *   gcc -O2 -Wno-incompatible-pointer-types -I. -I.. -DPRINTF_ADVANCED_ENABLE=1U -o str_test fsl_str_test.c && \
+ *       ./str_test
+ *
+ * ConvertRadixNumToString() is compared with a conversion that divides once per digit, the way fsl_str converted
+ * before the reciprocal division, on edge values and on random values of random magnitude in radix 2, 8, 10 and 16,
+ * upper and lower case, signed and unsigned. The digits, their count, the leading terminator and the byte past the
+ * digits are checked. The division by 100 is then checked over all 32-bit inputs, and the conversion time of both
+ * is measured. StrFormatPrintf() itself is not run, it takes the address of its va_list parameter, which only works
+ * where va_list is not an array type, as on Arm but not on x86-64 hosts. The exit code is 0 on success.
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include "fsl_str.c"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_RANDOM_NUM (2000000U)
+#define TEST_BENCH_NUM  (2000000U)
+#define TEST_GUARD      ((char)0x5A)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static unsigned long testSeed = 1U;
+static int testFailures;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t TestRandom(void)
+{
+    testSeed = (testSeed * 1103515245U + 12345U) & 0xFFFFFFFFU;
+    return (uint32_t)(testSeed >> 8);
+}
+
+static double TestNow(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Random value of 0 to 64 significant bits */
+static unsigned long long TestRandomValue(void)
+{
+    unsigned long long value =
+        ((unsigned long long)TestRandom() << 40) ^ ((unsigned long long)TestRandom() << 20) ^ TestRandom();
+    uint32_t bits = TestRandom() % 65U;
+
+    return (bits == 64U) ? value : (value & ((1ULL << bits) - 1ULL));
+}
+
+/* One division per digit, least significant digit first, the magnitude of negative values */
+static int32_t TestConvertReference(char *numstr, void *nump, unsigned int neg, unsigned int radix, bool use_caps)
+{
+    STR_FORMAT_PRINTF_UVAL_TYPE ua;
+    uint32_t digit;
+    int32_t nlen = 0;
+    char *nstrp  = numstr;
+
+    *nstrp++ = '\0';
+
+#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
+    if (0U != neg)
+    {
+        long long int a = *(long long int *)nump;
+
+        do
+        {
+            long long int c = a % (long long int)radix;
+
+            digit    = (uint32_t)((c < 0) ? -c : c);
+            *nstrp++ = (char)((digit < 10U) ? ('0' + digit) : ((use_caps ? 'A' : 'a') + digit - 10U));
+            ++nlen;
+            a /= (long long int)radix;
+        } while (a != 0);
+
+        return nlen;
+    }
+    ua = *(unsigned long long int *)nump;
+#else
+    (void)neg;
+    ua = *(unsigned int *)nump;
+#endif /* PRINTF_ADVANCED_ENABLE */
+
+    do
+    {
+        digit    = (uint32_t)(ua % radix);
+        *nstrp++ = (char)((digit < 10U) ? ('0' + digit) : ((use_caps ? 'A' : 'a') + digit - 10U));
+        ++nlen;
+        ua /= radix;
+    } while (ua != 0U);
+
+    return nlen;
+}
+
+/* Converts value with both and compares, returns false on a mismatch */
+static bool TestCompare(unsigned long long value, unsigned int neg, unsigned int radix, bool use_caps)
+{
+    char actual[72];
+    char expected[72];
+    STR_FORMAT_PRINTF_UVAL_TYPE arg = (STR_FORMAT_PRINTF_UVAL_TYPE)value;
+    int32_t actualLen;
+    int32_t expectedLen;
+
+    (void)memset(actual, TEST_GUARD, sizeof(actual));
+    actualLen   = ConvertRadixNumToString(actual, &arg, neg, radix, use_caps);
+    expectedLen = TestConvertReference(expected, &arg, neg, radix, use_caps);
+
+    if ((actualLen != expectedLen) || (actual[0] != '\0') ||
+        (memcmp(actual, expected, (size_t)expectedLen + 1U) != 0) || (actual[actualLen + 1] != TEST_GUARD))
+    {
+        if (testFailures < 10)
+        {
+            printf("FAIL: %llu%s in radix %u gives %d digits, %d expected\n", value, neg != 0U ? " signed" : "", radix,
+                   (int)actualLen, (int)expectedLen);
+        }
+        testFailures++;
+        return false;
+    }
+
+    return true;
+}
+
+static void TestConversion(void)
+{
+    static const unsigned int radices[] = {2U, 8U, 10U, 16U};
+    static const unsigned long long edges[] = {0ULL,
+                                               1ULL,
+                                               9ULL,
+                                               10ULL,
+                                               99ULL,
+                                               100ULL,
+                                               101ULL,
+                                               999ULL,
+                                               1000ULL,
+                                               99999999ULL,
+                                               100000000ULL,
+                                               4294967295ULL,
+                                               4294967296ULL,
+                                               9999999999999999ULL,
+                                               10000000000000000ULL,
+                                               0x7FFFFFFFFFFFFFFFULL,
+                                               0x8000000000000000ULL,
+                                               0xFFFFFFFFFFFFFFFFULL};
+    uint32_t checks = 0U;
+    uint32_t r, e, k;
+    unsigned int neg;
+    unsigned long long value;
+
+    for (r = 0U; r < sizeof(radices) / sizeof(radices[0]); r++)
+    {
+        for (neg = 0U; neg < ((PRINTF_ADVANCED_ENABLE > 0U) ? 2U : 1U); neg++)
+        {
+            for (e = 0U; e < sizeof(edges) / sizeof(edges[0]); e++)
+            {
+                /* every edge value around the 8 digit chunks, and its negation */
+                for (k = 0U; k < 2U; k++)
+                {
+                    value = (k == 0U) ? edges[e] : (0ULL - edges[e]);
+                    (void)TestCompare(value, neg, radices[r], true);
+                    (void)TestCompare(value, neg, radices[r], false);
+                    checks += 2U;
+                }
+            }
+            for (k = 0U; k < TEST_RANDOM_NUM; k++)
+            {
+                value = TestRandomValue();
+                if ((neg != 0U) && ((TestRandom() & 1U) != 0U))
+                {
+                    value = 0ULL - value;
+                }
+                (void)TestCompare(value, neg, radices[r], (TestRandom() & 1U) != 0U);
+                checks++;
+            }
+        }
+    }
+
+    printf("conversion: %u values compared\n", (unsigned)checks);
+}
+
+/* The reciprocal division by 100 of the decimal conversion, over every 32-bit value */
+static void TestDivide100(void)
+{
+    uint32_t mismatches = 0U;
+    uint32_t value      = 0U;
+
+    do
+    {
+        if ((ConvertMulHigh32(value, 0x51EB851FU) >> 5U) != (value / 100U))
+        {
+            mismatches++;
+        }
+        value++;
+    } while (value != 0U);
+
+    printf("divide by 100: 4294967296 values, %u mismatches\n", (unsigned)mismatches);
+    if (mismatches != 0U)
+    {
+        testFailures++;
+    }
+}
+
+static void TestBenchmark(void)
+{
+    static unsigned long long values[1024];
+    char numstr[72];
+    volatile int32_t sink = 0;
+    STR_FORMAT_PRINTF_UVAL_TYPE arg;
+    unsigned int radix;
+    uint32_t k;
+    double t0, t1, t2;
+
+    for (k = 0U; k < 1024U; k++)
+    {
+        values[k] = TestRandomValue();
+    }
+
+    printf("radix  conversion  per digit division (host, ns per value)\n");
+    for (radix = 10U; radix <= 16U; radix += 6U)
+    {
+        t0 = TestNow();
+        for (k = 0U; k < TEST_BENCH_NUM; k++)
+        {
+            arg = (STR_FORMAT_PRINTF_UVAL_TYPE)values[k & 1023U];
+            sink += ConvertRadixNumToString(numstr, &arg, 0U, radix, false);
+        }
+        t1 = TestNow();
+        for (k = 0U; k < TEST_BENCH_NUM; k++)
+        {
+            arg = (STR_FORMAT_PRINTF_UVAL_TYPE)values[k & 1023U];
+            sink += TestConvertReference(numstr, &arg, 0U, radix, false);
+        }
+        t2 = TestNow();
+
+        printf("%5u  %10.1f  %18.1f\n", radix, (t1 - t0) / TEST_BENCH_NUM * 1e9, (t2 - t1) / TEST_BENCH_NUM * 1e9);
+    }
+    (void)sink;
+}
+
+int main(void)
+{
+    printf("PRINTF_ADVANCED_ENABLE %u\n", (unsigned)PRINTF_ADVANCED_ENABLE);
+    TestConversion();
+    TestDivide100();
+    TestBenchmark();
+
+    printf("%s\n", testFailures == 0 ? "PASS" : "FAIL");
+    return testFailures == 0 ? 0 : 1;
+}
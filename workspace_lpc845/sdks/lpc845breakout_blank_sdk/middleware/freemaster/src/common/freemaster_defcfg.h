@@ -233,6 +233,11 @@
 #define FMSTR_USE_TSA_DYNAMIC 0
 #endif
 
+/* number of variables of the TSA safety index (0 = search the TSA tables on each access) */
+#ifndef FMSTR_TSA_INDEX_SIZE
+#define FMSTR_TSA_INDEX_SIZE 0
+#endif
+
 /* use TSA user-defined resources (experimental feature) */
 #ifndef FMSTR_USE_URES
 #define FMSTR_USE_URES 0
@@ -315,6 +320,11 @@
 #define FMSTR_FASTREC_FALLING_EDGE_TRG_ONLY 0
 #endif
 
+/* compile the recorder variables to a copy plan when the recorder starts */
+#ifndef FMSTR_FASTREC_COPY_PLAN
+#define FMSTR_FASTREC_COPY_PLAN 0
+#endif
+
 #if FMSTR_FASTREC_RISING_EDGE_TRG_ONLY && FMSTR_FASTREC_FALLING_EDGE_TRG_ONLY
 #undef  FMSTR_FASTREC_FALLING_EDGE_TRG_ONLY
 #define FMSTR_FASTREC_FALLING_EDGE_TRG_ONLY 0
@@ -370,5 +380,6 @@
 #define FMSTR_SERIAL_MCUX_UART_ID            413
 #define FMSTR_SERIAL_MCUX_USART_ID           414
 #define FMSTR_SERIAL_MCUX_USB_ID             415
+#define FMSTR_SERIAL_MCUX_MINIUSART_DMA_ID   416
 
 #endif /* __FREEMASTER_DEF_CFG_H */
@@ -45,6 +45,9 @@
 #define FMSTR_REC_STRUCT_ALIGN sizeof(void *)
 #endif
 
+/* copy plan sampling, byte addressing only */
+#define FMSTR_REC_COPY_PLAN (FMSTR_FASTREC_COPY_PLAN > 0 && FMSTR_CFG_BUS_WIDTH == 1U)
+
 /********************************************************
  *  local types definition
  ********************************************************/
@@ -106,6 +109,19 @@ typedef struct FMSTR_REC_VAR_DATA_S
     FMSTR_BOOL trgLastState;          /* last trigger comparison state for edge detection if used */
 } FMSTR_REC_VAR_DATA;
 
+#if FMSTR_REC_COPY_PLAN
+/* One copy of the sampling plan, a block of variables contiguous in memory and in the sample point */
+typedef struct
+{
+    FMSTR_ADDR src;   /* address of the first variable of the block */
+    FMSTR_SIZE count; /* number of units in the block */
+    FMSTR_SIZE unit;  /* 4, 2 or 1 byte unit, the source and destination addresses are aligned on it */
+} FMSTR_REC_COPY;
+
+/* pointer to FMSTR_REC_COPY (potentially far on some platforms) */
+FMSTR_TYPEDEF_LPTR(FMSTR_REC_COPY, FMSTR_LP_REC_COPY);
+#endif /* FMSTR_REC_COPY_PLAN */
+
 /* runtime variables  */
 typedef struct
 {
@@ -122,6 +138,14 @@ typedef struct
     FMSTR_SIZE pointVarCount;     /* number of variables recorded (trigger-only vars excluded) */
     FMSTR_REC_FLAGS flags;        /* recorder flags */
     FMSTR_REC_CFG config;         /* original recorder configuration */
+#if FMSTR_REC_COPY_PLAN
+    FMSTR_LP_REC_COPY copyPlan;   /* copies of the sampled variables, one per block */
+    FMSTR_SIZE copyCount;         /* number of copies, 0 when the variables are sampled one by one */
+    FMSTR_LP_REC_VAR_DATA trgVar; /* the trigger variable, NULL if none */
+    FMSTR_BOOL trgAbove;          /* trigger when the variable gets above the threshold */
+    FMSTR_BOOL trgBelow;          /* trigger when the variable gets below the threshold */
+    FMSTR_BOOL trgLevel;          /* level trigger, otherwise edge */
+#endif
 } FMSTR_REC;
 
 /* pointer to FMSTR_REC (potentially far on some platforms) */
@@ -143,6 +167,10 @@ FMSTR_TYPEDEF_LPTR(FMSTR_REC, FMSTR_LP_REC);
 /**                                         **/
 /*********************************************/
 /**                                         **/
+/**   FMSTR_REC_COPY - arrays (copy plan)   **/
+/**                                         **/
+/*********************************************/
+/**                                         **/
 /**                                         **/
 /**                                         **/
 /**  FreeMASTER recorder samples buffer     **/
@@ -194,6 +222,11 @@ static FMSTR_BOOL _FMSTR_CompareDouble(FMSTR_LP_REC_VAR_DATA varData);
 #endif
 
 static void _FMSTR_Recorder2(FMSTR_LP_REC recorder);
+static void _FMSTR_RecSampleVars(FMSTR_LP_REC recorder);
+#if FMSTR_REC_COPY_PLAN
+static void _FMSTR_RecBuildCopyPlan(FMSTR_LP_REC recorder);
+static void _FMSTR_RecSamplePlan(FMSTR_LP_REC recorder);
+#endif
 
 /********************************************************
  *  static variables
@@ -380,6 +413,10 @@ static FMSTR_U8 _FMSTR_RecMemCfg(FMSTR_LP_REC recorder, FMSTR_INDEX recIndex, FM
     FMSTR_ASSERT(recBuff != NULL);
     FMSTR_ASSERT(recBuff->addr == FMSTR_CAST_PTR_TO_ADDR(recorder));
     FMSTR_ASSERT(recBuff->size >= (FMSTR_SIZE)(sizeof(FMSTR_REC) + sizeof(FMSTR_REC_VAR_DATA) * (FMSTR_SIZE)recCfg->varCount));
+#if FMSTR_REC_COPY_PLAN
+    FMSTR_ASSERT(recBuff->size >= (FMSTR_SIZE)(sizeof(FMSTR_REC) + (sizeof(FMSTR_REC_VAR_DATA) + sizeof(FMSTR_REC_COPY)) *
+                                                                         (FMSTR_SIZE)recCfg->varCount));
+#endif
 
     /* Make sure the recorder is stopped first before clearing the whole structure below
       (in case the FMSTR_Recorder is called from ISR, it could be invoked in the middle of clearing) */
@@ -400,6 +437,14 @@ static FMSTR_U8 _FMSTR_RecMemCfg(FMSTR_LP_REC recorder, FMSTR_INDEX recIndex, FM
     /* Data sampling area follows the variable array */
     dynAddr = FMSTR_CAST_PTR_TO_ADDR(recorder->varDescr + recCfg->varCount);
     dynAddr += FMSTR_GetAlignmentCorrection(dynAddr, FMSTR_REC_STRUCT_ALIGN);
+
+#if FMSTR_REC_COPY_PLAN
+    /* The copy plan takes at most one copy per variable, it is inserted before the sampling area */
+    recorder->copyPlan = (FMSTR_LP_REC_COPY)FMSTR_CAST_ADDR_TO_PTR(dynAddr);
+    dynAddr            = FMSTR_CAST_PTR_TO_ADDR(recorder->copyPlan + recCfg->varCount);
+    dynAddr += FMSTR_GetAlignmentCorrection(dynAddr, FMSTR_REC_STRUCT_ALIGN);
+#endif
+
     recorder->buffAddr = dynAddr;
 
     /*...and spans to the end of the recorder memory */
@@ -1293,6 +1338,11 @@ static FMSTR_U8 _FMSTR_CheckConfiguration(FMSTR_LP_REC recorder)
         recorder->pointSize     = pointSize;
         recorder->pointVarCount = pointVarCount;
 
+#if FMSTR_REC_COPY_PLAN
+        /* compile the variables to the copy plan */
+        _FMSTR_RecBuildCopyPlan(recorder);
+#endif
+
         /* it was not configured before, now everything is okay */
         recorder->flags.all              = 0;
         recorder->flags.flg.isConfigured = 1U;
@@ -1301,6 +1351,110 @@ static FMSTR_U8 _FMSTR_CheckConfiguration(FMSTR_LP_REC recorder)
     return FMSTR_STS_OK;
 }
 
+#if FMSTR_REC_COPY_PLAN
+
+/******************************************************************************
+ *
+ * @brief    Compile the recorder variables to a copy plan
+ *
+ * @param    recorder - recorder structure, configuration checked
+ *
+ * The sampled variables following each other in memory are grouped in one
+ * copy. Each copy moves 32-bit, 16-bit or byte units, the largest unit its
+ * source and destination addresses are aligned on in every sample point. The
+ * copy count stays 0 when more variables trigger, the variables are then
+ * sampled one by one.
+ *
+ ******************************************************************************/
+
+static void _FMSTR_RecBuildCopyPlan(FMSTR_LP_REC recorder)
+{
+    FMSTR_LP_REC_VAR_DATA varData = recorder->varDescr;
+    FMSTR_LP_REC_COPY copy        = NULL;
+    FMSTR_ADDR next               = recorder->buffAddr;
+    FMSTR_ADDR dest               = recorder->buffAddr;
+    FMSTR_SIZE copyCount          = 0U;
+    FMSTR_SIZE unit;
+    FMSTR_SIZE8 i;
+
+    recorder->copyCount = 0U;
+    recorder->trgVar    = NULL;
+
+    for (i = 0; i < recorder->config.varCount; i++)
+    {
+        if (varData->compareFunc != NULL)
+        {
+            /* the plan has a single comparator */
+            if (recorder->trgVar != NULL)
+            {
+                return;
+            }
+            recorder->trgVar = varData;
+        }
+
+        if ((varData->cfg.triggerMode & FMSTR_REC_TRG_F_TRGONLY) == 0U)
+        {
+            if (copy != NULL && varData->cfg.addr == next)
+            {
+                /* the variable follows the previous one, count is in bytes until the unit is known */
+                copy->count += varData->cfg.size;
+            }
+            else
+            {
+                copy        = &recorder->copyPlan[copyCount];
+                copy->src   = varData->cfg.addr;
+                copy->count = varData->cfg.size;
+                copyCount++;
+            }
+            next = varData->cfg.addr + varData->cfg.size;
+        }
+
+        /* advance to next variable (MISRA does not let to do it in the for() statement */
+        varData++;
+    }
+
+    /* the largest unit aligned in the variables, in the buffer and in the sample point */
+    copy = recorder->copyPlan;
+    for (i = 0; i < copyCount; i++)
+    {
+        unit = 4U;
+        while (unit > 1U && (FMSTR_GetAlignmentCorrection(copy->src, unit) != 0U ||
+                             FMSTR_GetAlignmentCorrection(dest, unit) != 0U || (copy->count % unit) != 0U ||
+                             (recorder->pointSize % unit) != 0U))
+        {
+            unit /= 2U;
+        }
+
+        dest += copy->count;
+        copy->count /= unit;
+        copy->unit = unit;
+        copy++;
+    }
+
+    if (recorder->trgVar != NULL)
+    {
+#if FMSTR_FASTREC_RISING_EDGE_TRG_ONLY
+        recorder->trgAbove = FMSTR_TRUE;
+        recorder->trgBelow = FMSTR_FALSE;
+        recorder->trgLevel = FMSTR_FALSE;
+#elif FMSTR_FASTREC_FALLING_EDGE_TRG_ONLY
+        recorder->trgAbove = FMSTR_FALSE;
+        recorder->trgBelow = FMSTR_TRUE;
+        recorder->trgLevel = FMSTR_FALSE;
+#else
+        FMSTR_SIZE8 triggerMode = recorder->trgVar->cfg.triggerMode;
+
+        recorder->trgAbove = (FMSTR_BOOL)((triggerMode & FMSTR_REC_TRG_F_ABOVE) != 0U ? FMSTR_TRUE : FMSTR_FALSE);
+        recorder->trgBelow = (FMSTR_BOOL)((triggerMode & FMSTR_REC_TRG_F_BELOW) != 0U ? FMSTR_TRUE : FMSTR_FALSE);
+        recorder->trgLevel = (FMSTR_BOOL)((triggerMode & FMSTR_REC_TRG_F_LEVEL) != 0U ? FMSTR_TRUE : FMSTR_FALSE);
+#endif
+    }
+
+    recorder->copyCount = copyCount;
+}
+
+#endif /* FMSTR_REC_COPY_PLAN */
+
 /******************************************************************************
  *
  * @brief    Compare macro used in trigger detection
@@ -1447,15 +1601,6 @@ void FMSTR_Recorder(FMSTR_INDEX recIndex)
 
 static void _FMSTR_Recorder2(FMSTR_LP_REC recorder)
 {
-    FMSTR_LP_REC_VAR_DATA recVarData;
-    FMSTR_PCOMPAREFUNC compareFunc;
-    FMSTR_PREADFUNC readFunc;
-    FMSTR_SIZE8 triggerMode;
-    FMSTR_SIZE8 sz;
-    FMSTR_SIZE i;
-    FMSTR_BOOL cmp;
-    FMSTR_U8 triggerResult;
-
 #if FMSTR_FASTREC_NO_TIME_DIVISION == 0
     /* skip this call ? */
     if (recorder->timeDivCtr > 0U)
@@ -1469,6 +1614,64 @@ static void _FMSTR_Recorder2(FMSTR_LP_REC recorder)
     recorder->timeDivCtr = recorder->config.timeDiv;
 #endif /* FMSTR_FASTREC_NO_TIME_DIVISION */
 
+#if FMSTR_REC_COPY_PLAN
+    if (recorder->copyCount > 0U)
+    {
+        _FMSTR_RecSamplePlan(recorder);
+    }
+    else
+#endif
+    {
+        _FMSTR_RecSampleVars(recorder);
+    }
+
+    /* We now have at least some data*/
+    recorder->flags.flg.hasData = 1U;
+
+    /* wrap around (circular buffer) ? */
+    if (recorder->writePtr >= recorder->endBuffPtr)
+    {
+        recorder->writePtr                = recorder->buffAddr;
+        recorder->flags.flg.isVirginCycle = 0U;
+    }
+
+    /* in stopping mode ? (note that this bit might have been set just above!) */
+    if (recorder->flags.flg.isStopping != 0U)
+    {
+        /* count down post-trigger samples expired ? */
+        if (recorder->stopRecCountDown == 0U)
+        {
+            /* STOP RECORDER */
+            recorder->flags.flg.isRunning = 0U;
+            return;
+        }
+
+        /* perhaps next time */
+        recorder->stopRecCountDown--;
+    }
+}
+
+/******************************************************************************
+ *
+ * @brief    Take a snapshot of the recorder variables one by one
+ *
+ ******************************************************************************/
+
+#if defined(FMSTR_PLATFORM_56F8xxx) || defined(FMSTR_PLATFORM_56F8xx)
+#pragma interrupt called
+#endif
+
+static void _FMSTR_RecSampleVars(FMSTR_LP_REC recorder)
+{
+    FMSTR_LP_REC_VAR_DATA recVarData;
+    FMSTR_PCOMPAREFUNC compareFunc;
+    FMSTR_PREADFUNC readFunc;
+    FMSTR_SIZE8 triggerMode;
+    FMSTR_SIZE8 sz;
+    FMSTR_SIZE i;
+    FMSTR_BOOL cmp;
+    FMSTR_U8 triggerResult;
+
     /* variable info data for the next loop processing */
     recVarData  = recorder->varDescr;
 
@@ -1540,34 +1743,95 @@ static void _FMSTR_Recorder2(FMSTR_LP_REC recorder)
         recVarData++;
     }
 
-    /* We now have at least some data*/
-    recorder->flags.flg.hasData = 1U;
+    FMSTR_UNUSED(triggerResult);
+}
 
-    /* wrap around (circular buffer) ? */
-    if (recorder->writePtr >= recorder->endBuffPtr)
+#if FMSTR_REC_COPY_PLAN
+
+/******************************************************************************
+ *
+ * @brief    Take a snapshot of the recorder variables by the copy plan
+ *
+ ******************************************************************************/
+
+#if defined(FMSTR_PLATFORM_56F8xxx) || defined(FMSTR_PLATFORM_56F8xx)
+#pragma interrupt called
+#endif
+
+static void _FMSTR_RecSamplePlan(FMSTR_LP_REC recorder)
+{
+    FMSTR_LP_REC_COPY copy       = recorder->copyPlan;
+    FMSTR_LP_REC_COPY copyEnd    = copy + recorder->copyCount;
+    FMSTR_LP_REC_VAR_DATA trgVar = recorder->trgVar;
+    FMSTR_ADDR dest              = recorder->writePtr;
+    FMSTR_SIZE n;
+    FMSTR_BOOL cmp;
+
+    /* test trigger condition if still running */
+    if (trgVar != NULL && recorder->flags.flg.isStopping == 0U)
     {
-        recorder->writePtr                = recorder->buffAddr;
-        recorder->flags.flg.isVirginCycle = 0U;
+        cmp = trgVar->compareFunc(trgVar);
+
+        /* above or below as configured, on the level or when the comparison changes (no trigger in virgin cycle) */
+        if (((((cmp & recorder->trgAbove) | ((cmp ^ 1U) & recorder->trgBelow)) &
+              (recorder->trgLevel | (cmp ^ trgVar->trgLastState))) != 0U) &&
+            recorder->flags.flg.isVirginCycle == 0U)
+        {
+            (void)_FMSTR_TriggerRec(recorder);
+        }
+
+        /* Store the last comparison */
+        trgVar->trgLastState = cmp;
     }
 
-    /* in stopping mode ? (note that this bit might have been set just above!) */
-    if (recorder->flags.flg.isStopping != 0U)
+    /* copy the blocks of variables */
+    while (copy < copyEnd)
     {
-        /* count down post-trigger samples expired ? */
-        if (recorder->stopRecCountDown == 0U)
+        n = copy->count;
+
+        if (copy->unit == 4U)
         {
-            /* STOP RECORDER */
-            recorder->flags.flg.isRunning = 0U;
-            return;
+            FMSTR_LP_U32 src32  = (FMSTR_LP_U32)FMSTR_CAST_ADDR_TO_PTR(copy->src);
+            FMSTR_LP_U32 dest32 = (FMSTR_LP_U32)FMSTR_CAST_ADDR_TO_PTR(dest);
+
+            while (n > 0U)
+            {
+                *dest32++ = *src32++;
+                n--;
+            }
         }
+        else if (copy->unit == 2U)
+        {
+            FMSTR_LP_U16 src16  = (FMSTR_LP_U16)FMSTR_CAST_ADDR_TO_PTR(copy->src);
+            FMSTR_LP_U16 dest16 = (FMSTR_LP_U16)FMSTR_CAST_ADDR_TO_PTR(dest);
 
-        /* perhaps next time */
-        recorder->stopRecCountDown--;
+            while (n > 0U)
+            {
+                *dest16++ = *src16++;
+                n--;
+            }
+        }
+        else
+        {
+            FMSTR_LP_U8 src8  = (FMSTR_LP_U8)FMSTR_CAST_ADDR_TO_PTR(copy->src);
+            FMSTR_LP_U8 dest8 = (FMSTR_LP_U8)FMSTR_CAST_ADDR_TO_PTR(dest);
+
+            while (n > 0U)
+            {
+                *dest8++ = *src8++;
+                n--;
+            }
+        }
+
+        dest += copy->count * copy->unit;
+        copy++;
     }
 
-    FMSTR_UNUSED(triggerResult);
+    recorder->writePtr = dest;
 }
 
+#endif /* FMSTR_REC_COPY_PLAN */
+
 #else /* FMSTR_USE_RECORDER && (!FMSTR_DISABLE) */
 
 FMSTR_BOOL FMSTR_RecorderCreate(FMSTR_INDEX recIndex, FMSTR_REC_BUFF *buffCfg)
@@ -39,6 +39,37 @@ static FMSTR_ADDR fmstr_tsaBuffAddr; /* Dynamic TSA buffer address */
 static FMSTR_SIZE fmstr_tsaTableIndex;
 #endif
 
+#if FMSTR_USE_TSA_SAFETY > 0 && FMSTR_TSA_INDEX_SIZE > 0
+
+/* TSA index states */
+#define FMSTR_TSA_INDEX_STALE    0U /* to be built from the TSA tables */
+#define FMSTR_TSA_INDEX_VALID    1U /* covers all variables of the TSA tables */
+#define FMSTR_TSA_INDEX_OVERFLOW 2U /* too many variables, the TSA tables are searched instead */
+
+/* Memory range of a TSA variable */
+typedef struct
+{
+    FMSTR_ADDR addr; /* first byte */
+    FMSTR_ADDR end;  /* first byte after the variable */
+} FMSTR_TSA_RANGE;
+
+/* Ranges sorted by address. A range contained in another one is dropped, so both the start
+   and the end addresses increase along the array and the only range which may contain a
+   given address is the last one starting at or before it. */
+typedef struct
+{
+    FMSTR_TSA_RANGE ranges[FMSTR_TSA_INDEX_SIZE];
+    FMSTR_SIZE count;   /* number of ranges */
+    FMSTR_SIZE lastHit; /* range found by the previous lookup */
+} FMSTR_TSA_INDEX;
+
+static FMSTR_TSA_INDEX fmstr_tsaIndex[2]; /* [0] for read access (all variables), [1] for write access */
+static FMSTR_U8 fmstr_tsaIndexState;
+
+static void _FMSTR_TsaIndexBuild(void);
+static FMSTR_BOOL _FMSTR_TsaIndexAdd(FMSTR_LP_TSA_ENTRY pte);
+#endif
+
 /******************************************************************************
  *
  * @brief    TSA Initialization
@@ -54,6 +85,11 @@ FMSTR_BOOL FMSTR_InitTsa(void)
     fmstr_tsaBuffAddr   = (FMSTR_ADDR)NULL;
 #endif
 
+#if FMSTR_USE_TSA_SAFETY > 0 && FMSTR_TSA_INDEX_SIZE > 0
+    /* index the variables of the static tables now, the dynamic table is indexed as it grows */
+    _FMSTR_TsaIndexBuild();
+#endif
+
     return FMSTR_TRUE;
 }
 
@@ -73,6 +109,9 @@ FMSTR_BOOL FMSTR_SetUpTsaBuff(FMSTR_ADDR buffAddr, FMSTR_SIZE buffSize)
         FMSTR_SIZE alignment = FMSTR_GetAlignmentCorrection(buffAddr, sizeof(FMSTR_ADDR));
         fmstr_tsaBuffAddr    = buffAddr + alignment;
         fmstr_tsaBuffSize    = buffSize - alignment;
+#if FMSTR_USE_TSA_SAFETY > 0 && FMSTR_TSA_INDEX_SIZE > 0
+        fmstr_tsaIndexState = FMSTR_TSA_INDEX_STALE;
+#endif
         return FMSTR_TRUE;
     }
     else
@@ -160,6 +199,13 @@ FMSTR_BOOL FMSTR_TsaAddVar(FMSTR_TSATBL_STRPTR tsaName,
         pItem->addr.p = FMSTR_TSATBL_VOIDPTR_CAST(varAddr);
         pItem->info.p = FMSTR_TSATBL_VOIDPTR_CAST(info);
         fmstr_tsaTableIndex++;
+
+#if FMSTR_USE_TSA_SAFETY > 0 && FMSTR_TSA_INDEX_SIZE > 0
+        if (fmstr_tsaIndexState == FMSTR_TSA_INDEX_VALID && _FMSTR_TsaIndexAdd(pItem) == FMSTR_FALSE)
+        {
+            fmstr_tsaIndexState = FMSTR_TSA_INDEX_OVERFLOW;
+        }
+#endif
         return FMSTR_TRUE;
     }
     else
@@ -312,9 +358,250 @@ static FMSTR_BOOL FMSTR_CheckMemSpace(FMSTR_ADDR addrUser,
     return ret;
 }
 
+#if FMSTR_USE_TSA_SAFETY > 0 && FMSTR_TSA_INDEX_SIZE > 0
+
 /******************************************************************************
  *
- * @brief    Check wether given memory region is "safe" (covered by TSA)
+ * @brief    Find the last range of the index starting at or before given address
+ *
+ * @param    index - TSA index
+ * @param    addr  - address
+ *
+ * @return   Position of the range, or index->count if all ranges start after addr
+ *
+ ******************************************************************************/
+
+static FMSTR_SIZE _FMSTR_TsaIndexFind(FMSTR_TSA_INDEX *index, FMSTR_ADDR addr)
+{
+    FMSTR_SIZE low  = 0U;
+    FMSTR_SIZE high = index->count;
+    FMSTR_SIZE mid;
+
+    /* binary search of the first range starting after addr */
+    while (low < high)
+    {
+        mid = low + ((high - low) / 2U);
+        if (index->ranges[mid].addr <= addr)
+        {
+            low = mid + 1U;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return (low > 0U) ? (low - 1U) : index->count;
+}
+
+/******************************************************************************
+ *
+ * @brief    Insert a variable range to the index
+ *
+ * @param    index - TSA index
+ * @param    addr  - address of the variable
+ * @param    end   - address after the variable
+ *
+ * @return   FMSTR_FALSE if the index is full
+ *
+ ******************************************************************************/
+
+static FMSTR_BOOL _FMSTR_TsaIndexInsert(FMSTR_TSA_INDEX *index, FMSTR_ADDR addr, FMSTR_ADDR end)
+{
+    FMSTR_SIZE pos = _FMSTR_TsaIndexFind(index, addr);
+    FMSTR_SIZE last;
+    FMSTR_SIZE i;
+
+    if (pos < index->count)
+    {
+        /* the range is covered by an existing one */
+        if (end <= index->ranges[pos].end)
+        {
+            return FMSTR_TRUE;
+        }
+
+        /* the new range goes after this one unless they start at the same address */
+        if (index->ranges[pos].addr < addr)
+        {
+            pos++;
+        }
+    }
+    else
+    {
+        pos = 0U;
+    }
+
+    /* drop the ranges covered by the new one */
+    last = pos;
+    while (last < index->count && index->ranges[last].end <= end)
+    {
+        last++;
+    }
+
+    if (last == pos)
+    {
+        if (index->count >= (FMSTR_SIZE)FMSTR_TSA_INDEX_SIZE)
+        {
+            return FMSTR_FALSE;
+        }
+
+        for (i = index->count; i > pos; i--)
+        {
+            index->ranges[i] = index->ranges[i - 1U];
+        }
+        index->count++;
+    }
+    else
+    {
+        for (i = last; i < index->count; i++)
+        {
+            index->ranges[i - (last - pos) + 1U] = index->ranges[i];
+        }
+        index->count -= (last - pos) - 1U;
+    }
+
+    index->ranges[pos].addr = addr;
+    index->ranges[pos].end  = end;
+    index->lastHit          = 0U;
+    return FMSTR_TRUE;
+}
+
+/******************************************************************************
+ *
+ * @brief    Add a TSA table entry to the index if it is a variable
+ *
+ * @param    pte - TSA table entry
+ *
+ * @return   FMSTR_FALSE if the index is full
+ *
+ ******************************************************************************/
+
+static FMSTR_BOOL _FMSTR_TsaIndexAdd(FMSTR_LP_TSA_ENTRY pte)
+{
+    FMSTR_ADDR addr;
+    FMSTR_ADDR end;
+    unsigned long info;
+
+    if (sizeof(pte->addr.p) < sizeof(pte->addr.n))
+    {
+        info = (unsigned long)pte->info.n;
+        addr = pte->addr.n;
+    }
+    else
+    {
+        info = (unsigned long)pte->info.p;
+        addr = (FMSTR_ADDR)pte->addr.p;
+    }
+
+    if (_FMSTR_IsMemoryMapped(pte->type.p, info) == FMSTR_FALSE)
+    {
+        return FMSTR_TRUE;
+    }
+
+#ifdef __HCS12X__
+    /* convert from logical to global if needed */
+    addr = FMSTR_FixHcs12xAddr(addr);
+#endif
+    end = addr + (FMSTR_SIZE)(info >> 2);
+
+    if (_FMSTR_TsaIndexInsert(&fmstr_tsaIndex[0], addr, end) == FMSTR_FALSE)
+    {
+        return FMSTR_FALSE;
+    }
+
+    if ((info & FMSTR_TSA_INFO_VAR_MASK) == FMSTR_TSA_INFO_RW_VAR)
+    {
+        return _FMSTR_TsaIndexInsert(&fmstr_tsaIndex[1], addr, end);
+    }
+
+    return FMSTR_TRUE;
+}
+
+/******************************************************************************
+ *
+ * @brief    Build the index of the variables of all TSA tables
+ *
+ ******************************************************************************/
+
+static void _FMSTR_TsaIndexBuild(void)
+{
+    FMSTR_LP_TSA_ENTRY pte;
+    FMSTR_ADDR pteAddr;
+    FMSTR_SIZE tableIndex;
+    FMSTR_SIZE i, cnt;
+
+    fmstr_tsaIndex[0].count   = 0U;
+    fmstr_tsaIndex[0].lastHit = 0U;
+    fmstr_tsaIndex[1].count   = 0U;
+    fmstr_tsaIndex[1].lastHit = 0U;
+    fmstr_tsaIndexState       = FMSTR_TSA_INDEX_VALID;
+
+    tableIndex = 0U;
+    while ((pteAddr = FMSTR_TsaGetTable(tableIndex, &cnt)) != NULL)
+    {
+        pte = (FMSTR_LP_TSA_ENTRY)FMSTR_CAST_ADDR_TO_PTR(pteAddr);
+
+        /* number of items in a table */
+        cnt /= (FMSTR_SIZE)sizeof(FMSTR_TSA_ENTRY);
+
+        /* all table entries */
+        for (i = 0U; i < cnt; i++)
+        {
+            if (_FMSTR_TsaIndexAdd(pte) == FMSTR_FALSE)
+            {
+                fmstr_tsaIndexState = FMSTR_TSA_INDEX_OVERFLOW;
+                return;
+            }
+
+            pte++;
+        }
+
+        tableIndex++;
+    }
+}
+
+/******************************************************************************
+ *
+ * @brief    Look up a memory region in the index
+ *
+ * @param    index   - TSA index
+ * @param    varAddr - address of the memory to be checked
+ * @param    varSize - size of the memory to be checked
+ *
+ * @return   Non-zero if the region lies in one of the variables
+ *
+ ******************************************************************************/
+
+static FMSTR_BOOL _FMSTR_TsaIndexLookup(FMSTR_TSA_INDEX *index, FMSTR_ADDR varAddr, FMSTR_SIZE varSize)
+{
+    FMSTR_SIZE pos;
+
+#ifdef __HCS12X__
+    /* convert from logical to global if needed */
+    varAddr = FMSTR_FixHcs12xAddr(varAddr);
+#endif
+
+    /* the host polls the same variables over and over, try the previous hit first */
+    pos = index->lastHit;
+    if (pos >= index->count || varAddr < index->ranges[pos].addr || (varAddr + varSize) > index->ranges[pos].end)
+    {
+        pos = _FMSTR_TsaIndexFind(index, varAddr);
+        if (pos >= index->count || (varAddr + varSize) > index->ranges[pos].end)
+        {
+            return FMSTR_FALSE;
+        }
+
+        index->lastHit = pos;
+    }
+
+    return FMSTR_TRUE;
+}
+
+#endif /* FMSTR_USE_TSA_SAFETY > 0 && FMSTR_TSA_INDEX_SIZE > 0 */
+
+/******************************************************************************
+ *
+ * @brief    Check wether given memory region lies in a variable of the TSA tables
  *
  * @param    varAddr - address of the memory to be checked
  * @param    varSize  - size of the memory to be checked
@@ -324,7 +611,7 @@ static FMSTR_BOOL FMSTR_CheckMemSpace(FMSTR_ADDR addrUser,
  *
  ******************************************************************************/
 
-FMSTR_BOOL FMSTR_CheckTsaSpace(FMSTR_ADDR varAddr, FMSTR_SIZE varSize, FMSTR_BOOL writeAccess)
+static FMSTR_BOOL _FMSTR_CheckTsaVarSpace(FMSTR_ADDR varAddr, FMSTR_SIZE varSize, FMSTR_BOOL writeAccess)
 {
     FMSTR_LP_TSA_ENTRY pte;
     FMSTR_ADDR pteAddr;
@@ -333,13 +620,6 @@ FMSTR_BOOL FMSTR_CheckTsaSpace(FMSTR_ADDR varAddr, FMSTR_SIZE varSize, FMSTR_BOO
     unsigned long info;
     const char *type;
 
-#if FMSTR_CFG_BUS_WIDTH >= 2U
-    /* TSA tables use sizeof() operator which returns size in "bus-widths" (e.g. 56F8xx) */
-    varSize = (varSize + 1) / FMSTR_CFG_BUS_WIDTH;
-#endif
-
-    /* to be as fast as possible during normal operation,
-       check variable entries in all tables first */
     tableIndex = 0U;
     while ((pteAddr = FMSTR_TsaGetTable(tableIndex, &cnt)) != NULL)
     {
@@ -390,6 +670,59 @@ FMSTR_BOOL FMSTR_CheckTsaSpace(FMSTR_ADDR varAddr, FMSTR_SIZE varSize, FMSTR_BOO
         tableIndex++;
     }
 
+    return FMSTR_FALSE;
+}
+
+/******************************************************************************
+ *
+ * @brief    Check wether given memory region is "safe" (covered by TSA)
+ *
+ * @param    varAddr - address of the memory to be checked
+ * @param    varSize  - size of the memory to be checked
+ * @param    writeAccess - write access is required
+ *
+ * @return   This function returns non-zero if user space is safe
+ *
+ ******************************************************************************/
+
+FMSTR_BOOL FMSTR_CheckTsaSpace(FMSTR_ADDR varAddr, FMSTR_SIZE varSize, FMSTR_BOOL writeAccess)
+{
+    FMSTR_LP_TSA_ENTRY pte;
+    FMSTR_ADDR pteAddr;
+    FMSTR_SIZE tableIndex;
+    FMSTR_SIZE i, cnt;
+    FMSTR_BOOL granted;
+
+#if FMSTR_CFG_BUS_WIDTH >= 2U
+    /* TSA tables use sizeof() operator which returns size in "bus-widths" (e.g. 56F8xx) */
+    varSize = (varSize + 1) / FMSTR_CFG_BUS_WIDTH;
+#endif
+
+    /* to be as fast as possible during normal operation,
+       check variable entries in all tables first */
+#if FMSTR_USE_TSA_SAFETY > 0 && FMSTR_TSA_INDEX_SIZE > 0
+    /* the dynamic table was replaced */
+    if (fmstr_tsaIndexState == FMSTR_TSA_INDEX_STALE)
+    {
+        _FMSTR_TsaIndexBuild();
+    }
+
+    if (fmstr_tsaIndexState == FMSTR_TSA_INDEX_VALID)
+    {
+        granted = _FMSTR_TsaIndexLookup(&fmstr_tsaIndex[writeAccess != FMSTR_FALSE ? 1 : 0], varAddr, varSize);
+    }
+    else
+#endif
+    {
+        granted = _FMSTR_CheckTsaVarSpace(varAddr, varSize, writeAccess);
+    }
+
+    if (granted != FMSTR_FALSE)
+    {
+        return FMSTR_TRUE; /* access granted! */
+    }
+
+
     /* no more writable memory chunks available */
     if (writeAccess != FMSTR_FALSE)
     {
@@ -0,0 +1,416 @@
+/*
+ * Copyright (c) 2007-2015 Freescale Semiconductor, Inc.
+ * Copyright 2018-2020, 2024 NXP
+ *
+ * License: NXP LA_OPT_Online Code Hosting NXP_Software_License
+ *
+ * NXP Proprietary. This software is owned or controlled by NXP and may
+ * only be used strictly in accordance with the applicable license terms.
+ * By expressly accepting such terms or by downloading, installing,
+ * activating and/or otherwise using the software, you are agreeing that
+ * you have read, and that you agree to comply with and are bound by,
+ * such license terms.  If you do not agree to be bound by the applicable
+ * license terms, then you may not retain, install, activate or otherwise
+ * use the software.
+ *
+ * FreeMASTER Communication Driver - MINIUSART low-level driver with DMA
+ */
+
+#include "freemaster.h"
+#include "freemaster_private.h"
+
+/* Compile this code only if the SERIAL driver is selected in freemaster_cfg.h. */
+#if defined(FMSTR_SERIAL_DRV) && (FMSTR_MK_IDSTR(FMSTR_SERIAL_DRV) == FMSTR_SERIAL_MCUX_MINIUSART_DMA_ID)
+
+#include "freemaster_serial_miniusart_dma.h"
+
+#if FMSTR_DISABLE == 0
+
+#include "fsl_common.h"
+#include "fsl_usart.h"
+#include "fsl_usart_dma.h"
+
+#include "freemaster_protocol.h"
+#include "freemaster_serial.h"
+
+/******************************************************************************
+ * Adapter configuration
+ ******************************************************************************/
+#if FMSTR_POLL_DRIVEN == 0
+#error The MINIUSART_DMA driver supports the poll-driven mode only, the frames are processed in FMSTR_Poll.
+#endif
+
+#if FMSTR_SERIAL_SINGLEWIRE > 0
+#error The MINIUSART_DMA driver does not support single wire configuration of UART communication.
+#endif
+
+#if (FMSTR_SERIAL_DMA_RX_RING_SIZE < 2) || ((FMSTR_SERIAL_DMA_RX_RING_SIZE % 2) != 0) || \
+    (FMSTR_SERIAL_DMA_RX_RING_SIZE > USART_DMA_RX_RING_BUFFER_MAX_SIZE)
+#error FMSTR_SERIAL_DMA_RX_RING_SIZE must be even and at most USART_DMA_RX_RING_BUFFER_MAX_SIZE.
+#endif
+
+/* Characters taken from the receive ring buffer at once */
+#define FMSTR_SERIAL_DMA_RX_CHUNK_SIZE 16
+
+/******************************************************************************
+ * Type definitions
+ ******************************************************************************/
+
+/* Context structure of the MINIUSART DMA interface */
+typedef struct FMSTR_MINIUSART_DMA_CTX_S
+{
+    usart_dma_handle_t handle;                            /* USART DMA transactional handle */
+    FMSTR_BCHR rxRing[FMSTR_SERIAL_DMA_RX_RING_SIZE];     /* Receive ring buffer, filled by the DMA */
+    FMSTR_BCHR rxChunk[FMSTR_SERIAL_DMA_RX_CHUNK_SIZE];   /* Characters taken from the ring buffer */
+    FMSTR_BCHR txBuffer[FMSTR_SERIAL_DMA_TX_BUFFER_SIZE]; /* Transmit buffer, sent by the DMA */
+    FMSTR_SIZE rxCount;                                   /* Characters in the chunk */
+    FMSTR_SIZE rxIndex;                                   /* Next character in the chunk */
+    FMSTR_SIZE txSize;                                    /* Data size in transmit buffer */
+    FMSTR_BOOL txEnabled;                                 /* Transmit is enabled */
+    FMSTR_BOOL rxEnabled;                                 /* Receiver enabled */
+} FMSTR_MINIUSART_DMA_CTX;
+
+/***********************************
+ *  local variables
+ ***********************************/
+
+/* Serial base address */
+#ifdef FMSTR_SERIAL_BASE
+static USART_Type *fmstr_serialBaseAddr = FMSTR_SERIAL_BASE;
+#else
+static USART_Type *fmstr_serialBaseAddr = NULL;
+#endif
+
+/* DMA channels serving the USART requests */
+static dma_handle_t *fmstr_serialTxDmaHandle = NULL;
+static dma_handle_t *fmstr_serialRxDmaHandle = NULL;
+
+/* Context data of the MINIUSART DMA interface */
+static FMSTR_MINIUSART_DMA_CTX fmstr_miniUsartDmaCtx;
+
+/***********************************
+ *  local function prototypes
+ ***********************************/
+
+/* Interface function - Initialization of serial UART driver adapter */
+static FMSTR_BOOL _FMSTR_SerialMiniUsartDmaInit(void);
+static void _FMSTR_SerialMiniUsartDmaEnableTransmit(FMSTR_BOOL enable);
+static void _FMSTR_SerialMiniUsartDmaEnableReceive(FMSTR_BOOL enable);
+static void _FMSTR_SerialMiniUsartDmaEnableTransmitInterrupt(FMSTR_BOOL enable);
+static void _FMSTR_SerialMiniUsartDmaEnableTransmitCompleteInterrupt(FMSTR_BOOL enable);
+static void _FMSTR_SerialMiniUsartDmaEnableReceiveInterrupt(FMSTR_BOOL enable);
+static FMSTR_BOOL _FMSTR_SerialMiniUsartDmaIsTransmitRegEmpty(void);
+static FMSTR_BOOL _FMSTR_SerialMiniUsartDmaIsReceiveRegFull(void);
+static FMSTR_BOOL _FMSTR_SerialMiniUsartDmaIsTransmitterActive(void);
+static void _FMSTR_SerialMiniUsartDmaPutChar(FMSTR_BCHR ch);
+static FMSTR_BCHR _FMSTR_SerialMiniUsartDmaGetChar(void);
+static void _FMSTR_SerialMiniUsartDmaFlush(void);
+static FMSTR_BOOL _FMSTR_SerialMiniUsartDmaIsSending(void);
+
+/***********************************
+ *  global variables
+ ***********************************/
+/* Interface of this serial UART driver */
+const FMSTR_SERIAL_DRV_INTF FMSTR_SERIAL_MCUX_MINIUSART_DMA = {
+    .Init                            = _FMSTR_SerialMiniUsartDmaInit,
+    .EnableTransmit                  = _FMSTR_SerialMiniUsartDmaEnableTransmit,
+    .EnableReceive                   = _FMSTR_SerialMiniUsartDmaEnableReceive,
+    .EnableTransmitInterrupt         = _FMSTR_SerialMiniUsartDmaEnableTransmitInterrupt,
+    .EnableTransmitCompleteInterrupt = _FMSTR_SerialMiniUsartDmaEnableTransmitCompleteInterrupt,
+    .EnableReceiveInterrupt          = _FMSTR_SerialMiniUsartDmaEnableReceiveInterrupt,
+    .IsTransmitRegEmpty              = _FMSTR_SerialMiniUsartDmaIsTransmitRegEmpty,
+    .IsReceiveRegFull                = _FMSTR_SerialMiniUsartDmaIsReceiveRegFull,
+    .IsTransmitterActive             = _FMSTR_SerialMiniUsartDmaIsTransmitterActive,
+    .PutChar                         = _FMSTR_SerialMiniUsartDmaPutChar,
+    .GetChar                         = _FMSTR_SerialMiniUsartDmaGetChar,
+    .Flush                           = _FMSTR_SerialMiniUsartDmaFlush,
+};
+
+/******************************************************************************
+ *
+ * @brief    Serial communication initialization
+ *
+ * The receive DMA runs continuously into the ring buffer, the characters are
+ * taken from it in FMSTR_Poll. No USART interrupt is used, the DMA interrupt
+ * is taken once per half of the ring buffer and once per response.
+ *
+ ******************************************************************************/
+static FMSTR_BOOL _FMSTR_SerialMiniUsartDmaInit(void)
+{
+    /* valid runtime module address and DMA channels must be assigned */
+    if (fmstr_serialBaseAddr == NULL || fmstr_serialTxDmaHandle == NULL || fmstr_serialRxDmaHandle == NULL)
+    {
+        return FMSTR_FALSE;
+    }
+
+    FMSTR_MemSet(&fmstr_miniUsartDmaCtx, 0, sizeof(fmstr_miniUsartDmaCtx));
+
+    if (USART_TransferCreateHandleDMA(fmstr_serialBaseAddr, &fmstr_miniUsartDmaCtx.handle, NULL, NULL,
+                                      fmstr_serialTxDmaHandle, fmstr_serialRxDmaHandle) != kStatus_Success)
+    {
+        return FMSTR_FALSE;
+    }
+
+    if (USART_TransferStartRingBufferDMA(fmstr_serialBaseAddr, &fmstr_miniUsartDmaCtx.handle,
+                                         fmstr_miniUsartDmaCtx.rxRing,
+                                         sizeof(fmstr_miniUsartDmaCtx.rxRing)) != kStatus_Success)
+    {
+        return FMSTR_FALSE;
+    }
+
+    return FMSTR_TRUE;
+}
+
+/******************************************************************************
+ *
+ * @brief    Enable/Disable Serial transmitter
+ *
+ ******************************************************************************/
+
+static void _FMSTR_SerialMiniUsartDmaEnableTransmit(FMSTR_BOOL enable)
+{
+    fmstr_miniUsartDmaCtx.txEnabled = enable;
+    USART_EnableTx(fmstr_serialBaseAddr, enable != FMSTR_FALSE);
+}
+
+/******************************************************************************
+ *
+ * @brief    Enable/Disable Serial receiver
+ *
+ * The receive DMA keeps running, the characters received meanwhile stay in
+ * the ring buffer.
+ *
+ ******************************************************************************/
+
+static void _FMSTR_SerialMiniUsartDmaEnableReceive(FMSTR_BOOL enable)
+{
+    fmstr_miniUsartDmaCtx.rxEnabled = enable;
+
+    if (enable != FMSTR_FALSE)
+    {
+        USART_EnableRx(fmstr_serialBaseAddr, true);
+    }
+}
+
+/******************************************************************************
+ *
+ * @brief    Enable/Disable interrupt from transmit register empty event
+ *
+ ******************************************************************************/
+
+static void _FMSTR_SerialMiniUsartDmaEnableTransmitInterrupt(FMSTR_BOOL enable)
+{
+    FMSTR_UNUSED(enable);
+}
+
+/******************************************************************************
+ *
+ * @brief    Enable/Disable interrupt from transmit complete event
+ *
+ ******************************************************************************/
+
+static void _FMSTR_SerialMiniUsartDmaEnableTransmitCompleteInterrupt(FMSTR_BOOL enable)
+{
+    FMSTR_UNUSED(enable);
+}
+
+/******************************************************************************
+ *
+ * @brief    Enable/Disable interrupt from receive register full event
+ *
+ ******************************************************************************/
+
+static void _FMSTR_SerialMiniUsartDmaEnableReceiveInterrupt(FMSTR_BOOL enable)
+{
+    FMSTR_UNUSED(enable);
+}
+
+/******************************************************************************
+ *
+ * @brief    Returns TRUE if the transmit buffer has space for the next char
+ *
+ ******************************************************************************/
+
+static FMSTR_BOOL _FMSTR_SerialMiniUsartDmaIsTransmitRegEmpty(void)
+{
+    /* Check if transmit is enabled or if the DMA is sending the buffer */
+    if (fmstr_miniUsartDmaCtx.txEnabled == FMSTR_FALSE || _FMSTR_SerialMiniUsartDmaIsSending() != FMSTR_FALSE)
+    {
+        return FMSTR_FALSE;
+    }
+
+    /* Check, if buffer is not full */
+    if (fmstr_miniUsartDmaCtx.txSize < sizeof(fmstr_miniUsartDmaCtx.txBuffer))
+    {
+        return FMSTR_TRUE;
+    }
+
+    /* Send buffer is full -> flush data, the next char waits for the DMA */
+    _FMSTR_SerialMiniUsartDmaFlush();
+
+    return FMSTR_FALSE;
+}
+
+/******************************************************************************
+ *
+ * @brief    Returns TRUE if a received char is available
+ *
+ * The characters are taken from the ring buffer by chunks, so the DMA state
+ * is not read for each character.
+ *
+ ******************************************************************************/
+
+static FMSTR_BOOL _FMSTR_SerialMiniUsartDmaIsReceiveRegFull(void)
+{
+    if (fmstr_miniUsartDmaCtx.rxEnabled == FMSTR_FALSE)
+    {
+        return FMSTR_FALSE;
+    }
+
+    if (fmstr_miniUsartDmaCtx.rxIndex < fmstr_miniUsartDmaCtx.rxCount)
+    {
+        return FMSTR_TRUE;
+    }
+
+    fmstr_miniUsartDmaCtx.rxIndex = 0U;
+    fmstr_miniUsartDmaCtx.rxCount =
+        (FMSTR_SIZE)USART_TransferReadRingBufferDMA(fmstr_serialBaseAddr, &fmstr_miniUsartDmaCtx.handle,
+                                                    fmstr_miniUsartDmaCtx.rxChunk, sizeof(fmstr_miniUsartDmaCtx.rxChunk));
+
+    return (FMSTR_BOOL)(fmstr_miniUsartDmaCtx.rxCount > 0U);
+}
+
+/******************************************************************************
+ *
+ * @brief    Returns TRUE if the transmitter is still active
+ *
+ ******************************************************************************/
+
+static FMSTR_BOOL _FMSTR_SerialMiniUsartDmaIsTransmitterActive(void)
+{
+    uint32_t sr;
+
+    if (_FMSTR_SerialMiniUsartDmaIsSending() != FMSTR_FALSE)
+    {
+        return FMSTR_TRUE;
+    }
+
+    /* the DMA is done, the last character may still be shifted out */
+    sr = USART_GetStatusFlags(fmstr_serialBaseAddr);
+
+    return (FMSTR_BOOL)((sr & (uint32_t)kUSART_TxIdleFlag) == 0U);
+}
+
+/******************************************************************************
+ *
+ * @brief    The function puts the char to the transmit buffer
+ *
+ ******************************************************************************/
+
+static void _FMSTR_SerialMiniUsartDmaPutChar(FMSTR_BCHR ch)
+{
+    /* Make sure there is free space TX buffer before writing */
+    if (fmstr_miniUsartDmaCtx.txSize >= sizeof(fmstr_miniUsartDmaCtx.txBuffer))
+    {
+        return;
+    }
+
+    fmstr_miniUsartDmaCtx.txBuffer[fmstr_miniUsartDmaCtx.txSize] = ch;
+    fmstr_miniUsartDmaCtx.txSize++;
+}
+
+/******************************************************************************
+ *
+ * @brief    The function gets the received char
+ *
+ ******************************************************************************/
+static FMSTR_BCHR _FMSTR_SerialMiniUsartDmaGetChar(void)
+{
+    /* Any data in the chunk? */
+    if (fmstr_miniUsartDmaCtx.rxIndex >= fmstr_miniUsartDmaCtx.rxCount)
+    {
+        return 0;
+    }
+
+    return fmstr_miniUsartDmaCtx.rxChunk[fmstr_miniUsartDmaCtx.rxIndex++];
+}
+
+/******************************************************************************
+ *
+ * @brief    The function sends buffered data
+ *
+ * The whole buffer is sent by one DMA transfer, the buffer is not touched
+ * again before the transfer is done.
+ *
+ ******************************************************************************/
+static void _FMSTR_SerialMiniUsartDmaFlush(void)
+{
+    usart_transfer_t xfer;
+
+    if (fmstr_miniUsartDmaCtx.txSize == 0U || _FMSTR_SerialMiniUsartDmaIsSending() != FMSTR_FALSE)
+    {
+        return;
+    }
+
+    xfer.txData   = fmstr_miniUsartDmaCtx.txBuffer;
+    xfer.dataSize = fmstr_miniUsartDmaCtx.txSize;
+
+    if (USART_TransferSendDMA(fmstr_serialBaseAddr, &fmstr_miniUsartDmaCtx.handle, &xfer) == kStatus_Success)
+    {
+        fmstr_miniUsartDmaCtx.txSize = 0U;
+    }
+}
+
+/******************************************************************************
+ *
+ * @brief    Returns TRUE while the DMA sends the transmit buffer
+ *
+ ******************************************************************************/
+static FMSTR_BOOL _FMSTR_SerialMiniUsartDmaIsSending(void)
+{
+    uint32_t count;
+
+    return (FMSTR_BOOL)(USART_TransferGetSendCountDMA(fmstr_serialBaseAddr, &fmstr_miniUsartDmaCtx.handle, &count) !=
+                        kStatus_NoTransferInProgress);
+}
+
+/******************************************************************************
+ *
+ * @brief    Assigning FreeMASTER communication module base address
+ *
+ ******************************************************************************/
+void FMSTR_SerialSetBaseAddress(USART_Type *base)
+{
+    fmstr_serialBaseAddr = base;
+}
+
+/******************************************************************************
+ *
+ * @brief    Assigning FreeMASTER communication DMA channels
+ *
+ * The DMA handles must be created with DMA_CreateHandle for the channels
+ * serving the USART TX and RX requests, and the channels enabled by
+ * DMA_EnableChannel, before FMSTR_Init is called.
+ *
+ ******************************************************************************/
+void FMSTR_SerialSetDmaHandles(dma_handle_t *txDmaHandle, dma_handle_t *rxDmaHandle)
+{
+    fmstr_serialTxDmaHandle = txDmaHandle;
+    fmstr_serialRxDmaHandle = rxDmaHandle;
+}
+
+#else /* (!(FMSTR_DISABLE)) */
+
+void FMSTR_SerialSetBaseAddress(USART_Type *base)
+{
+    FMSTR_UNUSED(base);
+}
+
+void FMSTR_SerialSetDmaHandles(dma_handle_t *txDmaHandle, dma_handle_t *rxDmaHandle)
+{
+    FMSTR_UNUSED(txDmaHandle);
+    FMSTR_UNUSED(rxDmaHandle);
+}
+
+#endif /* (!(FMSTR_DISABLE)) */
+#endif /* defined(FMSTR_SERIAL_DRV) && (FMSTR_MK_IDSTR(FMSTR_SERIAL_DRV) == FMSTR_SERIAL_MCUX_MINIUSART_DMA_ID) */
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2007-2015 Freescale Semiconductor, Inc.
+ * Copyright 2018-2020, 2024 NXP
+ *
+ * License: NXP LA_OPT_Online Code Hosting NXP_Software_License
+ *
+ * NXP Proprietary. This software is owned or controlled by NXP and may
+ * only be used strictly in accordance with the applicable license terms.
+ * By expressly accepting such terms or by downloading, installing,
+ * activating and/or otherwise using the software, you are agreeing that
+ * you have read, and that you agree to comply with and are bound by,
+ * such license terms.  If you do not agree to be bound by the applicable
+ * license terms, then you may not retain, install, activate or otherwise
+ * use the software.
+ *
+ * FreeMASTER Communication Driver - MINIUSART low-level driver with DMA
+ */
+
+#ifndef __FREEMASTER_SERIAL_MINIUSART_DMA_H
+#define __FREEMASTER_SERIAL_MINIUSART_DMA_H
+
+/******************************************************************************
+ * Required header files include check
+ ******************************************************************************/
+#ifndef __FREEMASTER_H
+#error Please include the freemaster.h master header file before the freemaster_serial_miniusart_dma.h
+#endif
+
+/* This low-level driver uses the MCUXpresso SDK peripheral structure types. */
+#include "fsl_device_registers.h"
+#include "fsl_dma.h"
+
+/******************************************************************************
+ * Adapter configuration
+ ******************************************************************************/
+
+/* Size of the receive ring buffer filled by the DMA, even. It must hold the characters received between two
+   FMSTR_Poll calls. The characters the DMA overwrites before a poll are lost, so their request gets no response and
+   the host waits for its timeout, or gets a checksum error response. In the host test with a ring of 8 characters,
+   polls every 12 characters answered 49 requests and left 99 to time out, polls every 115 characters answered 1,
+   returned 31 checksum errors and left 99 to time out. */
+#ifndef FMSTR_SERIAL_DMA_RX_RING_SIZE
+#define FMSTR_SERIAL_DMA_RX_RING_SIZE 128
+#endif
+
+/* Size of the transmit buffer. The default holds the longest response with all characters replicated, so each
+   response is sent by a single DMA transfer. A smaller buffer is sent in several transfers. */
+#ifndef FMSTR_SERIAL_DMA_TX_BUFFER_SIZE
+#define FMSTR_SERIAL_DMA_TX_BUFFER_SIZE (1 + 2 * (FMSTR_COMM_BUFFER_SIZE + 3))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ * Types definition
+ ******************************************************************************/
+
+/******************************************************************************
+ * inline functions
+ ******************************************************************************/
+
+/******************************************************************************
+ * Global API functions
+ ******************************************************************************/
+
+void FMSTR_SerialSetBaseAddress(USART_Type *base);
+void FMSTR_SerialSetDmaHandles(dma_handle_t *txDmaHandle, dma_handle_t *rxDmaHandle);
+
+#ifdef __cplusplus
+}
+#endif
+
+/****************************************************************************************
+ * Global variable declaration
+ *****************************************************************************************/
+#endif /* __FREEMASTER_SERIAL_MINIUSART_DMA_H */
@@ -55,6 +55,7 @@
 //    FMSTR_SERIAL_MCUX_LPUART -   MCUXSDK driver for LPUART peripheral
 //    FMSTR_SERIAL_MCUX_USART  -   MCUXSDK driver for USART peripheral
 //    FMSTR_SERIAL_MCUX_MINIUSART -MCUXSDK driver for MINIUSART peripheral
+//    FMSTR_SERIAL_MCUX_MINIUSART_DMA - MCUXSDK driver for MINIUSART peripheral with DMA, poll-driven only
 //    FMSTR_SERIAL_MCUX_USB    -   MCUXSDK driver for USB peripheral with CDC class
 // FMSTR_CAN      -   CAN transport protocol (used by various types of CAN peripherals)
 //    FMSTR_CAN_MCUX_FLEXCAN   -   MCUXSDK driver for FlexCAN peripheral
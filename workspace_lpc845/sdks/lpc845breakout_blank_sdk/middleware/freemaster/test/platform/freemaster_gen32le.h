@@ -0,0 +1,70 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * FreeMASTER Communication Driver - Generic 32-bit little endian platform of the host tests
+ */
+
+/*
+ * Host replacement of src/platforms/gen32le/freemaster_gen32le.h. The types are the same except FMSTR_U32 and
+ * FMSTR_S32, which are int because long is 64 bits on the 64-bit hosts.
+ */
+
+#ifndef _FREEMASTER_GEN32LE_H
+#define _FREEMASTER_GEN32LE_H
+
+#include <string.h>
+#include <stdlib.h>
+
+/******************************************************************************
+ * platform-specific default configuration
+ ******************************************************************************/
+
+#define FMSTR_CFG_BUS_WIDTH       1U
+#define FMSTR_TSA_FLAGS           0U
+#define FMSTR_PLATFORM_BIG_ENDIAN 0U
+#define FMSTR_MEMCPY_MAX_SIZE     4U
+
+#ifndef FMSTR_PLATFORM_BASE_ADDRESS
+#define FMSTR_PLATFORM_BASE_ADDRESS 0x20000000L
+#endif
+
+/******************************************************************************
+ * Types definition
+ ******************************************************************************/
+
+typedef unsigned char *FMSTR_ADDR;  /* CPU address type */
+typedef unsigned int FMSTR_SIZE;    /* general size type (at least 16 bits) */
+typedef unsigned char FMSTR_SIZE8;  /* one-byte size value */
+typedef unsigned long FMSTR_SIZE32; /* general size type (at least size of address) */
+typedef unsigned int FMSTR_BOOL;    /* general boolean type  */
+
+typedef unsigned char FMSTR_U8;       /* smallest memory entity */
+typedef unsigned short FMSTR_U16;     /* 16bit value */
+typedef unsigned int FMSTR_U32;       /* 32bit value */
+typedef unsigned long long FMSTR_U64; /* 64bit value */
+
+typedef signed char FMSTR_S8;       /* signed 8bit value */
+typedef signed short FMSTR_S16;     /* signed 16bit value */
+typedef signed int FMSTR_S32;       /* signed 32bit value */
+typedef signed long long FMSTR_S64; /* signed 64bit value */
+
+typedef float FMSTR_FLOAT;   /* float value */
+typedef double FMSTR_DOUBLE; /* double value */
+
+typedef unsigned char FMSTR_FLAGS; /* type to be union-ed with flags (at least 8 bits) */
+typedef signed int FMSTR_INDEX;    /* general for-loop index (must be signed) */
+
+typedef unsigned char FMSTR_BCHR;  /* type of a single character in comm.buffer */
+typedef unsigned char *FMSTR_BPTR; /* pointer within a communication buffer */
+
+typedef char FMSTR_CHAR; /* regular character, part of string */
+
+/*********************************************************************************
+ * Platform dependent functions
+ *********************************************************************************/
+
+#define FMSTR_Rand() rand()
+
+#endif /* _FREEMASTER_GEN32LE_H */
@@ -0,0 +1,33 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * FreeMASTER Communication Driver - User Configuration File of the recorder host test
+ */
+
+#ifndef __FREEMASTER_CFG_H
+#define __FREEMASTER_CFG_H
+
+#define FMSTR_PLATFORM_CORTEX_M 1 /* generic 32bit little-endian platform, the host is one too */
+#define FMSTR_DISABLE           0
+#define FMSTR_POLL_DRIVEN       1
+
+#define FMSTR_TRANSPORT  FMSTR_SERIAL
+#define FMSTR_SERIAL_DRV FMSTR_SERIAL_NONE
+
+#define FMSTR_COMM_BUFFER_SIZE 0
+
+#define FMSTR_USE_TSA 0
+
+#define FMSTR_USE_READMEM  1
+#define FMSTR_USE_WRITEMEM 1
+
+#define FMSTR_USE_RECORDER  1
+#define FMSTR_REC_BUFF_SIZE 32768
+#define FMSTR_USE_SCOPE     0
+
+/* FMSTR_FASTREC_COPY_PLAN and FMSTR_FASTREC_RISING_EDGE_TRG_ONLY are given on the command line, see
+   freemaster_rec_test.c */
+
+#endif /* __FREEMASTER_CFG_H */
@@ -0,0 +1,296 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * FreeMASTER Communication Driver - Recorder sampling host test
+ */
+
+/*
+ * Build from this directory with the generic per-variable sampling and with the copy plan:
+ *   gcc -O2 -I. -I../platform -I../../src/common -Wno-pointer-to-int-cast \
+ *       -DFMSTR_FASTREC_COPY_PLAN=0 -o rec_generic freemaster_rec_test.c
+ *   gcc -O2 -I. -I../platform -I../../src/common -Wno-pointer-to-int-cast \
+ *       -DFMSTR_FASTREC_COPY_PLAN=1 -o rec_plan freemaster_rec_test.c
+ *
+ * Run the equivalence check, the two builds must print the same line, then the benchmark:
+ *   ./rec_generic -c > generic.txt && ./rec_plan -c | cmp - generic.txt && ./rec_generic && ./rec_plan
+ *
+ * Add -DFMSTR_FASTREC_RISING_EDGE_TRG_ONLY=1 to both builds to check the rising edge only trigger too.
+ *
+ * The check configures random layouts of 1 to 16 variables of 1 to 8 bytes, packed or spread over the memory, with
+ * 0 to 2 trigger variables of random trigger modes, random time division and pre-trigger. It samples random values
+ * until the recorder stops and hashes the flags, the write position and the sample buffer after every sample. Layouts
+ * of trigger-only variables are expected not to start and are skipped. The benchmark measures the time of
+ * FMSTR_Recorder() with 1 to 16 contiguous 32-bit variables. The exit code is 0 on success.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "freemaster_rec.c"
+#include "freemaster_utils.c"
+
+/******************************************************************************
+ * Local definitions
+ ******************************************************************************/
+
+#define TEST_LAYOUT_NUM  20000
+#define TEST_SAMPLE_MAX  400
+#define TEST_BENCH_NUM   4000000L
+#define TEST_MEMORY_SIZE 512U
+
+/******************************************************************************
+ * Local variables
+ ******************************************************************************/
+
+static union
+{
+    FMSTR_U64 words[TEST_MEMORY_SIZE / 8U];
+    FMSTR_U8 bytes[TEST_MEMORY_SIZE];
+} testMemory;
+
+static union
+{
+    FMSTR_U64 words[4];
+    FMSTR_U8 bytes[32];
+} testThreshold;
+
+static unsigned long testSeed = 12345U;
+static unsigned long long testHash = 14695981039346656037ULL;
+static int testFailures;
+
+/******************************************************************************
+ * Local functions
+ ******************************************************************************/
+
+static FMSTR_U32 TestRandom(void)
+{
+    testSeed = (testSeed * 1103515245U + 12345U) & 0xFFFFFFFFU;
+    return (FMSTR_U32)(testSeed >> 8);
+}
+
+static double TestNow(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* FNV-1a */
+static void TestHash(const void *data, size_t size)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+
+    while (size-- > 0U)
+    {
+        testHash = (testHash ^ *bytes++) * 1099511628211ULL;
+    }
+}
+
+/* Configures and starts the recorder with count variables, trgCount of them compared with the threshold. The recorder
+   does not start when all the variables are trigger-only. */
+static FMSTR_BOOL TestSetUp(FMSTR_SIZE8 count, FMSTR_BOOL packed, FMSTR_SIZE trgCount)
+{
+    static const FMSTR_SIZE8 trgSizes[] = {1U, 2U, 4U, 8U};
+    FMSTR_REC_CFG cfg;
+    FMSTR_REC_VAR var;
+    FMSTR_SIZE offset   = 0U;
+    FMSTR_SIZE triggers = 0U;
+    FMSTR_BOOL sampled  = FMSTR_FALSE;
+    FMSTR_SIZE8 i;
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.varCount   = count;
+    cfg.totalSmps  = 50U + TestRandom() % 100U;
+    cfg.preTrigger = TestRandom() % 40U;
+    cfg.timeDiv    = TestRandom() % 2U;
+    if (FMSTR_RecorderConfigure(0, &cfg) == FMSTR_FALSE)
+    {
+        return FMSTR_FALSE;
+    }
+
+    for (i = 0U; i < count; i++)
+    {
+        memset(&var, 0, sizeof(var));
+        var.size = packed != FMSTR_FALSE ? 4U : (FMSTR_SIZE8)(1U << (TestRandom() % 4U));
+
+        /* spread variables start after a gap, or on their natural alignment */
+        if (packed == FMSTR_FALSE && TestRandom() % 3U == 0U)
+        {
+            offset += TestRandom() % 5U;
+        }
+        if (packed == FMSTR_FALSE && (TestRandom() & 1U) != 0U)
+        {
+            offset = (offset + var.size - 1U) & ~(FMSTR_SIZE)(var.size - 1U);
+        }
+
+        if (triggers < trgCount && (TestRandom() % count == 0U || i == count - 1U))
+        {
+            FMSTR_SIZE8 trgSize = trgSizes[TestRandom() % 4U];
+
+            /* a trigger variable is aligned on its size */
+            if (trgSize > var.size)
+            {
+                var.size = trgSize;
+                offset   = (offset + trgSize - 1U) & ~(FMSTR_SIZE)(trgSize - 1U);
+            }
+            var.triggerMode = (FMSTR_SIZE8)(1U + TestRandom() % 2U);
+            var.triggerMode |= TestRandom() % 3U == 0U ? FMSTR_REC_TRG_F_TRGONLY : 0U;
+            var.triggerMode |= (TestRandom() & 1U) != 0U ? FMSTR_REC_TRG_F_ABOVE : 0U;
+#if FMSTR_FASTREC_RISING_EDGE_TRG_ONLY == 0
+            /* the rising edge only build rejects the other modes */
+            var.triggerMode |= (TestRandom() & 1U) != 0U ? FMSTR_REC_TRG_F_BELOW : 0U;
+            var.triggerMode |= (TestRandom() & 1U) != 0U ? FMSTR_REC_TRG_F_LEVEL : 0U;
+#endif
+            var.trgAddr = (FMSTR_ADDR)&testThreshold.bytes[0];
+            triggers++;
+        }
+
+        if (offset + var.size > TEST_MEMORY_SIZE - 8U)
+        {
+            offset = 0U;
+        }
+        var.addr = (FMSTR_ADDR)&testMemory.bytes[offset];
+        offset += var.size;
+        if ((var.triggerMode & FMSTR_REC_TRG_F_TRGONLY) == 0U)
+        {
+            sampled = FMSTR_TRUE;
+        }
+
+        if (FMSTR_RecorderAddVariable(0, i, &var) == FMSTR_FALSE)
+        {
+            printf("FAIL: variable %u of %u bytes, trigger mode 0x%02x is rejected\n", i, var.size, var.triggerMode);
+            testFailures++;
+            return FMSTR_FALSE;
+        }
+    }
+
+    if (FMSTR_RecorderStart(0) == FMSTR_FALSE)
+    {
+        if (sampled != FMSTR_FALSE)
+        {
+            printf("FAIL: the recorder does not start with %u variables\n", count);
+            testFailures++;
+        }
+        return FMSTR_FALSE;
+    }
+    return FMSTR_TRUE;
+}
+
+/* Samples random layouts and hashes the state of the recorder after every sample */
+static int TestEquivalence(void)
+{
+    FMSTR_LP_REC recorder = _FMSTR_GetRecorderByRecIx(0);
+    FMSTR_FLAGS flags;
+    FMSTR_SIZE writeOffset;
+    int layouts = 0;
+    int stops   = 0;
+    int plans   = 0;
+    int run, k, j;
+
+    for (run = 0; run < TEST_LAYOUT_NUM; run++)
+    {
+        FMSTR_SIZE8 count = (FMSTR_SIZE8)(1U + TestRandom() % 16U);
+        FMSTR_BOOL packed = TestRandom() % 4U == 0U ? FMSTR_TRUE : FMSTR_FALSE;
+
+        if (TestSetUp(count, packed, TestRandom() % 3U) == FMSTR_FALSE)
+        {
+            continue;
+        }
+        layouts++;
+#if FMSTR_REC_COPY_PLAN
+        plans += recorder->copyCount > 0U ? 1 : 0;
+#endif
+
+        for (k = 0; k < TEST_SAMPLE_MAX; k++)
+        {
+            for (j = 0; j < (int)(TEST_MEMORY_SIZE / 8U); j++)
+            {
+                testMemory.words[j] = ((FMSTR_U64)TestRandom() << 40) ^ ((FMSTR_U64)TestRandom() << 16) ^ TestRandom();
+            }
+            if (TestRandom() % 8U == 0U)
+            {
+                for (j = 0; j < 32; j++)
+                {
+                    testThreshold.bytes[j] = (FMSTR_U8)TestRandom();
+                }
+            }
+
+            FMSTR_Recorder(0);
+
+            flags       = recorder->flags.all;
+            writeOffset = (FMSTR_SIZE)(recorder->writePtr - recorder->buffAddr);
+            TestHash(&flags, sizeof(flags));
+            TestHash(&recorder->stopRecCountDown, sizeof(recorder->stopRecCountDown));
+            TestHash(&writeOffset, sizeof(writeOffset));
+            if (recorder->flags.flg.isRunning == 0U)
+            {
+                stops++;
+                break;
+            }
+        }
+        TestHash(recorder->buffAddr, (size_t)(recorder->endBuffPtr - recorder->buffAddr));
+    }
+
+    printf("%d layouts sampled, %d stopped, state hash %016llx\n", layouts, stops, testHash);
+    return plans;
+}
+
+static void TestBenchmark(void)
+{
+    static const FMSTR_SIZE8 counts[] = {1U, 4U, 8U, 16U};
+    FMSTR_LP_REC recorder = _FMSTR_GetRecorderByRecIx(0);
+    FMSTR_SIZE copies = 0U;
+    double t0, t1;
+    long k;
+    int c;
+
+    printf("variables  copies  time per sample\n");
+    for (c = 0; c < (int)(sizeof(counts) / sizeof(counts[0])); c++)
+    {
+        if (TestSetUp(counts[c], FMSTR_TRUE, 0U) == FMSTR_FALSE)
+        {
+            break;
+        }
+#if FMSTR_REC_COPY_PLAN
+        copies = recorder->copyCount;
+#endif
+
+        t0 = TestNow();
+        for (k = 0; k < TEST_BENCH_NUM; k++)
+        {
+            testMemory.words[k & 63]++;
+            FMSTR_Recorder(0);
+            if (recorder->flags.flg.isRunning == 0U)
+            {
+                (void)FMSTR_RecorderStart(0);
+            }
+        }
+        t1 = TestNow();
+
+        printf("%9u  %6u  %12.1f ns\n", counts[c], copies, (t1 - t0) / TEST_BENCH_NUM * 1e9);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int plans;
+
+    (void)FMSTR_InitRec();
+
+    plans = TestEquivalence();
+    if (argc > 1 && strcmp(argv[1], "-c") == 0)
+    {
+        return testFailures == 0 ? 0 : 1;
+    }
+
+    printf("FMSTR_FASTREC_COPY_PLAN %d, FMSTR_FASTREC_RISING_EDGE_TRG_ONLY %d, layouts sampled with a plan %d\n",
+           FMSTR_FASTREC_COPY_PLAN, FMSTR_FASTREC_RISING_EDGE_TRG_ONLY, plans);
+    TestBenchmark();
+
+    printf("%s\n", testFailures == 0 ? "PASS" : "FAIL");
+    return testFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * FreeMASTER Communication Driver - User Configuration File of the serial DMA host test
+ */
+
+#ifndef __FREEMASTER_CFG_H
+#define __FREEMASTER_CFG_H
+
+#define FMSTR_PLATFORM_CORTEX_M 1 /* generic 32bit little-endian platform, the host is one too */
+#define FMSTR_DISABLE           0
+
+/* TEST_SERIAL_DMA is given on the command line, see freemaster_serial_dma_test.c */
+#define FMSTR_TRANSPORT FMSTR_SERIAL
+#if TEST_SERIAL_DMA
+#define FMSTR_SERIAL_DRV  FMSTR_SERIAL_MCUX_MINIUSART_DMA
+#define FMSTR_POLL_DRIVEN 1
+#else
+#define FMSTR_SERIAL_DRV FMSTR_SERIAL_MCUX_MINIUSART
+#define FMSTR_LONG_INTR  1
+#endif
+
+#define FMSTR_COMM_BUFFER_SIZE 254
+
+#define FMSTR_USE_TSA 0
+
+#define FMSTR_USE_READMEM  1
+#define FMSTR_USE_WRITEMEM 1
+
+#define FMSTR_USE_RECORDER 0
+#define FMSTR_USE_SCOPE    0
+#define FMSTR_USE_PIPES    0
+#define FMSTR_USE_APPCMD   0
+
+#endif /* __FREEMASTER_CFG_H */
@@ -0,0 +1,514 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * FreeMASTER Communication Driver - MINIUSART DMA serial driver host test
+ */
+
+/*
+ * Build and run from this directory with the interrupt driven MINIUSART driver, with the MINIUSART_DMA driver, with
+ * a receive ring smaller than the characters received between two polls and with a small transmit buffer:
+ *   F="-I. -I../platform -I../../src/common -I../../src/drivers/mcuxsdk/serial -Wno-pointer-to-int-cast"
+ *   gcc -O2 $F -DTEST_SERIAL_DMA=0 -o serial_isr freemaster_serial_dma_test.c && ./serial_isr
+ *   gcc -O2 $F -DTEST_SERIAL_DMA=1 -o serial_dma freemaster_serial_dma_test.c && ./serial_dma
+ *   gcc -O2 $F -DTEST_SERIAL_DMA=1 -DFMSTR_SERIAL_DMA_RX_RING_SIZE=8 -o serial_dma_ring8 \
+ *       freemaster_serial_dma_test.c && ./serial_dma_ring8
+ *   gcc -O2 $F -DTEST_SERIAL_DMA=1 -DFMSTR_SERIAL_DMA_TX_BUFFER_SIZE=64 -o serial_dma_tx64 \
+ *       freemaster_serial_dma_test.c && ./serial_dma_tx64
+ *
+ * The USART and its DMA are simulated on a full duplex line moving one character per character time in each
+ * direction. The host side sends READMEM requests of 200 bytes at random addresses and checks the checksum and the
+ * data of every response. A request without a response is abandoned after a timeout. The line runs with FMSTR_Poll()
+ * called every 1, 12 and 115 character times. The test reports the payload bytes per character time, the interrupts
+ * per payload byte, counting the DMA interrupts of the ring halves and of the completed transfers, and the host time
+ * spent in FMSTR_Poll() and FMSTR_SerialIsr() per payload byte.
+ *
+ * No read may return wrong data. Error responses and timeouts are only allowed when the receive ring is smaller than
+ * the characters received between two polls. The exit code is 0 on success.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "freemaster_protocol.c"
+#include "freemaster_serial.c"
+#include "freemaster_utils.c"
+#include "freemaster_serial_miniusart.c"
+#include "freemaster_serial_miniusart_dma.c"
+#include "fsl_usart_dma.h"
+
+/******************************************************************************
+ * Local definitions
+ ******************************************************************************/
+
+#define TEST_TICK_NUM    2000000L /* character times per run */
+#define TEST_READ_SIZE   200U
+#define TEST_TIMEOUT     20000L /* character times without a response before the next request */
+#define TEST_REQUEST_GAP 2
+
+/******************************************************************************
+ * Local variables
+ ******************************************************************************/
+
+static USART_Type testUsart;
+static usart_dma_handle_t *testDmaHandle;
+static int testTxHold = -1; /* character in the transmit register, -1 when empty */
+static long testIrqs;
+static long testOverruns;
+static long testRingDrops;
+
+static FMSTR_U8 testTarget[4096];
+static FMSTR_U8 *testReadAddr;
+static FMSTR_U8 testRequest[64];
+static int testRequestLen;
+static int testRequestPos;
+static int testRequestGap;
+static FMSTR_U8 testResponse[2 * TEST_READ_SIZE];
+static int testResponseLen;
+static int testResponseTodo; /* 0 when no response is being received, -1 when the length byte comes next */
+static FMSTR_BOOL testResponseSob;
+
+static unsigned long testSeed = 1U;
+static int testFailures;
+
+/******************************************************************************
+ * Host replacement of the USART and USART DMA drivers
+ ******************************************************************************/
+
+void USART_EnableTx(USART_Type *base, bool enable)
+{
+    (void)base;
+    (void)enable;
+}
+
+void USART_EnableRx(USART_Type *base, bool enable)
+{
+    (void)base;
+    (void)enable;
+}
+
+uint32_t USART_GetStatusFlags(USART_Type *base)
+{
+    return base->STAT;
+}
+
+void USART_EnableInterrupts(USART_Type *base, uint32_t mask)
+{
+    base->INTENSET |= mask;
+}
+
+void USART_DisableInterrupts(USART_Type *base, uint32_t mask)
+{
+    base->INTENSET &= ~mask;
+}
+
+void USART_WriteByte(USART_Type *base, uint8_t data)
+{
+    testTxHold = data;
+    base->STAT &= ~(USART_STAT_TXRDY_MASK | USART_STAT_TXIDLE_MASK);
+}
+
+uint8_t USART_ReadByte(USART_Type *base)
+{
+    base->STAT &= ~USART_STAT_RXRDY_MASK;
+    return (uint8_t)base->RXDAT;
+}
+
+status_t USART_TransferCreateHandleDMA(USART_Type *base,
+                                       usart_dma_handle_t *handle,
+                                       usart_dma_transfer_callback_t callback,
+                                       void *userData,
+                                       dma_handle_t *txDmaHandle,
+                                       dma_handle_t *rxDmaHandle)
+{
+    (void)callback;
+    (void)userData;
+    (void)txDmaHandle;
+    (void)rxDmaHandle;
+
+    memset(handle, 0, sizeof(*handle));
+    handle->base  = base;
+    testDmaHandle = handle;
+    return kStatus_Success;
+}
+
+status_t USART_TransferSendDMA(USART_Type *base, usart_dma_handle_t *handle, usart_transfer_t *xfer)
+{
+    if (handle->txBusy)
+    {
+        return kStatus_USART_TxBusy;
+    }
+
+    handle->txData        = xfer->txData;
+    handle->txDataSizeAll = xfer->dataSize;
+    handle->txDataSent    = 0U;
+    handle->txBusy        = true;
+    base->STAT &= ~USART_STAT_TXIDLE_MASK;
+    return kStatus_Success;
+}
+
+status_t USART_TransferStartRingBufferDMA(USART_Type *base,
+                                          usart_dma_handle_t *handle,
+                                          uint8_t *ringBuffer,
+                                          size_t ringBufferSize)
+{
+    (void)base;
+
+    handle->rxData           = ringBuffer;
+    handle->rxRingBufferSize = ringBufferSize;
+    handle->rxDataReceived   = 0U;
+    handle->rxRingBufferRead = 0U;
+    return kStatus_Success;
+}
+
+/* The characters overwritten by the DMA before they are read are dropped */
+size_t USART_TransferReadRingBufferDMA(USART_Type *base, usart_dma_handle_t *handle, uint8_t *data, size_t length)
+{
+    size_t count = handle->rxDataReceived - handle->rxRingBufferRead;
+    size_t i;
+
+    (void)base;
+
+    if (count > handle->rxRingBufferSize)
+    {
+        testRingDrops += (long)(count - handle->rxRingBufferSize);
+        handle->rxRingBufferRead = handle->rxDataReceived - handle->rxRingBufferSize;
+        count                    = handle->rxRingBufferSize;
+    }
+    count = count < length ? count : length;
+
+    for (i = 0U; i < count; i++)
+    {
+        data[i] = handle->rxData[handle->rxRingBufferRead++ % handle->rxRingBufferSize];
+    }
+    return count;
+}
+
+status_t USART_TransferGetSendCountDMA(USART_Type *base, usart_dma_handle_t *handle, uint32_t *count)
+{
+    (void)base;
+
+    if (!handle->txBusy)
+    {
+        return kStatus_NoTransferInProgress;
+    }
+
+    *count = (uint32_t)handle->txDataSent;
+    return kStatus_Success;
+}
+
+/******************************************************************************
+ * Local functions
+ ******************************************************************************/
+
+static FMSTR_U32 TestRandom(void)
+{
+    testSeed = (testSeed * 1103515245U + 12345U) & 0xFFFFFFFFU;
+    return (FMSTR_U32)(testSeed >> 8);
+}
+
+static double TestNow(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static FMSTR_U8 TestCrc8(const FMSTR_U8 *data, int size)
+{
+    FMSTR_BCHR crc;
+    int i;
+
+    FMSTR_Crc8Init(&crc);
+    for (i = 0; i < size; i++)
+    {
+        FMSTR_Crc8AddByte(&crc, data[i]);
+    }
+    return (FMSTR_U8)crc;
+}
+
+static int TestUleb(FMSTR_U8 *dest, FMSTR_U64 value)
+{
+    int size = 0;
+
+    do
+    {
+        dest[size] = (FMSTR_U8)(value & 0x7FU);
+        value >>= 7;
+        dest[size++] |= value != 0U ? 0x80U : 0U;
+    } while (value != 0U);
+
+    return size;
+}
+
+/* Prepares the READMEM request of a random address, SOB characters in the frame are replicated */
+static void TestHostRequest(void)
+{
+    FMSTR_U8 frame[32];
+    int size = 2;
+    int i;
+
+    testReadAddr = &testTarget[TestRandom() % (sizeof(testTarget) - TEST_READ_SIZE)];
+
+    frame[0] = FMSTR_CMD_READMEM;
+    size += TestUleb(&frame[size], (FMSTR_U64)(uintptr_t)testReadAddr);
+    size += TestUleb(&frame[size], TEST_READ_SIZE);
+    frame[1]    = (FMSTR_U8)(size - 2);
+    frame[size] = TestCrc8(frame, size);
+    size++;
+
+    testRequestLen                = 0;
+    testRequest[testRequestLen++] = FMSTR_SOB;
+    for (i = 0; i < size; i++)
+    {
+        testRequest[testRequestLen++] = frame[i];
+        if (frame[i] == FMSTR_SOB)
+        {
+            testRequest[testRequestLen++] = FMSTR_SOB;
+        }
+    }
+
+    testRequestPos   = 0;
+    testRequestGap   = TEST_REQUEST_GAP;
+    testResponseTodo = 0;
+}
+
+/* Decodes a character received by the host, returns TRUE when a response is complete */
+static FMSTR_BOOL TestHostRx(FMSTR_U8 ch)
+{
+    if (ch == FMSTR_SOB)
+    {
+        testResponseSob = testResponseSob != FMSTR_FALSE ? FMSTR_FALSE : FMSTR_TRUE;
+        if (testResponseSob != FMSTR_FALSE)
+        {
+            return FMSTR_FALSE;
+        }
+    }
+
+    /* a character preceded by a single SOB is the status */
+    if (testResponseSob != FMSTR_FALSE)
+    {
+        testResponseSob = FMSTR_FALSE;
+        testResponseLen = 0;
+
+        testResponse[testResponseLen++] = ch;
+        if ((ch & FMSTR_STSF_ERROR) != 0U)
+        {
+            testResponseTodo = 1;
+        }
+        else if ((ch & FMSTR_STSF_VARLEN) != 0U)
+        {
+            testResponseTodo = -1;
+        }
+        else
+        {
+            testResponseTodo = (int)TEST_READ_SIZE + 1;
+        }
+        return FMSTR_FALSE;
+    }
+
+    if (testResponseTodo == 0 || testResponseLen >= (int)sizeof(testResponse))
+    {
+        return FMSTR_FALSE;
+    }
+
+    testResponse[testResponseLen++] = ch;
+    if (testResponseTodo < 0)
+    {
+        testResponseTodo = ch + 1;
+        return FMSTR_FALSE;
+    }
+
+    return --testResponseTodo == 0 ? FMSTR_TRUE : FMSTR_FALSE;
+}
+
+/* Runs the line with FMSTR_Poll() called every pollInterval character times */
+static void TestRun(long pollInterval)
+{
+#if TEST_SERIAL_DMA
+    static dma_handle_t txDmaHandle, rxDmaHandle;
+#endif
+    long good = 0, errors = 0, corrupted = 0, timeouts = 0, idle = 0;
+    double cpu = 0.0, t0;
+    int ch;
+    long t;
+
+    memset(&testUsart, 0, sizeof(testUsart));
+    testUsart.STAT = USART_STAT_TXRDY_MASK | USART_STAT_TXIDLE_MASK;
+    testTxHold     = -1;
+    testIrqs       = 0;
+    testOverruns   = 0;
+    testRingDrops  = 0;
+
+    FMSTR_SerialSetBaseAddress(&testUsart);
+#if TEST_SERIAL_DMA
+    FMSTR_SerialSetDmaHandles(&txDmaHandle, &rxDmaHandle);
+#endif
+    if (FMSTR_Init() == FMSTR_FALSE)
+    {
+        printf("FAIL: FMSTR_Init\n");
+        testFailures++;
+        return;
+    }
+
+    TestHostRequest();
+    for (t = 0; t < TEST_TICK_NUM; t++)
+    {
+        /* host to target */
+        if (testRequestGap > 0)
+        {
+            testRequestGap--;
+        }
+        else if (testRequestPos < testRequestLen)
+        {
+            ch = testRequest[testRequestPos++];
+#if TEST_SERIAL_DMA
+            testDmaHandle->rxData[testDmaHandle->rxDataReceived++ % testDmaHandle->rxRingBufferSize] = (FMSTR_U8)ch;
+            if (testDmaHandle->rxDataReceived % (testDmaHandle->rxRingBufferSize / 2U) == 0U)
+            {
+                testIrqs++;
+            }
+#else
+            if ((testUsart.STAT & USART_STAT_RXRDY_MASK) != 0U)
+            {
+                testOverruns++;
+            }
+            testUsart.RXDAT = (uint32_t)ch;
+            testUsart.STAT |= USART_STAT_RXRDY_MASK;
+            if ((testUsart.INTENSET & USART_INTENSET_RXRDYEN_MASK) != 0U)
+            {
+                testIrqs++;
+                t0 = TestNow();
+                FMSTR_SerialIsr();
+                cpu += TestNow() - t0;
+            }
+#endif
+        }
+
+        /* target to host */
+        ch = -1;
+#if TEST_SERIAL_DMA
+        if (testDmaHandle->txBusy)
+        {
+            ch = testDmaHandle->txData[testDmaHandle->txDataSent++];
+            if (testDmaHandle->txDataSent == testDmaHandle->txDataSizeAll)
+            {
+                testDmaHandle->txBusy = false;
+                testIrqs++;
+            }
+        }
+        else
+        {
+            testUsart.STAT |= USART_STAT_TXIDLE_MASK;
+        }
+#else
+        if (testTxHold >= 0)
+        {
+            ch         = testTxHold;
+            testTxHold = -1;
+            testUsart.STAT |= USART_STAT_TXRDY_MASK;
+        }
+        else
+        {
+            testUsart.STAT |= USART_STAT_TXIDLE_MASK;
+        }
+        if (((testUsart.INTENSET & USART_INTENSET_TXRDYEN_MASK) != 0U &&
+             (testUsart.STAT & USART_STAT_TXRDY_MASK) != 0U) ||
+            ((testUsart.INTENSET & USART_INTENSET_TXIDLEEN_MASK) != 0U &&
+             (testUsart.STAT & USART_STAT_TXIDLE_MASK) != 0U))
+        {
+            testIrqs++;
+            t0 = TestNow();
+            FMSTR_SerialIsr();
+            cpu += TestNow() - t0;
+        }
+#endif
+
+        if (ch >= 0 && TestHostRx((FMSTR_U8)ch) != FMSTR_FALSE)
+        {
+            FMSTR_BOOL crcOk = testResponse[testResponseLen - 1] == TestCrc8(testResponse, testResponseLen - 1);
+
+            if (crcOk != FMSTR_FALSE && testResponse[0] == FMSTR_STS_OK &&
+                testResponseLen == (int)TEST_READ_SIZE + 2 &&
+                memcmp(&testResponse[1], testReadAddr, TEST_READ_SIZE) == 0)
+            {
+                good++;
+            }
+            else if (crcOk != FMSTR_FALSE && (testResponse[0] & FMSTR_STSF_ERROR) != 0U)
+            {
+                errors++;
+            }
+            else
+            {
+                if (corrupted++ == 0)
+                {
+                    printf("FAIL: response of %d bytes, status 0x%02x\n", testResponseLen, testResponse[0]);
+                }
+            }
+            TestHostRequest();
+            idle = 0;
+        }
+        else if (++idle > TEST_TIMEOUT)
+        {
+            timeouts++;
+            TestHostRequest();
+            idle = 0;
+        }
+
+        if (t % pollInterval == 0)
+        {
+            t0 = TestNow();
+            FMSTR_Poll();
+            cpu += TestNow() - t0;
+        }
+    }
+
+    printf("%13ld  %4ld  %6ld  %8ld  %8ld  %10ld  %13.3f  %14.4f  %12.1f\n", pollInterval, good, errors, timeouts,
+           testOverruns, testRingDrops, (double)good * TEST_READ_SIZE / TEST_TICK_NUM,
+           (double)testIrqs / ((double)good * TEST_READ_SIZE), cpu * 1e9 / ((double)good * TEST_READ_SIZE));
+
+    if (corrupted != 0 || good == 0)
+    {
+        testFailures++;
+    }
+#if TEST_SERIAL_DMA
+    if (FMSTR_SERIAL_DMA_RX_RING_SIZE >= pollInterval && (errors != 0 || timeouts != 0))
+#else
+    if (errors != 0 || timeouts != 0 || testOverruns != 0)
+#endif
+    {
+        printf("FAIL: requests are lost\n");
+        testFailures++;
+    }
+}
+
+int main(void)
+{
+    static const long pollIntervals[] = {1, 12, 115};
+    unsigned int i;
+
+    for (i = 0U; i < sizeof(testTarget); i++)
+    {
+        /* every other group of 8 bytes holds SOB characters, replicated on the line */
+        testTarget[i] = (FMSTR_U8)(i * 7U + (((i >> 3) & 1U) != 0U ? FMSTR_SOB : 0U));
+    }
+
+#if TEST_SERIAL_DMA
+    printf("MINIUSART_DMA, receive ring %d, transmit buffer %d\n", FMSTR_SERIAL_DMA_RX_RING_SIZE,
+           FMSTR_SERIAL_DMA_TX_BUFFER_SIZE);
+#else
+    printf("MINIUSART, FMSTR_LONG_INTR\n");
+#endif
+    printf("poll interval  good  errors  timeouts  overruns  ring drops  payload/char  interrupts/byte"
+           "  host ns/byte\n");
+    for (i = 0U; i < sizeof(pollIntervals) / sizeof(pollIntervals[0]); i++)
+    {
+        TestRun(pollIntervals[i]);
+    }
+
+    printf("%s\n", testFailures == 0 ? "PASS" : "FAIL");
+    return testFailures == 0 ? 0 : 1;
+}
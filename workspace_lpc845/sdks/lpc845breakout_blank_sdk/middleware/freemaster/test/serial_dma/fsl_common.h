@@ -0,0 +1,38 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of fsl_common.h for the FreeMASTER serial DMA test, see freemaster_serial_dma_test.c. */
+
+#ifndef _FSL_COMMON_H_
+#define _FSL_COMMON_H_
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "fsl_device_registers.h"
+
+typedef int32_t status_t;
+
+#define MAKE_STATUS(group, code) ((((group)*100) + (code)))
+
+enum _status_groups
+{
+    kStatusGroup_Generic   = 0,
+    kStatusGroup_LPC_USART = 57,
+};
+
+enum
+{
+    kStatus_Success              = MAKE_STATUS(kStatusGroup_Generic, 0),
+    kStatus_InvalidArgument      = MAKE_STATUS(kStatusGroup_Generic, 4),
+    kStatus_NoTransferInProgress = MAKE_STATUS(kStatusGroup_Generic, 6),
+};
+
+#endif /* _FSL_COMMON_H_ */
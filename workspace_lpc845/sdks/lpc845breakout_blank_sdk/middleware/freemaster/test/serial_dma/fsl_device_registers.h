@@ -0,0 +1,37 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of fsl_device_registers.h for the FreeMASTER serial DMA test, the USART is simulated by
+   freemaster_serial_dma_test.c. */
+
+#ifndef _FSL_DEVICE_REGISTERS_H_
+#define _FSL_DEVICE_REGISTERS_H_
+
+#include <stdint.h>
+
+typedef struct
+{
+    volatile uint32_t CFG;
+    volatile uint32_t CTL;
+    volatile uint32_t STAT;
+    volatile uint32_t INTENSET;
+    volatile uint32_t INTENCLR;
+    volatile uint32_t RXDAT;
+    volatile uint32_t RXDATSTAT;
+    volatile uint32_t TXDAT;
+} USART_Type;
+
+#define USART_STAT_RXRDY_MASK        (0x1U)
+#define USART_STAT_TXRDY_MASK        (0x4U)
+#define USART_STAT_TXIDLE_MASK       (0x8U)
+#define USART_INTENSET_RXRDYEN_MASK  (0x1U)
+#define USART_INTENSET_TXRDYEN_MASK  (0x4U)
+#define USART_INTENSET_TXIDLEEN_MASK (0x8U)
+
+#define FSL_FEATURE_USART_HAS_INTENSET_TXIDLEEN (1)
+
+#endif /* _FSL_DEVICE_REGISTERS_H_ */
@@ -0,0 +1,22 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of fsl_dma.h for the FreeMASTER serial DMA test, see freemaster_serial_dma_test.c. */
+
+#ifndef _FSL_DMA_H_
+#define _FSL_DMA_H_
+
+#include "fsl_common.h"
+
+#define DMA_MAX_TRANSFER_COUNT 0x400U
+
+typedef struct _dma_handle
+{
+    uint32_t channel;
+} dma_handle_t;
+
+#endif /* _FSL_DMA_H_ */
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of fsl_usart.h for the FreeMASTER serial DMA test, the USART is simulated by
+   freemaster_serial_dma_test.c. */
+
+#ifndef _FSL_USART_H_
+#define _FSL_USART_H_
+
+#include "fsl_common.h"
+
+enum
+{
+    kStatus_USART_TxBusy = MAKE_STATUS(kStatusGroup_LPC_USART, 0),
+    kStatus_USART_RxBusy = MAKE_STATUS(kStatusGroup_LPC_USART, 1),
+};
+
+enum _usart_interrupt_enable
+{
+    kUSART_RxReadyInterruptEnable = (USART_INTENSET_RXRDYEN_MASK),
+    kUSART_TxReadyInterruptEnable = (USART_INTENSET_TXRDYEN_MASK),
+    kUSART_TxIdleInterruptEnable  = (USART_INTENSET_TXIDLEEN_MASK),
+};
+
+enum _usart_flags
+{
+    kUSART_RxReady    = (USART_STAT_RXRDY_MASK),
+    kUSART_TxReady    = (USART_STAT_TXRDY_MASK),
+    kUSART_TxIdleFlag = (USART_STAT_TXIDLE_MASK),
+};
+
+typedef struct _usart_transfer
+{
+    union
+    {
+        uint8_t *data;
+        uint8_t *rxData;
+        const uint8_t *txData;
+    };
+    size_t dataSize;
+} usart_transfer_t;
+
+void USART_EnableTx(USART_Type *base, bool enable);
+void USART_EnableRx(USART_Type *base, bool enable);
+uint32_t USART_GetStatusFlags(USART_Type *base);
+void USART_EnableInterrupts(USART_Type *base, uint32_t mask);
+void USART_DisableInterrupts(USART_Type *base, uint32_t mask);
+void USART_WriteByte(USART_Type *base, uint8_t data);
+uint8_t USART_ReadByte(USART_Type *base);
+
+#endif /* _FSL_USART_H_ */
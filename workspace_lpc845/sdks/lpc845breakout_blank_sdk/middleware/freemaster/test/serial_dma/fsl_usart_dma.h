@@ -0,0 +1,53 @@
+/*
+ * Copyright 2026 NXP
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of fsl_usart_dma.h for the FreeMASTER serial DMA test, the DMA transfers are simulated by
+   freemaster_serial_dma_test.c. */
+
+#ifndef _FSL_USART_DMA_H_
+#define _FSL_USART_DMA_H_
+
+#include "fsl_dma.h"
+#include "fsl_usart.h"
+
+#define USART_DMA_RX_RING_BUFFER_MAX_SIZE (2UL * DMA_MAX_TRANSFER_COUNT)
+
+typedef struct _usart_dma_handle usart_dma_handle_t;
+
+typedef void (*usart_dma_transfer_callback_t)(USART_Type *base,
+                                              usart_dma_handle_t *handle,
+                                              status_t status,
+                                              void *userData);
+
+struct _usart_dma_handle
+{
+    USART_Type *base;
+    const uint8_t *txData;     /* Start of the data to send. */
+    size_t txDataSizeAll;      /* Size of the data to send out. */
+    size_t txDataSent;         /* Bytes moved to the line. */
+    uint8_t *rxData;           /* Start of the ring buffer. */
+    size_t rxRingBufferSize;   /* Size of the ring buffer. */
+    uint32_t rxDataReceived;   /* Bytes written to the ring buffer since the start. */
+    uint32_t rxRingBufferRead; /* Bytes read from the ring buffer since the start. */
+    bool txBusy;               /* A send is in progress. */
+};
+
+status_t USART_TransferCreateHandleDMA(USART_Type *base,
+                                       usart_dma_handle_t *handle,
+                                       usart_dma_transfer_callback_t callback,
+                                       void *userData,
+                                       dma_handle_t *txDmaHandle,
+                                       dma_handle_t *rxDmaHandle);
+status_t USART_TransferSendDMA(USART_Type *base, usart_dma_handle_t *handle, usart_transfer_t *xfer);
+status_t USART_TransferStartRingBufferDMA(USART_Type *base,
+                                          usart_dma_handle_t *handle,
+                                          uint8_t *ringBuffer,
+                                          size_t ringBufferSize);
+size_t USART_TransferReadRingBufferDMA(USART_Type *base, usart_dma_handle_t *handle, uint8_t *data, size_t length);
+status_t USART_TransferGetSendCountDMA(USART_Type *base, usart_dma_handle_t *handle, uint32_t *count);
+
+#endif /* _FSL_USART_DMA_H_ */
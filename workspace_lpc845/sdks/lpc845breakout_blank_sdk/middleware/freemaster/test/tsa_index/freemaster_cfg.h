@@ -0,0 +1,33 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * FreeMASTER Communication Driver - User Configuration File of the TSA index host test
+ */
+
+#ifndef __FREEMASTER_CFG_H
+#define __FREEMASTER_CFG_H
+
+#define FMSTR_PLATFORM_CORTEX_M 1 /* generic 32bit little-endian platform, the host is one too */
+#define FMSTR_DISABLE           0
+#define FMSTR_POLL_DRIVEN       1
+
+#define FMSTR_TRANSPORT  FMSTR_SERIAL
+#define FMSTR_SERIAL_DRV FMSTR_SERIAL_NONE
+
+#define FMSTR_COMM_BUFFER_SIZE 0
+
+#define FMSTR_USE_TSA         1
+#define FMSTR_USE_TSA_SAFETY  1
+#define FMSTR_USE_TSA_DYNAMIC 1
+#define FMSTR_USE_TSA_INROM   1
+
+#define FMSTR_USE_READMEM  1
+#define FMSTR_USE_WRITEMEM 1
+#define FMSTR_USE_RECORDER 0
+#define FMSTR_USE_SCOPE    0
+
+/* FMSTR_TSA_INDEX_SIZE is given on the command line, see freemaster_tsa_test.c */
+
+#endif /* __FREEMASTER_CFG_H */
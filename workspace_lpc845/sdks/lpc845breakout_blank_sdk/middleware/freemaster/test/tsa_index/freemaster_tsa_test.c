@@ -0,0 +1,250 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * FreeMASTER Communication Driver - TSA safety check host test
+ */
+
+/*
+ * Build and run from this directory, with the linear scan, an index large enough for the tables, and an index too
+ * small for them:
+ *   gcc -O2 -I. -I../../src/common -I../../src/platforms/gen32le -DFMSTR_TSA_INDEX_SIZE=0 \
+ *       -o tsa_scan freemaster_tsa_test.c && ./tsa_scan
+ *   gcc -O2 -I. -I../../src/common -I../../src/platforms/gen32le -DFMSTR_TSA_INDEX_SIZE=2048 \
+ *       -o tsa_index freemaster_tsa_test.c && ./tsa_index
+ *   gcc -O2 -I. -I../../src/common -I../../src/platforms/gen32le -DFMSTR_TSA_INDEX_SIZE=8 \
+ *       -o tsa_small_index freemaster_tsa_test.c && ./tsa_small_index
+ *
+ * Variables of random sizes, some of them read-only, some overlapping or nested in others, are added to the dynamic
+ * TSA table in random address order. FMSTR_CheckTsaSpace() is compared with a reference model on random read and
+ * write requests, once the index is rebuilt after FMSTR_SetUpTsaBuff() and again after more variables are inserted
+ * into it. The test then measures the checks per second while the host polls 16 variables round robin, and while it
+ * polls a single one. The exit code is 0 on success.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "freemaster_tsa.c"
+#include "freemaster_utils.c"
+
+/******************************************************************************
+ * Local definitions
+ ******************************************************************************/
+
+#define TEST_VAR_MAX     2048U
+#define TEST_VAR_SPACING 24U
+#define TEST_CHECK_NUM   200000U
+#define TEST_WATCH_NUM   16U
+#define TEST_POLL_NUM    2000000U
+
+FMSTR_TSA_TABLE_LIST_BEGIN()
+FMSTR_TSA_TABLE(dynamic_tsa)
+FMSTR_TSA_TABLE_LIST_END()
+
+/******************************************************************************
+ * Local variables
+ ******************************************************************************/
+
+static FMSTR_U8 testMemory[TEST_VAR_MAX * TEST_VAR_SPACING + 64U];
+static FMSTR_TSA_ENTRY testTable[TEST_VAR_MAX];
+static char testNames[TEST_VAR_MAX][12];
+static FMSTR_SIZE testOffset[TEST_VAR_MAX];
+static FMSTR_SIZE testSize[TEST_VAR_MAX];
+static unsigned long testSeed = 1U;
+static int testFailures;
+
+/******************************************************************************
+ * Local functions
+ ******************************************************************************/
+
+static FMSTR_U32 TestRandom(void)
+{
+    testSeed = (testSeed * 1103515245U + 12345U) & 0xFFFFFFFFU;
+    return (FMSTR_U32)(testSeed >> 8);
+}
+
+static double TestNow(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Every fifth variable is read-only */
+static FMSTR_BOOL TestIsWritable(FMSTR_SIZE var)
+{
+    return (var % 5U) != 0U ? FMSTR_TRUE : FMSTR_FALSE;
+}
+
+/* Lays out count variables of 1 to 8 bytes, or up to 60 bytes so that some of them contain others */
+static void TestLayout(FMSTR_SIZE count, FMSTR_BOOL nested)
+{
+    FMSTR_SIZE i, j, tmp;
+
+    for (i = 0U; i < count; i++)
+    {
+        testOffset[i] = i * TEST_VAR_SPACING + TestRandom() % 8U;
+        testSize[i]   = 1U << (TestRandom() % 4U);
+        if (nested != FMSTR_FALSE && TestRandom() % 3U == 0U)
+        {
+            testSize[i] = 1U + TestRandom() % 60U;
+        }
+        if (nested != FMSTR_FALSE && TestRandom() % 4U == 0U)
+        {
+            testOffset[i] /= 2U;
+        }
+    }
+
+    /* the variables are added in random address order */
+    for (i = count - 1U; i > 0U; i--)
+    {
+        j             = TestRandom() % (i + 1U);
+        tmp           = testOffset[i];
+        testOffset[i] = testOffset[j];
+        testOffset[j] = tmp;
+    }
+}
+
+static void TestAddVars(FMSTR_SIZE first, FMSTR_SIZE last)
+{
+    FMSTR_SIZE i;
+
+    for (i = first; i < last; i++)
+    {
+        (void)snprintf(testNames[i], sizeof(testNames[i]), "v%u", (unsigned)i);
+        if (FMSTR_TsaAddVar(testNames[i], FMSTR_TSA_UINT32, &testMemory[testOffset[i]], testSize[i],
+                            TestIsWritable(i) != FMSTR_FALSE ? FMSTR_TSA_INFO_RW_VAR : FMSTR_TSA_INFO_RO_VAR) ==
+            FMSTR_FALSE)
+        {
+            printf("FAIL: variable %u is not added\n", (unsigned)i);
+            testFailures++;
+        }
+    }
+}
+
+static void TestSetUp(FMSTR_SIZE count)
+{
+    (void)FMSTR_InitTsa();
+    (void)FMSTR_SetUpTsaBuff((FMSTR_ADDR)testTable, sizeof(testTable));
+    TestAddVars(0U, count);
+}
+
+/* Compares random checks of the first count variables with the reference, returns the mismatches */
+static FMSTR_SIZE TestCompare(FMSTR_SIZE count)
+{
+    FMSTR_SIZE mismatches = 0U;
+    FMSTR_SIZE k, i;
+
+    for (k = 0U; k < TEST_CHECK_NUM; k++)
+    {
+        FMSTR_SIZE addr     = TestRandom() % (count * TEST_VAR_SPACING + 32U);
+        FMSTR_SIZE size     = 1U + TestRandom() % 8U;
+        FMSTR_BOOL write    = (TestRandom() & 1U) != 0U ? FMSTR_TRUE : FMSTR_FALSE;
+        FMSTR_BOOL expected = FMSTR_FALSE;
+        FMSTR_BOOL granted;
+
+        for (i = 0U; i < count && expected == FMSTR_FALSE; i++)
+        {
+            if (addr >= testOffset[i] && (addr + size) <= (testOffset[i] + testSize[i]) &&
+                (write == FMSTR_FALSE || TestIsWritable(i) != FMSTR_FALSE))
+            {
+                expected = FMSTR_TRUE;
+            }
+        }
+
+        granted = FMSTR_CheckTsaSpace(&testMemory[addr], size, write) != FMSTR_FALSE ? FMSTR_TRUE : FMSTR_FALSE;
+        if (granted != expected)
+        {
+            if (mismatches < 5U)
+            {
+                printf("FAIL: %s of %u bytes at %u is %s\n", write != FMSTR_FALSE ? "write" : "read", (unsigned)size,
+                       (unsigned)addr, granted != FMSTR_FALSE ? "granted" : "denied");
+            }
+            mismatches++;
+        }
+    }
+
+    return mismatches;
+}
+
+static void TestEquivalence(void)
+{
+    static const FMSTR_SIZE counts[] = {5U, 64U, 300U, 1024U};
+    FMSTR_SIZE c, count, mismatches;
+
+    for (c = 0U; c < sizeof(counts) / sizeof(counts[0]); c++)
+    {
+        count = counts[c];
+        TestLayout(count, FMSTR_TRUE);
+
+        /* the first half is indexed when the index is rebuilt, the second half is inserted into it */
+        TestSetUp(count / 2U);
+        mismatches = TestCompare(count / 2U);
+        TestAddVars(count / 2U, count);
+        mismatches += TestCompare(count);
+
+        printf("%4u nested variables: %u checks, %u mismatches\n", (unsigned)count, 2U * TEST_CHECK_NUM,
+               (unsigned)mismatches);
+        if (mismatches != 0U)
+        {
+            testFailures++;
+        }
+    }
+}
+
+static void TestBenchmark(void)
+{
+    static const FMSTR_SIZE counts[] = {16U, 64U, 256U, 1024U};
+    FMSTR_SIZE watch[TEST_WATCH_NUM];
+    FMSTR_SIZE c, k, i, count, granted;
+    double t0, t1, t2;
+
+    printf("variables  round robin checks/s  single variable checks/s\n");
+    for (c = 0U; c < sizeof(counts) / sizeof(counts[0]); c++)
+    {
+        count = counts[c];
+        TestLayout(count, FMSTR_FALSE);
+        TestSetUp(count);
+        for (k = 0U; k < TEST_WATCH_NUM; k++)
+        {
+            watch[k] = TestRandom() % count;
+        }
+
+        granted = 0U;
+        t0      = TestNow();
+        for (k = 0U; k < TEST_POLL_NUM; k++)
+        {
+            i = watch[k % TEST_WATCH_NUM];
+            granted += FMSTR_CheckTsaSpace(&testMemory[testOffset[i]], testSize[i], FMSTR_FALSE) != FMSTR_FALSE;
+        }
+        t1 = TestNow();
+        for (k = 0U; k < TEST_POLL_NUM; k++)
+        {
+            i = watch[0];
+            granted += FMSTR_CheckTsaSpace(&testMemory[testOffset[i]], testSize[i], FMSTR_FALSE) != FMSTR_FALSE;
+        }
+        t2 = TestNow();
+
+        printf("%9u  %18.1f M  %22.1f M\n", (unsigned)count, TEST_POLL_NUM / (t1 - t0) * 1e-6,
+               TEST_POLL_NUM / (t2 - t1) * 1e-6);
+        if (granted != 2U * TEST_POLL_NUM)
+        {
+            printf("FAIL: a watched variable is denied\n");
+            testFailures++;
+        }
+    }
+}
+
+int main(void)
+{
+    printf("FMSTR_TSA_INDEX_SIZE %u\n", (unsigned)FMSTR_TSA_INDEX_SIZE);
+    TestEquivalence();
+    TestBenchmark();
+
+    printf("%s\n", testFailures == 0 ? "PASS" : "FAIL");
+    return testFailures == 0 ? 0 : 1;
+}